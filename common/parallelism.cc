@@ -0,0 +1,23 @@
+#include "drake/common/parallelism.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+
+Parallelism Parallelism::Max() {
+  const int hardware_concurrency =
+      static_cast<int>(std::thread::hardware_concurrency());
+  return Parallelism(std::max(1, hardware_concurrency));
+}
+
+Parallelism::Parallelism(bool parallelize)
+    : num_threads_(parallelize ? Max().num_threads() : 1) {}
+
+Parallelism::Parallelism(int num_threads) : num_threads_(num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+}
+
+}  // namespace drake
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+
+/** Specifies a desired degree of parallelism for a parallelized operation.
+
+This class denotes a specific number of threads; either 1 (no parallelism),
+a user-specified value (any number >= 1), or the maximum number of threads.
+
+For the maximum parallelism, use Parallelism::Max(). The value of "Max" is
+given by `std::thread::hardware_concurrency()`, but never less than one.
+
+In the common case of an API that offers an "on/off" parallelism switch, the
+implicit conversion from `bool` can be used:
+@code
+  // Run in parallel, using the maximum number of threads.
+  DoSomething(..., true);  // i.e., parallelism = Parallelism::Max().
+@endcode
+
+Note that code that uses OpenMP to implement its parallel loops will only run
+in parallel when Drake has been built with OpenMP enabled; otherwise the work
+happens sequentially regardless of the number of threads requested here. */
+class Parallelism {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Parallelism)
+
+  /** Constructs a %Parallelism with no parallelism (i.e., num_threads=1).
+  Python note: This is not bound in pydrake (because it would be confusing);
+  instead, pass `false` to opt-out of parallelism. */
+  Parallelism() = default;
+
+  /** Constructs a %Parallelism with no parallelism (i.e., num_threads=1).
+  This is equivalent to the default constructor. */
+  static Parallelism None() { return Parallelism(); }
+
+  /** Constructs a %Parallelism with the maximum number of threads. */
+  static Parallelism Max();
+
+  /** Constructs a %Parallelism with either no parallelism (i.e., using
+  num_threads=1) or the maximum number of threads (Max()). Setting `parallelize`
+  to `true` is equivalent to calling Max(). This constructor is intentionally
+  implicit so that `bool` arguments may be used to opt-in to parallelism. */
+  // NOLINTNEXTLINE(runtime/explicit)
+  Parallelism(bool parallelize);
+
+  /** Constructs a %Parallelism with the given number of threads.
+  @throws std::exception if num_threads < 1. */
+  explicit Parallelism(int num_threads);
+
+  /** Returns the degree of parallelism. The result will always be >= 1. */
+  int num_threads() const { return num_threads_; }
+
+ private:
+  // Forbid implicit conversion from other types (e.g., double) that might
+  // otherwise silently select one of the overloads above.
+  template <typename T>
+  explicit Parallelism(T) = delete;
+
+  int num_threads_{1};
+};
+
+}  // namespace drake
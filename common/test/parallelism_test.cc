@@ -0,0 +1,49 @@
+#include "drake/common/parallelism.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace {
+
+int GetHardwareConcurrency() {
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+GTEST_TEST(ParallelismTest, DefaultIsNone) {
+  EXPECT_EQ(Parallelism().num_threads(), 1);
+  EXPECT_EQ(Parallelism::None().num_threads(), 1);
+}
+
+GTEST_TEST(ParallelismTest, Max) {
+  EXPECT_EQ(Parallelism::Max().num_threads(), GetHardwareConcurrency());
+}
+
+GTEST_TEST(ParallelismTest, FromBool) {
+  const Parallelism off = false;
+  const Parallelism on = true;
+  EXPECT_EQ(off.num_threads(), 1);
+  EXPECT_EQ(on.num_threads(), GetHardwareConcurrency());
+}
+
+GTEST_TEST(ParallelismTest, FromInt) {
+  EXPECT_EQ(Parallelism(1).num_threads(), 1);
+  EXPECT_EQ(Parallelism(3).num_threads(), 3);
+  DRAKE_EXPECT_THROWS_MESSAGE(Parallelism(0), ".*num_threads >= 1.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(Parallelism(-1), ".*num_threads >= 1.*");
+}
+
+GTEST_TEST(ParallelismTest, Copyable) {
+  const Parallelism original(2);
+  Parallelism copy = original;
+  EXPECT_EQ(copy.num_threads(), 2);
+  copy = Parallelism::None();
+  EXPECT_EQ(copy.num_threads(), 1);
+}
+
+}  // namespace
+}  // namespace drake
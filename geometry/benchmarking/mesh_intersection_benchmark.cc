@@ -7,6 +7,7 @@
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/mesh_intersection.h"
+#include "drake/geometry/proximity/wide_bvh.h"
 #include "drake/math/rigid_transform.h"
 
 namespace drake {
@@ -104,7 +105,15 @@ Resulting contact surface sizes:
  MeshIntersectionBenchmark/TestName/resolution/contact_overlap/rotation_factor/min_time
  ```
 
-   - __TestName__: RigidSoftMesh
+   - __TestName__: One of
+     - RigidSoftMesh: culls with the binary bounding volume hierarchies.
+     - RigidSoftMeshWide: culls with the four-wide hierarchies (see WideBvh),
+       whose children's boxes are tested against a query box all at once
+       with AVX2 instructions where available. The contact surfaces should
+       match those of RigidSoftMesh.
+     - BroadphaseBinary and BroadphaseWide: only the culling of the two
+       variants above, i.e., the traversal that produces the candidate pairs
+       of tetrahedra and triangles, without computing the contact surface.
    - __resolution__: Affects the resolution of the ellipsoid and sphere
      meshes. Valid values must be one of [0, 1, 2, 3], where 0 produces the
      coarsest meshes and 3 produces the finest meshes. This is converted behind
@@ -263,6 +272,67 @@ BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMesh)
     ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
     ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
 
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, RigidSoftMeshWide)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const WideBvh<VolumeMesh<double>> bvh_S(mesh_S_);
+  const WideBvh<TriangleSurfaceMesh<double>> bvh_R(mesh_R_);
+  std::unique_ptr<TriangleSurfaceMesh<double>> surface_SR;
+  std::unique_ptr<TriangleSurfaceMeshFieldLinear<double, double>> e_SR;
+  for (auto _ : state) {
+    SurfaceVolumeIntersector<TriMeshBuilder<double>, Obb> intersector;
+    intersector.SampleVolumeFieldOnSurface(
+        field_S_, mesh_R_, X_SR_, bvh_S.GetCollisionCandidates(bvh_R, X_SR_));
+    surface_SR = intersector.release_mesh();
+    e_SR = intersector.release_field();
+  }
+  RecordContactSurfaceResult(surface_SR.get(), "RigidSoftMeshWide", state);
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMeshWide)
+    ->Unit(benchmark::kMillisecond)
+    ->MinTime(2)
+    ->Args({0, 4, 0})   // 0 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({1, 4, 0})   // 1 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({2, 1, 0})   // 2 resolution, 1 contact overlap, 0 rotation factor.
+    ->Args({2, 3, 1});  // 2 resolution, 3 contact overlap, 1 rotation factor.
+
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, BroadphaseBinary)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const auto bvh_S = Bvh<Obb, VolumeMesh<double>>(mesh_S_);
+  const auto bvh_R = Bvh<Obb, TriangleSurfaceMesh<double>>(mesh_R_);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bvh_S.GetCollisionCandidates(bvh_R, X_SR_));
+  }
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, BroadphaseBinary)
+    ->Unit(benchmark::kMillisecond)
+    ->MinTime(2)
+    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({2, 3, 1});  // 2 resolution, 3 contact overlap, 1 rotation factor.
+
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, BroadphaseWide)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const WideBvh<VolumeMesh<double>> bvh_S(mesh_S_);
+  const WideBvh<TriangleSurfaceMesh<double>> bvh_R(mesh_R_);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bvh_S.GetCollisionCandidates(bvh_R, X_SR_));
+  }
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, BroadphaseWide)
+    ->Unit(benchmark::kMillisecond)
+    ->MinTime(2)
+    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
+    ->Args({2, 3, 1});  // 2 resolution, 3 contact overlap, 1 rotation factor.
+
 void ReportContactSurfaces() {
   std::cout << "Resulting contact surface sizes:" << std::endl;
   for (const auto& output :
@@ -520,6 +520,28 @@ class GeometryState {
         });
   }
 
+  /** @name        Proximity query settings    */
+
+  /** Implementation of SceneGraph::set_proximity_parallelism(). */
+  void set_proximity_parallelism(Parallelism parallelism) {
+    geometry_engine_->set_parallelism(parallelism);
+  }
+
+  /** Implementation of SceneGraph::get_proximity_parallelism(). */
+  Parallelism get_proximity_parallelism() const {
+    return geometry_engine_->parallelism();
+  }
+
+  /** Implementation of SceneGraph::set_hydroelastic_candidate_margin(). */
+  void set_hydroelastic_candidate_margin(double margin) {
+    geometry_engine_->set_hydroelastic_candidate_margin(margin);
+  }
+
+  /** Implementation of SceneGraph::get_hydroelastic_candidate_margin(). */
+  double get_hydroelastic_candidate_margin() const {
+    return geometry_engine_->hydroelastic_candidate_margin();
+  }
+
   //---------------------------------------------------------------------------
   /** @name                Signed Distance Queries
    See @ref signed_distance_query "Signed Distance Queries" for more details.
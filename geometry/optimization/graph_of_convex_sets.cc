@@ -4,8 +4,12 @@
 
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +35,7 @@ using Eigen::RowVector2d;
 using Eigen::RowVectorXd;
 using Eigen::VectorXd;
 using solvers::Binding;
+using solvers::BoundingBoxConstraint;
 using solvers::Constraint;
 using solvers::Cost;
 using solvers::L1NormCost;
@@ -52,17 +57,18 @@ using symbolic::Variable;
 using symbolic::Variables;
 
 namespace {
-MathematicalProgramResult Solve(const MathematicalProgram& prog,
-                                const GraphOfConvexSetsOptions& options,
-                                bool rounding) {
+MathematicalProgramResult Solve(
+    const MathematicalProgram& prog, const GraphOfConvexSetsOptions& options,
+    bool rounding,
+    const std::optional<Eigen::VectorXd>& initial_guess = std::nullopt) {
   MathematicalProgramResult result;
   auto solver_options = (rounding && options.rounding_solver_options)
                             ? options.rounding_solver_options
                             : options.solver_options;
   if (options.solver) {
-    options.solver->Solve(prog, {}, solver_options, &result);
+    options.solver->Solve(prog, initial_guess, solver_options, &result);
   } else {
-    result = solvers::Solve(prog, {}, solver_options);
+    result = solvers::Solve(prog, initial_guess, solver_options);
   }
   return result;
 }
@@ -484,10 +490,11 @@ std::set<EdgeId> GraphOfConvexSets::PreprocessShortestPath(
   return unusable_edges;
 }
 
-void GraphOfConvexSets::AddPerspectiveCost(
+std::vector<Binding<Constraint>> GraphOfConvexSets::AddPerspectiveCost(
     MathematicalProgram* prog, const Binding<Cost>& binding,
-    const VectorXDecisionVariable& vars) const {
+    const VectorXDecisionVariable& vars, VectorXDecisionVariable* slack) const {
   const double inf = std::numeric_limits<double>::infinity();
+  std::vector<Binding<Constraint>> constraints;
 
   // TODO(russt): Avoid this use of RTTI, which mirrors the current
   // pattern in MathematicalProgram::AddCost.
@@ -504,7 +511,7 @@ void GraphOfConvexSets::AddPerspectiveCost(
     a(0) = lc->b();
     a(1) = -1.0;
     a.tail(lc->a().size()) = lc->a();
-    prog->AddLinearConstraint(a, -inf, 0.0, vars);
+    constraints.push_back(prog->AddLinearConstraint(a, -inf, 0.0, vars));
   } else if (QuadraticCost* qc = dynamic_cast<QuadraticCost*>(cost)) {
     // .5 x'Qx + b'x + c is restated as a rotated Lorentz cone constraint
     // enforcing that ℓ should be lower-bounded by the perspective, with
@@ -535,13 +542,21 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_cone(1, 0) = -qc->c();
     // z₂ ... z_{n+1} = R x.
     A_cone.block(2, 2, R.rows(), R.cols()) = R;
-    prog->AddRotatedLorentzConeConstraint(A_cone, VectorXd::Zero(A_cone.rows()),
-                                          vars);
+    constraints.push_back(prog->AddRotatedLorentzConeConstraint(
+        A_cone, VectorXd::Zero(A_cone.rows()), vars));
   } else if (L1NormCost* l1c = dynamic_cast<L1NormCost*>(cost)) {
     // |Ax + b|₁ becomes ℓ ≥ Σᵢ δᵢ and δᵢ ≥ |Aᵢx+bᵢϕ|.
     int A_rows = l1c->A().rows();
     int A_cols = l1c->A().cols();
-    auto l1c_slack = prog->NewContinuousVariables(A_rows, "l1c_slack");
+    VectorXDecisionVariable l1c_slack;
+    if (slack != nullptr && slack->size() == A_rows) {
+      l1c_slack = *slack;
+    } else {
+      l1c_slack = prog->NewContinuousVariables(A_rows, "l1c_slack");
+      if (slack != nullptr) {
+        *slack = l1c_slack;
+      }
+    }
     VectorXDecisionVariable cost_vars(vars.size() + l1c_slack.size());
     cost_vars << vars, l1c_slack;
     MatrixXd A_linear = MatrixXd::Zero(2 * A_rows + 1, cost_vars.size());
@@ -562,16 +577,17 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_linear(2 * A_rows, 1) = -1;
     A_linear.block(2 * A_rows, A_cols + 2, 1, l1c_slack.size()) =
         RowVectorXd::Ones(l1c_slack.size());
-    prog->AddLinearConstraint(A_linear,
-                              VectorXd::Constant(A_linear.rows(), -inf),
-                              VectorXd::Zero(A_linear.rows()), cost_vars);
+    constraints.push_back(prog->AddLinearConstraint(
+        A_linear, VectorXd::Constant(A_linear.rows(), -inf),
+        VectorXd::Zero(A_linear.rows()), cost_vars));
   } else if (L2NormCost* l2c = dynamic_cast<L2NormCost*>(cost)) {
     // |Ax + b|₂ becomes ℓ ≥ |Ax+bϕ|₂.
     MatrixXd A_cone = MatrixXd::Zero(l2c->A().rows() + 1, vars.size());
     A_cone(0, 1) = 1.0;                                 // z₀ = ℓ.
     A_cone.block(1, 0, l2c->A().rows(), 1) = l2c->b();  // bϕ.
     A_cone.block(1, 2, l2c->A().rows(), l2c->A().cols()) = l2c->A();  // Ax.
-    prog->AddLorentzConeConstraint(A_cone, VectorXd::Zero(A_cone.rows()), vars);
+    constraints.push_back(prog->AddLorentzConeConstraint(
+        A_cone, VectorXd::Zero(A_cone.rows()), vars));
   } else if (LInfNormCost* linfc = dynamic_cast<LInfNormCost*>(cost)) {
     // |Ax + b|∞ becomes ℓ ≥ |Aᵢx+bᵢϕ| ∀ i.
     int A_rows = linfc->A().rows();
@@ -582,9 +598,9 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_linear.block(A_rows, 0, A_rows, 1) = -linfc->b();              // -bϕ.
     A_linear.block(A_rows, 1, A_rows, 1) = -VectorXd::Ones(A_rows);  // -ℓ.
     A_linear.block(A_rows, 2, A_rows, linfc->A().cols()) = -linfc->A();  // -Ax.
-    prog->AddLinearConstraint(A_linear,
-                              VectorXd::Constant(A_linear.rows(), -inf),
-                              VectorXd::Zero(A_linear.rows()), vars);
+    constraints.push_back(prog->AddLinearConstraint(
+        A_linear, VectorXd::Constant(A_linear.rows(), -inf),
+        VectorXd::Zero(A_linear.rows()), vars));
   } else if (PerspectiveQuadraticCost* pqc =
                  dynamic_cast<PerspectiveQuadraticCost*>(cost)) {
     // (z_1^2 + ... + z_{n-1}^2) / z_0 for z = Ax + b becomes
@@ -593,19 +609,21 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_cone(0, 1) = 1.0;
     A_cone.block(1, 0, pqc->A().rows(), 1) = pqc->b();
     A_cone.block(1, 2, pqc->A().rows(), pqc->A().cols()) = pqc->A();
-    prog->AddRotatedLorentzConeConstraint(
-        A_cone, VectorXd::Zero(pqc->A().rows() + 1), vars);
+    constraints.push_back(prog->AddRotatedLorentzConeConstraint(
+        A_cone, VectorXd::Zero(pqc->A().rows() + 1), vars));
   } else {
     throw std::runtime_error(fmt::format(
         "GraphOfConvexSets::Edge does not support this binding type: {}",
         binding.to_string()));
   }
+  return constraints;
 }
 
-void GraphOfConvexSets::AddPerspectiveConstraint(
+std::vector<Binding<Constraint>> GraphOfConvexSets::AddPerspectiveConstraint(
     MathematicalProgram* prog, const Binding<Constraint>& binding,
     const VectorXDecisionVariable& vars) const {
   const double inf = std::numeric_limits<double>::infinity();
+  std::vector<Binding<Constraint>> constraints;
 
   Constraint* constraint = binding.evaluator().get();
   if (LinearEqualityConstraint* lec =
@@ -616,7 +634,8 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
     MatrixXd Aeq(A.rows(), A.cols() + 1);
     Aeq.col(0) = -lec->lower_bound();
     Aeq.rightCols(A.cols()) = A;
-    prog->AddLinearEqualityConstraint(Aeq, VectorXd::Zero(A.rows()), vars);
+    constraints.push_back(
+        prog->AddLinearEqualityConstraint(Aeq, VectorXd::Zero(A.rows()), vars));
     // Note that LinearEqualityConstraint must come before LinearConstraint,
     // because LinearEqualityConstraint isa LinearConstraint.
   } else if (LinearConstraint* lc =
@@ -631,12 +650,12 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
       if (std::isfinite(lc->upper_bound()[i])) {
         a[0] = -lc->upper_bound()[i];
         a.tail(A.cols()) = A.row(i);
-        prog->AddLinearConstraint(a, -inf, 0, vars);
+        constraints.push_back(prog->AddLinearConstraint(a, -inf, 0, vars));
       }
       if (std::isfinite(lc->lower_bound()[i])) {
         a[0] = -lc->lower_bound()[i];
         a.tail(A.cols()) = A.row(i);
-        prog->AddLinearConstraint(a, 0, inf, vars);
+        constraints.push_back(prog->AddLinearConstraint(a, 0, inf, vars));
       }
     }
   } else {
@@ -645,6 +664,219 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
                     "binding type: {}",
                     binding.to_string()));
   }
+  return constraints;
+}
+
+MathematicalProgramResult GraphOfConvexSets::RoundShortestPath(
+    MathematicalProgram* prog, VertexId source_id, VertexId target_id,
+    const std::map<VertexId, std::vector<Edge*>>& outgoing_edges,
+    const std::map<EdgeId, Variable>& relaxed_phi,
+    const std::set<EdgeId>& unusable_edges,
+    const GraphOfConvexSetsOptions& options,
+    MathematicalProgramResult result) const {
+  DRAKE_THROW_UNLESS(options.max_rounding_trials > 0);
+  RandomGenerator generator(options.rounding_seed);
+  std::uniform_real_distribution<double> uniform;
+  std::vector<std::vector<const Edge*>> paths;
+  std::map<EdgeId, double> flows;
+  for (const auto& [edge_id, e] : edges_) {
+    if (!e->phi_value_.value_or(true) || unusable_edges.count(edge_id)) {
+      flows.emplace(edge_id, 0);
+    } else {
+      flows.emplace(edge_id, result.GetSolution(relaxed_phi.at(edge_id)));
+    }
+  }
+  int num_trials = 0;
+  MathematicalProgramResult best_rounded_result;
+  while (static_cast<int>(paths.size()) < options.max_rounded_paths &&
+         num_trials < options.max_rounding_trials) {
+    ++num_trials;
+
+    // Find candidate path by traversing the graph with a depth first search
+    // where edges are taken with prbability proportional to their flow.
+    std::vector<VertexId> visited_vertex_ids{source_id};
+    std::vector<VertexId> path_vertex_ids{source_id};
+    std::vector<const Edge*> new_path;
+    while (path_vertex_ids.back() != target_id) {
+      std::vector<const Edge*> candidate_edges;
+      const auto outgoing = outgoing_edges.find(path_vertex_ids.back());
+      if (outgoing != outgoing_edges.end()) {
+        for (const Edge* e : outgoing->second) {
+          if (std::find(visited_vertex_ids.begin(), visited_vertex_ids.end(),
+                        e->v().id()) == visited_vertex_ids.end() &&
+              flows.at(e->id()) > options.flow_tolerance) {
+            candidate_edges.emplace_back(e);
+          }
+        }
+      }
+      // If the depth first search finds itself at a node with no candidate
+      // outbound edges, backtrack to the previous node and continue the
+      // search.
+      if (candidate_edges.size() == 0) {
+        path_vertex_ids.pop_back();
+        new_path.pop_back();
+        continue;
+      }
+      Eigen::VectorXd candidate_flows(candidate_edges.size());
+      for (size_t ii = 0; ii < candidate_edges.size(); ++ii) {
+        candidate_flows(ii) = flows.at(candidate_edges[ii]->id());
+      }
+      double edge_sample = uniform(generator) * candidate_flows.sum();
+      for (size_t ii = 0; ii < candidate_edges.size(); ++ii) {
+        if (edge_sample >= candidate_flows(ii)) {
+          edge_sample -= candidate_flows(ii);
+        } else {
+          visited_vertex_ids.push_back(candidate_edges[ii]->v().id());
+          path_vertex_ids.push_back(candidate_edges[ii]->v().id());
+          new_path.emplace_back(candidate_edges[ii]);
+          break;
+        }
+      }
+    }
+
+    if (std::find(paths.begin(), paths.end(), new_path) != paths.end()) {
+      continue;
+    }
+    paths.push_back(new_path);
+
+    // Optimize path
+    std::vector<Binding<Constraint>> added_constraints;
+    for (const auto& [edge_id, e] : edges_) {
+      if (e->phi_value_.has_value() || unusable_edges.count(edge_id)) {
+        continue;
+      }
+      if (std::find(new_path.begin(), new_path.end(), e.get()) !=
+          new_path.end()) {
+        added_constraints.push_back(
+            prog->AddBoundingBoxConstraint(1, 1, relaxed_phi.at(edge_id)));
+      } else {
+        added_constraints.push_back(
+            prog->AddBoundingBoxConstraint(0, 0, relaxed_phi.at(edge_id)));
+        added_constraints.push_back(prog->AddLinearEqualityConstraint(
+            e->y_.cast<Expression>(), VectorXd::Zero(e->y_.size())));
+        added_constraints.push_back(prog->AddLinearEqualityConstraint(
+            e->z_.cast<Expression>(), VectorXd::Zero(e->z_.size())));
+        added_constraints.push_back(prog->AddLinearEqualityConstraint(
+            e->ell_.cast<Expression>(), VectorXd::Zero(e->ell_.size())));
+      }
+    }
+
+    MathematicalProgramResult rounded_result = Solve(*prog, options, true);
+
+    // Check path quality.
+    if (rounded_result.is_success() &&
+        (!best_rounded_result.is_success() ||
+         rounded_result.get_optimal_cost() <
+             best_rounded_result.get_optimal_cost())) {
+      best_rounded_result = rounded_result;
+    }
+
+    for (Binding<Constraint>& con : added_constraints) {
+      prog->RemoveConstraint(con);
+    }
+  }
+  if (best_rounded_result.is_success()) {
+    result = best_rounded_result;
+  } else {
+    result.set_solution_result(SolutionResult::kIterationLimit);
+  }
+  return result;
+}
+
+void GraphOfConvexSets::SetPlaceholderSolution(
+    const MathematicalProgram& prog, VertexId target_id,
+    const std::map<VertexId, std::vector<Edge*>>& incoming_edges,
+    const std::map<VertexId, std::vector<Edge*>>& outgoing_edges,
+    const std::map<VertexId, MatrixXDecisionVariable>& vertex_edge_ell,
+    const std::map<EdgeId, Variable>& relaxed_phi,
+    const std::vector<Edge*>& excluded_edges,
+    const std::vector<Variable>& excluded_phi,
+    const GraphOfConvexSetsOptions& options,
+    MathematicalProgramResult* result) const {
+  int num_placeholder_vars = relaxed_phi.size();
+  for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
+       vertices_) {
+    num_placeholder_vars += vpair.second->ambient_dimension();
+    num_placeholder_vars += vpair.second->ell_.size();
+  }
+  for (const Edge* e : excluded_edges) {
+    num_placeholder_vars += e->y_.size() + e->z_.size() + e->ell_.size() + 1;
+  }
+  num_placeholder_vars += excluded_phi.size();
+  std::unordered_map<symbolic::Variable::Id, int> decision_variable_index =
+      prog.decision_variable_index();
+  int count = result->get_x_val().size();
+  Eigen::VectorXd x_val(count + num_placeholder_vars);
+  x_val.head(count) = result->get_x_val();
+  for (const Edge* e : excluded_edges) {
+    for (int i = 0; i < e->y_.size(); ++i) {
+      decision_variable_index.emplace(e->y_[i].get_id(), count);
+      x_val[count++] = 0;
+    }
+    for (int i = 0; i < e->z_.size(); ++i) {
+      decision_variable_index.emplace(e->z_[i].get_id(), count);
+      x_val[count++] = 0;
+    }
+    for (int i = 0; i < e->ell_.size(); ++i) {
+      decision_variable_index.emplace(e->ell_[i].get_id(), count);
+      x_val[count++] = 0;
+    }
+    decision_variable_index.emplace(e->phi_.get_id(), count);
+    x_val[count++] = 0;
+  }
+  for (const Variable& phi : excluded_phi) {
+    decision_variable_index.emplace(phi.get_id(), count);
+    x_val[count++] = 0;
+  }
+  for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
+       vertices_) {
+    const Vertex* v = vpair.second.get();
+    const bool is_target = (target_id == v->id());
+    VectorXd x_v = VectorXd::Zero(v->ambient_dimension());
+    double sum_phi = 0;
+    if (is_target) {
+      sum_phi = 1.0;
+      if (incoming_edges.count(v->id()) > 0) {
+        for (const auto& e : incoming_edges.at(v->id())) {
+          x_v += result->GetSolution(e->z_);
+        }
+      }
+    } else if (outgoing_edges.count(v->id()) > 0) {
+      for (const auto& e : outgoing_edges.at(v->id())) {
+        x_v += result->GetSolution(e->y_);
+        sum_phi += result->GetSolution(
+            options.convex_relaxation ? relaxed_phi.at(e->id()) : e->phi_);
+      }
+    }
+    // In the convex relaxation, sum_relaxed_phi may not be one even for
+    // vertices in the shortest path. We undo yₑ = ϕₑ xᵤ here to ensure that
+    // xᵤ is in v->set(). If ∑ ϕₑ is small enough that numerical errors
+    // prevent the projection back into the Xᵤ, then we prefer to return NaN.
+    if (sum_phi < 100.0 * std::numeric_limits<double>::epsilon()) {
+      x_v = VectorXd::Constant(v->ambient_dimension(),
+                               std::numeric_limits<double>::quiet_NaN());
+    } else if (options.convex_relaxation) {
+      x_v /= sum_phi;
+    }
+    for (int i = 0; i < v->ambient_dimension(); ++i) {
+      decision_variable_index.emplace(v->x()[i].get_id(), count);
+      x_val[count++] = x_v[i];
+    }
+    for (int ii = 0; ii < v->ell_.size(); ++ii) {
+      decision_variable_index.emplace(v->ell_[ii].get_id(), count);
+      x_val[count++] =
+          result->GetSolution(vertex_edge_ell.at(v->id()).col(ii)).sum();
+    }
+  }
+  if (options.convex_relaxation) {
+    // Write the value of the relaxed phi into the phi placeholder.
+    for (const auto& [edge_id, relaxed_phi_var] : relaxed_phi) {
+      decision_variable_index.emplace(edges_.at(edge_id)->phi_.get_id(), count);
+      x_val[count++] = result->GetSolution(relaxed_phi_var);
+    }
+  }
+  result->set_decision_variable_index(decision_variable_index);
+  result->set_x_val(x_val);
 }
 
 MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
@@ -905,209 +1137,519 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
 
   MathematicalProgramResult result = Solve(prog, options, false);
 
-  // Implements the rounding scheme put forth in Section 4.2 of
-  // "Motion Planning around Obstacles with Convex Optimization":
-  // https://arxiv.org/abs/2205.04422
   if (options.convex_relaxation && options.max_rounded_paths > 0 &&
       result.is_success()) {
-    DRAKE_THROW_UNLESS(options.max_rounding_trials > 0);
-    RandomGenerator generator(options.rounding_seed);
-    std::uniform_real_distribution<double> uniform;
-    std::vector<std::vector<const Edge*>> paths;
-    std::map<EdgeId, double> flows;
-    for (const auto& [edge_id, e] : edges_) {
-      if (!e->phi_value_.value_or(true) || unusable_edges.count(edge_id)) {
-        flows.emplace(edge_id, 0);
+    result = RoundShortestPath(&prog, source_id, target_id, outgoing_edges,
+                               relaxed_phi, unusable_edges, options,
+                               std::move(result));
+  }
+
+  SetPlaceholderSolution(prog, target_id, incoming_edges, outgoing_edges,
+                         vertex_edge_ell, relaxed_phi, excluded_edges,
+                         excluded_phi, options, &result);
+  return result;
+}
+
+MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
+    const Vertex& source, const Vertex& target,
+    const GraphOfConvexSetsOptions& options) const {
+  return SolveShortestPath(source.id(), target.id(), options);
+}
+
+namespace {
+
+// Bindings that are added to and removed from a program together.
+struct BindingGroup {
+  void SetActive(MathematicalProgram* prog, bool value) {
+    if (value == active) {
+      return;
+    }
+    for (const Binding<Cost>& b : costs) {
+      if (value) {
+        prog->AddCost(b);
       } else {
-        flows.emplace(edge_id, result.GetSolution(relaxed_phi[edge_id]));
+        prog->RemoveCost(b);
       }
     }
-    int num_trials = 0;
-    MathematicalProgramResult best_rounded_result;
-    while (static_cast<int>(paths.size()) < options.max_rounded_paths &&
-           num_trials < options.max_rounding_trials) {
-      ++num_trials;
-
-      // Find candidate path by traversing the graph with a depth first search
-      // where edges are taken with prbability proportional to their flow.
-      std::vector<VertexId> visited_vertex_ids{source_id};
-      std::vector<VertexId> path_vertex_ids{source_id};
-      std::vector<const Edge*> new_path;
-      while (path_vertex_ids.back() != target_id) {
-        std::vector<const Edge*> candidate_edges;
-        for (const Edge* e : outgoing_edges[path_vertex_ids.back()]) {
-          if (std::find(visited_vertex_ids.begin(), visited_vertex_ids.end(),
-                        e->v().id()) == visited_vertex_ids.end() &&
-              flows[e->id()] > options.flow_tolerance) {
-            candidate_edges.emplace_back(e);
-          }
-        }
-        // If the depth first search finds itself at a node with no candidate
-        // outbound edges, backtrack to the previous node and continue the
-        // search.
-        if (candidate_edges.size() == 0) {
-          path_vertex_ids.pop_back();
-          new_path.pop_back();
-          continue;
-        }
-        Eigen::VectorXd candidate_flows(candidate_edges.size());
-        for (size_t ii = 0; ii < candidate_edges.size(); ++ii) {
-          candidate_flows(ii) = flows[candidate_edges[ii]->id()];
-        }
-        double edge_sample = uniform(generator) * candidate_flows.sum();
-        for (size_t ii = 0; ii < candidate_edges.size(); ++ii) {
-          if (edge_sample >= candidate_flows(ii)) {
-            edge_sample -= candidate_flows(ii);
-          } else {
-            visited_vertex_ids.push_back(candidate_edges[ii]->v().id());
-            path_vertex_ids.push_back(candidate_edges[ii]->v().id());
-            new_path.emplace_back(candidate_edges[ii]);
-            break;
-          }
-        }
+    for (const Binding<Constraint>& b : constraints) {
+      if (value) {
+        prog->AddConstraint(b);
+      } else {
+        prog->RemoveConstraint(b);
       }
+    }
+    active = value;
+  }
 
-      if (std::find(paths.begin(), paths.end(), new_path) != paths.end()) {
-        continue;
+  std::vector<Binding<Cost>> costs;
+  std::vector<Binding<Constraint>> constraints;
+  bool active{true};
+};
+
+void Append(std::vector<Binding<Constraint>>&& from,
+            std::vector<Binding<Constraint>>* to) {
+  to->insert(to->end(), from.begin(), from.end());
+}
+
+}  // namespace
+
+// The program of a PreparedShortestPath, along with the bindings of the parts
+// of it that depend on the query.
+struct GraphOfConvexSets::PreparedShortestPath::Data {
+  struct EdgeData {
+    Variable phi;
+    // Keeps ϕ in [0, 1], or fixes it per the phi constraints and preprocessing.
+    std::optional<Binding<BoundingBoxConstraint>> phi_bounds;
+    // Fixes y and z to zero when the edge is excluded, like SolveShortestPath()
+    // does for the edges that it leaves out of its program.
+    std::optional<Binding<BoundingBoxConstraint>> yz_bounds;
+    // The ℓ cost and the perspective edge costs.
+    BindingGroup costs;
+    // The slack variables of each perspective edge cost (if any), which are
+    // reused when the costs are rebuilt.
+    std::vector<VectorXDecisionVariable> cost_slacks;
+    // Whether SolveShortestPath() would leave the edge out of its program for
+    // the current query (per its phi constraint or preprocessing).
+    bool excluded{false};
+  };
+
+  // The two-cycle constraints of a pair of an outgoing edge and its reverse.
+  struct TwoCycle {
+    const Edge* e_out{};
+    const Edge* e_in{};
+    BindingGroup constraints;
+  };
+
+  struct VertexData {
+    int num_costs{};
+    // Conservation of flow, whose right-hand side is δ(is_source) -
+    // δ(is_target).
+    std::optional<Binding<LinearEqualityConstraint>> flow;
+    // Degree constraint, whose upper bound is 1 - δ(is_target).
+    std::optional<Binding<LinearConstraint>> degree;
+    // Spatial conservation of flow; only active when the vertex is neither the
+    // source nor the target.
+    BindingGroup spatial_flow;
+    // The two-cycle constraints for each pair of an outgoing edge and its
+    // reverse; only active when neither the vertex nor the head of the
+    // outgoing edge is the source or the target, and neither edge is
+    // excluded.
+    std::vector<TwoCycle> two_cycles;
+    // The vertex costs and constraints on the outgoing edges ([0]), or on the
+    // incoming edges when the vertex is the target ([1]), along with their ℓ
+    // slack variables. Each one is built the first time that it is needed.
+    std::array<std::optional<BindingGroup>, 2> costs;
+    std::array<MatrixXDecisionVariable, 2> edge_ell;
+  };
+
+  MathematicalProgram prog;
+  std::map<EdgeId, EdgeData> edges;
+  std::map<VertexId, VertexData> vertices;
+  // Every edge is in the program, even when it is turned off.
+  std::map<VertexId, std::vector<Edge*>> incoming_edges;
+  std::map<VertexId, std::vector<Edge*>> outgoing_edges;
+  std::map<EdgeId, Variable> relaxed_phi;
+  std::optional<VertexId> source_id;
+  std::optional<VertexId> target_id;
+  // The solution of the last successful solve (before rounding), which is the
+  // initial guess for the next one.
+  VectorXd initial_guess;
+};
+
+GraphOfConvexSets::PreparedShortestPath::PreparedShortestPath(
+    const GraphOfConvexSets* graph, const GraphOfConvexSetsOptions& options)
+    : graph_(*graph), options_(options), data_(std::make_unique<Data>()) {
+  const double inf = std::numeric_limits<double>::infinity();
+  Data& data = *data_;
+  MathematicalProgram* prog = &data.prog;
+
+  for (const auto& [vertex_id, v] : graph_.vertices_) {
+    data.incoming_edges[vertex_id];
+    data.outgoing_edges[vertex_id];
+  }
+
+  for (const auto& [edge_id, e] : graph_.edges_) {
+    data.outgoing_edges.at(e->u().id()).emplace_back(e.get());
+    data.incoming_edges.at(e->v().id()).emplace_back(e.get());
+
+    Data::EdgeData& edge = data.edges[edge_id];
+    if (options_.convex_relaxation) {
+      edge.phi = prog->NewContinuousVariables<1>("phi")[0];
+      data.relaxed_phi.emplace(edge_id, edge.phi);
+    } else {
+      edge.phi = e->phi_;
+      prog->AddDecisionVariables(Vector1<Variable>(edge.phi));
+    }
+    edge.phi_bounds = prog->AddBoundingBoxConstraint(0, 1, edge.phi);
+    prog->AddDecisionVariables(e->y_);
+    prog->AddDecisionVariables(e->z_);
+    if (e->y_.size() + e->z_.size() > 0) {
+      VectorXDecisionVariable yz(e->y_.size() + e->z_.size());
+      yz << e->y_, e->z_;
+      edge.yz_bounds = prog->AddBoundingBoxConstraint(-inf, inf, yz);
+    }
+
+    // Spatial non-negativity: y ∈ ϕX, z ∈ ϕX.
+    if (e->u().ambient_dimension() > 0) {
+      e->u().set().AddPointInNonnegativeScalingConstraints(prog, e->y_,
+                                                           edge.phi);
+    }
+    if (e->v().ambient_dimension() > 0) {
+      e->v().set().AddPointInNonnegativeScalingConstraints(prog, e->z_,
+                                                           edge.phi);
+    }
+
+    AddEdgeCosts(*e);
+
+    // Edge constraints.
+    for (const Binding<Constraint>& b : e->constraints_) {
+      const VectorXDecisionVariable& old_vars = b.variables();
+      VectorXDecisionVariable vars(old_vars.size() + 1);
+      // vars = [phi; yz_vars]
+      vars[0] = edge.phi;
+      for (int j = 0; j < old_vars.size(); ++j) {
+        vars[j + 1] = e->x_to_yz_.at(old_vars[j]);
+      }
+      graph_.AddPerspectiveConstraint(prog, b, vars);
+    }
+  }
+
+  for (const auto& [vertex_id, v] : graph_.vertices_) {
+    Data::VertexData& vertex = data.vertices[vertex_id];
+    vertex.num_costs = v->ell_.size();
+    const std::vector<Edge*>& incoming = data.incoming_edges.at(vertex_id);
+    const std::vector<Edge*>& outgoing = data.outgoing_edges.at(vertex_id);
+
+    if (incoming.size() + outgoing.size() > 0) {  // in degree + out degree
+      VectorXDecisionVariable vars(incoming.size() + outgoing.size());
+      RowVectorXd a(incoming.size() + outgoing.size());
+      a << RowVectorXd::Constant(incoming.size(), -1.0),
+          RowVectorXd::Ones(outgoing.size());
+
+      // Conservation of flow: ∑ ϕ_out - ∑ ϕ_in = δ(is_source) - δ(is_target).
+      int count = 0;
+      for (const Edge* e : incoming) {
+        vars[count++] = data.edges.at(e->id()).phi;
       }
-      paths.push_back(new_path);
+      for (const Edge* e : outgoing) {
+        vars[count++] = data.edges.at(e->id()).phi;
+      }
+      vertex.flow = prog->AddLinearEqualityConstraint(a, 0.0, vars);
 
-      // Optimize path
-      std::vector<Binding<Constraint>> added_constraints;
-      for (const auto& [edge_id, e] : edges_) {
-        if (e->phi_value_.has_value() || unusable_edges.count(edge_id)) {
-          continue;
+      // Spatial conservation of flow: ∑ z_in = ∑ y_out.
+      for (int i = 0; i < v->ambient_dimension(); ++i) {
+        count = 0;
+        for (const Edge* e : incoming) {
+          vars[count++] = e->z_[i];
         }
-        if (std::find(new_path.begin(), new_path.end(), e.get()) !=
-            new_path.end()) {
-          added_constraints.push_back(
-              prog.AddBoundingBoxConstraint(1, 1, relaxed_phi.at(edge_id)));
-        } else {
-          added_constraints.push_back(
-              prog.AddBoundingBoxConstraint(0, 0, relaxed_phi.at(edge_id)));
-          added_constraints.push_back(prog.AddLinearEqualityConstraint(
-              e->y_.cast<Expression>(), VectorXd::Zero(e->y_.size())));
-          added_constraints.push_back(prog.AddLinearEqualityConstraint(
-              e->z_.cast<Expression>(), VectorXd::Zero(e->z_.size())));
-          added_constraints.push_back(prog.AddLinearEqualityConstraint(
-              e->ell_.cast<Expression>(), VectorXd::Zero(e->ell_.size())));
+        for (const Edge* e : outgoing) {
+          vars[count++] = e->y_[i];
         }
+        vertex.spatial_flow.constraints.push_back(
+            prog->AddLinearEqualityConstraint(a, 0, vars));
       }
+    }
 
-      MathematicalProgramResult rounded_result = Solve(prog, options, true);
-
-      // Check path quality.
-      if (rounded_result.is_success() &&
-          (!best_rounded_result.is_success() ||
-           rounded_result.get_optimal_cost() <
-               best_rounded_result.get_optimal_cost())) {
-        best_rounded_result = rounded_result;
+    if (outgoing.size() > 0) {
+      int n_v = v->ambient_dimension();
+      VectorXDecisionVariable phi_out(outgoing.size());
+      VectorXDecisionVariable yz_out(outgoing.size() * n_v);
+      for (int i = 0; i < static_cast<int>(outgoing.size()); ++i) {
+        phi_out[i] = data.edges.at(outgoing[i]->id()).phi;
+        yz_out.segment(i * n_v, n_v) = outgoing[i]->y_;
       }
+      // Degree constraint: ∑ ϕ_out <= 1- δ(is_target).
+      vertex.degree = prog->AddLinearConstraint(
+          RowVectorXd::Ones(outgoing.size()), 0.0, 1.0, phi_out);
 
-      for (Binding<Constraint>& con : added_constraints) {
-        prog.RemoveConstraint(con);
+      RowVectorXd a = RowVectorXd::Ones(outgoing.size());
+      MatrixXd A_yz(n_v, outgoing.size() * n_v);
+      for (int i = 0; i < static_cast<int>(outgoing.size()); ++i) {
+        A_yz.block(0, i * n_v, n_v, n_v) = MatrixXd::Identity(n_v, n_v);
+      }
+      for (int i = 0; i < static_cast<int>(outgoing.size()); ++i) {
+        const Edge* e_out = outgoing[i];
+        for (const Edge* e_in : incoming) {
+          if (e_in->u().id() == e_out->v().id()) {
+            BindingGroup two_cycle;
+            a[i] = -1.0;
+            phi_out[i] = data.edges.at(e_in->id()).phi;
+            // Two-cycle constraint: ∑ ϕ_u,out - ϕ_uv - ϕ_vu >= 0
+            two_cycle.constraints.push_back(
+                prog->AddLinearConstraint(a, 0.0, 1.0, phi_out));
+            if (n_v > 0) {
+              A_yz.block(0, i * n_v, n_v, n_v) = -MatrixXd::Identity(n_v, n_v);
+              yz_out.segment(i * n_v, n_v) = e_in->z_;
+              // Two-cycle spatial constraint:
+              // ∑ y_u - y_uv - z_vu ∈ (∑ ϕ_u,out - ϕ_uv - ϕ_vu) X_u
+              Append(v->set().AddPointInNonnegativeScalingConstraints(
+                         prog, A_yz, VectorXd::Zero(n_v), a, 0, yz_out,
+                         phi_out),
+                     &two_cycle.constraints);
+              A_yz.block(0, i * n_v, n_v, n_v) = MatrixXd::Identity(n_v, n_v);
+              yz_out.segment(i * n_v, n_v) = e_out->y_;
+            }
+            a[i] = 1.0;
+            phi_out[i] = data.edges.at(e_out->id()).phi;
+            vertex.two_cycles.push_back({e_out, e_in, std::move(two_cycle)});
+          }
+        }
       }
     }
-    if (best_rounded_result.is_success()) {
-      result = best_rounded_result;
-    } else {
-      result.set_solution_result(SolutionResult::kIterationLimit);
-    }
+
+    UpdateVertex(*v);
   }
+}
 
-  // Push the placeholder variables and excluded edge variables into the result,
-  // so that they can be accessed as if they were variables included in the
-  // optimization.
-  int num_placeholder_vars = relaxed_phi.size();
-  for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
-       vertices_) {
-    num_placeholder_vars += vpair.second->ambient_dimension();
-    num_placeholder_vars += vpair.second->ell_.size();
+GraphOfConvexSets::PreparedShortestPath::~PreparedShortestPath() = default;
+
+MathematicalProgramResult GraphOfConvexSets::PreparedShortestPath::Solve(
+    VertexId source_id, VertexId target_id) {
+  const double inf = std::numeric_limits<double>::infinity();
+  Data& data = *data_;
+  const bool same_vertices = std::equal(
+      graph_.vertices_.begin(), graph_.vertices_.end(), data.vertices.begin(),
+      data.vertices.end(), [](const auto& v, const auto& vertex) {
+        return v.first == vertex.first &&
+               v.second->ell_.size() == vertex.second.num_costs;
+      });
+  const bool same_edges =
+      std::equal(graph_.edges_.begin(), graph_.edges_.end(),
+                 data.edges.begin(), data.edges.end(),
+                 [](const auto& e, const auto& edge) {
+                   return e.first == edge.first;
+                 });
+  if (!same_vertices || !same_edges) {
+    throw std::runtime_error(
+        "GraphOfConvexSets::PreparedShortestPath::Solve(): The vertices, "
+        "edges, or vertex costs of the graph have changed since the program "
+        "was prepared; call PrepareShortestPath() again.");
   }
-  for (const Edge* e : excluded_edges) {
-    num_placeholder_vars += e->y_.size() + e->z_.size() + e->ell_.size() + 1;
+  DRAKE_THROW_UNLESS(data.vertices.count(source_id) > 0);
+  DRAKE_THROW_UNLESS(data.vertices.count(target_id) > 0);
+
+  std::set<EdgeId> unusable_edges;
+  if (options_.preprocessing) {
+    unusable_edges =
+        graph_.PreprocessShortestPath(source_id, target_id, options_);
   }
-  num_placeholder_vars += excluded_phi.size();
-  std::unordered_map<symbolic::Variable::Id, int> decision_variable_index =
-      prog.decision_variable_index();
-  int count = result.get_x_val().size();
-  Eigen::VectorXd x_val(count + num_placeholder_vars);
-  x_val.head(count) = result.get_x_val();
-  for (const Edge* e : excluded_edges) {
-    for (int i = 0; i < e->y_.size(); ++i) {
-      decision_variable_index.emplace(e->y_[i].get_id(), count);
-      x_val[count++] = 0;
-    }
-    for (int i = 0; i < e->z_.size(); ++i) {
-      decision_variable_index.emplace(e->z_[i].get_id(), count);
-      x_val[count++] = 0;
+
+  // The vertices whose constraints and costs must be updated (see below).
+  std::set<VertexId> affected;
+
+  // Turn off the edges that SolveShortestPath() would leave out of its
+  // program, and apply the phi constraints to the others.
+  for (const auto& [edge_id, e] : graph_.edges_) {
+    Data::EdgeData& edge = data.edges.at(edge_id);
+    const bool excluded =
+        !e->phi_value_.value_or(true) || unusable_edges.count(edge_id) > 0;
+    if (edge.excluded != excluded) {
+      // SolveShortestPath() only has two-cycle constraints for pairs of
+      // edges that are both in its program; those are owned by the edge's
+      // endpoints.
+      edge.excluded = excluded;
+      affected.insert(e->u().id());
+      affected.insert(e->v().id());
     }
-    for (int i = 0; i < e->ell_.size(); ++i) {
-      decision_variable_index.emplace(e->ell_[i].get_id(), count);
-      x_val[count++] = 0;
+    const double phi_lower = (!excluded && e->phi_value_.has_value()) ? 1 : 0;
+    const double phi_upper = excluded ? 0 : 1;
+    edge.phi_bounds->evaluator()->set_bounds(Vector1d(phi_lower),
+                                             Vector1d(phi_upper));
+    if (edge.yz_bounds.has_value()) {
+      const int size = edge.yz_bounds->variables().size();
+      const double bound = excluded ? 0 : inf;
+      edge.yz_bounds->evaluator()->set_bounds(VectorXd::Constant(size, -bound),
+                                              VectorXd::Constant(size, bound));
     }
-    decision_variable_index.emplace(e->phi_.get_id(), count);
-    x_val[count++] = 0;
-  }
-  for (const Variable& phi : excluded_phi) {
-    decision_variable_index.emplace(phi.get_id(), count);
-    x_val[count++] = 0;
   }
-  for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
-       vertices_) {
-    const Vertex* v = vpair.second.get();
-    const bool is_target = (target_id == v->id());
-    VectorXd x_v = VectorXd::Zero(v->ambient_dimension());
-    double sum_phi = 0;
-    if (is_target) {
-      sum_phi = 1.0;
-      for (const auto& e : incoming_edges[v->id()]) {
-        x_v += result.GetSolution(e->z_);
-      }
-    } else {
-      for (const auto& e : outgoing_edges[v->id()]) {
-        x_v += result.GetSolution(e->y_);
-        sum_phi += result.GetSolution(
-            options.convex_relaxation ? relaxed_phi.at(e->id()) : e->phi_);
+
+  // Otherwise, only the vertices whose role changes need to be updated, along
+  // with their in-neighbors, whose two-cycle constraints depend on those
+  // roles.
+  if (data.source_id != source_id || data.target_id != target_id) {
+    std::set<VertexId> changed{source_id, target_id};
+    for (const std::optional<VertexId>& id : {data.source_id, data.target_id}) {
+      if (id.has_value()) {
+        changed.insert(*id);
       }
     }
-    // In the convex relaxation, sum_relaxed_phi may not be one even for
-    // vertices in the shortest path. We undo yₑ = ϕₑ xᵤ here to ensure that
-    // xᵤ is in v->set(). If ∑ ϕₑ is small enough that numerical errors
-    // prevent the projection back into the Xᵤ, then we prefer to return NaN.
-    if (sum_phi < 100.0 * std::numeric_limits<double>::epsilon()) {
-      x_v = VectorXd::Constant(v->ambient_dimension(),
-                               std::numeric_limits<double>::quiet_NaN());
-    } else if (options.convex_relaxation) {
-      x_v /= sum_phi;
+    data.source_id = source_id;
+    data.target_id = target_id;
+    affected.insert(changed.begin(), changed.end());
+    for (const VertexId& id : changed) {
+      for (const Edge* e : data.incoming_edges.at(id)) {
+        affected.insert(e->u().id());
+      }
     }
-    for (int i = 0; i < v->ambient_dimension(); ++i) {
-      decision_variable_index.emplace(v->x()[i].get_id(), count);
-      x_val[count++] = x_v[i];
+  }
+  for (const VertexId& id : affected) {
+    UpdateVertex(*graph_.vertices_.at(id));
+  }
+
+  // Variables that were added since the last solve have no initial guess.
+  std::optional<VectorXd> initial_guess;
+  if (data.initial_guess.size() > 0) {
+    initial_guess = VectorXd::Constant(
+        data.prog.num_vars(), std::numeric_limits<double>::quiet_NaN());
+    initial_guess->head(data.initial_guess.size()) = data.initial_guess;
+  }
+  // N.B. Qualified, to call the free function instead of this method.
+  MathematicalProgramResult result =
+      optimization::Solve(data.prog, options_, false, initial_guess);
+  if (result.is_success()) {
+    data.initial_guess = result.get_x_val();
+  }
+
+  if (options_.convex_relaxation && options_.max_rounded_paths > 0 &&
+      result.is_success()) {
+    result = graph_.RoundShortestPath(
+        &data.prog, source_id, target_id, data.outgoing_edges,
+        data.relaxed_phi, unusable_edges, options_, std::move(result));
+  }
+
+  std::map<VertexId, MatrixXDecisionVariable> vertex_edge_ell;
+  for (const auto& [vertex_id, vertex] : data.vertices) {
+    if (vertex.num_costs > 0) {
+      vertex_edge_ell.emplace(vertex_id,
+                              vertex.edge_ell[vertex_id == target_id ? 1 : 0]);
     }
-    for (int ii = 0; ii < v->ell_.size(); ++ii) {
-      decision_variable_index.emplace(v->ell_[ii].get_id(), count);
-      x_val[count++] =
-          result.GetSolution(vertex_edge_ell.at(v->id()).col(ii)).sum();
+  }
+  graph_.SetPlaceholderSolution(data.prog, target_id, data.incoming_edges,
+                                data.outgoing_edges, vertex_edge_ell,
+                                data.relaxed_phi, {}, {}, options_, &result);
+  return result;
+}
+
+MathematicalProgramResult GraphOfConvexSets::PreparedShortestPath::Solve(
+    const Vertex& source, const Vertex& target) {
+  return Solve(source.id(), target.id());
+}
+
+void GraphOfConvexSets::PreparedShortestPath::UpdateEdgeCosts(EdgeId edge_id) {
+  DRAKE_THROW_UNLESS(data_->edges.count(edge_id) > 0);
+  DRAKE_THROW_UNLESS(graph_.edges_.count(edge_id) > 0);
+  data_->edges.at(edge_id).costs.SetActive(&data_->prog, false);
+  AddEdgeCosts(*graph_.edges_.at(edge_id));
+}
+
+void GraphOfConvexSets::PreparedShortestPath::AddEdgeCosts(const Edge& e) {
+  MathematicalProgram* prog = &data_->prog;
+  Data::EdgeData& edge = data_->edges.at(e.id());
+
+  // This is a no-op, except for the costs added since the last call.
+  prog->AddDecisionVariables(e.ell_);
+  BindingGroup costs;
+  costs.costs.push_back(
+      prog->AddLinearCost(VectorXd::Ones(e.ell_.size()), e.ell_));
+  edge.cost_slacks.resize(e.ell_.size());
+  for (int i = 0; i < e.ell_.size(); ++i) {
+    const Binding<Cost>& b = e.costs_[i];
+
+    const VectorXDecisionVariable& old_vars = b.variables();
+    VectorXDecisionVariable vars(old_vars.size() + 2);
+    // vars = [phi; ell; yz_vars]
+    vars[0] = edge.phi;
+    vars[1] = e.ell_[i];
+    for (int j = 0; j < old_vars.size(); ++j) {
+      vars[j + 2] = e.x_to_yz_.at(old_vars[j]);
     }
+
+    Append(graph_.AddPerspectiveCost(prog, b, vars, &edge.cost_slacks[i]),
+           &costs.constraints);
   }
-  if (options.convex_relaxation) {
-    // Write the value of the relaxed phi into the phi placeholder.
-    for (const auto& [edge_id, relaxed_phi_var] : relaxed_phi) {
-      decision_variable_index.emplace(edges_.at(edge_id)->phi_.get_id(), count);
-      x_val[count++] = result.GetSolution(relaxed_phi_var);
+  edge.costs = std::move(costs);
+}
+
+void GraphOfConvexSets::PreparedShortestPath::UpdateVertex(const Vertex& v) {
+  Data& data = *data_;
+  MathematicalProgram* prog = &data.prog;
+  Data::VertexData& vertex = data.vertices.at(v.id());
+  const bool is_source = (data.source_id == v.id());
+  const bool is_target = (data.target_id == v.id());
+
+  if (vertex.flow.has_value()) {
+    const Vector1d rhs((is_source ? 1.0 : 0.0) - (is_target ? 1.0 : 0.0));
+    vertex.flow->evaluator()->set_bounds(rhs, rhs);
+  }
+  if (vertex.degree.has_value()) {
+    vertex.degree->evaluator()->set_bounds(Vector1d(0.0),
+                                           Vector1d(is_target ? 0.0 : 1.0));
+  }
+  vertex.spatial_flow.SetActive(prog, !is_source && !is_target);
+  for (Data::TwoCycle& two_cycle : vertex.two_cycles) {
+    const VertexId head = two_cycle.e_out->v().id();
+    two_cycle.constraints.SetActive(
+        prog, !is_source && !is_target && data.source_id != head &&
+                  data.target_id != head &&
+                  !data.edges.at(two_cycle.e_out->id()).excluded &&
+                  !data.edges.at(two_cycle.e_in->id()).excluded);
+  }
+
+  const int active = is_target ? 1 : 0;
+  if (vertex.costs[1 - active].has_value()) {
+    vertex.costs[1 - active]->SetActive(prog, false);
+  }
+  if (vertex.costs[active].has_value()) {
+    vertex.costs[active]->SetActive(prog, true);
+    return;
+  }
+
+  const std::vector<Edge*>& cost_edges = is_target
+                                            ? data.incoming_edges.at(v.id())
+                                            : data.outgoing_edges.at(v.id());
+  BindingGroup costs;
+
+  // Vertex costs.
+  if (v.ell_.size() > 0) {
+    MatrixXDecisionVariable& edge_ell = vertex.edge_ell[active];
+    edge_ell = prog->NewContinuousVariables(cost_edges.size(), v.ell_.size());
+    for (int ii = 0; ii < v.ell_.size(); ++ii) {
+      const Binding<Cost>& b = v.costs_[ii];
+      const VectorXDecisionVariable& old_vars = b.variables();
+
+      VectorXDecisionVariable vertex_ell = edge_ell.col(ii);
+      costs.costs.push_back(
+          prog->AddLinearCost(VectorXd::Ones(vertex_ell.size()), vertex_ell));
+
+      for (int jj = 0; jj < static_cast<int>(cost_edges.size()); ++jj) {
+        const Edge* e = cost_edges[jj];
+        VectorXDecisionVariable vars(old_vars.size() + 2);
+        // vars = [phi; ell; yz_vars]
+        vars[0] = data.edges.at(e->id()).phi;
+        vars[1] = vertex_ell[jj];
+        for (int kk = 0; kk < old_vars.size(); ++kk) {
+          vars[kk + 2] = e->x_to_yz_.at(old_vars[kk]);
+        }
+
+        Append(graph_.AddPerspectiveCost(prog, b, vars), &costs.constraints);
+      }
     }
   }
-  result.set_decision_variable_index(decision_variable_index);
-  result.set_x_val(x_val);
 
-  return result;
+  // Vertex constraints.
+  for (const Binding<Constraint>& b : v.constraints_) {
+    const VectorXDecisionVariable& old_vars = b.variables();
+
+    for (const Edge* e : cost_edges) {
+      VectorXDecisionVariable vars(old_vars.size() + 1);
+      // vars = [phi; yz_vars]
+      vars[0] = data.edges.at(e->id()).phi;
+      for (int ii = 0; ii < old_vars.size(); ++ii) {
+        vars[ii + 1] = e->x_to_yz_.at(old_vars[ii]);
+      }
+
+      Append(graph_.AddPerspectiveConstraint(prog, b, vars),
+             &costs.constraints);
+    }
+  }
+  vertex.costs[active] = std::move(costs);
 }
 
-MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
-    const Vertex& source, const Vertex& target,
+std::unique_ptr<GraphOfConvexSets::PreparedShortestPath>
+GraphOfConvexSets::PrepareShortestPath(
     const GraphOfConvexSetsOptions& options) const {
-  return SolveShortestPath(source.id(), target.id(), options);
+  return std::unique_ptr<PreparedShortestPath>(
+      new PreparedShortestPath(this, options));
 }
 
 }  // namespace optimization
@@ -108,7 +108,8 @@ class GraphOfConvexSets {
 
   virtual ~GraphOfConvexSets();
 
-  class Edge;  // forward declaration.
+  class Edge;                  // forward declaration.
+  class PreparedShortestPath;  // forward declaration.
 
   using VertexId = Identifier<class VertexTag>;
   using EdgeId = Identifier<class EdgeTag>;
@@ -229,6 +230,7 @@ class GraphOfConvexSets {
     std::vector<solvers::Binding<solvers::Constraint>> constraints_{};
 
     friend class GraphOfConvexSets;
+    friend class PreparedShortestPath;
   };
 
   // Note: We think of this as a directed edge in the shortest path problem, but
@@ -389,6 +391,7 @@ class GraphOfConvexSets {
     std::optional<bool> phi_value_{};
 
     friend class GraphOfConvexSets;
+    friend class PreparedShortestPath;
   };
 
   /** Adds a vertex to the graph.  A copy of @p set is cloned and stored inside
@@ -505,6 +508,108 @@ class GraphOfConvexSets {
       const GraphOfConvexSetsOptions& options =
           GraphOfConvexSetsOptions()) const;
 
+  /** A shortest path program on a graph that is built once, and then solved
+  for any number of (source, target) pairs. See PrepareShortestPath().
+
+  SolveShortestPath() transcribes the whole graph into a new
+  MathematicalProgram on every call, although only the constraints and costs
+  next to the source and target depend on the query. This object keeps one
+  program for the graph; each call to Solve() only swaps the constraints and
+  costs that depend on the roles of the old and new source and target (and
+  of their in-neighbors), and passes the previous solution of the program to
+  the solver as its initial guess, for the solvers that can use one to warm
+  start (e.g., Mosek and Gurobi when convex_relaxation is false).
+
+  The results are the same as those of SolveShortestPath() with the same
+  options, up to the tolerance of the solver.
+
+  The program captures the vertices, edges, and vertex costs and constraints
+  and edge constraints of the graph when it is prepared. Afterwards, only
+  these changes to the graph are taken into account:
+  - Phi constraints (Edge::AddPhiConstraint() and friends) are read on every
+    call to Solve().
+  - Edge costs are rebuilt by UpdateEdgeCosts().
+
+  Any other change to the graph requires a new call to PrepareShortestPath().
+  Solve() throws if vertices or edges were added or removed, or if costs were
+  added to a vertex, but it cannot detect every other change: in particular,
+  costs added to an edge are silently ignored until UpdateEdgeCosts() is
+  called for it, and constraints added to an edge are always ignored.
+  The graph must outlive this object.
+
+  @experimental */
+  class PreparedShortestPath final {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PreparedShortestPath)
+
+    ~PreparedShortestPath();
+
+    /** Returns the options used to prepare (and solve) the program. */
+    const GraphOfConvexSetsOptions& options() const { return options_; }
+
+    /** Solves the shortest path problem from @p source_id to @p target_id.
+    The returned result can be used with the solution accessors of the
+    vertices and edges, just like the result of SolveShortestPath().
+    @throws std::exception if either id is not a vertex of the prepared graph,
+    or if vertices or edges have been added or removed since the program was
+    prepared.
+    @pydrake_mkdoc_identifier{by_id} */
+    solvers::MathematicalProgramResult Solve(VertexId source_id,
+                                             VertexId target_id);
+
+    /** Convenience overload that takes const reference arguments for source
+    and target.
+    @pydrake_mkdoc_identifier{by_reference} */
+    solvers::MathematicalProgramResult Solve(const Vertex& source,
+                                             const Vertex& target);
+
+    /** Rebuilds the costs of edge @p edge_id in the program from the edge's
+    current costs; use this after changing the coefficients of those costs (e.g.
+    through the bindings returned by Edge::AddCost()), or after adding costs to
+    the edge.
+
+    The program does not grow when the edge's costs keep their types and
+    sizes: the constraints that implement the old costs are replaced, and any
+    slack variables that they need (e.g., for an L1NormCost) are reused.
+    Otherwise, slack variables that are no longer needed stay in the program
+    (unconstrained) until PrepareShortestPath() is called again.
+    @throws std::exception if @p edge_id is not an edge of the prepared graph.
+    */
+    void UpdateEdgeCosts(EdgeId edge_id);
+
+   private:
+    friend class GraphOfConvexSets;
+
+    struct Data;
+
+    PreparedShortestPath(const GraphOfConvexSets* graph,
+                         const GraphOfConvexSetsOptions& options);
+
+    // Adds the ℓ cost and perspective costs of `edge` to the program.
+    void AddEdgeCosts(const Edge& edge);
+
+    // Adds (or removes) the constraints and costs of `vertex` that depend on
+    // the current source and target, so that they match the program that
+    // SolveShortestPath() would build.
+    void UpdateVertex(const Vertex& vertex);
+
+    const GraphOfConvexSets& graph_;
+    const GraphOfConvexSetsOptions options_;
+    std::unique_ptr<Data> data_;
+  };
+
+  /** Builds a shortest path program on the current graph, which can then be
+  solved repeatedly for different source and target vertices. This is much
+  faster than calling SolveShortestPath() for each query on large graphs; see
+  PreparedShortestPath for which changes to the graph it keeps track of.
+  @param options include all settings for solving the shortest path problem.
+  See `GraphOfConvexSetsOptions` for further details.
+  @throws std::exception if any of the costs or constraints in the graph are
+  incompatible with the shortest path formulation or otherwise unsupported. */
+  std::unique_ptr<PreparedShortestPath> PrepareShortestPath(
+      const GraphOfConvexSetsOptions& options =
+          GraphOfConvexSetsOptions()) const;
+
  private:
   /* Facilitates testing. */
   friend class PreprocessShortestPathTest;
@@ -519,21 +624,62 @@ class GraphOfConvexSets {
   // min g(x) ⇒ min ℓ, s.t. ℓ ≥ ϕ g(ϕx)
   // `vars` is a vector of variables to be used in the cost and constraint
   // consisting of ℓ, ϕ, and ϕ times the variables in the original cost.
-  void AddPerspectiveCost(solvers::MathematicalProgram* prog,
-                          const solvers::Binding<solvers::Cost>& binding,
-                          const solvers::VectorXDecisionVariable& vars) const;
+  // Some costs (e.g., L1NormCost) also need slack variables of their own. If
+  // `slack` is non-null and already holds the right number of variables, they
+  // are reused; otherwise new variables are added to `prog` and stored in
+  // `slack`.
+  // Returns the added constraints.
+  std::vector<solvers::Binding<solvers::Constraint>> AddPerspectiveCost(
+      solvers::MathematicalProgram* prog,
+      const solvers::Binding<solvers::Cost>& binding,
+      const solvers::VectorXDecisionVariable& vars,
+      solvers::VectorXDecisionVariable* slack = nullptr) const;
 
   // Adds a perspective version of the constraint to the mathematical program.
   // Specifically given a constraint h(x) ≤ b, this method implements its
   // perspective:
   // h(x) ≤ b ⇒ h(ϕx) ≤ ϕb
   // vars` is a vector of variables to be used in the constraint consisting of
-  // ϕ, and ϕ times the variables in the original constraint.
-  void AddPerspectiveConstraint(
+  // ϕ, and ϕ times the variables in the original constraint. Returns the added
+  // constraints.
+  std::vector<solvers::Binding<solvers::Constraint>> AddPerspectiveConstraint(
       solvers::MathematicalProgram* prog,
       const solvers::Binding<solvers::Constraint>& binding,
       const solvers::VectorXDecisionVariable& vars) const;
 
+  // Implements the rounding scheme put forth in Section 4.2 of
+  // "Motion Planning around Obstacles with Convex Optimization":
+  // https://arxiv.org/abs/2205.04422
+  // `result` is the (successful) solution of the convex relaxation `prog`,
+  // whose relaxed ϕ are `relaxed_phi`. Returns the best rounded result, or
+  // `result` with SolutionResult::kIterationLimit if no rounded path could be
+  // solved. `prog` is left unchanged.
+  solvers::MathematicalProgramResult RoundShortestPath(
+      solvers::MathematicalProgram* prog, VertexId source_id,
+      VertexId target_id,
+      const std::map<VertexId, std::vector<Edge*>>& outgoing_edges,
+      const std::map<EdgeId, symbolic::Variable>& relaxed_phi,
+      const std::set<EdgeId>& unusable_edges,
+      const GraphOfConvexSetsOptions& options,
+      solvers::MathematicalProgramResult result) const;
+
+  // Pushes the placeholder variables and the variables of the edges excluded
+  // from `prog` into `result`, so that they can be accessed as if they were
+  // variables included in the optimization. `vertex_edge_ell` holds the slack
+  // variables of each vertex's costs, with one row per incoming edge at the
+  // target and one row per outgoing edge elsewhere.
+  void SetPlaceholderSolution(
+      const solvers::MathematicalProgram& prog, VertexId target_id,
+      const std::map<VertexId, std::vector<Edge*>>& incoming_edges,
+      const std::map<VertexId, std::vector<Edge*>>& outgoing_edges,
+      const std::map<VertexId, solvers::MatrixXDecisionVariable>&
+          vertex_edge_ell,
+      const std::map<EdgeId, symbolic::Variable>& relaxed_phi,
+      const std::vector<Edge*>& excluded_edges,
+      const std::vector<symbolic::Variable>& excluded_phi,
+      const GraphOfConvexSetsOptions& options,
+      solvers::MathematicalProgramResult* result) const;
+
   std::map<VertexId, std::unique_ptr<Vertex>> vertices_{};
   std::map<EdgeId, std::unique_ptr<Edge>> edges_{};
 };
@@ -1718,6 +1718,108 @@ GTEST_TEST(ShortestPathTest, Figure9) {
   }
 }
 
+// Checks that a prepared program gives the same results as SolveShortestPath()
+// as the source, target, phi constraints, and edge costs change.
+GTEST_TEST(ShortestPathTest, PreparedShortestPath) {
+  GraphOfConvexSets spp;
+
+  std::vector<Vertex*> v;
+  v.push_back(spp.AddVertex(Point(Vector2d(0, 0))));
+  v.push_back(
+      spp.AddVertex(HPolyhedron::MakeBox(Vector2d(1, -2), Vector2d(2, -1))));
+  v.push_back(
+      spp.AddVertex(HPolyhedron::MakeBox(Vector2d(1, 1), Vector2d(2, 2))));
+  v.push_back(spp.AddVertex(Point(Vector2d(3, 0))));
+  v[1]->AddCost(v[1]->x()[0]);
+  v[2]->AddConstraint(v[2]->x()[1] <= 1.5);
+
+  // |xu - xv|₁
+  Matrix<double, 2, 4> A;
+  A.leftCols(2) = Matrix2d::Identity();
+  A.rightCols(2) = -Matrix2d::Identity();
+  auto cost = std::make_shared<solvers::L1NormCost>(A, Vector2d::Zero());
+  std::vector<Edge*> edges;
+  for (const auto& [i, j] : std::vector<std::pair<int, int>>{
+           {0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}}) {
+    edges.push_back(spp.AddEdge(*v[i], *v[j]));
+    edges.push_back(spp.AddEdge(*v[j], *v[i]));
+  }
+  for (Edge* e : edges) {
+    e->AddCost(solvers::Binding(cost, {e->xu(), e->xv()}));
+  }
+  // This cost is updated below.
+  auto edge_03_cost =
+      std::make_shared<solvers::L1NormCost>(A, Vector2d::Zero());
+  Edge* edge_03 = spp.AddEdge(*v[0], *v[3]);
+  edge_03->AddCost(solvers::Binding(edge_03_cost, {v[0]->x(), v[3]->x()}));
+
+  std::vector<GraphOfConvexSetsOptions> all_options(2);
+  all_options[1].preprocessing = true;
+  if (MixedIntegerSolverAvailable()) {
+    all_options.emplace_back().convex_relaxation = false;
+  }
+  for (const GraphOfConvexSetsOptions& options : all_options) {
+    const auto dut = spp.PrepareShortestPath(options);
+
+    const auto compare = [&](int source, int target) {
+      const MathematicalProgramResult expected =
+          spp.SolveShortestPath(*v[source], *v[target], options);
+      const MathematicalProgramResult result =
+          dut->Solve(*v[source], *v[target]);
+      ASSERT_EQ(result.is_success(), expected.is_success());
+      if (!expected.is_success()) {
+        return;
+      }
+      EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(),
+                  1e-6);
+      // The optimal paths need not be unique, but the solution is always in
+      // the source and target sets.
+      EXPECT_TRUE(v[source]->set().PointInSet(v[source]->GetSolution(result),
+                                              1e-6));
+      EXPECT_TRUE(v[target]->set().PointInSet(v[target]->GetSolution(result),
+                                              1e-6));
+    };
+
+    for (const auto& [source, target] : std::vector<std::pair<int, int>>{
+             {0, 3}, {3, 0}, {1, 3}, {0, 2}, {2, 1}, {0, 3}}) {
+      SCOPED_TRACE(std::to_string(source) + " -> " + std::to_string(target));
+      compare(source, target);
+    }
+
+    // Phi constraints are applied on every solve.
+    edge_03->AddPhiConstraint(false);
+    compare(0, 3);
+    edge_03->ClearPhiConstraints();
+
+    // Excluding one edge of a reverse pair also drops the pair's two-cycle
+    // constraints, which is visible in the relaxation (the default options,
+    // with max_rounded_paths == 0).
+    edges[5]->AddPhiConstraint(false);
+    for (const auto& [source, target] :
+         std::vector<std::pair<int, int>>{{0, 3}, {1, 3}, {0, 1}}) {
+      SCOPED_TRACE(std::to_string(source) + " -> " + std::to_string(target));
+      compare(source, target);
+    }
+    edges[5]->ClearPhiConstraints();
+
+    // Edge costs are rebuilt on request, without growing the program.
+    const int num_vars = dut->Solve(*v[0], *v[3]).get_x_val().size();
+    edge_03_cost->UpdateCoefficients(2 * A, Vector2d::Zero());
+    dut->UpdateEdgeCosts(edge_03->id());
+    compare(0, 3);
+    edge_03_cost->UpdateCoefficients(A, Vector2d::Zero());
+    dut->UpdateEdgeCosts(edge_03->id());
+    EXPECT_EQ(dut->Solve(*v[0], *v[3]).get_x_val().size(), num_vars);
+  }
+
+  const auto dut = spp.PrepareShortestPath();
+  DRAKE_EXPECT_THROWS_MESSAGE(dut->UpdateEdgeCosts(EdgeId::get_new_id()),
+                              ".*edges.*");
+  spp.AddVertex(Point(Vector2d(4, 0)));
+  DRAKE_EXPECT_THROWS_MESSAGE(dut->Solve(*v[0], *v[3]),
+                              ".*call PrepareShortestPath.*");
+}
+
 GTEST_TEST(ShortestPathTest, Graphviz) {
   GraphOfConvexSets g;
   auto source = g.AddVertex(Point(Vector2d{1.0, 2.}), "source");
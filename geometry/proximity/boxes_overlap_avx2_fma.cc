@@ -0,0 +1,162 @@
+#include "drake/geometry/proximity/boxes_overlap_avx2_fma.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#else
+#include <cstdlib>
+#include <iostream>
+#endif
+
+/* N.B. Do not include any other drake headers here because this file will be
+part of a compilation unit that may have a different opinion about whether SIMD
+instructions are enabled than Eigen does in the rest of Drake. */
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+#if defined(__AVX2__) && defined(__FMA__)
+namespace {
+
+// Check if AVX2 is supported by the CPU. We can assume that OS support for AVX2
+// is available if AVX2 is supported by hardware, and do not need to test if it
+// is enabled in software as well.
+bool CheckCpuForAvxSupport() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+
+// Turn d into d d d d.
+__m256d four(double d) {
+  return _mm256_set1_pd(d);
+}
+
+// Computes |x| lane-wise by clearing the sign bits.
+__m256d abs4(__m256d x) {
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+}
+
+// Returns the lanes for which lhs > rhs (i.e., the lanes that are separated).
+__m256d greater4(__m256d lhs, __m256d rhs) {
+  return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ);
+}
+
+}  // namespace
+
+bool BoxesOverlapAvxSupported() {
+  static const bool avx_supported = CheckCpuForAvxSupport();
+  return avx_supported;
+}
+
+/* This mirrors BoxesOverlap() with box A = Q and box B = Cₖ for each lane k.
+The relative pose X_QC = X_HQ⁻¹ * X_HC is formed lane-wise: R_QC = R_HQᵀ R_HC
+and p_QC = R_HQᵀ (p_HC - p_HQ). In the notation of BoxesOverlap(), r = R_QC
+and t = p_QC. All fifteen separating axes are tested for all four lanes; the
+only early exit happens when every lane is separated. */
+int BoxesOverlap4Avx(const double* R_HQ_data, const double* p_HQ,
+                     const double* half_width_Q, const BoxesSoa& boxes) {
+  // Entry (m, i) of R_HQ.
+  auto R_HQ = [R_HQ_data](int m, int i) { return R_HQ_data[m + 3 * i]; };
+
+  // Δp = p_HC - p_HQ, per lane.
+  __m256d dp[3];
+  for (int m = 0; m < 3; ++m) {
+    dp[m] = _mm256_sub_pd(_mm256_load_pd(boxes.p_HC[m]), four(p_HQ[m]));
+  }
+
+  // r(i, j) = Σₘ R_HQ(m, i) R_HC(m, j), t(i) = Σₘ R_HQ(m, i) Δp(m).
+  __m256d r[3][3];
+  __m256d t[3];
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      __m256d sum = _mm256_mul_pd(four(R_HQ(0, i)),
+                                  _mm256_load_pd(boxes.R_HC[0 + 3 * j]));
+      sum = _mm256_fmadd_pd(four(R_HQ(1, i)),
+                            _mm256_load_pd(boxes.R_HC[1 + 3 * j]), sum);
+      r[i][j] = _mm256_fmadd_pd(four(R_HQ(2, i)),
+                                _mm256_load_pd(boxes.R_HC[2 + 3 * j]), sum);
+    }
+    __m256d sum = _mm256_mul_pd(four(R_HQ(0, i)), dp[0]);
+    sum = _mm256_fmadd_pd(four(R_HQ(1, i)), dp[1], sum);
+    t[i] = _mm256_fmadd_pd(four(R_HQ(2, i)), dp[2], sum);
+  }
+
+  // The same epsilon as BoxesOverlap() to counteract arithmetic error.
+  const __m256d kEpsilon = four(0.000001);
+  __m256d abs_r[3][3];
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      abs_r[i][j] = _mm256_add_pd(abs4(r[i][j]), kEpsilon);
+    }
+  }
+
+  __m256d a[3];
+  __m256d b[3];
+  for (int i = 0; i < 3; ++i) {
+    a[i] = four(half_width_Q[i]);
+    b[i] = _mm256_load_pd(boxes.half_width[i]);
+  }
+
+  // First category of cases separating along Q's axes.
+  __m256d separated = _mm256_setzero_pd();
+  for (int i = 0; i < 3; ++i) {
+    __m256d rhs = _mm256_fmadd_pd(b[0], abs_r[i][0], a[i]);
+    rhs = _mm256_fmadd_pd(b[1], abs_r[i][1], rhs);
+    rhs = _mm256_fmadd_pd(b[2], abs_r[i][2], rhs);
+    separated = _mm256_or_pd(separated, greater4(abs4(t[i]), rhs));
+  }
+  if (_mm256_movemask_pd(separated) == 0xF) return 0;
+
+  // Second category of cases separating along C's axes.
+  for (int j = 0; j < 3; ++j) {
+    __m256d lhs = _mm256_mul_pd(t[0], r[0][j]);
+    lhs = _mm256_fmadd_pd(t[1], r[1][j], lhs);
+    lhs = _mm256_fmadd_pd(t[2], r[2][j], lhs);
+    __m256d rhs = _mm256_fmadd_pd(a[0], abs_r[0][j], b[j]);
+    rhs = _mm256_fmadd_pd(a[1], abs_r[1][j], rhs);
+    rhs = _mm256_fmadd_pd(a[2], abs_r[2][j], rhs);
+    separated = _mm256_or_pd(separated, greater4(abs4(lhs), rhs));
+  }
+  if (_mm256_movemask_pd(separated) == 0xF) return 0;
+
+  // Third category of cases separating along the axes formed from the cross
+  // products of Q's and C's axes.
+  for (int i = 0; i < 3; ++i) {
+    const int i1 = (i + 1) % 3;
+    const int i2 = (i + 2) % 3;
+    for (int j = 0; j < 3; ++j) {
+      const int j1 = (j + 1) % 3;
+      const int j2 = (j + 2) % 3;
+      const __m256d lhs = _mm256_fmsub_pd(
+          t[i2], r[i1][j], _mm256_mul_pd(t[i1], r[i2][j]));
+      __m256d rhs = _mm256_mul_pd(a[i1], abs_r[i2][j]);
+      rhs = _mm256_fmadd_pd(a[i2], abs_r[i1][j], rhs);
+      rhs = _mm256_fmadd_pd(b[j1], abs_r[i][j2], rhs);
+      rhs = _mm256_fmadd_pd(b[j2], abs_r[i][j1], rhs);
+      separated = _mm256_or_pd(separated, greater4(abs4(lhs), rhs));
+    }
+  }
+
+  return ~_mm256_movemask_pd(separated) & 0xF;
+}
+
+#else
+namespace {
+void AbortNotEnabledInBuild(const char* func) {
+  std::cerr << "abort: " << func << " is not enabled in build" << std::endl;
+  std::abort();
+}
+}  // namespace
+
+bool BoxesOverlapAvxSupported() { return false; }
+
+int BoxesOverlap4Avx(const double*, const double*, const double*,
+                     const BoxesSoa&) {
+  AbortNotEnabledInBuild(__func__);
+  return 0;
+}
+#endif
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,40 @@
+#pragma once
+
+/** @file
+Internal use only. */
+
+/* Declarations for a SIMD implementation of the oriented box overlap test of
+BoxesOverlap(), testing one box against four boxes at once.
+
+N.B. Do not include any other drake headers here (except for the plain data
+of boxes_soa.h) because this file will be included by a compilation unit that
+may have a different opinion about whether SIMD instructions are enabled than
+Eigen does in the rest of Drake. Only .cc files may include this header. */
+
+#include "drake/geometry/proximity/boxes_soa.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* Detects if BoxesOverlap4Avx() is supported. Supported means that both (1)
+AVX2 was enabled at build time, and (2) the processor executing this code
+supports AVX2 instructions. */
+bool BoxesOverlapAvxSupported();
+
+/* Tests the oriented box Q against each of the four oriented boxes in `boxes`
+with the same separating axis test as BoxesOverlap().
+
+@param R_HQ          The orientation of box Q in frame H as nine doubles: the
+                     3x3 rotation matrix in column order.
+@param p_HQ          The three entries of the position of Q's center in H.
+@param half_width_Q  The three half widths of box Q.
+@param boxes         The four boxes, posed in frame H.
+@returns A bit mask whose k-th bit is set if Q overlaps the k-th box.
+@pre BoxesOverlapAvxSupported() is true. */
+int BoxesOverlap4Avx(const double* R_HQ, const double* p_HQ,
+                     const double* half_width_Q, const BoxesSoa& boxes);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,35 @@
+#pragma once
+
+/** @file
+Internal use only. */
+
+/* The structure-of-arrays layout of the boxes tested by BoxesOverlap4Avx().
+
+N.B. This header is plain data: it must not include any other headers,
+because it is included by a compilation unit that may have a different
+opinion about whether SIMD instructions are enabled than Eigen does in the
+rest of Drake. */
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The number of boxes tested together by BoxesOverlap4Avx(). */
+constexpr int kBoxesOverlapLanes = 4;
+
+/* The layout of four oriented boxes C₀…C₃, posed in a common frame H, as a
+structure of arrays. Each quantity is stored as kBoxesOverlapLanes consecutive
+doubles, one per box (lane):
+ - R_HC: the nine entries of the 3x3 rotation matrices in column order, i.e.,
+   entry (i, j) of lane k is at `R_HC[i + 3 * j][k]`.
+ - p_HC: the three entries of the boxes' center positions.
+ - half_width: the three half widths of the boxes (along their own axes). */
+struct BoxesSoa {
+  alignas(32) double R_HC[9][kBoxesOverlapLanes];
+  alignas(32) double p_HC[3][kBoxesOverlapLanes];
+  alignas(32) double half_width[3][kBoxesOverlapLanes];
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
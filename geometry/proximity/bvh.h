@@ -224,45 +224,38 @@ class Bvh {
   void Collide(
       const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
       BvttCallback callback) const {
-    using NodePair =
-        std::pair<const NodeType&, const typename OtherBvhType::NodeType&>;
-    std::stack<NodePair, std::vector<NodePair>> node_pairs;
-    node_pairs.emplace(root_node(), bvh_B.root_node());
+    CollideImpl(bvh_B, callback,
+                [&X_AB](const BvType& bv_a, const auto& bv_b) {
+                  return BvType::HasOverlap(bv_a, bv_b, X_AB);
+                });
+  }
 
-    while (!node_pairs.empty()) {
-      const auto& [node_a, node_b] = node_pairs.top();
-      node_pairs.pop();
+  /* Variant of Collide() in which each of this %Bvh's bounding volumes is
+   grown by `padding` before it is tested against `bvh_B`'s bounding volumes.
+   The reported pairs are a superset of the pairs reported by Collide(). In
+   particular, they include every pair that Collide() would report if no point
+   of `bvh_B`'s bounding volumes moved by more than `padding` relative to frame
+   A. Pairs reported by both methods are reported in the same relative order.
 
-      // Check if the bounding volumes overlap.
-      if (!BvType::HasOverlap(node_a.bv(), node_b.bv(), X_AB)) {
-        continue;
-      }
+   This overload is only available for bounding volume types that provide a
+   padded overlap test (e.g., Obb).
 
-      // Run the callback on the pair if they are both leaf nodes, otherwise
-      // check each branch.
-      if (node_a.is_leaf() && node_b.is_leaf()) {
-        const int num_a_elements = node_a.num_element_indices();
-        const int num_b_elements = node_b.num_element_indices();
-        for (int a = 0; a < num_a_elements; ++a) {
-          for (int b = 0; b < num_b_elements; ++b) {
-            const BvttCallbackResult result =
-                callback(node_a.element_index(a), node_b.element_index(b));
-            if (result == BvttCallbackResult::Terminate) return;
-          }
-        }
-      } else if (node_b.is_leaf()) {
-        node_pairs.emplace(node_a.left(), node_b);
-        node_pairs.emplace(node_a.right(), node_b);
-      } else if (node_a.is_leaf()) {
-        node_pairs.emplace(node_a, node_b.left());
-        node_pairs.emplace(node_a, node_b.right());
-      } else {
-        node_pairs.emplace(node_a.left(), node_b.left());
-        node_pairs.emplace(node_a.right(), node_b.left());
-        node_pairs.emplace(node_a.left(), node_b.right());
-        node_pairs.emplace(node_a.right(), node_b.right());
-      }
-    }
+   @param bvh_B           The bounding volume hierarchy to collide with.
+   @param X_AB            The relative pose of the two hierarchies.
+   @param padding         The amount by which this hierarchy's bounding volumes
+                          are grown.
+   @param callback        The callback to invoke on each unculled pair.
+   @tparam OtherBvhType   The type of Bvh to collide against this.
+   @pre padding >= 0.  */
+  template <class OtherBvhType>
+  void Collide(
+      const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
+      double padding, BvttCallback callback) const {
+    DRAKE_ASSERT(padding >= 0);
+    CollideImpl(bvh_B, callback,
+                [&X_AB, padding](const BvType& bv_a, const auto& bv_b) {
+                  return BvType::HasOverlap(bv_a, bv_b, X_AB, padding);
+                });
   }
 
   /* Culls the nodes of the BVH based on the nodes' bounding volumes'
@@ -347,6 +340,53 @@ class Bvh {
 
   NodeType& mutable_root_node() { return *root_node_; }
 
+  /* The traversal shared by the two BVH-BVH Collide() overloads; they differ
+   only in the bounding-volume test `has_overlap(bv_a, bv_b)` used to cull
+   node pairs.  */
+  template <class OtherBvhType, typename OverlapTest>
+  void CollideImpl(const OtherBvhType& bvh_B, const BvttCallback& callback,
+                   const OverlapTest& has_overlap) const {
+    using NodePair =
+        std::pair<const NodeType&, const typename OtherBvhType::NodeType&>;
+    std::stack<NodePair, std::vector<NodePair>> node_pairs;
+    node_pairs.emplace(root_node(), bvh_B.root_node());
+
+    while (!node_pairs.empty()) {
+      const auto& [node_a, node_b] = node_pairs.top();
+      node_pairs.pop();
+
+      // Check if the bounding volumes overlap.
+      if (!has_overlap(node_a.bv(), node_b.bv())) {
+        continue;
+      }
+
+      // Run the callback on the pair if they are both leaf nodes, otherwise
+      // check each branch.
+      if (node_a.is_leaf() && node_b.is_leaf()) {
+        const int num_a_elements = node_a.num_element_indices();
+        const int num_b_elements = node_b.num_element_indices();
+        for (int a = 0; a < num_a_elements; ++a) {
+          for (int b = 0; b < num_b_elements; ++b) {
+            const BvttCallbackResult result =
+                callback(node_a.element_index(a), node_b.element_index(b));
+            if (result == BvttCallbackResult::Terminate) return;
+          }
+        }
+      } else if (node_b.is_leaf()) {
+        node_pairs.emplace(node_a.left(), node_b);
+        node_pairs.emplace(node_a.right(), node_b);
+      } else if (node_a.is_leaf()) {
+        node_pairs.emplace(node_a, node_b.left());
+        node_pairs.emplace(node_a, node_b.right());
+      } else {
+        node_pairs.emplace(node_a.left(), node_b.left());
+        node_pairs.emplace(node_a.right(), node_b.left());
+        node_pairs.emplace(node_a.left(), node_b.right());
+        node_pairs.emplace(node_a.right(), node_b.right());
+      }
+    }
+  }
+
   using CentroidPair = std::pair<int, Vector3<double>>;
 
   static std::unique_ptr<NodeType> BuildBvTree(
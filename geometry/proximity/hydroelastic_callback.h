@@ -19,6 +19,7 @@
 #include "drake/geometry/proximity/mesh_plane_intersection.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
+#include "drake/geometry/proximity/soft_rigid_candidate_cache.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/math/rigid_transform.h"
@@ -40,6 +41,7 @@ namespace hydroelastic DRAKE_NO_EXPORT {
     - The choice of how to represent contact polygons.
     - A vector of contact surfaces -- one instance of ContactSurface for
       every supported, unfiltered penetrating pair.
+    - An optional cache of soft-volume vs rigid-surface candidates.
 
  @tparam T The computation scalar.  */
 template <typename T>
@@ -89,6 +91,10 @@ struct CallbackData {
 
   /* The results of the distance query.  */
   std::vector<ContactSurface<T>>& surfaces;
+
+  /* If non-null, soft-volume vs rigid-surface contact surfaces draw their
+   candidate element pairs from this cache (see SoftRigidCandidateCache).  */
+  SoftRigidCandidateCache* candidate_cache{nullptr};
 };
 
 enum class CalcContactSurfaceResult {
@@ -103,14 +109,16 @@ enum class CalcContactSurfaceResult {
 };
 
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
- represented by the given `soft` and `rigid` geometries.
+ represented by the given `soft` and `rigid` geometries. The optional
+ `candidate_cache` is only used when both geometries are meshes.
  @pre The geometries are not *both* half spaces.  */
 template <typename T>
 std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
     const SoftGeometry& soft, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    SoftRigidCandidateCache* candidate_cache = nullptr) {
   if (soft.is_half_space() || rigid.is_half_space()) {
     if (soft.is_half_space()) {
       DRAKE_DEMAND(!rigid.is_half_space());
@@ -137,7 +145,8 @@ std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R = rigid.bvh();
 
     return ComputeContactSurfaceFromSoftVolumeRigidSurface(
-        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation);
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation,
+        candidate_cache);
   }
 }
 
@@ -258,8 +267,9 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
   const math::RigidTransform<T>& X_WS(data->X_WGs.at(id_S));
   const math::RigidTransform<T>& X_WR(data->X_WGs.at(id_R));
 
-  std::unique_ptr<ContactSurface<T>> surface = DispatchRigidSoftCalculation(
-      soft, X_WS, id_S, rigid, X_WR, id_R, data->representation);
+  std::unique_ptr<ContactSurface<T>> surface =
+      DispatchRigidSoftCalculation(soft, X_WS, id_S, rigid, X_WR, id_R,
+                                   data->representation, data->candidate_cache);
 
   if (surface != nullptr) {
     DRAKE_DEMAND(surface->id_M() < surface->id_N());
@@ -291,8 +291,6 @@ void SurfaceVolumeIntersector<MeshBuilder, BvType>::SampleVolumeFieldOnSurface(
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_N,
     const math::RigidTransform<T>& X_MN,
     const bool filter_face_normal_along_field_gradient) {
-  // Builds the intersection mesh represented in M's frame.
-  MeshBuilder builder_M;
   const math::RigidTransform<double>& X_MN_d = convert_to_double(X_MN);
 
   std::vector<std::pair<int, int>> candidate_tet_tri_pairs;
@@ -303,6 +301,22 @@ void SurfaceVolumeIntersector<MeshBuilder, BvType>::SampleVolumeFieldOnSurface(
                   return BvttCallbackResult::Continue;
                 });
 
+  SampleVolumeFieldOnSurface(volume_field_M, surface_N, X_MN,
+                             candidate_tet_tri_pairs,
+                             filter_face_normal_along_field_gradient);
+}
+
+template <typename MeshBuilder, typename BvType>
+void SurfaceVolumeIntersector<MeshBuilder, BvType>::SampleVolumeFieldOnSurface(
+    const VolumeMeshFieldLinear<double, double>& volume_field_M,
+    const TriangleSurfaceMesh<double>& surface_N,
+    const math::RigidTransform<T>& X_MN,
+    const std::vector<std::pair<int, int>>& candidate_tet_tri_pairs,
+    const bool filter_face_normal_along_field_gradient) {
+  // Builds the intersection mesh represented in M's frame.
+  MeshBuilder builder_M;
+  const math::RigidTransform<double>& X_MN_d = convert_to_double(X_MN);
+
   for (const auto& [tet_index, tri_index] : candidate_tet_tri_pairs) {
     CalcContactPolygon(volume_field_M, surface_N, X_MN, X_MN_d, &builder_M,
                        filter_face_normal_along_field_gradient, tet_index,
@@ -384,7 +398,8 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    SoftRigidCandidateCache* candidate_cache) {
   auto process_intersection =
       [&X_WS, id_S,
        id_R](auto&& intersector_in) -> std::unique_ptr<ContactSurface<T>> {
@@ -421,14 +436,26 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
   // Compute the transformation from the rigid frame to the soft frame.
   const math::RigidTransform<T> X_SR = X_WS.InvertAndCompose(X_WR);
 
+  auto sample_field = [&](auto&& intersector_in) {
+    if (candidate_cache != nullptr) {
+      intersector_in.SampleVolumeFieldOnSurface(
+          field_S, mesh_R, X_SR,
+          *candidate_cache->GetCandidates(id_S, bvh_S, id_R, bvh_R,
+                                          convert_to_double(X_SR)));
+    } else {
+      intersector_in.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R,
+                                                X_SR);
+    }
+  };
+
   if (representation == HydroelasticContactRepresentation::kTriangle) {
     SurfaceVolumeIntersector<TriMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    sample_field(intersector);
     return process_intersection(intersector);
   } else {
     // Polygon.
     SurfaceVolumeIntersector<PolyMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    sample_field(intersector);
     return process_intersection(intersector);
   }
 }
@@ -12,6 +12,7 @@
 #include "drake/geometry/proximity/polygon_surface_mesh.h"
 #include "drake/geometry/proximity/polygon_surface_mesh_field.h"
 #include "drake/geometry/proximity/posed_half_space.h"
+#include "drake/geometry/proximity/soft_rigid_candidate_cache.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/proximity/triangle_surface_mesh_field.h"
 #include "drake/geometry/proximity/volume_mesh.h"
@@ -165,6 +166,22 @@ class SurfaceVolumeIntersector {
       const math::RigidTransform<T>& X_MN,
       bool filter_face_normal_along_field_gradient = true);
 
+  /* Variant of SampleVolumeFieldOnSurface() that skips the bounding volume
+   hierarchy traversal and instead tests the given (tetrahedron, triangle)
+   index pairs. The result matches the other overload's result as long as
+   `candidate_tet_tri_pairs` contains every pair of elements whose bounding
+   volumes overlap, in traversal order (see SoftRigidCandidateCache).
+   @param[in] candidate_tet_tri_pairs
+       The (tetrahedron, triangle) pairs to test, indexing into the mesh of
+       `volume_field_M` and into `surface_N`, respectively.
+   The remaining parameters are as documented for the other overload.  */
+  void SampleVolumeFieldOnSurface(
+      const VolumeMeshFieldLinear<double, double>& volume_field_M,
+      const TriangleSurfaceMesh<double>& surface_N,
+      const math::RigidTransform<T>& X_MN,
+      const std::vector<std::pair<int, int>>& candidate_tet_tri_pairs,
+      bool filter_face_normal_along_field_gradient = true);
+
   bool has_intersection() const { return mesh_M_ != nullptr; }
 
   /* Returns surface_MN_M the intersection surface between the volume mesh M
@@ -416,6 +433,10 @@ class SurfaceVolumeIntersector {
      The pose of the rigid frame R in the world frame W.
  @param[in] representation
      The preferred representation of each contact polygon.
+ @param[in, out] candidate_cache
+     If non-null, the candidate (tetrahedron, triangle) pairs are obtained from
+     (and recorded in) this cache instead of by traversing `bvh_S` and `bvh_R`.
+     The resulting contact surface is the same either way.
  @return
      The contact surface between M and N. Geometries S and R map to M and N
      with a consistent mapping (as documented in ContactSurface) but without any
@@ -449,7 +470,8 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const GeometryId id_R, const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    SoftRigidCandidateCache* candidate_cache = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
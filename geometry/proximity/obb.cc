@@ -37,6 +37,16 @@ bool Obb::HasOverlap(const Obb& a, const Obb& b,
   return BoxesOverlap(a.half_width(), b.half_width(), X_AB);
 }
 
+bool Obb::HasOverlap(const Obb& a, const Obb& b, const RigidTransformd& X_GH,
+                     double padding) {
+  DRAKE_ASSERT(padding >= 0);
+  const RigidTransformd& X_GA = a.pose();
+  const RigidTransformd& X_HB = b.pose();
+  const RigidTransformd X_AB = X_GA.InvertAndCompose(X_GH * X_HB);
+  return BoxesOverlap(a.half_width() + Vector3d::Constant(padding),
+                      b.half_width(), X_AB);
+}
+
 bool Obb::HasOverlap(const Obb& obb_G, const Aabb& aabb_H,
                      const RigidTransformd& X_GH) {
   /* For this analysis, aabb has local frame A and obb has local frame O.
@@ -83,6 +83,21 @@ class Obb {
   static bool HasOverlap(const Obb& a_G, const Obb& b_H,
                          const math::RigidTransformd& X_GH);
 
+  /* Reports whether the oriented bounding box `a_G`, grown by `padding` along
+   each of its axes, intersects `b_H`. The grown box contains every point
+   within distance `padding` of `a_G`, so this is a conservative test for
+   whether the two boxes come within `padding` of each other.
+
+   @param a_G       The first oriented box.
+   @param b_H       The second oriented box.
+   @param X_GH      The relative pose between hierarchy frame G and hierarchy
+                    frame H.
+   @param padding   The non-negative amount by which `a_G` is grown.
+   @returns `true` if the grown box intersects `b_H`.
+   @pre padding >= 0.  */
+  static bool HasOverlap(const Obb& a_G, const Obb& b_H,
+                         const math::RigidTransformd& X_GH, double padding);
+
   /* Reports whether oriented bounding box `obb_G` intersects the given
    axis-aligned bounding box `aabb_H`. The poses of `obb_G` and `aabb_H` are
    defined in their corresponding hierarchy frames G and H, respectively.
@@ -0,0 +1,154 @@
+#include "drake/geometry/proximity/soft_rigid_candidate_cache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stack>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using math::RigidTransformd;
+
+namespace {
+
+/* Returns an upper bound on the distance from the hierarchy's frame origin to
+ any point contained in any of its bounding volumes. The bounding volumes of
+ child nodes are not necessarily contained in their parents', so every node
+ is visited.  */
+double CalcBoundingRadius(const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh) {
+  using NodeType = Bvh<Obb, TriangleSurfaceMesh<double>>::NodeType;
+  double radius = 0;
+  std::stack<const NodeType*> nodes;
+  nodes.push(&bvh.root_node());
+  while (!nodes.empty()) {
+    const NodeType* node = nodes.top();
+    nodes.pop();
+    radius = std::max(
+        radius, node->bv().center().norm() + node->bv().half_width().norm());
+    if (!node->is_leaf()) {
+      nodes.push(&node->left());
+      nodes.push(&node->right());
+    }
+  }
+  return radius;
+}
+
+/* Returns an upper bound on the distance any point within `radius` of R's
+ origin moves in frame S when R's pose changes from X_SR0 to X_SR1.  */
+double CalcMaxDisplacement(const RigidTransformd& X_SR0,
+                           const RigidTransformd& X_SR1, double radius) {
+  // For a point P, |p_SP1 - p_SP0| = |(R_SR1 - R_SR0) p_RP + Δp_SRo|
+  //                                ≤ ‖R_SR1 - R_SR0‖₂ |p_RP| + |Δp_SRo|.
+  // ‖R_SR1 - R_SR0‖₂ = ‖R_R0R1 - I‖₂ = 2 sin(θ/2) = √(3 - tr(R_R0R1)), where θ
+  // is the angle of the relative rotation R_R0R1 = R_SR0ᵀ R_SR1.
+  const double trace =
+      (X_SR0.rotation().matrix().transpose() * X_SR1.rotation().matrix())
+          .trace();
+  const double rotation_distance = std::sqrt(std::max(0.0, 3.0 - trace));
+  return rotation_distance * radius +
+         (X_SR1.translation() - X_SR0.translation()).norm();
+}
+
+}  // namespace
+
+SoftRigidCandidateCache::SoftRigidCandidateCache(double margin)
+    : margin_(margin) {
+  DRAKE_THROW_UNLESS(std::isfinite(margin) && margin > 0);
+}
+
+std::shared_ptr<const SoftRigidCandidateCache::Candidates>
+SoftRigidCandidateCache::GetCandidates(
+    GeometryId id_S, const Bvh<Obb, VolumeMesh<double>>& bvh_S,
+    GeometryId id_R, const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
+    const RigidTransformd& X_SR) {
+  const SortedPair<GeometryId> key(id_S, id_R);
+  std::shared_ptr<const Record> old_record;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(key);
+    if (iter != entries_.end()) {
+      iter->second.used = true;
+      old_record = iter->second.record;
+    }
+  }
+
+  if (old_record != nullptr &&
+      CalcMaxDisplacement(old_record->X_SR, X_SR, old_record->radius_R) <=
+          margin_) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++num_hits_;
+    return std::shared_ptr<const Candidates>(old_record,
+                                             &old_record->candidates);
+  }
+
+  auto record = std::make_shared<Record>();
+  record->X_SR = X_SR;
+  record->radius_R = old_record != nullptr ? old_record->radius_R
+                                           : CalcBoundingRadius(bvh_R);
+  if (old_record != nullptr) {
+    record->candidates.reserve(old_record->candidates.size());
+  }
+  Candidates& candidates = record->candidates;
+  bvh_S.Collide(bvh_R, X_SR, margin_,
+                [&candidates](int tet_index,
+                              int tri_index) -> BvttCallbackResult {
+                  candidates.emplace_back(tet_index, tri_index);
+                  return BvttCallbackResult::Continue;
+                });
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[key] = Entry{record, true};
+    ++num_misses_;
+  }
+  return std::shared_ptr<const Candidates>(record, &record->candidates);
+}
+
+void SoftRigidCandidateCache::PruneUnused() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto iter = entries_.begin(); iter != entries_.end();) {
+    if (iter->second.used) {
+      iter->second.used = false;
+      ++iter;
+    } else {
+      iter = entries_.erase(iter);
+    }
+  }
+}
+
+void SoftRigidCandidateCache::RemoveGeometry(GeometryId id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto iter = entries_.begin(); iter != entries_.end();) {
+    if (iter->first.first() == id || iter->first.second() == id) {
+      iter = entries_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+void SoftRigidCandidateCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+int SoftRigidCandidateCache::num_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(entries_.size());
+}
+
+int SoftRigidCandidateCache::num_hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_hits_;
+}
+
+int SoftRigidCandidateCache::num_misses() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_misses_;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
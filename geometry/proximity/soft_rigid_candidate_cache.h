@@ -0,0 +1,133 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/sorted_pair.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obb.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* Exploits temporal coherence when computing contact surfaces between a soft
+ volume S and a rigid surface R (see
+ ComputeContactSurfaceFromSoftVolumeRigidSurface()) over a sequence of
+ slightly different poses, e.g., across the steps of a simulation.
+
+ For each (S, R) pair, the cache records the candidate (tetrahedron, triangle)
+ pairs found by a BVH-BVH traversal in which S's bounding volumes are grown by
+ a margin δ (see the padded Bvh::Collide()), together with the relative pose
+ X_SR used for that traversal. When the pair is queried again, the recorded
+ candidates are reused as long as no point of R's bounding volumes has moved
+ by more than δ relative to S since they were recorded. Otherwise, the padded
+ traversal is repeated at the new pose and the record is replaced.
+
+ Reused candidates are a superset of the candidates that an unpadded traversal
+ at the new pose would report, and the shared candidates appear in the same
+ relative order. The extra candidates have disjoint bounding volumes and
+ produce no contact polygons, so the contact surfaces computed from cached
+ candidates are identical to those computed without the cache. Larger margins
+ trade more (fruitless) narrowphase tests for fewer traversals.
+
+ Records store element indices into the geometries' meshes, so the records
+ of a geometry must be discarded (via RemoveGeometry()) whenever its
+ hydroelastic representation changes. To keep the cache from growing without
+ bound as geometries move in and out of each other's vicinity, PruneUnused()
+ discards the records of pairs that have not been queried recently.
+
+ All methods may be invoked concurrently from multiple threads, including
+ GetCandidates() for the same geometry pair. Records are immutable once made;
+ a miss replaces a pair's record rather than modifying it, so the candidates
+ returned to one caller are never changed by another.  */
+class SoftRigidCandidateCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SoftRigidCandidateCache)
+
+  /* A list of candidate (tetrahedron, triangle) index pairs.  */
+  using Candidates = std::vector<std::pair<int, int>>;
+
+  /* Constructs an empty cache with the given margin δ.
+   @throws std::exception if `margin` is not positive and finite.  */
+  explicit SoftRigidCandidateCache(double margin);
+
+  /* Returns the margin δ, in meters.  */
+  double margin() const { return margin_; }
+
+  /* Returns the candidate (tetrahedron, triangle) index pairs for the soft
+   geometry S and the rigid geometry R at relative pose X_SR -- a superset of
+   `bvh_S.GetCollisionCandidates(bvh_R, X_SR)` as described in the class
+   documentation. The returned candidates remain valid for as long as the
+   caller holds on to them, regardless of later changes to the cache.
+
+   @param id_S    The id of the soft geometry S.
+   @param bvh_S   The bounding volume hierarchy of S's volume mesh.
+   @param id_R    The id of the rigid geometry R.
+   @param bvh_R   The bounding volume hierarchy of R's surface mesh.
+   @param X_SR    The pose of R in S.  */
+  std::shared_ptr<const Candidates> GetCandidates(
+      GeometryId id_S, const Bvh<Obb, VolumeMesh<double>>& bvh_S,
+      GeometryId id_R, const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
+      const math::RigidTransformd& X_SR);
+
+  /* Discards the records of all pairs that have not been passed to
+   GetCandidates() since the previous invocation of PruneUnused().  */
+  void PruneUnused();
+
+  /* Discards the records of all pairs that include the geometry with the
+   given `id`.  */
+  void RemoveGeometry(GeometryId id);
+
+  /* Discards all records.  */
+  void Clear();
+
+  /* Returns the number of geometry pairs with records.  */
+  int num_entries() const;
+
+  /* Returns the number of GetCandidates() invocations that reused recorded
+   candidates.  */
+  int num_hits() const;
+
+  /* Returns the number of GetCandidates() invocations that had to traverse the
+   bounding volume hierarchies.  */
+  int num_misses() const;
+
+ private:
+  struct Record {
+    // The pose X_SR at which `candidates` were computed.
+    math::RigidTransformd X_SR;
+    // An upper bound on the distance from R's origin to any point in any of
+    // R's bounding volumes.
+    double radius_R{};
+    Candidates candidates;
+  };
+
+  struct Entry {
+    std::shared_ptr<const Record> record;
+    // Whether the pair has been queried since the last PruneUnused().
+    bool used{true};
+  };
+
+  const double margin_;
+
+  // Guards all of the members below. Records are shared (rather than guarded)
+  // so that the traversal and the callers' use of candidates happen outside
+  // of the lock.
+  mutable std::mutex mutex_;
+  std::unordered_map<SortedPair<GeometryId>, Entry> entries_;
+  int num_hits_{0};
+  int num_misses_{0};
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
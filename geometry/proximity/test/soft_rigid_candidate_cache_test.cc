@@ -0,0 +1,193 @@
+#include "drake/geometry/proximity/soft_rigid_candidate_cache.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/geometry/proximity/make_sphere_field.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/mesh_intersection.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using std::pair;
+using std::vector;
+
+// Reports whether `sub` is a subsequence of `super`.
+bool IsSubsequence(const vector<pair<int, int>>& sub,
+                   const vector<pair<int, int>>& super) {
+  auto iter = super.begin();
+  for (const auto& item : sub) {
+    iter = std::find(iter, super.end(), item);
+    if (iter == super.end()) return false;
+    ++iter;
+  }
+  return true;
+}
+
+// A soft sphere S resting on a rigid box R; the box's top face penetrates the
+// bottom of the sphere.
+class SoftRigidCandidateCacheTest : public ::testing::Test {
+ protected:
+  SoftRigidCandidateCacheTest()
+      : mesh_S_(MakeSphereVolumeMesh<double>(
+            Sphere(kRadius), kRadius / 4,
+            TessellationStrategy::kDenseInteriorVertices)),
+        field_S_(MakeSpherePressureField<double>(Sphere(kRadius), &mesh_S_,
+                                                 1e5)),
+        bvh_S_(mesh_S_),
+        mesh_R_(MakeBoxSurfaceMesh<double>(Box(0.4, 0.4, 0.1), 0.05)),
+        bvh_R_(mesh_R_),
+        X_WS_(Vector3d(0, 0, kRadius + 0.05 - 0.01)) {}
+
+  static constexpr double kRadius = 0.1;
+
+  const GeometryId id_S_{GeometryId::get_new_id()};
+  const GeometryId id_R_{GeometryId::get_new_id()};
+  const VolumeMesh<double> mesh_S_;
+  const VolumeMeshFieldLinear<double, double> field_S_;
+  const Bvh<Obb, VolumeMesh<double>> bvh_S_;
+  const TriangleSurfaceMesh<double> mesh_R_;
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_R_;
+  const RigidTransformd X_WS_;
+};
+
+TEST_F(SoftRigidCandidateCacheTest, BadMargin) {
+  DRAKE_EXPECT_THROWS_MESSAGE(SoftRigidCandidateCache(0.0), ".*margin.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(SoftRigidCandidateCache(-1e-3), ".*margin.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SoftRigidCandidateCache(std::numeric_limits<double>::infinity()),
+      ".*margin.*");
+}
+
+// Small motions reuse the recorded candidates, which remain a superset of the
+// unpadded candidates (in the same relative order); large motions trigger a
+// new traversal.
+TEST_F(SoftRigidCandidateCacheTest, ReuseAndInvalidation) {
+  const double kMargin = 1e-3;
+  SoftRigidCandidateCache dut(kMargin);
+  EXPECT_EQ(dut.margin(), kMargin);
+  EXPECT_EQ(dut.num_entries(), 0);
+
+  const RigidTransformd X_SR0 = X_WS_.inverse();
+  const vector<pair<int, int>> candidates0 =
+      *dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR0);
+  EXPECT_EQ(dut.num_entries(), 1);
+  EXPECT_EQ(dut.num_misses(), 1);
+  EXPECT_EQ(dut.num_hits(), 0);
+  const vector<pair<int, int>> expected0 =
+      bvh_S_.GetCollisionCandidates(bvh_R_, X_SR0);
+  ASSERT_FALSE(expected0.empty());
+  EXPECT_GE(candidates0.size(), expected0.size());
+  EXPECT_TRUE(IsSubsequence(expected0, candidates0));
+
+  // Translation and rotation, each well within the margin.
+  const RigidTransformd X_SR1 =
+      X_SR0 * RigidTransformd(RollPitchYawd(0, 0, 1e-3), Vector3d(2e-4, 0, 0));
+  const std::shared_ptr<const vector<pair<int, int>>> candidates1 =
+      dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR1);
+  EXPECT_EQ(dut.num_misses(), 1);
+  EXPECT_EQ(dut.num_hits(), 1);
+  EXPECT_EQ(*candidates1, candidates0);
+  EXPECT_TRUE(IsSubsequence(bvh_S_.GetCollisionCandidates(bvh_R_, X_SR1),
+                            *candidates1));
+
+  // A translation beyond the margin.
+  const RigidTransformd X_SR2 =
+      X_SR0 * RigidTransformd(Vector3d(0, 0, 2 * kMargin));
+  dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR2);
+  EXPECT_EQ(dut.num_misses(), 2);
+  EXPECT_EQ(dut.num_hits(), 1);
+  // Replacing the record leaves previously returned candidates intact.
+  EXPECT_EQ(*candidates1, candidates0);
+
+  // A pure rotation that moves R's far corners beyond the margin even though
+  // R's origin doesn't move.
+  const RigidTransformd X_SR3 =
+      X_SR2 * RigidTransformd(RollPitchYawd(0, 0, 0.02), Vector3d::Zero());
+  dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR3);
+  EXPECT_EQ(dut.num_misses(), 3);
+  EXPECT_EQ(dut.num_hits(), 1);
+  EXPECT_EQ(dut.num_entries(), 1);
+
+  dut.Clear();
+  EXPECT_EQ(dut.num_entries(), 0);
+}
+
+// Records of pairs that go unqueried between two prunes are discarded, as are
+// the records of removed geometries.
+TEST_F(SoftRigidCandidateCacheTest, PruneAndRemove) {
+  SoftRigidCandidateCache dut(1e-3);
+  const RigidTransformd X_SR = X_WS_.inverse();
+  const GeometryId id_R2 = GeometryId::get_new_id();
+  dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR);
+  dut.GetCandidates(id_S_, bvh_S_, id_R2, bvh_R_, X_SR);
+  EXPECT_EQ(dut.num_entries(), 2);
+
+  // Both pairs were queried since construction.
+  dut.PruneUnused();
+  EXPECT_EQ(dut.num_entries(), 2);
+
+  // Only one pair is queried before the next prune.
+  dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR);
+  dut.PruneUnused();
+  EXPECT_EQ(dut.num_entries(), 1);
+  dut.GetCandidates(id_S_, bvh_S_, id_R_, bvh_R_, X_SR);
+  EXPECT_EQ(dut.num_hits(), 2);
+
+  dut.GetCandidates(id_S_, bvh_S_, id_R2, bvh_R_, X_SR);
+  EXPECT_EQ(dut.num_entries(), 2);
+  dut.RemoveGeometry(id_R_);
+  EXPECT_EQ(dut.num_entries(), 1);
+  dut.RemoveGeometry(id_S_);
+  EXPECT_EQ(dut.num_entries(), 0);
+}
+
+// The contact surfaces computed with the cache are identical to those computed
+// without it, across a sequence of small motions.
+TEST_F(SoftRigidCandidateCacheTest, ContactSurfaceUnchanged) {
+  SoftRigidCandidateCache cache(2e-3);
+  for (const auto representation :
+       {HydroelasticContactRepresentation::kTriangle,
+        HydroelasticContactRepresentation::kPolygon}) {
+    cache.Clear();
+    for (int i = 0; i < 5; ++i) {
+      const RigidTransformd X_WR(RollPitchYawd(0, 0, 2e-4 * i),
+                                 Vector3d(1e-4 * i, 0, -2e-4 * i));
+      const std::unique_ptr<ContactSurface<double>> expected =
+          ComputeContactSurfaceFromSoftVolumeRigidSurface(
+              id_S_, field_S_, bvh_S_, X_WS_, id_R_, mesh_R_, bvh_R_, X_WR,
+              representation);
+      const std::unique_ptr<ContactSurface<double>> cached =
+          ComputeContactSurfaceFromSoftVolumeRigidSurface(
+              id_S_, field_S_, bvh_S_, X_WS_, id_R_, mesh_R_, bvh_R_, X_WR,
+              representation, &cache);
+      ASSERT_NE(expected, nullptr);
+      ASSERT_NE(cached, nullptr);
+      EXPECT_TRUE(cached->Equal(*expected));
+    }
+  }
+  // Each representation's sequence misses once and then reuses candidates.
+  EXPECT_EQ(cache.num_misses(), 2);
+  EXPECT_EQ(cache.num_hits(), 8);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
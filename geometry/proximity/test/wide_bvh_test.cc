@@ -0,0 +1,186 @@
+#include "drake/geometry/proximity/wide_bvh.h"
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/proximity/boxes_overlap.h"
+#include "drake/geometry/proximity/make_sphere_field.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/mesh_intersection.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using std::pair;
+using std::vector;
+
+// Returns a random pose with position in [-1, 1]³.
+RigidTransformd RandomPose(std::mt19937* generator) {
+  std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+  std::uniform_real_distribution<double> position(-1, 1);
+  return RigidTransformd(
+      RollPitchYawd(angle(*generator), angle(*generator), angle(*generator)),
+      Vector3d(position(*generator), position(*generator),
+               position(*generator)));
+}
+
+// Returns random half widths in [0.05, 0.6]³.
+Vector3d RandomHalfWidth(std::mt19937* generator) {
+  std::uniform_real_distribution<double> half_width(0.05, 0.6);
+  return Vector3d(half_width(*generator), half_width(*generator),
+                  half_width(*generator));
+}
+
+// Both implementations of BoxesOverlap4() agree with BoxesOverlap().
+GTEST_TEST(BoxesOverlap4Test, AgreesWithBoxesOverlap) {
+  std::mt19937 generator(1234);
+  int num_overlaps = 0;
+  for (int trial = 0; trial < 500; ++trial) {
+    const RigidTransformd X_HQ = RandomPose(&generator);
+    const Vector3d half_width_Q = RandomHalfWidth(&generator);
+    BoxesSoa boxes{};
+    int expected = 0;
+    for (int k = 0; k < kBoxesOverlapLanes; ++k) {
+      const RigidTransformd X_HC = RandomPose(&generator);
+      const Vector3d half_width_C = RandomHalfWidth(&generator);
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          boxes.R_HC[i + 3 * j][k] = X_HC.rotation().matrix()(i, j);
+        }
+        boxes.p_HC[i][k] = X_HC.translation()(i);
+        boxes.half_width[i][k] = half_width_C(i);
+      }
+      if (BoxesOverlap(half_width_Q, half_width_C,
+                       X_HQ.InvertAndCompose(X_HC))) {
+        expected |= 1 << k;
+        ++num_overlaps;
+      }
+    }
+    for (int num_boxes = 0; num_boxes <= kBoxesOverlapLanes; ++num_boxes) {
+      const int expected_subset = expected & ((1 << num_boxes) - 1);
+      EXPECT_EQ(BoxesOverlap4Portable(X_HQ, half_width_Q, boxes, num_boxes),
+                expected_subset);
+      EXPECT_EQ(BoxesOverlap4(X_HQ, half_width_Q, boxes, num_boxes),
+                expected_subset);
+    }
+  }
+  // Confirm that the random boxes exercise both outcomes.
+  EXPECT_GT(num_overlaps, 0);
+  EXPECT_LT(num_overlaps, 500 * kBoxesOverlapLanes);
+}
+
+class WideBvhTest : public ::testing::Test {
+ protected:
+  WideBvhTest()
+      : mesh_S_(MakeSphereVolumeMesh<double>(
+            Sphere(1.0), 0.25, TessellationStrategy::kDenseInteriorVertices)),
+        field_S_(MakeSpherePressureField<double>(Sphere(1.0), &mesh_S_, 1e5)),
+        mesh_R_(MakeSphereSurfaceMesh<double>(Sphere(0.8), 0.2)),
+        bvh_S_(mesh_S_),
+        bvh_R_(mesh_R_) {}
+
+  const VolumeMesh<double> mesh_S_;
+  const VolumeMeshFieldLinear<double, double> field_S_;
+  const TriangleSurfaceMesh<double> mesh_R_;
+  const Bvh<Obb, VolumeMesh<double>> bvh_S_;
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_R_;
+};
+
+// Every element is referenced by exactly one leaf, and the wide hierarchy has
+// fewer internal nodes than the binary hierarchy.
+TEST_F(WideBvhTest, Structure) {
+  const WideBvh<VolumeMesh<double>> wide_S(bvh_S_);
+  const WideBvh<TriangleSurfaceMesh<double>> wide_R(bvh_R_);
+
+  // A hierarchy of a single element is a single leaf. Colliding against it
+  // reports each candidate element once.
+  const TriangleSurfaceMesh<double> big_triangle(
+      {SurfaceTriangle(0, 1, 2)},
+      {Vector3d(-10, -10, 0), Vector3d(10, -10, 0), Vector3d(0, 10, 0)});
+  const WideBvh<TriangleSurfaceMesh<double>> wide_big(big_triangle);
+  EXPECT_EQ(wide_big.num_nodes(), 0);
+  EXPECT_EQ(wide_big.num_leaves(), 1);
+  const vector<pair<int, int>> all =
+      wide_S.GetCollisionCandidates(wide_big, RigidTransformd::Identity());
+  std::set<int> tets;
+  for (const auto& [tet, tri] : all) {
+    EXPECT_EQ(tri, 0);
+    EXPECT_TRUE(tets.insert(tet).second);
+  }
+  EXPECT_FALSE(tets.empty());
+
+  // The leaves partition the elements: colliding the hierarchy with itself
+  // reports each element paired with itself exactly once.
+  int num_leaf_elements = 0;
+  wide_S.Collide(wide_S, RigidTransformd::Identity(),
+                 [&num_leaf_elements](int a, int b) {
+                   if (a == b) ++num_leaf_elements;
+                   return BvttCallbackResult::Continue;
+                 });
+  EXPECT_EQ(num_leaf_elements, mesh_S_.num_elements());
+
+  // Each binary internal node has two children; each wide one has up to four.
+  EXPECT_LT(wide_S.num_nodes(), mesh_S_.num_elements() / 2);
+  EXPECT_GT(wide_S.num_nodes(), 0);
+  EXPECT_GT(wide_R.num_leaves(), 0);
+}
+
+// The wide hierarchy's candidates produce the same contact surface as the
+// binary hierarchy's candidates.
+TEST_F(WideBvhTest, ContactSurfaceMatchesBinaryBvh) {
+  const WideBvh<VolumeMesh<double>> wide_S(bvh_S_);
+  const WideBvh<TriangleSurfaceMesh<double>> wide_R(bvh_R_);
+  for (const RigidTransformd& X_SR :
+       {RigidTransformd(Vector3d(0.5, 0, 0)),
+        RigidTransformd(RollPitchYawd(0.3, -0.2, 0.7), Vector3d(0, 0.9, 0.4)),
+        RigidTransformd(RollPitchYawd(1.0, 0.5, 0), Vector3d(1.2, 1.2, 0))}) {
+    SurfaceVolumeIntersector<PolyMeshBuilder<double>, Obb> expected;
+    expected.SampleVolumeFieldOnSurface(field_S_, bvh_S_, mesh_R_, bvh_R_,
+                                        X_SR);
+    const vector<pair<int, int>> candidates =
+        wide_S.GetCollisionCandidates(wide_R, X_SR);
+    SurfaceVolumeIntersector<PolyMeshBuilder<double>, Obb> dut;
+    dut.SampleVolumeFieldOnSurface(field_S_, mesh_R_, X_SR, candidates);
+
+    ASSERT_EQ(dut.has_intersection(), expected.has_intersection());
+    if (!expected.has_intersection()) continue;
+    EXPECT_EQ(dut.mutable_mesh().num_elements(),
+              expected.mutable_mesh().num_elements());
+    EXPECT_NEAR(dut.mutable_mesh().total_area(),
+                expected.mutable_mesh().total_area(), 1e-12);
+  }
+}
+
+// The traversal stops as soon as the callback requests it.
+TEST_F(WideBvhTest, Terminate) {
+  const WideBvh<VolumeMesh<double>> wide_S(bvh_S_);
+  const WideBvh<TriangleSurfaceMesh<double>> wide_R(bvh_R_);
+  int num_calls = 0;
+  wide_S.Collide(wide_R, RigidTransformd::Identity(), [&num_calls](int, int) {
+    ++num_calls;
+    return BvttCallbackResult::Terminate;
+  });
+  EXPECT_EQ(num_calls, 1);
+
+  // Separated hierarchies produce no candidates.
+  EXPECT_TRUE(wide_S.GetCollisionCandidates(
+                  wide_R, RigidTransformd(Vector3d(5, 0, 0)))
+                  .empty());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
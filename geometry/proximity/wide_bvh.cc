@@ -0,0 +1,116 @@
+#include "drake/geometry/proximity/wide_bvh.h"
+
+#include "drake/geometry/proximity/boxes_overlap.h"
+#include "drake/geometry/proximity/boxes_overlap_avx2_fma.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+int BoxesOverlap4(const RigidTransformd& X_HQ, const Vector3d& half_width_Q,
+                  const BoxesSoa& boxes, int num_boxes) {
+  DRAKE_ASSERT(0 <= num_boxes && num_boxes <= kBoxesOverlapLanes);
+  if (BoxesOverlapAvxSupported()) {
+    const int all_lanes = (1 << num_boxes) - 1;
+    return all_lanes &
+           BoxesOverlap4Avx(X_HQ.rotation().matrix().data(),
+                            X_HQ.translation().data(), half_width_Q.data(),
+                            boxes);
+  }
+  return BoxesOverlap4Portable(X_HQ, half_width_Q, boxes, num_boxes);
+}
+
+int BoxesOverlap4Portable(const RigidTransformd& X_HQ,
+                          const Vector3d& half_width_Q, const BoxesSoa& boxes,
+                          int num_boxes) {
+  DRAKE_ASSERT(0 <= num_boxes && num_boxes <= kBoxesOverlapLanes);
+  int overlaps = 0;
+  for (int k = 0; k < num_boxes; ++k) {
+    Matrix3<double> R_HC;
+    Vector3d p_HC;
+    Vector3d half_width_C;
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        R_HC(i, j) = boxes.R_HC[i + 3 * j][k];
+      }
+      p_HC(i) = boxes.p_HC[i][k];
+      half_width_C(i) = boxes.half_width[i][k];
+    }
+    const RigidTransformd X_HC(RotationMatrixd(R_HC), p_HC);
+    if (BoxesOverlap(half_width_Q, half_width_C,
+                     X_HQ.InvertAndCompose(X_HC))) {
+      overlaps |= 1 << k;
+    }
+  }
+  return overlaps;
+}
+
+template <class MeshType>
+WideBvh<MeshType>::WideBvh(const Bvh<Obb, MeshType>& bvh) {
+  root_ = AddSubtree(bvh.root_node());
+}
+
+template <class MeshType>
+int WideBvh<MeshType>::AddSubtree(const BinaryNode& node) {
+  if (node.is_leaf()) {
+    Leaf leaf;
+    leaf.num_index = node.num_element_indices();
+    for (int i = 0; i < leaf.num_index; ++i) {
+      leaf.indices[i] = node.element_index(i);
+    }
+    leaves_.push_back(leaf);
+    leaf_bvs_.push_back(node.bv());
+    return ~(num_leaves() - 1);
+  }
+
+  // Collapse the binary levels below `node` by repeatedly replacing the
+  // largest internal descendant with its two children.
+  std::array<const BinaryNode*, kWidth> children{&node.left(), &node.right()};
+  int num_children = 2;
+  while (num_children < kWidth) {
+    int largest = -1;
+    for (int k = 0; k < num_children; ++k) {
+      if (children[k]->is_leaf()) continue;
+      if (largest < 0 || children[k]->bv().CalcVolume() >
+                             children[largest]->bv().CalcVolume()) {
+        largest = k;
+      }
+    }
+    if (largest < 0) break;
+    const BinaryNode* expanded = children[largest];
+    children[largest] = &expanded->left();
+    children[num_children++] = &expanded->right();
+  }
+
+  // N.B. Recursion may grow `nodes_`, so the node is accessed by index.
+  const int index = num_nodes();
+  nodes_.emplace_back();
+  node_bvs_.push_back(node.bv());
+  nodes_[index].num_children = num_children;
+  for (int k = 0; k < num_children; ++k) {
+    const Obb& bv = children[k]->bv();
+    BoxesSoa& soa = nodes_[index].children_bvs;
+    const Matrix3<double>& R_HC = bv.pose().rotation().matrix();
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        soa.R_HC[i + 3 * j][k] = R_HC(i, j);
+      }
+      soa.p_HC[i][k] = bv.center()(i);
+      soa.half_width[i][k] = bv.half_width()(i);
+    }
+    const int child = AddSubtree(*children[k]);
+    nodes_[index].children[k] = child;
+  }
+  return index;
+}
+
+template class WideBvh<TriangleSurfaceMesh<double>>;
+template class WideBvh<VolumeMesh<double>>;
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/boxes_soa.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obb.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* Tests the oriented box Q against the first `num_boxes` boxes in `boxes`. The
+ test is BoxesOverlap()'s separating axis test; it uses BoxesOverlap4Avx() if
+ BoxesOverlapAvxSupported() and BoxesOverlap4Portable() otherwise.
+ @param X_HQ          The pose of box Q's canonical frame in frame H.
+ @param half_width_Q  The half widths of box Q.
+ @param boxes         The boxes, posed in frame H.
+ @param num_boxes     The number of valid boxes in `boxes`.
+ @returns A bit mask whose k-th bit is set if Q overlaps the k-th box.
+ @pre 0 <= num_boxes <= kBoxesOverlapLanes.  */
+int BoxesOverlap4(const math::RigidTransformd& X_HQ,
+                  const Vector3<double>& half_width_Q, const BoxesSoa& boxes,
+                  int num_boxes);
+
+/* The portable implementation of BoxesOverlap4(); it invokes BoxesOverlap()
+ once per box.  */
+int BoxesOverlap4Portable(const math::RigidTransformd& X_HQ,
+                          const Vector3<double>& half_width_Q,
+                          const BoxesSoa& boxes, int num_boxes);
+
+/* %WideBvh is a four-ary bounding volume hierarchy of oriented bounding boxes.
+ It is derived from a binary Bvh<Obb, MeshType> by collapsing its levels: each
+ node of a %WideBvh adopts as many as four descendants of the corresponding
+ binary node, greedily expanding the descendant with the largest volume. The
+ bounding boxes are the binary hierarchy's boxes.
+
+ The bounding boxes of a node's children are stored together as a structure of
+ arrays (see BoxesSoa) so that a single query box can be tested against all of
+ them at once with BoxesOverlap4(). That test uses AVX2 instructions if Drake
+ was built with them enabled and the executing processor supports them, and a
+ scalar fallback otherwise.
+
+ Like Bvh::Collide(), Collide() is conservative: it reports every pair of
+ elements whose geometries intersect. Because it tests different pairs of
+ boxes along the way, the reported pairs and their order can differ from
+ those reported by Bvh::Collide().
+
+ @warning %WideBvh is experimental and benchmarking-only. It is only exercised
+ by mesh_intersection_benchmark to compare broadphase throughput against Bvh;
+ it is not part of the proximity library, it is not used by ProximityEngine,
+ and no query can be configured to use it.
+ Swapping it into the hydroelastic paths would change the order of contact
+ surface faces, so it would first need an order-preserving candidate sort.
+
+ @tparam MeshType  TriangleSurfaceMesh<double> or VolumeMesh<double>.  */
+template <class MeshType>
+class WideBvh {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(WideBvh)
+
+  /* The maximum number of children per node.  */
+  static constexpr int kWidth = kBoxesOverlapLanes;
+
+  /* The maximum number of elements per leaf.  */
+  static constexpr int kMaxElementPerLeaf =
+      MeshTraits<MeshType>::kMaxElementPerBvhLeaf;
+
+  /* Constructs the wide hierarchy from the given binary hierarchy.  */
+  explicit WideBvh(const Bvh<Obb, MeshType>& bvh);
+
+  /* Constructs the wide hierarchy for the given mesh.  */
+  explicit WideBvh(const MeshType& mesh)
+      : WideBvh(Bvh<Obb, MeshType>(mesh)) {}
+
+  /* Returns the number of internal (non-leaf) nodes.  */
+  int num_nodes() const { return static_cast<int>(nodes_.size()); }
+
+  /* Returns the number of leaves.  */
+  int num_leaves() const { return static_cast<int>(leaves_.size()); }
+
+  /* Performs a query of this hierarchy's mesh elements (measured and expressed
+   in frame A) against the given hierarchy's mesh elements (measured and
+   expressed in frame B). The callback is invoked on every pair of elements
+   that cannot conclusively be shown to be separated via bounding-volume
+   comparisons. See Bvh::Collide().
+
+   @param bvh_B      The bounding volume hierarchy to collide with.
+   @param X_AB       The relative pose of the two hierarchies.
+   @param callback   The callback to invoke on each unculled pair.  */
+  template <class OtherMeshType>
+  void Collide(const WideBvh<OtherMeshType>& bvh_B,
+               const math::RigidTransformd& X_AB,
+               BvttCallback callback) const {
+    if (!Obb::HasOverlap(bv(root_), bvh_B.bv(bvh_B.root_), X_AB)) return;
+
+    const math::RigidTransformd X_BA = X_AB.inverse();
+    // References to nodes (non-negative) or leaves (negative); see bv().
+    std::vector<std::pair<int, int>> ref_pairs;
+    ref_pairs.emplace_back(root_, bvh_B.root_);
+    while (!ref_pairs.empty()) {
+      const auto [a, b] = ref_pairs.back();
+      ref_pairs.pop_back();
+
+      if (a < 0 && b < 0) {
+        const Leaf& leaf_a = leaves_[~a];
+        const auto& leaf_b = bvh_B.leaves_[~b];
+        for (int i = 0; i < leaf_a.num_index; ++i) {
+          for (int j = 0; j < leaf_b.num_index; ++j) {
+            const BvttCallbackResult result =
+                callback(leaf_a.indices[i], leaf_b.indices[j]);
+            if (result == BvttCallbackResult::Terminate) return;
+          }
+        }
+        continue;
+      }
+
+      // Descend into the larger of the two (internal) nodes, testing its
+      // children against the other's box all at once.
+      const Obb& bv_a = bv(a);
+      const Obb& bv_b = bvh_B.bv(b);
+      if (b < 0 || (a >= 0 && bv_a.CalcVolume() >= bv_b.CalcVolume())) {
+        const Node& node = nodes_[a];
+        const int overlaps =
+            BoxesOverlap4(X_AB * bv_b.pose(), bv_b.half_width(),
+                          node.children_bvs, node.num_children);
+        for (int k = node.num_children - 1; k >= 0; --k) {
+          if (overlaps & (1 << k)) ref_pairs.emplace_back(node.children[k], b);
+        }
+      } else {
+        const auto& node = bvh_B.nodes_[b];
+        const int overlaps =
+            BoxesOverlap4(X_BA * bv_a.pose(), bv_a.half_width(),
+                          node.children_bvs, node.num_children);
+        for (int k = node.num_children - 1; k >= 0; --k) {
+          if (overlaps & (1 << k)) ref_pairs.emplace_back(a, node.children[k]);
+        }
+      }
+    }
+  }
+
+  /* Wrapper around Collide() with a callback that accumulates each pair of
+   collision candidates and returns them all.  */
+  template <class OtherMeshType>
+  std::vector<std::pair<int, int>> GetCollisionCandidates(
+      const WideBvh<OtherMeshType>& bvh_B,
+      const math::RigidTransformd& X_AB) const {
+    std::vector<std::pair<int, int>> result;
+    Collide(bvh_B, X_AB, [&result](int a, int b) -> BvttCallbackResult {
+      result.emplace_back(a, b);
+      return BvttCallbackResult::Continue;
+    });
+    return result;
+  }
+
+ private:
+  template <class> friend class WideBvh;
+
+  using BinaryNode = typename Bvh<Obb, MeshType>::NodeType;
+
+  /* An internal node: the bounding boxes of its children and references to
+   them (see bv()). Lanes at or beyond `num_children` are unused.  */
+  struct Node {
+    BoxesSoa children_bvs{};
+    std::array<int, kWidth> children{};
+    int num_children{};
+  };
+
+  struct Leaf {
+    int num_index{};
+    std::array<int, kMaxElementPerLeaf> indices{};
+  };
+
+  /* Returns the bounding box of the node (`ref` >= 0) or leaf (`ref` < 0)
+   referenced by `ref`; leaves are referenced by the bitwise complement of
+   their index.  */
+  const Obb& bv(int ref) const {
+    return ref >= 0 ? node_bvs_[ref] : leaf_bvs_[~ref];
+  }
+
+  /* Adds the subtree rooted at the given binary node, returning its
+   reference.  */
+  int AddSubtree(const BinaryNode& node);
+
+  std::vector<Node> nodes_;
+  std::vector<Obb> node_bvs_;
+  std::vector<Leaf> leaves_;
+  std::vector<Obb> leaf_bvs_;
+  int root_{};
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -1,7 +1,10 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <cmath>
+#include <exception>
 #include <filesystem>
+#include <iterator>
 #include <limits>
 #include <string>
 #include <tuple>
@@ -27,6 +30,8 @@
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
+#include "drake/geometry/proximity/proximity_utilities.h"
+#include "drake/geometry/proximity/soft_rigid_candidate_cache.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
 #include "drake/geometry/proximity/vtk_to_volume_mesh.h"
 #include "drake/geometry/read_obj.h"
@@ -209,6 +214,103 @@ bool OrderContactSurface(const ContactSurface<T>& s1,
   return s1.id_N() < s2.id_N();
 }
 
+// A pair of fcl objects reported by the broadphase as a candidate for a
+// narrowphase query.
+using CandidatePair = std::pair<CollisionObjectd*, CollisionObjectd*>;
+
+// Supporting data for the broadphase callbacks that merely record candidate
+// pairs (see CollectCollisionCandidate() and CollectDistanceCandidate()).
+struct CandidateData {
+  // The collision filter system. Filtered pairs are not recorded.
+  const CollisionFilter& collision_filter;
+
+  // The maximum distance for a pair to be recorded; only used by
+  // CollectDistanceCandidate().
+  double max_distance{};
+
+  // The recorded pairs, in the order in which the broadphase visits them.
+  std::vector<CandidatePair>& pairs;
+};
+
+// Broadphase collision callback that records every unfiltered pair whose
+// bounding volumes overlap.
+bool CollectCollisionCandidate(CollisionObjectd* object_A_ptr,
+                               CollisionObjectd* object_B_ptr,
+                               void* callback_data) {
+  auto& data = *static_cast<CandidateData*>(callback_data);
+  if (data.collision_filter.CanCollideWith(EncodedData(*object_A_ptr).id(),
+                                           EncodedData(*object_B_ptr).id())) {
+    data.pairs.emplace_back(object_A_ptr, object_B_ptr);
+  }
+  // Tell the broadphase to keep searching.
+  return false;
+}
+
+// Broadphase distance callback that records every unfiltered pair whose
+// bounding volumes are within the maximum distance. The culling distance is
+// reported back to the broadphase exactly as shape_distance::Callback() does
+// so that the very same pairs are visited.
+bool CollectDistanceCandidate(CollisionObjectd* object_A_ptr,
+                              CollisionObjectd* object_B_ptr,
+                              // NOLINTNEXTLINE
+                              void* callback_data, double& max_distance) {
+  auto& data = *static_cast<CandidateData*>(callback_data);
+  const double kEps = std::numeric_limits<double>::epsilon() / 10;
+  max_distance = std::max(data.max_distance, kEps);
+  if (data.collision_filter.CanCollideWith(EncodedData(*object_A_ptr).id(),
+                                           EncodedData(*object_B_ptr).id())) {
+    data.pairs.emplace_back(object_A_ptr, object_B_ptr);
+  }
+  // Tell the broadphase to keep searching.
+  return false;
+}
+
+// Invokes `evaluate(candidate, &output)` on each of the given `candidates`
+// using up to `num_threads` threads. Each candidate writes into its own
+// default-constructed Output, so that the returned outputs are in the same
+// order as `candidates` regardless of the number of threads. If any evaluation
+// throws, the exception of the first throwing candidate (in candidate order)
+// is rethrown once all evaluations have completed.
+template <typename Output, typename Evaluate>
+std::vector<Output> EvaluateCandidates(
+    const std::vector<CandidatePair>& candidates, int num_threads,
+    const Evaluate& evaluate) {
+  const int num_candidates = static_cast<int>(candidates.size());
+  std::vector<Output> outputs(num_candidates);
+  std::vector<std::exception_ptr> errors(num_candidates);
+  // The cost of narrowphase queries varies widely between pairs (e.g. sphere
+  // vs. sphere or mesh vs. mesh); dynamic scheduling keeps threads busy.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int i = 0; i < num_candidates; ++i) {
+    try {
+      evaluate(candidates[i], &outputs[i]);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+  return outputs;
+}
+
+// Moves the elements of each of the `sources` to the back of `target`,
+// preserving their order.
+template <typename Value>
+void Concatenate(std::vector<std::vector<Value>>* sources,
+                 std::vector<Value>* target) {
+  size_t total_size = target->size();
+  for (const std::vector<Value>& source : *sources) {
+    total_size += source.size();
+  }
+  target->reserve(total_size);
+  for (std::vector<Value>& source : *sources) {
+    std::move(source.begin(), source.end(), std::back_inserter(*target));
+  }
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -241,6 +343,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
 
     collision_filter_ = other.collision_filter_;
+    parallelism_ = other.parallelism_;
+    // The copy starts with an empty cache.
+    set_hydroelastic_candidate_margin(other.hydroelastic_candidate_margin());
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -274,6 +379,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     engine->geometries_for_deformable_contact_ =
         this->geometries_for_deformable_contact_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->parallelism_ = this->parallelism_;
+    engine->set_hydroelastic_candidate_margin(hydroelastic_candidate_margin());
 
     return engine;
   }
@@ -338,6 +445,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_.RemoveGeometry(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
+    RemoveFromCandidateCache(id);
     const RigidTransformd X_WG = GetX_WG(id, geometry.is_dynamic());
     geometries_for_deformable_contact_.RemoveGeometry(id);
     geometries_for_deformable_contact_.MaybeAddRigidGeometry(
@@ -369,6 +477,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     }
     hydroelastic_geometries_.RemoveGeometry(id);
     geometries_for_deformable_contact_.RemoveGeometry(id);
+    RemoveFromCandidateCache(id);
   }
 
   void RemoveDeformableGeometry(GeometryId id) {
@@ -398,6 +507,24 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  Parallelism parallelism() const { return parallelism_; }
+
+  void set_hydroelastic_candidate_margin(double margin) {
+    DRAKE_THROW_UNLESS(std::isfinite(margin) && margin >= 0);
+    if (margin == hydroelastic_candidate_margin()) return;
+    if (margin == 0) {
+      candidate_cache_.reset();
+    } else {
+      candidate_cache_ = make_unique<SoftRigidCandidateCache>(margin);
+    }
+  }
+
+  double hydroelastic_candidate_margin() const {
+    return candidate_cache_ != nullptr ? candidate_cache_->margin() : 0.0;
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -586,6 +713,25 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
     data.request.distance_tolerance = distance_tolerance_;
 
+    if (parallelism_.num_threads() > 1) {
+      const std::vector<CandidatePair> candidates =
+          FindDistanceCandidates(max_distance);
+      std::vector<std::vector<SignedDistancePair<T>>> results =
+          EvaluateCandidates<std::vector<SignedDistancePair<T>>>(
+              candidates, parallelism_.num_threads(),
+              [&](const CandidatePair& candidate,
+                  std::vector<SignedDistancePair<T>>* pair_results) {
+                shape_distance::CallbackData<T> pair_data{
+                    &collision_filter_, &X_WGs, max_distance, pair_results};
+                pair_data.request = data.request;
+                double unused_max_distance{};
+                shape_distance::Callback<T>(candidate.first, candidate.second,
+                                            &pair_data, unused_max_distance);
+              });
+      Concatenate(&results, &witness_pairs);
+      return witness_pairs;
+    }
+
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.distance(&data, shape_distance::Callback<T>);
 
@@ -666,13 +812,28 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
                                                  &contacts};
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
-
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
-               penetration_as_point_pair::Callback<T>);
+    if (parallelism_.num_threads() > 1) {
+      std::vector<std::vector<PenetrationAsPointPair<T>>> results =
+          EvaluateCandidates<std::vector<PenetrationAsPointPair<T>>>(
+              FindCollisionCandidatePairs(), parallelism_.num_threads(),
+              [&](const CandidatePair& candidate,
+                  std::vector<PenetrationAsPointPair<T>>* pair_results) {
+                penetration_as_point_pair::CallbackData pair_data{
+                    &collision_filter_, &X_WGs, pair_results};
+                penetration_as_point_pair::Callback<T>(
+                    candidate.first, candidate.second, &pair_data);
+              });
+      Concatenate(&results, &contacts);
+    } else {
+      // Perform a query of the dynamic objects against themselves.
+      dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
+
+      // Perform a query of the dynamic objects against the anchored. We don't
+      // do anchored against anchored because those pairs are implicitly
+      // filtered.
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 penetration_as_point_pair::Callback<T>);
+    }
 
     std::sort(contacts.begin(), contacts.end(), OrderPointPair<T>);
 
@@ -726,13 +887,33 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
                                        &hydroelastic_geometries_,
                                        representation, &surfaces};
-
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
-
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data, hydroelastic::Callback<T>);
+    PruneCandidateCache();
+    data.candidate_cache = candidate_cache_.get();
+
+    if (parallelism_.num_threads() > 1) {
+      vector<vector<ContactSurface<T>>> results =
+          EvaluateCandidates<vector<ContactSurface<T>>>(
+              FindCollisionCandidatePairs(), parallelism_.num_threads(),
+              [&](const CandidatePair& candidate,
+                  vector<ContactSurface<T>>* pair_surfaces) {
+                hydroelastic::CallbackData<T> pair_data{
+                    &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+                    representation, pair_surfaces};
+                pair_data.candidate_cache = candidate_cache_.get();
+                hydroelastic::Callback<T>(candidate.first, candidate.second,
+                                          &pair_data);
+              });
+      Concatenate(&results, &surfaces);
+    } else {
+      // Perform a query of the dynamic objects against themselves.
+      dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
+
+      // Perform a query of the dynamic objects against the anchored. We don't
+      // do anchored against anchored because those pairs are implicitly
+      // filtered.
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 hydroelastic::Callback<T>);
+    }
 
     std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
 
@@ -755,13 +936,44 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                                       &hydroelastic_geometries_, representation,
                                       surfaces},
         point_pairs};
+    PruneCandidateCache();
+    data.data.candidate_cache = candidate_cache_.get();
+
+    if (parallelism_.num_threads() > 1) {
+      // The contacts found for a single candidate pair.
+      struct PairContacts {
+        std::vector<ContactSurface<T>> surfaces;
+        std::vector<PenetrationAsPointPair<T>> point_pairs;
+      };
+      std::vector<PairContacts> results = EvaluateCandidates<PairContacts>(
+          FindCollisionCandidatePairs(), parallelism_.num_threads(),
+          [&](const CandidatePair& candidate, PairContacts* pair_contacts) {
+            hydroelastic::CallbackWithFallbackData<T> pair_data{
+                hydroelastic::CallbackData<T>{
+                    &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+                    representation, &pair_contacts->surfaces},
+                &pair_contacts->point_pairs};
+            pair_data.data.candidate_cache = candidate_cache_.get();
+            hydroelastic::CallbackWithFallback<T>(
+                candidate.first, candidate.second, &pair_data);
+          });
+      for (PairContacts& pair_contacts : results) {
+        std::move(pair_contacts.surfaces.begin(),
+                  pair_contacts.surfaces.end(),
+                  std::back_inserter(*surfaces));
+        std::move(pair_contacts.point_pairs.begin(),
+                  pair_contacts.point_pairs.end(),
+                  std::back_inserter(*point_pairs));
+      }
+    } else {
+      // Dynamic vs dynamic and dynamic vs anchored represent all the
+      // geometries that we can support with the point-pair fallback. Do those
+      // first.
+      dynamic_tree_.collide(&data, hydroelastic::CallbackWithFallback<T>);
 
-    // Dynamic vs dynamic and dynamic vs anchored represent all the geometries
-    // that we can support with the point-pair fallback. Do those first.
-    dynamic_tree_.collide(&data, hydroelastic::CallbackWithFallback<T>);
-
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
-               hydroelastic::CallbackWithFallback<T>);
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 hydroelastic::CallbackWithFallback<T>);
+    }
 
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
 
@@ -901,6 +1113,46 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // transmogrify them. Otherwise, while the engine can't be transmogrified, the
   // results on an <AutoDiffXd> type will still be double.
 
+  // Returns the unfiltered pairs of dynamic-dynamic and dynamic-anchored
+  // objects whose bounding volumes overlap, in the order in which the
+  // broadphase reports them. Used to evaluate narrowphase collision queries in
+  // parallel.
+  std::vector<CandidatePair> FindCollisionCandidatePairs() const {
+    std::vector<CandidatePair> pairs;
+    CandidateData data{collision_filter_, 0.0, pairs};
+    dynamic_tree_.collide(&data, CollectCollisionCandidate);
+    FclCollide(dynamic_tree_, anchored_tree_, &data,
+               CollectCollisionCandidate);
+    return pairs;
+  }
+
+  // Returns the unfiltered pairs of dynamic-dynamic and dynamic-anchored
+  // objects whose bounding volumes lie within `max_distance`, in the order in
+  // which the broadphase reports them. Used to evaluate narrowphase distance
+  // queries in parallel.
+  std::vector<CandidatePair> FindDistanceCandidates(
+      double max_distance) const {
+    std::vector<CandidatePair> pairs;
+    CandidateData data{collision_filter_, max_distance, pairs};
+    dynamic_tree_.distance(&data, CollectDistanceCandidate);
+    FclDistance(dynamic_tree_, anchored_tree_, &data,
+                CollectDistanceCandidate);
+    return pairs;
+  }
+
+  // Discards the recorded soft-rigid candidates of the geometry with the given
+  // `id`; they index into a hydroelastic representation that no longer exists.
+  void RemoveFromCandidateCache(GeometryId id) {
+    if (candidate_cache_ != nullptr) candidate_cache_->RemoveGeometry(id);
+  }
+
+  // Discards the recorded soft-rigid candidates of pairs that were not queried
+  // by the previous contact surface query (e.g., because they've moved apart),
+  // so that the records don't accumulate over a long simulation.
+  void PruneCandidateCache() const {
+    if (candidate_cache_ != nullptr) candidate_cache_->PruneUnused();
+  }
+
   // Helper method called by the various ImplementGeometry overrides to
   // facilitate the logistics of creating shapes from specifications. `data`
   // is a unique_ptr of an fcl CollisionObject that should be instantiated
@@ -932,6 +1184,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // The number of threads used to evaluate narrowphase queries.
+  // @see ProximityEngine::set_parallelism() for more details.
+  Parallelism parallelism_;
+
+  // The temporal-coherence cache for soft-volume vs rigid-surface contact;
+  // null when disabled. Although the queries that use it are const, the cache
+  // is not part of the engine's logical state.
+  // @see ProximityEngine::set_hydroelastic_candidate_margin().
+  std::unique_ptr<SoftRigidCandidateCache> candidate_cache_;
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
@@ -1048,6 +1310,26 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_parallelism(Parallelism parallelism) {
+  impl_->set_parallelism(parallelism);
+}
+
+template <typename T>
+Parallelism ProximityEngine<T>::parallelism() const {
+  return impl_->parallelism();
+}
+
+template <typename T>
+void ProximityEngine<T>::set_hydroelastic_candidate_margin(double margin) {
+  impl_->set_hydroelastic_candidate_margin(margin);
+}
+
+template <typename T>
+double ProximityEngine<T>::hydroelastic_candidate_margin() const {
+  return impl_->hydroelastic_candidate_margin();
+}
+
 template <typename T>
 template <typename U>
 std::unique_ptr<ProximityEngine<U>> ProximityEngine<T>::ToScalarType() const {
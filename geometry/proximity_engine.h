@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -170,6 +171,40 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Sets the degree of parallelism used to evaluate the narrowphase of
+   ComputeSignedDistancePairwiseClosestPoints(), ComputePointPairPenetration(),
+   ComputeContactSurfaces() and ComputeContactSurfacesWithFallback(). By
+   default, queries run on a single thread.
+
+   When more than one thread is requested, the broadphase first collects all
+   candidate pairs of geometries and the candidates are then evaluated
+   concurrently. The results are identical to (and in the same order as) the
+   single-threaded results. Parallel evaluation requires Drake to be built
+   with OpenMP enabled; otherwise candidates are evaluated sequentially. */
+  void set_parallelism(Parallelism parallelism);
+
+  Parallelism parallelism() const;
+
+  /* Sets the margin δ (in meters) of the temporal-coherence cache used by
+   ComputeContactSurfaces() and ComputeContactSurfacesWithFallback() for
+   contact between soft volumes and rigid surface meshes. For each such pair,
+   the candidate (tetrahedron, triangle) pairs found by the bounding volume
+   hierarchy traversal are recorded and reused by later queries as long as
+   the pair's relative pose moves no point of the rigid geometry by more than
+   δ. Larger margins produce more candidates per traversal but repeat the
+   traversal less often; they are best suited to quasi-static contact.
+
+   The computed contact surfaces are identical with or without the cache. A
+   margin of zero (the default) disables the cache. Each query discards the
+   records of pairs that the previous query did not reach, and the records of
+   a geometry are discarded when it is removed or its properties change. The
+   cache may be used by concurrent queries. Copies of the engine start with an
+   empty cache.
+   @throws std::exception if `margin` is negative or not finite.  */
+  void set_hydroelastic_candidate_margin(double margin);
+
+  double hydroelastic_candidate_margin() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -370,6 +370,50 @@ CollisionFilterManager SceneGraph<T>::collision_filter_manager(
   return mutable_geometry_state(context).collision_filter_manager();
 }
 
+template <typename T>
+void SceneGraph<T>::set_proximity_parallelism(Parallelism parallelism) {
+  model_.set_proximity_parallelism(parallelism);
+}
+
+template <typename T>
+void SceneGraph<T>::set_proximity_parallelism(Context<T>* context,
+                                              Parallelism parallelism) const {
+  mutable_geometry_state(context).set_proximity_parallelism(parallelism);
+}
+
+template <typename T>
+Parallelism SceneGraph<T>::get_proximity_parallelism() const {
+  return model_.get_proximity_parallelism();
+}
+
+template <typename T>
+Parallelism SceneGraph<T>::get_proximity_parallelism(
+    const Context<T>& context) const {
+  return geometry_state(context).get_proximity_parallelism();
+}
+
+template <typename T>
+void SceneGraph<T>::set_hydroelastic_candidate_margin(double margin) {
+  model_.set_hydroelastic_candidate_margin(margin);
+}
+
+template <typename T>
+void SceneGraph<T>::set_hydroelastic_candidate_margin(Context<T>* context,
+                                                      double margin) const {
+  mutable_geometry_state(context).set_hydroelastic_candidate_margin(margin);
+}
+
+template <typename T>
+double SceneGraph<T>::get_hydroelastic_candidate_margin() const {
+  return model_.get_hydroelastic_candidate_margin();
+}
+
+template <typename T>
+double SceneGraph<T>::get_hydroelastic_candidate_margin(
+    const Context<T>& context) const {
+  return geometry_state(context).get_hydroelastic_candidate_margin();
+}
+
 template <typename T>
 void SceneGraph<T>::SetDefaultParameters(const Context<T>& context,
                                          Parameters<T>* parameters) const {
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_set.h"
@@ -945,6 +946,73 @@ class SceneGraph final : public systems::LeafSystem<T> {
       systems::Context<T>* context) const;
   //@}
 
+  /** @name         Proximity query settings
+
+   These settings tune how proximity queries are evaluated without changing
+   their results. As with other geometry data, they can be configured in
+   %SceneGraph's *model* (and are then copied into every subsequently
+   allocated Context) or in the copy stored in a particular Context.  */
+  //@{
+
+  /** Sets the degree of parallelism used to evaluate the narrowphase of
+   QueryObject::ComputeSignedDistancePairwiseClosestPoints(),
+   QueryObject::ComputePointPairPenetration(),
+   QueryObject::ComputeContactSurfaces() and
+   QueryObject::ComputeContactSurfacesWithFallback() for this %SceneGraph
+   instance's *model*. By default, queries run on a single thread.
+
+   When more than one thread is requested, the candidate pairs of geometries
+   are evaluated concurrently. The results are identical to (and in the same
+   order as) the single-threaded results. Parallel evaluation requires Drake to
+   be built with OpenMP enabled; otherwise candidates are evaluated
+   sequentially.  */
+  void set_proximity_parallelism(Parallelism parallelism);
+
+  /** systems::Context-modifying variant of set_proximity_parallelism(). Rather
+   than modifying %SceneGraph's model, it modifies the copy of the model stored
+   in the provided context.  */
+  void set_proximity_parallelism(systems::Context<T>* context,
+                                 Parallelism parallelism) const;
+
+  /** Reports the proximity query parallelism of this %SceneGraph instance's
+   *model*.  */
+  Parallelism get_proximity_parallelism() const;
+
+  /** Reports the proximity query parallelism of the data stored in
+   `context`.  */
+  Parallelism get_proximity_parallelism(
+      const systems::Context<T>& context) const;
+
+  /** Sets the margin δ (in meters) used by
+   QueryObject::ComputeContactSurfaces() and
+   QueryObject::ComputeContactSurfacesWithFallback() to reuse work across
+   queries for contact between soft volumes and rigid surface meshes in this
+   %SceneGraph instance's *model*. For each such pair, the candidate pairs of
+   mesh elements found by the bounding volume hierarchy traversal are recorded
+   and reused as long as the pair's relative pose moves no point of the rigid
+   geometry by more than δ. Larger margins repeat the traversal less often but
+   test more candidates; they are best suited to quasi-static contact. The
+   computed contact surfaces are identical for any margin. A margin of zero
+   (the default) disables the reuse.
+   @throws std::exception if `margin` is negative or not finite.  */
+  void set_hydroelastic_candidate_margin(double margin);
+
+  /** systems::Context-modifying variant of
+   set_hydroelastic_candidate_margin(). Rather than modifying %SceneGraph's
+   model, it modifies the copy of the model stored in the provided context.  */
+  void set_hydroelastic_candidate_margin(systems::Context<T>* context,
+                                         double margin) const;
+
+  /** Reports the hydroelastic candidate margin of this %SceneGraph instance's
+   *model*.  */
+  double get_hydroelastic_candidate_margin() const;
+
+  /** Reports the hydroelastic candidate margin of the data stored in
+   `context`.  */
+  double get_hydroelastic_candidate_margin(
+      const systems::Context<T>& context) const;
+  //@}
+
  private:
   // Friend class to facilitate testing.
   friend class SceneGraphTester;
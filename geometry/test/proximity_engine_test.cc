@@ -1924,6 +1924,62 @@ GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairResultOrdering) {
   }
 }
 
+// Confirms that evaluating the narrowphase of point-pair penetration and
+// signed distance queries in parallel reports exactly the same results, in
+// the same order, as the serial evaluation.
+GTEST_TEST(ProximityEngineTests, ParallelPenetrationAndDistance) {
+  ProximityEngine<double> serial;
+  EXPECT_EQ(serial.parallelism().num_threads(), 1);
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 8);
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    serial.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  // The anchored box lies below, but not touching, the ring of spheres.
+  const RigidTransformd X_WA(Vector3d(0, 0, -1.2));
+  serial.AddAnchoredGeometry(Box(10, 10, 1), X_WA, anchored_id);
+  poses[anchored_id] = X_WA;
+  serial.UpdateWorldPoses(poses);
+
+  ProximityEngine<double> parallel(serial);
+  parallel.set_parallelism(Parallelism(3));
+  EXPECT_EQ(parallel.parallelism().num_threads(), 3);
+  // Copies preserve the parallelism.
+  EXPECT_EQ(ProximityEngine<double>(parallel).parallelism().num_threads(), 3);
+
+  const auto expected_contacts = serial.ComputePointPairPenetration(poses);
+  const auto contacts = parallel.ComputePointPairPenetration(poses);
+  ASSERT_EQ(contacts.size(), expected_contacts.size());
+  ASSERT_FALSE(contacts.empty());
+  for (size_t i = 0; i < contacts.size(); ++i) {
+    EXPECT_EQ(contacts[i].id_A, expected_contacts[i].id_A);
+    EXPECT_EQ(contacts[i].id_B, expected_contacts[i].id_B);
+    EXPECT_EQ(contacts[i].depth, expected_contacts[i].depth);
+    EXPECT_TRUE(CompareMatrices(contacts[i].nhat_BA_W,
+                                expected_contacts[i].nhat_BA_W));
+  }
+
+  const double max_distance = 0.25;
+  const auto expected_distances =
+      serial.ComputeSignedDistancePairwiseClosestPoints(poses, max_distance);
+  const auto distances =
+      parallel.ComputeSignedDistancePairwiseClosestPoints(poses, max_distance);
+  ASSERT_EQ(distances.size(), expected_distances.size());
+  ASSERT_FALSE(distances.empty());
+  for (size_t i = 0; i < distances.size(); ++i) {
+    EXPECT_EQ(distances[i].id_A, expected_distances[i].id_A);
+    EXPECT_EQ(distances[i].id_B, expected_distances[i].id_B);
+    EXPECT_EQ(distances[i].distance, expected_distances[i].distance);
+    EXPECT_TRUE(
+        CompareMatrices(distances[i].p_ACa, expected_distances[i].p_ACa));
+    EXPECT_TRUE(
+        CompareMatrices(distances[i].p_BCb, expected_distances[i].p_BCb));
+  }
+}
+
 // Confirms that the FindCollisionCandidates() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2009,6 +2065,80 @@ TEST_F(ProximityEngineHydro, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// Confirms that parallel evaluation of the narrowphase produces the same
+// contact surfaces as the serial evaluation.
+TEST_F(ProximityEngineHydro, ParallelComputeContactSurfaces) {
+  engine_.UpdateWorldPoses(poses_);
+  const auto expected = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kTriangle, poses_);
+
+  engine_.set_parallelism(Parallelism(2));
+  const auto results = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kTriangle, poses_);
+  ASSERT_EQ(results.size(), expected.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(results[i].id_M(), expected[i].id_M());
+    EXPECT_EQ(results[i].id_N(), expected[i].id_N());
+    EXPECT_EQ(results[i].num_faces(), expected[i].num_faces());
+    EXPECT_EQ(results[i].total_area(), expected[i].total_area());
+  }
+}
+
+// Errors raised while evaluating candidates in parallel must propagate to the
+// caller just as they do in serial evaluation.
+TEST_F(ProximityEngineHydro, ParallelComputeContactSurfacesThrows) {
+  // A pair of rigid spheres in contact is not supported by strict
+  // hydroelastics.
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(0.5, &rigid_properties);
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  ProximityEngine<double> engine;
+  engine.AddDynamicGeometry(Sphere(0.5), {}, id_A, rigid_properties);
+  engine.AddDynamicGeometry(Sphere(0.5), {}, id_B, rigid_properties);
+  const unordered_map<GeometryId, RigidTransformd> poses{
+      {id_A, RigidTransformd::Identity()},
+      {id_B, RigidTransformd(Vector3d(0.5, 0, 0))}};
+  engine.UpdateWorldPoses(poses);
+  engine.set_parallelism(Parallelism(2));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.ComputeContactSurfaces(
+          HydroelasticContactRepresentation::kTriangle, poses),
+      "Requested contact between two rigid objects .*");
+}
+
+// Confirms that enabling the soft-rigid candidate cache leaves the contact
+// surfaces unchanged, both when the cache is populated and when it is reused.
+TEST_F(ProximityEngineHydro, CandidateCacheComputeContactSurfaces) {
+  EXPECT_EQ(engine_.hydroelastic_candidate_margin(), 0.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(engine_.set_hydroelastic_candidate_margin(-1),
+                              ".*margin >= 0.*");
+
+  engine_.UpdateWorldPoses(poses_);
+  const auto expected = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kPolygon, poses_);
+
+  engine_.set_hydroelastic_candidate_margin(1e-3);
+  EXPECT_EQ(engine_.hydroelastic_candidate_margin(), 1e-3);
+  for (int i = 0; i < 2; ++i) {
+    const auto results = engine_.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kPolygon, poses_);
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t j = 0; j < results.size(); ++j) {
+      EXPECT_TRUE(results[j].Equal(expected[j]));
+    }
+  }
+
+  // Copies and scalar conversions preserve the margin.
+  const ProximityEngine<double> copy(engine_);
+  EXPECT_EQ(copy.hydroelastic_candidate_margin(), 1e-3);
+  EXPECT_EQ(engine_.ToScalarType<AutoDiffXd>()->hydroelastic_candidate_margin(),
+            1e-3);
+
+  engine_.set_hydroelastic_candidate_margin(0);
+  EXPECT_EQ(engine_.hydroelastic_candidate_margin(), 0.0);
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2095,6 +2225,37 @@ TEST_F(ProximityEngineHydroWithFallback,
   }
 }
 
+// Confirms that parallel evaluation of the narrowphase produces the same
+// contact surfaces and point pairs as the serial evaluation.
+TEST_F(ProximityEngineHydroWithFallback,
+       ParallelComputeContactSurfacesWithFallback) {
+  engine_.UpdateWorldPoses(poses_);
+  vector<ContactSurface<double>> expected_surfaces;
+  vector<PenetrationAsPointPair<double>> expected_points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &expected_surfaces,
+      &expected_points);
+
+  engine_.set_parallelism(Parallelism(3));
+  vector<ContactSurface<double>> surfaces;
+  vector<PenetrationAsPointPair<double>> points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &surfaces,
+      &points);
+  ASSERT_EQ(surfaces.size(), expected_surfaces.size());
+  ASSERT_EQ(points.size(), expected_points.size());
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    EXPECT_EQ(surfaces[i].id_M(), expected_surfaces[i].id_M());
+    EXPECT_EQ(surfaces[i].id_N(), expected_surfaces[i].id_N());
+    EXPECT_EQ(surfaces[i].total_area(), expected_surfaces[i].total_area());
+  }
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(points[i].id_A, expected_points[i].id_A);
+    EXPECT_EQ(points[i].id_B, expected_points[i].id_B);
+    EXPECT_EQ(points[i].depth, expected_points[i].depth);
+  }
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
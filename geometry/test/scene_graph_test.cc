@@ -15,6 +15,7 @@
 #include "drake/geometry/geometry_set.h"
 #include "drake/geometry/geometry_state.h"
 #include "drake/geometry/make_mesh_for_deformable.h"
+#include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/render/render_label.h"
 #include "drake/geometry/shape_specification.h"
@@ -859,6 +860,114 @@ GTEST_TEST(SceneGraphContextModifier, RegisterGeometry) {
       "Referenced geometry \\d+ has not been registered.");
 }
 
+// The proximity query parallelism can be configured in the model (and is
+// inherited by new contexts) or in a context, and doesn't change the results
+// of queries made through the QueryObject.
+GTEST_TEST(SceneGraphProximitySettingsTest, Parallelism) {
+  SceneGraph<double> scene_graph;
+  EXPECT_EQ(scene_graph.get_proximity_parallelism().num_threads(), 1);
+
+  // An anchored sphere at the origin penetrates a dynamic sphere at x = 1.5.
+  const SourceId source_id = scene_graph.RegisterSource("source");
+  const FrameId frame_id =
+      scene_graph.RegisterFrame(source_id, GeometryFrame("frame"));
+  const GeometryId anchored_id =
+      scene_graph.RegisterAnchoredGeometry(source_id, make_sphere_instance());
+  const GeometryId dynamic_id =
+      scene_graph.RegisterGeometry(source_id, frame_id, make_sphere_instance());
+  for (const GeometryId id : {anchored_id, dynamic_id}) {
+    scene_graph.AssignRole(source_id, id, ProximityProperties());
+  }
+
+  scene_graph.set_proximity_parallelism(Parallelism(2));
+  EXPECT_EQ(scene_graph.get_proximity_parallelism().num_threads(), 2);
+  auto context = scene_graph.CreateDefaultContext();
+  EXPECT_EQ(scene_graph.get_proximity_parallelism(*context).num_threads(), 2);
+  const RigidTransformd X_WF(Eigen::Vector3d(1.5, 0, 0));
+  scene_graph.get_source_pose_port(source_id).FixValue(
+      context.get(), FramePoseVector<double>{{frame_id, X_WF}});
+
+  const auto& query_object =
+      scene_graph.get_query_output_port().Eval<QueryObject<double>>(*context);
+  const std::vector<PenetrationAsPointPair<double>> parallel_results =
+      query_object.ComputePointPairPenetration();
+  ASSERT_EQ(parallel_results.size(), 1);
+  EXPECT_NEAR(parallel_results[0].depth, 0.5, 1e-14);
+
+  // Changing the context leaves the model alone.
+  scene_graph.set_proximity_parallelism(context.get(), Parallelism::None());
+  EXPECT_EQ(scene_graph.get_proximity_parallelism(*context).num_threads(), 1);
+  EXPECT_EQ(scene_graph.get_proximity_parallelism().num_threads(), 2);
+  const auto& serial_query_object =
+      scene_graph.get_query_output_port().Eval<QueryObject<double>>(*context);
+  const std::vector<PenetrationAsPointPair<double>> serial_results =
+      serial_query_object.ComputePointPairPenetration();
+  ASSERT_EQ(serial_results.size(), 1);
+  EXPECT_EQ(serial_results[0].id_A, parallel_results[0].id_A);
+  EXPECT_EQ(serial_results[0].id_B, parallel_results[0].id_B);
+  EXPECT_EQ(serial_results[0].depth, parallel_results[0].depth);
+}
+
+// The hydroelastic candidate margin can be configured in the model (and is
+// inherited by new contexts) or in a context, and doesn't change the contact
+// surfaces reported by the QueryObject.
+GTEST_TEST(SceneGraphProximitySettingsTest, HydroelasticCandidateMargin) {
+  SceneGraph<double> scene_graph;
+  EXPECT_EQ(scene_graph.get_hydroelastic_candidate_margin(), 0.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      scene_graph.set_hydroelastic_candidate_margin(-1.0), ".*margin.*");
+
+  // An anchored soft sphere at the origin penetrates a dynamic rigid box
+  // centered at x = 1.25.
+  const SourceId source_id = scene_graph.RegisterSource("source");
+  const FrameId frame_id =
+      scene_graph.RegisterFrame(source_id, GeometryFrame("frame"));
+  const GeometryId soft_id =
+      scene_graph.RegisterAnchoredGeometry(source_id, make_sphere_instance());
+  ProximityProperties soft_properties;
+  AddCompliantHydroelasticProperties(0.25, 1e5, &soft_properties);
+  scene_graph.AssignRole(source_id, soft_id, soft_properties);
+  const GeometryId rigid_id = scene_graph.RegisterGeometry(
+      source_id, frame_id,
+      make_unique<GeometryInstance>(RigidTransformd::Identity(),
+                                    make_unique<Box>(1.0, 1.0, 1.0), "box"));
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(0.25, &rigid_properties);
+  scene_graph.AssignRole(source_id, rigid_id, rigid_properties);
+
+  scene_graph.set_hydroelastic_candidate_margin(1e-3);
+  EXPECT_EQ(scene_graph.get_hydroelastic_candidate_margin(), 1e-3);
+  auto cached_context = scene_graph.CreateDefaultContext();
+  EXPECT_EQ(scene_graph.get_hydroelastic_candidate_margin(*cached_context),
+            1e-3);
+  auto uncached_context = scene_graph.CreateDefaultContext();
+  scene_graph.set_hydroelastic_candidate_margin(uncached_context.get(), 0.0);
+  EXPECT_EQ(scene_graph.get_hydroelastic_candidate_margin(*uncached_context),
+            0.0);
+  EXPECT_EQ(scene_graph.get_hydroelastic_candidate_margin(), 1e-3);
+
+  auto compute_surfaces = [&](const RigidTransformd& X_WF,
+                              Context<double>* context) {
+    scene_graph.get_source_pose_port(source_id).FixValue(
+        context, FramePoseVector<double>{{frame_id, X_WF}});
+    return scene_graph.get_query_output_port()
+        .Eval<QueryObject<double>>(*context)
+        .ComputeContactSurfaces(HydroelasticContactRepresentation::kPolygon);
+  };
+
+  // A sequence of small motions, queried in both contexts.
+  for (int i = 0; i < 3; ++i) {
+    const RigidTransformd X_WF(Eigen::Vector3d(1.25 - 1e-4 * i, 0, 0));
+    const std::vector<ContactSurface<double>> cached =
+        compute_surfaces(X_WF, cached_context.get());
+    const std::vector<ContactSurface<double>> uncached =
+        compute_surfaces(X_WF, uncached_context.get());
+    ASSERT_EQ(cached.size(), 1);
+    ASSERT_EQ(uncached.size(), 1);
+    EXPECT_TRUE(cached[0].Equal(uncached[0]));
+  }
+}
+
 // A limited test -- the majority of this functionality is encoded in and tested
 // via GeometryState. This is just a regression test to make sure SceneGraph's
 // invocation of that function doesn't become corrupt.
@@ -0,0 +1,134 @@
+// @file
+// Benchmarks for the SAP discrete update of a pile of objects.
+//
+// This measures how the time spent in the SAP solver scales with the number of
+// threads used by its supernodal algebra on a scene with many contacts.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/common/parallelism.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/contact_solvers/sap/sap_solver.h"
+#include "drake/multibody/plant/compliant_contact_manager.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using contact_solvers::internal::SapSolverParameters;
+using Eigen::Vector3d;
+using geometry::ProximityProperties;
+using geometry::Sphere;
+using internal::CompliantContactManager;
+using math::RigidTransformd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+using systems::DiscreteValues;
+
+// We use this alias to silence cpplint barking at mutable references.
+using BenchmarkStateRef = benchmark::State&;
+
+// A pile of spheres resting on the ground, arranged in rows of stacks. The
+// stacks in a row lean on one another, while the rows are separated. The
+// benchmark's argument is the number of threads used by the SAP solver.
+class SapPile : public benchmark::Fixture {
+ public:
+  SapPile() { tools::performance::AddMinMaxStatistics(this); }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(BenchmarkStateRef state) override {
+    const int kNumRows = 6;
+    const int kNumStacksPerRow = 4;
+    const int kStackHeight = 5;
+    const double kRadius = 0.05;
+    // Neighboring spheres overlap slightly so that every contact is active.
+    const double kSpacing = 2 * kRadius - 1e-4;
+
+    positions_.clear();
+    DiagramBuilder<double> builder;
+    auto items = AddMultibodyPlantSceneGraph(&builder, 0.01);
+    plant_ = &items.plant;
+    plant_->set_discrete_contact_solver(DiscreteContactSolver::kSap);
+
+    ProximityProperties properties;
+    geometry::AddContactMaterial({}, {}, CoulombFriction<double>(0.5, 0.5),
+                                 &properties);
+    plant_->RegisterCollisionGeometry(
+        plant_->world_body(), RigidTransformd(Vector3d(0, 0, -0.5)),
+        geometry::Box(10, 10, 1), "ground", properties);
+    for (int row = 0; row < kNumRows; ++row) {
+      for (int stack = 0; stack < kNumStacksPerRow; ++stack) {
+        for (int level = 0; level < kStackHeight; ++level) {
+          const RigidBody<double>& body = plant_->AddRigidBody(
+              fmt::format("sphere_{}_{}_{}", row, stack, level),
+              SpatialInertia<double>::SolidSphereWithMass(0.1, kRadius));
+          plant_->RegisterCollisionGeometry(body, RigidTransformd::Identity(),
+                                            Sphere(kRadius), body.name(),
+                                            properties);
+          positions_.emplace_back(stack * kSpacing, row * 4 * kRadius,
+                                  kRadius + level * kSpacing);
+        }
+      }
+    }
+    plant_->Finalize();
+
+    auto manager = std::make_unique<CompliantContactManager<double>>();
+    SapSolverParameters parameters;
+    parameters.parallelism = Parallelism(static_cast<int>(state.range(0)));
+    manager->set_sap_solver_parameters(parameters);
+    plant_->SetDiscreteUpdateManager(std::move(manager));
+
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+    discrete_values_ = diagram_->AllocateDiscreteVariables();
+  }
+
+ protected:
+  // Places the spheres back in the pile, which also invalidates the cached
+  // contact results.
+  void ResetPile() {
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(context_.get());
+    for (BodyIndex i(1); i < plant_->num_bodies(); ++i) {
+      plant_->SetFreeBodyPose(&plant_context, plant_->get_body(i),
+                              RigidTransformd(positions_[i - 1]));
+    }
+  }
+
+  MultibodyPlant<double>* plant_{};
+  std::vector<Vector3d> positions_;
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<DiscreteValues<double>> discrete_values_;
+};
+
+BENCHMARK_DEFINE_F(SapPile, DiscreteUpdate)(BenchmarkStateRef state) {
+  for (auto _ : state) {
+    ResetPile();
+    diagram_->CalcForcedDiscreteVariableUpdate(*context_,
+                                               discrete_values_.get());
+  }
+}
+BENCHMARK_REGISTER_F(SapPile, DiscreteUpdate)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
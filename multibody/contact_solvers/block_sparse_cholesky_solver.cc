@@ -0,0 +1,299 @@
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <stdexcept>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/ssize.h"
+#include "drake/common/unused.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+using Eigen::MatrixXd;
+
+namespace {
+
+/* Runs `func(item)` for each item in `items` on up to `num_threads` threads.
+ */
+template <typename Func>
+void ForEachInParallel(const std::vector<int>& items, int num_threads,
+                       const Func& func) {
+  const int num_items = ssize(items);
+  // Levels close to the root of the elimination tree often hold a single
+  // column, for which it is not worth spinning up a team of threads.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic) \
+    if (num_items > 1)
+#endif
+  for (int i = 0; i < num_items; ++i) {
+    func(items[i]);
+  }
+  unused(num_threads);
+}
+
+}  // namespace
+
+BlockSparseCholeskySolver::BlockSparseCholeskySolver(
+    const BlockSparsityPattern& sparsity_pattern, Parallelism parallelism)
+    : parallelism_(parallelism),
+      block_sizes_(sparsity_pattern.block_sizes()) {
+  const int n = ssize(block_sizes_);
+  const std::vector<std::vector<int>>& neighbors = sparsity_pattern.neighbors();
+
+  starting_cols_.resize(n);
+  for (int j = 0; j < n; ++j) {
+    starting_cols_[j] = size_;
+    size_ += block_sizes_[j];
+  }
+
+  // The (symmetric) graph of blocks.
+  std::vector<std::set<int>> adjacency(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i : neighbors[j]) {
+      if (i == j) continue;
+      adjacency[i].insert(j);
+      adjacency[j].insert(i);
+    }
+  }
+
+  // Greedy minimum degree ordering. Eliminating a block connects all of its
+  // remaining neighbors to one another (fill-in); those neighbors are the
+  // nonzero blocks below the diagonal in the block's column of L.
+  auto calc_degree = [this, &adjacency](int v) {
+    int degree = 0;
+    for (int u : adjacency[v]) degree += block_sizes_[u];
+    return degree;
+  };
+  std::vector<int> degree(n);
+  std::set<std::pair<int, int>> queue;
+  for (int v = 0; v < n; ++v) {
+    degree[v] = calc_degree(v);
+    queue.emplace(degree[v], v);
+  }
+  std::vector<std::vector<int>> eliminated_neighbors(n);
+  elimination_order_.reserve(n);
+  while (!queue.empty()) {
+    const int v = queue.begin()->second;
+    queue.erase(queue.begin());
+    elimination_order_.push_back(v);
+    std::vector<int>& clique = eliminated_neighbors[v];
+    clique.assign(adjacency[v].begin(), adjacency[v].end());
+    for (int u : clique) {
+      adjacency[u].erase(v);
+      adjacency[u].insert(clique.begin(), clique.end());
+      adjacency[u].erase(u);
+    }
+    for (int u : clique) {
+      queue.erase({degree[u], u});
+      degree[u] = calc_degree(u);
+      queue.emplace(degree[u], u);
+    }
+    adjacency[v].clear();
+  }
+  block_to_column_.resize(n);
+  for (int k = 0; k < n; ++k) {
+    block_to_column_[elimination_order_[k]] = k;
+  }
+
+  // The sparsity pattern of L, in the permuted order.
+  std::vector<int> permuted_block_sizes(n);
+  std::vector<std::vector<int>> L_neighbors(n);
+  for (int k = 0; k < n; ++k) {
+    const int v = elimination_order_[k];
+    permuted_block_sizes[k] = block_sizes_[v];
+    L_neighbors[k].push_back(k);
+    for (int u : eliminated_neighbors[v]) {
+      L_neighbors[k].push_back(block_to_column_[u]);
+    }
+  }
+  L_ = std::make_unique<BlockSparseLowerTriangularMatrix>(BlockSparsityPattern(
+      std::move(permuted_block_sizes), std::move(L_neighbors)));
+
+  // Where each block of A lands in L.
+  auto flat_index = [this](int i, int k) {
+    const std::vector<int>& rows = L_->block_row_indices(k);
+    const auto it = std::lower_bound(rows.begin(), rows.end(), i);
+    DRAKE_DEMAND(it != rows.end() && *it == i);
+    return static_cast<int>(it - rows.begin());
+  };
+  a_to_l_.resize(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i : neighbors[j]) {
+      const int ki = block_to_column_[i];
+      const int kj = block_to_column_[j];
+      if (ki >= kj) {
+        a_to_l_[j].push_back({kj, flat_index(ki, kj), false});
+      } else {
+        a_to_l_[j].push_back({ki, flat_index(kj, ki), true});
+      }
+    }
+  }
+
+  // The row structure of L, and the levels of its elimination tree. The
+  // parent of column k is the first row below the diagonal in that column.
+  row_structure_.resize(n);
+  std::vector<int> level(n, 0);
+  int num_levels = 0;
+  for (int k = 0; k < n; ++k) {
+    const std::vector<int>& rows = L_->block_row_indices(k);
+    for (int flat = 1; flat < ssize(rows); ++flat) {
+      row_structure_[rows[flat]].emplace_back(k, flat);
+    }
+    if (ssize(rows) > 1) {
+      level[rows[1]] = std::max(level[rows[1]], level[k] + 1);
+    }
+    num_levels = std::max(num_levels, level[k] + 1);
+  }
+  levels_.resize(num_levels);
+  for (int k = 0; k < n; ++k) {
+    levels_[level[k]].push_back(k);
+  }
+}
+
+BlockSparseCholeskySolver::~BlockSparseCholeskySolver() = default;
+
+void BlockSparseCholeskySolver::SetMatrix(const BlockSparseSymmetricMatrix& A) {
+  if (A.sparsity_pattern().block_sizes() != block_sizes_ ||
+      ssize(A.sparsity_pattern().neighbors()) != ssize(a_to_l_)) {
+    throw std::logic_error(
+        "BlockSparseCholeskySolver::SetMatrix(): the sparsity pattern of the "
+        "matrix differs from the one given at construction.");
+  }
+  L_->SetZero();
+  for (int j = 0; j < ssize(a_to_l_); ++j) {
+    const std::vector<int>& rows = A.block_row_indices(j);
+    if (ssize(rows) != ssize(a_to_l_[j])) {
+      throw std::logic_error(
+          "BlockSparseCholeskySolver::SetMatrix(): the sparsity pattern of "
+          "the matrix differs from the one given at construction.");
+    }
+    for (int flat = 0; flat < ssize(rows); ++flat) {
+      const BlockLocation& location = a_to_l_[j][flat];
+      MatrixXd& L_block =
+          L_->mutable_block_flat(location.flat, location.column);
+      if (location.transpose) {
+        L_block = A.block_flat(flat, j).transpose();
+      } else {
+        L_block = A.block_flat(flat, j);
+      }
+    }
+  }
+  matrix_ready_ = true;
+  factorization_ready_ = false;
+}
+
+bool BlockSparseCholeskySolver::FactorColumn(int k) {
+  const std::vector<int>& rows = L_->block_row_indices(k);
+  MatrixXd& L_kk = L_->mutable_block_flat(0, k);
+
+  // Left-looking update with the columns j of the descendants of k:
+  //   L_kk ← A_kk − ∑ⱼ L_kj⋅L_kjᵀ,  L_ik ← A_ik − ∑ⱼ L_ij⋅L_kjᵀ.
+  for (const auto& [j, flat_kj] : row_structure_[k]) {
+    const MatrixXd& L_kj = L_->block_flat(flat_kj, j);
+    L_kk.noalias() -= L_kj * L_kj.transpose();
+    // The rows of column j below row k are also rows of column k. Both lists
+    // of rows are sorted, so we walk them together.
+    const std::vector<int>& rows_j = L_->block_row_indices(j);
+    int flat_ik = 1;
+    for (int flat_ij = flat_kj + 1; flat_ij < ssize(rows_j); ++flat_ij) {
+      while (rows[flat_ik] != rows_j[flat_ij]) {
+        ++flat_ik;
+        DRAKE_ASSERT(flat_ik < ssize(rows));
+      }
+      L_->mutable_block_flat(flat_ik, k).noalias() -=
+          L_->block_flat(flat_ij, j) * L_kj.transpose();
+    }
+  }
+
+  Eigen::LLT<Eigen::Ref<MatrixXd>> llt(L_kk);
+  if (llt.info() != Eigen::Success) return false;
+  L_kk.triangularView<Eigen::StrictlyUpper>().setZero();
+  // L_ik ← L_ik⋅L_kk⁻ᵀ.
+  const auto L_kk_transpose = L_kk.transpose().triangularView<Eigen::Upper>();
+  for (int flat = 1; flat < ssize(rows); ++flat) {
+    L_kk_transpose.solveInPlace<Eigen::OnTheRight>(
+        L_->mutable_block_flat(flat, k));
+  }
+  return true;
+}
+
+bool BlockSparseCholeskySolver::Factor() {
+  if (!matrix_ready_) {
+    throw std::logic_error(
+        "BlockSparseCholeskySolver::Factor(): the matrix is not set; call "
+        "SetMatrix() first.");
+  }
+  matrix_ready_ = false;
+  std::atomic<bool> success{true};
+  for (const std::vector<int>& level : levels_) {
+    ForEachInParallel(level, parallelism_.num_threads(), [&](int k) {
+      if (!FactorColumn(k)) success = false;
+    });
+    if (!success) break;
+  }
+  factorization_ready_ = success;
+  return factorization_ready_;
+}
+
+void BlockSparseCholeskySolver::SolveInPlace(VectorX<double>* b) const {
+  DRAKE_THROW_UNLESS(b != nullptr);
+  DRAKE_THROW_UNLESS(b->size() == size_);
+  if (!factorization_ready_) {
+    throw std::logic_error(
+        "BlockSparseCholeskySolver::SolveInPlace(): the matrix has not been "
+        "successfully factored.");
+  }
+  const int n = ssize(block_sizes_);
+  const std::vector<int>& permuted_starting_cols = L_->starting_cols();
+  VectorX<double> y(size_);
+  for (int k = 0; k < n; ++k) {
+    const int v = elimination_order_[k];
+    y.segment(permuted_starting_cols[k], block_sizes_[v]) =
+        b->segment(starting_cols_[v], block_sizes_[v]);
+  }
+  auto segment = [&](int k) {
+    return y.segment(permuted_starting_cols[k],
+                     block_sizes_[elimination_order_[k]]);
+  };
+
+  // Forward substitution L⋅z = y, from the leaves up.
+  for (const std::vector<int>& level : levels_) {
+    ForEachInParallel(level, parallelism_.num_threads(), [&](int k) {
+      auto y_k = segment(k);
+      for (const auto& [j, flat_kj] : row_structure_[k]) {
+        y_k.noalias() -= L_->block_flat(flat_kj, j) * segment(j);
+      }
+      L_->diagonal_block(k).triangularView<Eigen::Lower>().solveInPlace(y_k);
+    });
+  }
+  // Backward substitution Lᵀ⋅x = z, from the root down.
+  for (auto level = levels_.rbegin(); level != levels_.rend(); ++level) {
+    ForEachInParallel(*level, parallelism_.num_threads(), [&](int k) {
+      auto y_k = segment(k);
+      const std::vector<int>& rows = L_->block_row_indices(k);
+      for (int flat = 1; flat < ssize(rows); ++flat) {
+        y_k.noalias() -=
+            L_->block_flat(flat, k).transpose() * segment(rows[flat]);
+      }
+      L_->diagonal_block(k).transpose().triangularView<Eigen::Upper>()
+          .solveInPlace(y_k);
+    });
+  }
+
+  for (int k = 0; k < n; ++k) {
+    const int v = elimination_order_[k];
+    b->segment(starting_cols_[v], block_sizes_[v]) =
+        y.segment(permuted_starting_cols[k], block_sizes_[v]);
+  }
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
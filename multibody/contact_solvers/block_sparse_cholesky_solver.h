@@ -0,0 +1,123 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+/* Solves A⋅x = b for a symmetric positive definite block sparse matrix A
+ using the block Cholesky factorization Pᵀ⋅A⋅P = L⋅Lᵀ, where L is block lower
+ triangular and P is a block permutation chosen to reduce fill-in.
+
+ The block columns of L form an elimination tree in which each column only
+ depends on the columns of its descendants. The columns are scheduled by
+ level: a column's level is one more than the highest level of its children,
+ with leaves at level zero. Once all lower levels are done, the columns of a
+ level are independent of one another and are processed concurrently, both in
+ the factorization and in the forward and backward substitutions.
+
+ The permutation, the sparsity pattern of L and the level schedule only depend
+ on the sparsity pattern of A. They are computed once at construction so that
+ matrices with the same sparsity pattern can be factored repeatedly:
+
+   BlockSparseCholeskySolver solver(A.sparsity_pattern(), Parallelism(4));
+   solver.SetMatrix(A);
+   if (!solver.Factor()) { ... }
+   solver.SolveInPlace(&b);
+
+ The permutation is computed with a greedy minimum degree heuristic on the
+ graph of blocks, where the degree of a block is the number of scalar columns
+ of the blocks it is connected to. Ties are broken by block index so that the
+ factorization is deterministic, and independent of the number of threads.  */
+class BlockSparseCholeskySolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BlockSparseCholeskySolver)
+
+  /* Performs the symbolic analysis for matrices with the given sparsity
+   pattern. Numerical work is spread over up to `parallelism.num_threads()`
+   threads.  */
+  BlockSparseCholeskySolver(const BlockSparsityPattern& sparsity_pattern,
+                            Parallelism parallelism);
+
+  ~BlockSparseCholeskySolver();
+
+  /* The number of rows (and columns) of the matrices this solver factors.  */
+  int size() const { return size_; }
+
+  /* The number of levels in the elimination tree. The columns of each level
+   are processed concurrently.  */
+  int num_levels() const { return static_cast<int>(levels_.size()); }
+
+  /* Returns the permutation of block columns: the k-th block column of L
+   corresponds to block column `elimination_order()[k]` of A.  */
+  const std::vector<int>& elimination_order() const {
+    return elimination_order_;
+  }
+
+  /* Sets the matrix A to be factored, replacing any previous factorization.
+   @throws std::exception if the sparsity pattern of A differs from the one
+   given at construction.  */
+  void SetMatrix(const BlockSparseSymmetricMatrix& A);
+
+  /* Factors the matrix given to SetMatrix() in place. Returns false if the
+   factorization fails, e.g. because the matrix is not numerically positive
+   definite.
+   @throws std::exception if SetMatrix() has not been called since the last
+   call to Factor().  */
+  bool Factor();
+
+  /* Solves A⋅x = b and writes the result x in b.
+   @throws std::exception if the matrix has not been successfully factored.
+   @pre b != nullptr and b->size() == size().  */
+  void SolveInPlace(VectorX<double>* b) const;
+
+ private:
+  /* Factors the k-th block column of L, assuming that its descendants in the
+   elimination tree have been factored. Returns false if the diagonal block is
+   not positive definite.  */
+  bool FactorColumn(int k);
+
+  /* The location of a block of L, along with whether it stores the transpose
+   of the corresponding block of A.  */
+  struct BlockLocation {
+    int column{};
+    int flat{};
+    bool transpose{};
+  };
+
+  Parallelism parallelism_;
+  int size_{};
+  /* The block sizes and the starting scalar column of each block of A.  */
+  std::vector<int> block_sizes_;
+  std::vector<int> starting_cols_;
+  /* See elimination_order(); block_to_column_ is its inverse.  */
+  std::vector<int> elimination_order_;
+  std::vector<int> block_to_column_;
+  /* a_to_l_[j][flat] is the location in L of A's block with the given flat
+   index in A's j-th block column.  */
+  std::vector<std::vector<BlockLocation>> a_to_l_;
+  /* row_structure_[k] lists the pairs (j, flat), j < k, for which L's block
+   (k, j) is nonzero, where `flat` is the flat index of that block in the j-th
+   block column. These columns j are the descendants of k that update k.  */
+  std::vector<std::vector<std::pair<int, int>>> row_structure_;
+  /* levels_[l] lists the block columns of L at level l.  */
+  std::vector<std::vector<int>> levels_;
+  /* Holds A after SetMatrix() and L after Factor().  */
+  std::unique_ptr<BlockSparseLowerTriangularMatrix> L_;
+  bool matrix_ready_{false};
+  bool factorization_ready_{false};
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -221,7 +221,19 @@ class BlockSparseLowerTriangularOrSymmetricMatrix {
    indices instead of block row indices.
    @pre 0 <= j < block_cols().
    @pre The j-th block column has at least `flat+1` nonzero entries. */
-  const MatrixType& block_flat(int flat, int j) {
+  const MatrixType& block_flat(int flat, int j) const {
+    DRAKE_ASSERT(0 <= j && j < block_cols_);
+    DRAKE_ASSERT(flat >= 0 && flat < ssize(blocks_[j]));
+    return blocks_[j][flat];
+  }
+
+  /* (Advanced) Mutable version of block_flat(). Useful for algorithms that
+   update the blocks in place (e.g. a factorization stored in `this` matrix).
+   @pre 0 <= j < block_cols().
+   @pre The j-th block column has at least `flat+1` nonzero entries.
+   @warning If `this` matrix is symmetric and the block is on the diagonal,
+   the caller is responsible for keeping it symmetric. */
+  MatrixType& mutable_block_flat(int flat, int j) {
     DRAKE_ASSERT(0 <= j && j < block_cols_);
     DRAKE_ASSERT(flat >= 0 && flat < ssize(blocks_[j]));
     return blocks_[j][flat];
@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 namespace drake {
@@ -70,6 +72,52 @@ int ContactProblemGraph::AddConstraint(int first_clique, int second_clique,
                        num_constraint_equations);
 }
 
+std::vector<ContactProblemGraph::Island> ContactProblemGraph::CalcIslands()
+    const {
+  // Union-find over cliques, with path halving.
+  std::vector<int> parent(num_cliques());
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find_root = [&parent](int c) {
+    while (parent[c] != c) {
+      parent[c] = parent[parent[c]];
+      c = parent[c];
+    }
+    return c;
+  };
+  for (const ConstraintCluster& cluster : clusters_) {
+    const int r0 = find_root(cluster.cliques().first());
+    const int r1 = find_root(cluster.cliques().second());
+    // Keep the lowest clique as the root so that roots identify islands by
+    // their lowest clique index.
+    if (r0 != r1) parent[std::max(r0, r1)] = std::min(r0, r1);
+  }
+
+  // Cliques are visited in increasing order and therefore islands get created
+  // in the order of their lowest clique.
+  std::vector<int> root_to_island(num_cliques(), -1);
+  std::vector<Island> islands;
+  for (int c = 0; c < num_cliques(); ++c) {
+    if (!participating_cliques_.participates(c)) continue;
+    const int root = find_root(c);
+    if (root_to_island[root] < 0) {
+      root_to_island[root] = ssize(islands);
+      islands.emplace_back();
+    }
+    islands[root_to_island[root]].cliques.push_back(c);
+  }
+  for (const ConstraintCluster& cluster : clusters_) {
+    const int root = find_root(cluster.cliques().first());
+    Island& island = islands[root_to_island[root]];
+    island.constraints.insert(island.constraints.end(),
+                              cluster.constraint_index().begin(),
+                              cluster.constraint_index().end());
+  }
+  for (Island& island : islands) {
+    std::sort(island.constraints.begin(), island.constraints.end());
+  }
+  return islands;
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
@@ -90,6 +90,17 @@ class ContactProblemGraph {
     std::vector<int> constraint_num_equations_;
   };
 
+  /* A connected component of the graph. Constraints in different islands do
+   not share cliques and therefore the contact problem decouples into
+   independent problems, one per island. */
+  struct Island {
+    /* Cliques (nodes) in this island, in increasing order. */
+    std::vector<int> cliques;
+    /* Indexes of the constraints in this island, as assigned by
+     AddConstraint(), in increasing order. */
+    std::vector<int> constraints;
+  };
+
   /* Constructs an empty graph. */
   ContactProblemGraph() = default;
 
@@ -149,6 +160,11 @@ class ContactProblemGraph {
     return participating_cliques_;
   }
 
+  /* Computes the connected components (islands) of this graph. Only
+   participating cliques belong to an island, see participating_cliques().
+   Islands are sorted by their lowest clique index. */
+  std::vector<Island> CalcIslands() const;
+
  private:
   /* Helper to add a constraint between a pair of cliques. */
   int AddConstraint(SortedPair<int> cliques, int num_constrained_dofs);
@@ -4,6 +4,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/ssize.h"
+#include "drake/common/unused.h"
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
 namespace drake {
@@ -13,7 +14,9 @@ namespace internal {
 
 template <typename T>
 SapConstraintBundle<T>::SapConstraintBundle(
-    const SapContactProblem<T>* problem, const VectorX<T>& delassus_diagonal) {
+    const SapContactProblem<T>* problem, const VectorX<T>& delassus_diagonal,
+    Parallelism parallelism)
+    : parallelism_(parallelism) {
   DRAKE_THROW_UNLESS(problem != nullptr);
   DRAKE_THROW_UNLESS(delassus_diagonal.size() ==
                      problem->num_constraint_equations());
@@ -23,15 +26,22 @@ SapConstraintBundle<T>::SapConstraintBundle(
   // the ContactProblemGraph, where constraints between the same
   // pair of cliques are "clustered" together.
   constraints_.reserve(problem->num_constraints());
+  constraint_starts_.reserve(problem->num_constraints());
+  cluster_starts_.reserve(problem->graph().num_clusters() + 1);
 
   // Store constraints in the order specified by the graph, i.e. by clusters.
+  int constraint_start = 0;
   for (const ContactProblemGraph::ConstraintCluster& e :
        problem->graph().clusters()) {
+    cluster_starts_.push_back(ssize(constraints_));
     for (int i : e.constraint_index()) {
       const SapConstraint<T>& c = problem->get_constraint(i);
       constraints_.push_back(&c);
+      constraint_starts_.push_back(constraint_start);
+      constraint_start += c.num_constraint_equations();
     }
   }
+  cluster_starts_.push_back(ssize(constraints_));
 
   MakeConstraintBundleJacobian(*problem);
 }
@@ -109,6 +119,26 @@ void SapConstraintBundle<T>::MakeConstraintBundleJacobian(
   J_ = builder.Build();
 }
 
+template <typename T>
+template <typename Func>
+void SapConstraintBundle<T>::ForEachConstraint(const Func& func) const {
+  const int num_clusters = ssize(cluster_starts_) - 1;
+  const int num_threads = parallelism_.num_threads();
+  // Each constraint only writes to its own data, impulses and Hessian and
+  // therefore clusters can be processed concurrently without synchronization.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(static) \
+    if (num_threads > 1)
+#endif
+  for (int cluster = 0; cluster < num_clusters; ++cluster) {
+    for (int i = cluster_starts_[cluster]; i < cluster_starts_[cluster + 1];
+         ++i) {
+      func(i, constraint_starts_[i]);
+    }
+  }
+  unused(num_threads);
+}
+
 template <typename T>
 SapConstraintBundleData SapConstraintBundle<T>::MakeData(
     const T& time_step, const VectorX<T>& delassus_diagonal) const {
@@ -131,15 +161,13 @@ void SapConstraintBundle<T>::CalcData(
     const VectorX<T>& vc, SapConstraintBundleData* bundle_data) const {
   DRAKE_DEMAND(bundle_data != nullptr);
   DRAKE_DEMAND(ssize(*bundle_data) == num_constraints());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  ForEachConstraint([&](int i, int constraint_start) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
     const auto vc_i = vc.segment(constraint_start, ni);
     AbstractValue& data = *(*bundle_data)[i];
     c.CalcData(vc_i, &data);
-    constraint_start += ni;
-  }
+  });
 }
 
 template <typename T>
@@ -147,11 +175,21 @@ T SapConstraintBundle<T>::CalcCost(
     const SapConstraintBundleData& bundle_data) const {
   DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
   T cost = 0.0;
-  for (int i = 0; i < num_constraints(); ++i) {
-    const SapConstraint<T>& c = *constraints_[i];
-    const AbstractValue& data = *bundle_data[i];
-    cost += c.CalcCost(data);
+  if (parallelism_.num_threads() == 1) {
+    for (int i = 0; i < num_constraints(); ++i) {
+      const SapConstraint<T>& c = *constraints_[i];
+      const AbstractValue& data = *bundle_data[i];
+      cost += c.CalcCost(data);
+    }
+    return cost;
   }
+  // Per-constraint costs are summed in order so that the result is identical
+  // to the serial computation above.
+  std::vector<T> costs(num_constraints());
+  ForEachConstraint([&](int i, int) {
+    costs[i] = constraints_[i]->CalcCost(*bundle_data[i]);
+  });
+  for (const T& cost_i : costs) cost += cost_i;
   return cost;
 }
 
@@ -161,15 +199,13 @@ void SapConstraintBundle<T>::CalcImpulses(
   DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
   DRAKE_DEMAND(gamma != nullptr);
   DRAKE_DEMAND(gamma->size() == num_constraint_equations());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  ForEachConstraint([&](int i, int constraint_start) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
     const AbstractValue& data = *bundle_data[i];
     auto gamma_i = gamma->segment(constraint_start, ni);
     c.CalcImpulse(data, &gamma_i);
-    constraint_start += ni;
-  }
+  });
 }
 
 template <typename T>
@@ -182,8 +218,7 @@ void SapConstraintBundle<T>::CalcImpulsesAndConstraintsHessian(
   DRAKE_DEMAND(ssize(*G) == num_constraints());
 
   // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹.
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  ForEachConstraint([&](int i, int constraint_start) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
     const AbstractValue& data = *bundle_data[i];
@@ -191,8 +226,7 @@ void SapConstraintBundle<T>::CalcImpulsesAndConstraintsHessian(
     auto& Gi = (*G)[i];
     c.CalcImpulse(data, &gamma_i);
     c.CalcCostHessian(data, &Gi);
-    constraint_start += ni;
-  }
+  });
 }
 
 }  // namespace internal
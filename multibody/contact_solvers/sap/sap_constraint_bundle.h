@@ -5,6 +5,7 @@
 
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint.h"
@@ -65,9 +66,14 @@ class SapConstraintBundle {
    @param[in] delassus_diagonal It must have size problem.num_constraint() or an
    exception is thrown. The i-th entry stores the scaling parameter used for
    regularization estimation by the i-th constraint in `problem`, see
-   SapConstraint::CalcDiagonalRegularization(). */
+   SapConstraint::CalcDiagonalRegularization().
+   @param[in] parallelism Constraint computations are distributed by cluster
+   (i.e. by pair of cliques, see ContactProblemGraph) over up to
+   `parallelism.num_threads()` threads. Results do not depend on the number of
+   threads. */
   SapConstraintBundle(const SapContactProblem<T>* problem,
-                      const VectorX<T>& delassus_diagonal);
+                      const VectorX<T>& delassus_diagonal,
+                      Parallelism parallelism = Parallelism::None());
 
   /* Returns the number of constraints in this bundle. */
   int num_constraints() const;
@@ -128,9 +134,23 @@ class SapConstraintBundle {
    refer to the documentation for the public accessor J(). */
   void MakeConstraintBundleJacobian(const SapContactProblem<T>& problem);
 
+  /* Invokes func(i, constraint_start) for the i-th constraint in the bundle,
+   with constraint_start the index of its first constraint equation, for all
+   constraints. Clusters are distributed over parallelism_.num_threads()
+   threads, and the constraints within a cluster are processed in order. */
+  template <typename Func>
+  void ForEachConstraint(const Func& func) const;
+
   BlockSparseMatrix<T> J_;
   // Constraint references in the order dictated by the ContactProblemGraph.
   std::vector<const SapConstraint<T>*> constraints_;
+  // The i-th entry stores the index of the first equation of the i-th
+  // constraint.
+  std::vector<int> constraint_starts_;
+  // Constraints in the c-th cluster are indexed from cluster_starts_[c] to
+  // cluster_starts_[c + 1] - 1. Of size num_clusters + 1.
+  std::vector<int> cluster_starts_;
+  Parallelism parallelism_;
 };
 
 }  // namespace internal
@@ -29,8 +29,7 @@ SapContactProblem<T>::SapContactProblem(const T& time_step,
   for (int i = 0; i < ssize(A_); ++i) {
     const auto& Ac = A_[i];
     DRAKE_THROW_UNLESS(Ac.rows() == Ac.cols());
-    const int clique_nv = Ac.rows();
-    if (i > 0) velocities_start_[i] = velocities_start_[i - 1] + clique_nv;
+    velocities_start_[i] = nv_;
     nv_ += Ac.rows();
   }
   DRAKE_THROW_UNLESS(v_star_.size() == nv_);
@@ -121,6 +120,40 @@ std::unique_ptr<SapContactProblem<T>> SapContactProblem<T>::MakeReduced(
   return problem;
 }
 
+template <typename T>
+std::unique_ptr<SapContactProblem<T>> SapContactProblem<T>::MakeIsland(
+    const ContactProblemGraph::Island& island) const {
+  PartialPermutation clique_permutation(num_cliques());
+  std::vector<MatrixX<T>> A_island;
+  A_island.reserve(island.cliques.size());
+  int nv_island = 0;
+  for (int c : island.cliques) {
+    clique_permutation.push(c);
+    A_island.push_back(A_[c]);
+    nv_island += num_velocities(c);
+  }
+  VectorX<T> v_star_island(nv_island);
+  int offset = 0;
+  for (int c : island.cliques) {
+    v_star_island.segment(offset, num_velocities(c)) =
+        v_star_.segment(velocities_start(c), num_velocities(c));
+    offset += num_velocities(c);
+  }
+
+  auto problem = std::make_unique<SapContactProblem<T>>(
+      time_step(), std::move(A_island), std::move(v_star_island));
+  problem->set_num_objects(num_objects());
+  // All the DoFs of the island's cliques remain unknown.
+  const std::vector<std::vector<int>> no_known_dofs(num_cliques());
+  for (int i : island.constraints) {
+    std::unique_ptr<SapConstraint<T>> c =
+        get_constraint(i).MakeReduced(clique_permutation, no_known_dofs);
+    DRAKE_DEMAND(c != nullptr);
+    problem->AddConstraint(std::move(c));
+  }
+  return problem;
+}
+
 template <typename T>
 void SapContactProblem<T>::ExpandContactSolverResults(
     const ReducedMapping& reduced_mapping,
@@ -162,6 +162,21 @@ class SapContactProblem {
                                   const SapSolverResults<T>& reduced_results,
                                   SapSolverResults<T>* results) const;
 
+  /* Makes the contact problem for a single `island` of this problem's graph,
+    see ContactProblemGraph::CalcIslands(). Since islands do not share cliques,
+    the problem of each island can be solved independently of the others.
+
+    The k-th clique of the returned problem corresponds to clique
+    island.cliques[k] of this problem and the k-th constraint of the returned
+    problem corresponds to constraint island.constraints[k] of this problem.
+    Therefore, velocities and constraint equations of the island problem map to
+    contiguous segments of this problem's velocities and constraint equations,
+    see velocities_start() and constraint_equations_start().
+
+    @pre `island` is one of the islands returned by graph().CalcIslands(). */
+  std::unique_ptr<SapContactProblem<T>> MakeIsland(
+      const ContactProblemGraph::Island& island) const;
+
   /* TODO(amcastro-tri): consider constructor API taking std::vector<VectorX<T>>
    for v_star. It could be useful for deformables. */
 
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
@@ -136,8 +137,11 @@ class SapModel {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapModel);
 
   /* Constructs a model of `problem` optimized to be used by the SAP solver.
-   The input `problem` must outlive `this` model. */
-  explicit SapModel(const SapContactProblem<T>* problem);
+   The input `problem` must outlive `this` model. Constraint computations are
+   distributed over up to `parallelism.num_threads()` threads, see
+   SapConstraintBundle. */
+  explicit SapModel(const SapContactProblem<T>* problem,
+                    Parallelism parallelism = Parallelism::None());
 
   /* Returns a reference to the contact problem being modeled by this class. */
   const SapContactProblem<T>& problem() const {
@@ -1,6 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/sap_solver.h"
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <type_traits>
 #include <utility>
@@ -8,6 +9,8 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/ssize.h"
+#include "drake/common/unused.h"
 #include "drake/math/linear_solve.h"
 #include "drake/multibody/contact_solvers/newton_with_bisection.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
@@ -115,8 +118,17 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     return SapSolverStatus::kSuccess;
   }
 
+  if (parameters_.solve_contact_islands) {
+    const std::vector<ContactProblemGraph::Island> islands =
+        problem.graph().CalcIslands();
+    if (islands.size() > 1) {
+      return SolveIslands(problem, v_guess, islands, results);
+    }
+  }
+
   // Make model for the given contact problem.
-  model_ = std::make_unique<SapModel<double>>(&problem);
+  model_ =
+      std::make_unique<SapModel<double>>(&problem, parameters_.parallelism);
   const int nv = model_->num_velocities();
   const int nk = model_->num_constraint_equations();
 
@@ -127,7 +139,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   stats_ = SolverStats();
   // The supernodal solver is expensive to instantiate and therefore we only
   // instantiate when needed.
-  std::unique_ptr<SuperNodalSolver> supernodal_solver;
+  SuperNodalSolver* supernodal_solver = nullptr;
 
   {
     // We limit the lifetime of this reference, v, to within this scope where we
@@ -144,6 +156,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   bool converged = false;
   double alpha = 1.0;
   int num_line_search_iters = 0;
+  int num_consecutive_reuses = 0;
   for (;; ++k) {
     // We first verify the stopping criteria. If satisfied, we skip expensive
     // factorizations.
@@ -184,7 +197,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
         // Instantiate supernodal solver on the first iteration when needed. If
         // the stopping criteria is satisfied at k = 0 (good guess), then we
         // skip the expensive instantiation of the solver.
-        supernodal_solver = MakeSuperNodalSolver();
+        supernodal_solver = PrepareSuperNodalSolver();
       }
     }
 
@@ -193,9 +206,24 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     // considered.
     if (k == parameters_.max_iterations) break;
 
+    // Reuse the last factorization of H while the iterations contract the
+    // momentum residual fast enough. See
+    // SapSolverParameters::max_factorization_reuses.
+    const bool reuse_factorization =
+        !parameters_.use_dense_algebra && stats_.num_factorizations > 0 &&
+        num_consecutive_reuses < parameters_.max_factorization_reuses &&
+        momentum_residual <= 0.5 * stats_.momentum_residual[k - 1];
+    if (reuse_factorization) {
+      ++num_consecutive_reuses;
+      ++stats_.num_factorization_reuses;
+    } else {
+      num_consecutive_reuses = 0;
+      ++stats_.num_factorizations;
+    }
+
     // This is the most expensive update: it performs the factorization of H to
     // solve for the search direction dv.
-    CalcSearchDirectionData(*context, supernodal_solver.get(),
+    CalcSearchDirectionData(*context, supernodal_solver, reuse_factorization,
                             &search_direction_data);
     const VectorX<double>& dv = search_direction_data.dv;
 
@@ -246,6 +274,104 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   return SapSolverStatus::kSuccess;
 }
 
+template <typename T>
+SapSolverStatus SapSolver<T>::SolveIslands(
+    const SapContactProblem<T>& problem, const VectorX<T>& v_guess,
+    const std::vector<ContactProblemGraph::Island>& islands,
+    SapSolverResults<T>* results) {
+  const int num_islands = islands.size();
+  DRAKE_DEMAND(num_islands > 1);
+  while (ssize(island_solvers_) < num_islands) {
+    island_solvers_.push_back(std::make_unique<SapSolver<T>>());
+  }
+  SapSolverParameters island_parameters = parameters_;
+  island_parameters.solve_contact_islands = false;
+  island_parameters.parallelism = Parallelism::None();
+
+  results->Resize(problem.num_velocities(), problem.num_constraint_equations());
+  // Cliques that do not participate in any island move freely.
+  results->v = problem.v_star();
+  results->j.setZero();
+
+  // Each island writes to its own segments of `results`, given islands do not
+  // share cliques or constraints.
+  std::vector<SapSolverStatus> status(num_islands, SapSolverStatus::kSuccess);
+  std::vector<std::exception_ptr> exceptions(num_islands);
+  const int num_threads = parameters_.parallelism.num_threads();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int i = 0; i < num_islands; ++i) {
+    // Exceptions must not escape the parallel region. They are rethrown below.
+    try {
+      const ContactProblemGraph::Island& island = islands[i];
+      std::unique_ptr<SapContactProblem<T>> island_problem =
+          problem.MakeIsland(island);
+      VectorX<T> island_v_guess(island_problem->num_velocities());
+      int offset = 0;
+      for (int c : island.cliques) {
+        const int nv = problem.num_velocities(c);
+        island_v_guess.segment(offset, nv) =
+            v_guess.segment(problem.velocities_start(c), nv);
+        offset += nv;
+      }
+
+      SapSolver<T>& solver = *island_solvers_[i];
+      solver.set_parameters(island_parameters);
+      SapSolverResults<T> island_results;
+      status[i] = solver.SolveWithGuess(*island_problem, island_v_guess,
+                                        &island_results);
+      if (status[i] != SapSolverStatus::kSuccess) continue;
+
+      offset = 0;
+      for (int c : island.cliques) {
+        const int nv = problem.num_velocities(c);
+        const int start = problem.velocities_start(c);
+        results->v.segment(start, nv) = island_results.v.segment(offset, nv);
+        results->j.segment(start, nv) = island_results.j.segment(offset, nv);
+        offset += nv;
+      }
+      offset = 0;
+      for (int k : island.constraints) {
+        const int ne = problem.get_constraint(k).num_constraint_equations();
+        const int start = problem.constraint_equations_start(k);
+        results->vc.segment(start, ne) = island_results.vc.segment(offset, ne);
+        results->gamma.segment(start, ne) =
+            island_results.gamma.segment(offset, ne);
+        offset += ne;
+      }
+    } catch (...) {
+      exceptions[i] = std::current_exception();
+    }
+  }
+  unused(num_threads);
+  for (const std::exception_ptr& e : exceptions) {
+    if (e) std::rethrow_exception(e);
+  }
+
+  stats_ = SolverStats();
+  stats_.num_islands = num_islands;
+  stats_.optimality_criterion_reached = true;
+  stats_.cost_criterion_reached = true;
+  stats_.symbolic_analysis_reused = true;
+  for (int i = 0; i < num_islands; ++i) {
+    const SolverStats& island_stats = island_solvers_[i]->get_statistics();
+    stats_.num_iters = std::max(stats_.num_iters, island_stats.num_iters);
+    stats_.num_line_search_iters += island_stats.num_line_search_iters;
+    stats_.num_factorizations += island_stats.num_factorizations;
+    stats_.num_factorization_reuses += island_stats.num_factorization_reuses;
+    stats_.optimality_criterion_reached &=
+        island_stats.optimality_criterion_reached;
+    stats_.cost_criterion_reached &= island_stats.cost_criterion_reached;
+    stats_.symbolic_analysis_reused &= island_stats.symbolic_analysis_reused;
+  }
+
+  for (SapSolverStatus island_status : status) {
+    if (island_status != SapSolverStatus::kSuccess) return island_status;
+  }
+  return SapSolverStatus::kSuccess;
+}
+
 template <typename T>
 T SapSolver<T>::CalcCostAlongLine(
     const systems::Context<T>& context,
@@ -612,7 +738,8 @@ std::unique_ptr<SuperNodalSolver> SapSolver<T>::MakeSuperNodalSolver() const {
   if constexpr (std::is_same_v<T, double>) {
     const BlockSparseMatrix<T>& J = model_->constraints_bundle().J();
     return std::make_unique<SuperNodalSolver>(J.block_rows(), J.get_blocks(),
-                                              model_->dynamics_matrix());
+                                              model_->dynamics_matrix(),
+                                              parameters_.parallelism);
   } else {
     throw std::logic_error(
         "SapSolver::MakeSuperNodalSolver(): SuperNodalSolver only supports T "
@@ -620,6 +747,54 @@ std::unique_ptr<SuperNodalSolver> SapSolver<T>::MakeSuperNodalSolver() const {
   }
 }
 
+template <typename T>
+SuperNodalSolver* SapSolver<T>::PrepareSuperNodalSolver() {
+  if constexpr (std::is_same_v<T, double>) {
+    if (!parameters_.reuse_symbolic_analysis) {
+      supernodal_solver_ = MakeSuperNodalSolver();
+      supernodal_solver_sparsity_.clear();
+      return supernodal_solver_.get();
+    }
+    std::vector<int> sparsity = CalcSuperNodalSparsity();
+    if (supernodal_solver_ != nullptr &&
+        sparsity == supernodal_solver_sparsity_) {
+      const BlockSparseMatrix<T>& J = model_->constraints_bundle().J();
+      supernodal_solver_->UpdateMatrices(J.get_blocks(),
+                                         model_->dynamics_matrix());
+      stats_.symbolic_analysis_reused = true;
+    } else {
+      supernodal_solver_ = MakeSuperNodalSolver();
+      supernodal_solver_sparsity_ = std::move(sparsity);
+    }
+    return supernodal_solver_.get();
+  } else {
+    throw std::logic_error(
+        "SapSolver::PrepareSuperNodalSolver(): SuperNodalSolver only supports "
+        "T = double.");
+  }
+}
+
+template <typename T>
+std::vector<int> SapSolver<T>::CalcSuperNodalSparsity() const {
+  const BlockSparseMatrix<T>& J = model_->constraints_bundle().J();
+  const std::vector<MatrixX<T>>& A = model_->dynamics_matrix();
+  std::vector<int> sparsity;
+  sparsity.reserve(3 + A.size() + 4 * J.get_blocks().size());
+  sparsity.push_back(parameters_.parallelism.num_threads());
+  sparsity.push_back(J.block_rows());
+  sparsity.push_back(A.size());
+  for (const MatrixX<T>& A_t : A) {
+    sparsity.push_back(A_t.rows());
+  }
+  for (const auto& [p, t, J_pt] : J.get_blocks()) {
+    sparsity.push_back(p);
+    sparsity.push_back(t);
+    sparsity.push_back(J_pt.rows());
+    sparsity.push_back(J_pt.cols());
+  }
+  return sparsity;
+}
+
 template <typename T>
 void SapSolver<T>::CallDenseSolver(const Context<T>& context,
                                    VectorX<T>* dv) const {
@@ -663,11 +838,14 @@ void SapSolver<T>::UpdateSuperNodalSolver(
 template <typename T>
 void SapSolver<T>::CallSuperNodalSolver(const Context<T>& context,
                                         SuperNodalSolver* supernodal_solver,
+                                        bool reuse_factorization,
                                         VectorX<T>* dv) const {
   if constexpr (std::is_same_v<T, double>) {
-    UpdateSuperNodalSolver(context, supernodal_solver);
-    if (!supernodal_solver->Factor()) {
-      throw std::logic_error("SapSolver: Supernodal factorization failed.");
+    if (!reuse_factorization) {
+      UpdateSuperNodalSolver(context, supernodal_solver);
+      if (!supernodal_solver->Factor()) {
+        throw std::logic_error("SapSolver: Supernodal factorization failed.");
+      }
     }
     // We solve in place to avoid heap allocating additional memory for the
     // right hand side.
@@ -676,6 +854,7 @@ void SapSolver<T>::CallSuperNodalSolver(const Context<T>& context,
   } else {
     unused(context);
     unused(supernodal_solver);
+    unused(reuse_factorization);
     unused(dv);
     throw std::logic_error(
         "SapSolver::CallSuperNodalSolver(): SuperNodalSolver only supports T "
@@ -686,11 +865,12 @@ void SapSolver<T>::CallSuperNodalSolver(const Context<T>& context,
 template <typename T>
 void SapSolver<T>::CalcSearchDirectionData(
     const systems::Context<T>& context, SuperNodalSolver* supernodal_solver,
-    SapSolver<T>::SearchDirectionData* data) const {
+    bool reuse_factorization, SapSolver<T>::SearchDirectionData* data) const {
   DRAKE_DEMAND(parameters_.use_dense_algebra || (supernodal_solver != nullptr));
   // Update search direction dv.
   if (!parameters_.use_dense_algebra) {
-    CallSuperNodalSolver(context, supernodal_solver, &data->dv);
+    CallSuperNodalSolver(context, supernodal_solver, reuse_factorization,
+                         &data->dv);
   } else {
     CallDenseSolver(context, &data->dv);
   }
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/sap/sap_model.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
@@ -149,6 +150,40 @@ struct SapSolverParameters {
   // dense algebra instead. Typically used for testing.
   bool use_dense_algebra{false};
 
+  // Parallelism of the solver. With more than one thread, constraint impulses,
+  // costs and Hessians are evaluated concurrently for different clusters of
+  // constraints (pairs of cliques) and, unless use_dense_algebra = true,
+  // independent branches of the elimination tree of the Hessian are factored
+  // concurrently. This pays off for scenes with many contacting objects, e.g.
+  // piles.
+  Parallelism parallelism{false};
+
+  // When true, the problem is split into contact islands, i.e. the connected
+  // components of its contact graph (see ContactProblemGraph::CalcIslands()),
+  // and the problem of each island is solved independently with its own Newton
+  // iterations and convergence checks. Therefore a hard-to-converge island
+  // does not slow down the others. Islands are solved concurrently with up to
+  // parallelism.num_threads() threads, each island with a single thread.
+  // Problems with a single island are solved as a whole.
+  bool solve_contact_islands{false};
+
+  // When true, a SapSolver keeps its supernodal solver across calls to
+  // SolveWithGuess(). If the next problem has the same sparsity (the same
+  // contact graph and block sizes, as is typical of steady contact), only the
+  // numerical values are updated and the elimination ordering and symbolic
+  // analysis are reused. Ignored when use_dense_algebra = true.
+  bool reuse_symbolic_analysis{false};
+
+  // Maximum number of consecutive Newton iterations that reuse the last
+  // factorization of the Hessian instead of computing a new one. The
+  // resulting quasi-Newton direction is still a descent direction and the
+  // line search preserves global convergence, though convergence near the
+  // solution degrades from quadratic to linear. Therefore the factorization is
+  // only reused while the previous iteration reduced the momentum residual by
+  // at least half. Zero (the default) factorizes the Hessian at every
+  // iteration. Ignored when use_dense_algebra = true.
+  int max_factorization_reuses{0};
+
   // Dimensionless number used to allow some slop on the check near zero for
   // certain quantities such as the gradient of the cost.
   // It is also used to check for monotonic convergence. In particular, we allow
@@ -207,6 +242,10 @@ class SapSolver {
       num_line_search_iters = 0;
       optimality_criterion_reached = false;
       cost_criterion_reached = false;
+      num_factorizations = 0;
+      num_factorization_reuses = 0;
+      symbolic_analysis_reused = false;
+      num_islands = 0;
       momentum_residual.clear();
       momentum_scale.clear();
       cost.clear();
@@ -221,6 +260,26 @@ class SapSolver {
     // Indicates if the cost condition was reached.
     bool cost_criterion_reached{false};
 
+    // Number of factorizations of the Hessian.
+    int num_factorizations{0};
+
+    // Number of Newton iterations that reused the last factorization of the
+    // Hessian. See SapSolverParameters::max_factorization_reuses.
+    int num_factorization_reuses{0};
+
+    // Indicates if the symbolic analysis of the supernodal solver was reused
+    // from the previous call to SolveWithGuess(). See
+    // SapSolverParameters::reuse_symbolic_analysis.
+    bool symbolic_analysis_reused{false};
+
+    // Number of contact islands solved independently, see
+    // SapSolverParameters::solve_contact_islands. Zero when the problem is
+    // solved as a whole. When non-zero, num_iters is the largest number of
+    // iterations of any island, counters of work are summed over islands,
+    // convergence criteria are reached if reached by all islands, and the
+    // per-iteration histories below are left empty.
+    int num_islands{0};
+
     // Cost at each SAP Newton iteration. cost[0] stores cost at the initial
     // guess.
     std::vector<double> cost;
@@ -370,6 +429,14 @@ class SapSolver {
       const SearchDirectionData& search_direction_data,
       systems::Context<T>* scratch_workspace) const;
 
+  // Solves `problem` by independently solving the problems for each of the
+  // given `islands` of its graph, with at least two islands. See
+  // SapSolverParameters::solve_contact_islands.
+  SapSolverStatus SolveIslands(
+      const SapContactProblem<T>& problem, const VectorX<T>& v_guess,
+      const std::vector<ContactProblemGraph::Island>& islands,
+      SapSolverResults<T>* results);
+
   // Computes a dense Hessian H(v) = A + Jᵀ⋅G(v)⋅J for the generalized
   // velocities state stored in `context`.
   MatrixX<T> CalcDenseHessian(const systems::Context<T>& context) const;
@@ -377,6 +444,18 @@ class SapSolver {
   // Makes a new SuperNodalSolver compatible with the underlying SapModel.
   std::unique_ptr<SuperNodalSolver> MakeSuperNodalSolver() const;
 
+  // Returns a SuperNodalSolver compatible with the underlying SapModel, owned
+  // by `this`. When parameters_.reuse_symbolic_analysis = true and the
+  // sparsity of the model matches that of the solver kept from the previous
+  // call to SolveWithGuess(), that solver is reused with updated numerical
+  // values. Otherwise a new one is made with MakeSuperNodalSolver().
+  SuperNodalSolver* PrepareSuperNodalSolver();
+
+  // Encodes the block structure of the underlying SapModel's Jacobian and
+  // dynamics matrix, along with the supernodal solver's parallelism, so that
+  // two models with equal encodings admit the same supernodal solver.
+  std::vector<int> CalcSuperNodalSparsity() const;
+
   // Evaluates the constraint's Hessian G(v) and updates `supernodal_solver`'s
   // weight matrix so that we can later on solve the Newton system with Hessian
   // H(v) = A + Jᵀ⋅G(v)⋅J.
@@ -384,12 +463,14 @@ class SapSolver {
                               SuperNodalSolver* supernodal_solver) const;
 
   // Updates the supernodal solver with the constraint's Hessian G(v),
-  // factorizes it, and solves for the search direction `dv`.
+  // factorizes it, and solves for the search direction `dv`. If
+  // `reuse_factorization` is true, the solver's last factorization is used
+  // instead.
   // @pre supernodal_solver and dv are not nullptr.
   // @pre supernodal_solver was created with a call to MakeSuperNodalSolver().
   void CallSuperNodalSolver(const systems::Context<T>& context,
                             SuperNodalSolver* supernodal_solver,
-                            VectorX<T>* dv) const;
+                            bool reuse_factorization, VectorX<T>* dv) const;
 
   // Solves for dv using dense algebra, for debugging.
   // @pre context was created by the underlying SapModel.
@@ -404,11 +485,14 @@ class SapSolver {
   // @param supernodal_solver If nullptr, this method uses dense algebra to
   // compute the Hessian and factorize it. Otherwise, this method uses the
   // supernodal solver provided.
+  // @param reuse_factorization If true, the last factorization of the
+  // supernodal solver is used instead of the Hessian at `context`.
   // @pre context was created by the underlying SapModel.
   // @pre supernodal_solver must be a valid supernodal solver created with
   // MakeSuperNodalSolver() when parameters_.use_dense_algebra = false.
   void CalcSearchDirectionData(const systems::Context<T>& context,
                                SuperNodalSolver* supernodal_solver,
+                               bool reuse_factorization,
                                SearchDirectionData* data) const;
 
   std::unique_ptr<SapModel<T>> model_;
@@ -419,6 +503,13 @@ class SapSolver {
   // TODO(amcastro-tri): Consider moving stats into the solver's state stored as
   // part of the model's context.
   mutable SolverStats stats_;
+  // The supernodal solver used by the last call to SolveWithGuess() and the
+  // sparsity it was made for, see PrepareSuperNodalSolver().
+  std::unique_ptr<SuperNodalSolver> supernodal_solver_;
+  std::vector<int> supernodal_solver_sparsity_;
+  // Solvers for each contact island, kept across calls to SolveWithGuess() so
+  // that they can reuse their own supernodal solvers. See SolveIslands().
+  std::vector<std::unique_ptr<SapSolver<T>>> island_solvers_;
 };
 
 // Forward-declare specializations, prior to DRAKE_DECLARE... below.
@@ -129,6 +129,35 @@ TEST_F(ContactGraphTest, ResetGraph) {
   VerifyForExpectedGraph(graph);
 }
 
+TEST_F(ContactGraphTest, CalcIslands) {
+  // All participating cliques in the graph above are connected, while clique 2
+  // does not participate.
+  ContactProblemGraph graph = MakeGraph();
+  std::vector<ContactProblemGraph::Island> islands = graph.CalcIslands();
+  ASSERT_EQ(islands.size(), 1);
+  EXPECT_EQ(islands[0].cliques, std::vector<int>({0, 1, 3}));
+  EXPECT_EQ(islands[0].constraints, std::vector<int>({0, 1, 2, 3, 4}));
+
+  // Two more islands: clique 4 on its own, and cliques 2 and 5 connected
+  // through two constraints. Clique 6 does not participate.
+  graph.ResetNumCliques(7);
+  AddGraphConstraints(&graph);
+  EXPECT_EQ(graph.AddConstraint(5, 2, 3), 5);
+  EXPECT_EQ(graph.AddConstraint(4, 3), 6);
+  EXPECT_EQ(graph.AddConstraint(2, 5, 1), 7);
+  islands = graph.CalcIslands();
+  ASSERT_EQ(islands.size(), 3);
+  EXPECT_EQ(islands[0].cliques, std::vector<int>({0, 1, 3}));
+  EXPECT_EQ(islands[0].constraints, std::vector<int>({0, 1, 2, 3, 4}));
+  EXPECT_EQ(islands[1].cliques, std::vector<int>({2, 5}));
+  EXPECT_EQ(islands[1].constraints, std::vector<int>({5, 7}));
+  EXPECT_EQ(islands[2].cliques, std::vector<int>({4}));
+  EXPECT_EQ(islands[2].constraints, std::vector<int>({6}));
+
+  // A graph without constraints has no islands.
+  EXPECT_TRUE(ContactProblemGraph(3).CalcIslands().empty());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -226,6 +226,38 @@ TEST_F(SapConstraintBundleTest, VerifyGradients) {
   }
 }
 
+// Evaluating the bundle with multiple threads produces the same results as the
+// serial evaluation.
+TEST_F(SapConstraintBundleTest, ParallelEvaluation) {
+  const SapConstraintBundle<AutoDiffXd> parallel_bundle(
+      problem_.get(), delassus_diagonal_, Parallelism(3));
+  const AutoDiffXd time_step = 0.02;
+  SapConstraintBundleData data =
+      bundle_->MakeData(time_step, delassus_diagonal_);
+  SapConstraintBundleData parallel_data =
+      parallel_bundle.MakeData(time_step, delassus_diagonal_);
+  const VectorX<AutoDiffXd> vc = VectorXd::LinSpaced(17, -1.0, 2.5);
+  bundle_->CalcData(vc, &data);
+  parallel_bundle.CalcData(vc, &parallel_data);
+  EXPECT_EQ(parallel_bundle.CalcCost(parallel_data), bundle_->CalcCost(data));
+
+  VectorX<AutoDiffXd> gamma(vc.size());
+  VectorX<AutoDiffXd> parallel_gamma(vc.size());
+  std::vector<MatrixX<AutoDiffXd>> G(problem_->num_constraints());
+  std::vector<MatrixX<AutoDiffXd>> parallel_G(problem_->num_constraints());
+  bundle_->CalcImpulsesAndConstraintsHessian(data, &gamma, &G);
+  parallel_bundle.CalcImpulsesAndConstraintsHessian(parallel_data,
+                                                    &parallel_gamma,
+                                                    &parallel_G);
+  EXPECT_EQ(math::ExtractValue(parallel_gamma), math::ExtractValue(gamma));
+  for (int k = 0; k < problem_->num_constraints(); ++k) {
+    EXPECT_EQ(math::ExtractValue(parallel_G[k]), math::ExtractValue(G[k]));
+  }
+  parallel_gamma.setZero();
+  parallel_bundle.CalcImpulses(parallel_data, &parallel_gamma);
+  EXPECT_EQ(math::ExtractValue(parallel_gamma), math::ExtractValue(gamma));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -118,6 +118,10 @@ GTEST_TEST(ContactProblem, Construction) {
   EXPECT_EQ(problem.num_velocities(1), 3);
   EXPECT_EQ(problem.num_velocities(2), 4);
   EXPECT_EQ(problem.num_velocities(3), 2);
+  EXPECT_EQ(problem.velocities_start(0), 0);
+  EXPECT_EQ(problem.velocities_start(1), 2);
+  EXPECT_EQ(problem.velocities_start(2), 5);
+  EXPECT_EQ(problem.velocities_start(3), 9);
   EXPECT_EQ(problem.dynamics_matrix(), A);
   EXPECT_EQ(problem.v_star(), v_star);
 }
@@ -267,6 +271,47 @@ GTEST_TEST(ContactProblem, Clone) {
   EXPECT_EQ(graph.num_constraint_equations(), 17);
 }
 
+// The problem from AddConstraints() along with a constraint on clique 2 has
+// two islands: cliques {0, 1, 3} with constraints {0, 1, 2, 3, 4}, and clique
+// {2} with constraint {5}.
+GTEST_TEST(ContactProblem, MakeIsland) {
+  const double time_step = 0.01;
+  const std::vector<MatrixXd> A{S22, S33, S44, S22};
+  const VectorXd v_star = VectorXd::LinSpaced(11, 1.0, 11.0);
+  SapContactProblem<double> problem(time_step, A, v_star);
+  AddConstraints(&problem);
+  problem.AddConstraint(std::make_unique<TestConstraint>(
+      4 /* num_equations */, 2 /* clique */, 4 /* clique_nv */));
+
+  const std::vector<ContactProblemGraph::Island> islands =
+      problem.graph().CalcIslands();
+  ASSERT_EQ(islands.size(), 2);
+
+  std::unique_ptr<SapContactProblem<double>> island0 =
+      problem.MakeIsland(islands[0]);
+  EXPECT_EQ(island0->time_step(), time_step);
+  EXPECT_EQ(island0->num_objects(), problem.num_objects());
+  EXPECT_EQ(island0->dynamics_matrix(), std::vector<MatrixXd>({S22, S33, S22}));
+  const VectorXd v_star0 =
+      (VectorXd(7) << v_star.head<5>(), v_star.tail<2>()).finished();
+  EXPECT_EQ(island0->v_star(), v_star0);
+  ASSERT_EQ(island0->num_constraints(), 5);
+  EXPECT_EQ(island0->num_constraint_equations(), 17);
+  // Clique 3 in the original problem is clique 2 in the island problem.
+  EXPECT_EQ(island0->get_constraint(0).first_clique(), 2);
+  EXPECT_EQ(island0->get_constraint(1).first_clique(), 0);
+  EXPECT_EQ(island0->get_constraint(1).second_clique(), 1);
+  EXPECT_EQ(island0->get_constraint(2).second_clique(), 2);
+
+  std::unique_ptr<SapContactProblem<double>> island1 =
+      problem.MakeIsland(islands[1]);
+  EXPECT_EQ(island1->dynamics_matrix(), std::vector<MatrixXd>({S44}));
+  EXPECT_EQ(island1->v_star(), v_star.segment<4>(5));
+  ASSERT_EQ(island1->num_constraints(), 1);
+  EXPECT_EQ(island1->get_constraint(0).first_clique(), 0);
+  EXPECT_EQ(island1->num_constraint_equations(), 4);
+}
+
 /* We test reducing the SapContactProblem. The graph setup sketched below
 (having the same semantics as the graph described in AddConstraints())
 corresponds to the graph of the contact problem that results from locking DoFs
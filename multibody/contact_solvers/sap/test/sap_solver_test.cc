@@ -460,6 +460,73 @@ TEST_P(PizzaSaverTest, Stiction) {
   VerifyStictionSolution(params, relative_tolerance, cost_criterion_reached);
 }
 
+// Reusing the symbolic analysis across time steps and the factorization of the
+// Hessian across Newton iterations does not affect the accuracy of the
+// solution.
+TEST_P(PizzaSaverTest, StictionWithReuse) {
+  SapSolverParameters params;  // Default set of parameters.
+  params.line_search_type = GetParam();
+  params.reuse_symbolic_analysis = true;
+  params.max_factorization_reuses = 3;
+  const bool cost_criterion_reached = false;
+  const double relative_tolerance = params.rel_tolerance;
+  VerifyStictionSolution(params, relative_tolerance, cost_criterion_reached);
+}
+
+// Verifies the statistics on the reuse of the symbolic analysis and of the
+// factorizations of the Hessian.
+TEST_P(PizzaSaverTest, ReuseStatistics) {
+  PizzaSaverProblem problem = MakeStictionProblem();
+  const Vector4d tau(0.0, 0.0, -problem.mass() * problem.g(), 20.0);
+  const double beta = 1.0;
+
+  SapSolverParameters params;  // Default set of parameters.
+  params.line_search_type = GetParam();
+  params.reuse_symbolic_analysis = true;
+  params.max_factorization_reuses = 3;
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  SapSolverResults<double> result;
+
+  // Arbitrary non-zero guess so that every step performs Newton iterations.
+  const Vector4d v_guess(1.0, 2.0, 3.0, 4.0);
+  VectorXd q = Vector4d(0.0, 0.0, 0.0, M_PI / 5);
+  VectorXd v = VectorXd::Zero(problem.kNumVelocities);
+  int num_factorization_reuses = 0;
+  for (int i = 0; i < 10; ++i) {
+    const auto contact_problem =
+        problem.MakeContactProblem(q, v, tau, beta, kDefaultSigma);
+    ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+              SapSolverStatus::kSuccess);
+    const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+    // The three contacts persist, so only the first step performs the
+    // symbolic analysis.
+    EXPECT_EQ(stats.symbolic_analysis_reused, i > 0);
+    // Each Newton iteration either factorizes the Hessian or reuses the last
+    // factorization.
+    EXPECT_EQ(stats.num_factorizations + stats.num_factorization_reuses,
+              stats.num_iters);
+    EXPECT_GT(stats.num_factorizations, 0);
+    num_factorization_reuses += stats.num_factorization_reuses;
+    v = result.v;
+    q += problem.time_step() * v;
+  }
+  EXPECT_GT(num_factorization_reuses, 0);
+
+  // Without reuse, every iteration factorizes the Hessian.
+  params.reuse_symbolic_analysis = false;
+  params.max_factorization_reuses = 0;
+  sap.set_parameters(params);
+  const auto contact_problem =
+      problem.MakeContactProblem(q, v, tau, beta, kDefaultSigma);
+  ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+  EXPECT_FALSE(stats.symbolic_analysis_reused);
+  EXPECT_EQ(stats.num_factorization_reuses, 0);
+  EXPECT_EQ(stats.num_factorizations, stats.num_iters);
+}
+
 // We set a very tight optimality tolerance. The solver won't be able to reach
 // these tolerances. However, it will reach the optimal solution within
 // round-off errors. This is the best the solver could do. It makes sense that
@@ -1062,6 +1129,68 @@ TEST_P(SapNewtonIterationTest, GuessOutsideLimits) {
   CompareDenseAgainstSupernodal(v_guess);
 }
 
+// Solving each contact island independently gives the same solution as
+// solving the problem as a whole.
+TEST_P(SapNewtonIterationTest, ContactIslands) {
+  // Add limit constraints on cliques 0 and 2, so that each clique forms its own
+  // island. As for the limit constraint on clique 1, v* is within limits.
+  std::unique_ptr<SapContactProblem<double>> problem = sap_problem_->Clone();
+  problem->AddConstraint(std::make_unique<LimitConstraint<double>>(
+      0, Vector2d(-1.0, -1.0), Vector2d(3.0, 3.0),
+      VectorXd::Constant(4, 1.0e-3)));
+  problem->AddConstraint(std::make_unique<LimitConstraint<double>>(
+      2, Vector4d::Constant(0.0), Vector4d::Constant(10.0),
+      VectorXd::Constant(8, 1.0e-3)));
+  ASSERT_EQ(problem->graph().CalcIslands().size(), 3);
+
+  // An initial guess outside the limits of all three constraints forces
+  // several Newton iterations on each island.
+  VectorXd v_guess(problem->num_velocities());
+  v_guess << 4.0, -2.0,                                        // Clique 0.
+      1.2 * vl_(0), v_star_(3), 1.1 * vu_(2),                  // Clique 1.
+      11.0, v_star_(6), -1.0, v_star_(8);                      // Clique 2.
+
+  SapSolverParameters params;
+  params.line_search_type = GetParam();
+  params.backtracking_line_search.alpha_max =
+      1.0 / params.backtracking_line_search.rho;
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  SapSolverResults<double> expected;
+  ASSERT_EQ(sap.SolveWithGuess(*problem, v_guess, &expected),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(sap.get_statistics().num_islands, 0);
+  EXPECT_TRUE(CompareMatrices(expected.v, v_star_, 3.0 * kEps,
+                              MatrixCompareType::relative));
+
+  params.solve_contact_islands = true;
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(2)}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", parallelism.num_threads()));
+    params.parallelism = parallelism;
+    sap.set_parameters(params);
+    SapSolverResults<double> result;
+    ASSERT_EQ(sap.SolveWithGuess(*problem, v_guess, &result),
+              SapSolverStatus::kSuccess);
+    const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+    EXPECT_EQ(stats.num_islands, 3);
+    EXPECT_GT(stats.num_iters, 1);
+    EXPECT_TRUE(stats.optimality_criterion_reached);
+    EXPECT_TRUE(stats.momentum_residual.empty());
+
+    // Islands converge on their own, in fewer iterations than the problem as a
+    // whole. Therefore results only agree to round-off.
+    const double kTolerance = 10.0 * kEps;
+    EXPECT_TRUE(CompareMatrices(result.v, expected.v, kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(result.j, expected.j, kTolerance,
+                                MatrixCompareType::absolute));
+    EXPECT_TRUE(CompareMatrices(result.vc, expected.vc, kTolerance,
+                                MatrixCompareType::relative));
+    EXPECT_TRUE(CompareMatrices(result.gamma, expected.gamma, kTolerance,
+                                MatrixCompareType::absolute));
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, SapNewtonIterationTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
@@ -6,6 +6,10 @@
 #include "conex/clique_ordering.h"
 #include "conex/kkt_solver.h"
 
+#include "drake/common/ssize.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
+#include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
+
 using Eigen::MatrixXd;
 using std::vector;
 using MatrixBlock = std::pair<Eigen::MatrixXd, std::vector<int>>;
@@ -185,8 +189,219 @@ std::vector<int> GetMassMatrixStartingColumn(
   return y;
 }
 
+// Finds the range [start, end] of the diagonal blocks of the weight matrix G
+// that correspond to each row block of J, given the number of rows in each row
+// block. Returns false if the partition induced by G does not refine the
+// partition induced by J.
+bool CalcWeightMatrixRanges(const std::vector<int>& num_rows,
+                            const vector<MatrixXd>& weight_matrix,
+                            std::vector<std::pair<int, int>>* ranges) {
+  ranges->resize(num_rows.size());
+  bool weight_matrix_compatible = true;
+  int e_last = -1;
+  for (size_t p = 0; p < num_rows.size(); ++p) {
+    int s = e_last + 1;
+    int e = s;
+    if (e >= ssize(weight_matrix)) return false;
+    int num_rows_found = weight_matrix[e].rows();
+    while (num_rows_found < num_rows[p]) {
+      ++e;
+      if (e >= ssize(weight_matrix)) return false;
+      num_rows_found += weight_matrix[e].rows();
+    }
+    if (num_rows_found != num_rows[p]) {
+      weight_matrix_compatible = false;
+    }
+    e_last = e;
+    (*ranges)[p] = {s, e};
+  }
+  return weight_matrix_compatible;
+}
+
 }  // namespace
 
+class SuperNodalSolver::BlockSparseSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BlockSparseSolver)
+
+  // See SuperNodalSolver's constructor for the requirements on the arguments.
+  BlockSparseSolver(int num_jacobian_row_blocks,
+                    const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+                    const std::vector<Eigen::MatrixXd>& mass_matrices,
+                    Parallelism parallelism);
+
+  // See SuperNodalSolver::UpdateMatrices(). The positions of the blocks of J
+  // are verified by the caller.
+  void UpdateMatrices(const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+                      const std::vector<Eigen::MatrixXd>& mass_matrices);
+
+  // Assembles H = M + JᵀGJ. Returns false if G is incompatible with J.
+  bool SetWeightMatrix(const std::vector<Eigen::MatrixXd>& weight_matrix);
+
+  Eigen::MatrixXd MakeFullMatrix() const { return H_->MakeDenseMatrix(); }
+
+  bool Factor() {
+    cholesky_->SetMatrix(*H_);
+    return cholesky_->Factor();
+  }
+
+  void SolveInPlace(Eigen::VectorXd* b) const { cholesky_->SolveInPlace(b); }
+
+ private:
+  // The nonzero blocks Jₚₜ of a row block p of J, sorted by their block column
+  // t, along with storage for the dense product Jₚᵀ⋅Gₚ⋅Jₚ.
+  struct JacobianRow {
+    std::vector<MatrixBlock<double>> blocks;
+    std::vector<int> columns;
+    Eigen::MatrixXd JtGJ;
+  };
+
+  // Sets mass_blocks_ from the diagonal blocks of M.
+  void SetMassBlocks(const std::vector<Eigen::MatrixXd>& mass_matrices);
+
+  Parallelism parallelism_;
+  std::vector<JacobianRow> rows_;
+  std::vector<int> num_rows_;
+  std::vector<std::pair<int, int>> weight_ranges_;
+  // The diagonal block of M for each block column of J.
+  std::vector<Eigen::MatrixXd> mass_blocks_;
+  std::unique_ptr<BlockSparseSymmetricMatrix> H_;
+  std::unique_ptr<BlockSparseCholeskySolver> cholesky_;
+};
+
+SuperNodalSolver::BlockSparseSolver::BlockSparseSolver(
+    int num_jacobian_row_blocks,
+    const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+    const std::vector<Eigen::MatrixXd>& mass_matrices, Parallelism parallelism)
+    : parallelism_(parallelism),
+      rows_(num_jacobian_row_blocks),
+      num_rows_(num_jacobian_row_blocks) {
+  const std::vector<int> block_sizes =
+      GetJacobianBlockSizesVerifyTriplets(jacobian_blocks);
+  // Will throw an exception if verification fails.
+  VerifyMassMatrixPartitionRefinesJacobianPartition(block_sizes,
+                                                    mass_matrices);
+  const vector<vector<int>> row_to_triplet_list =
+      GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks);
+
+  // Block column t of H is coupled to block column t' > t by each row block
+  // of J with nonzero blocks in both columns.
+  const int num_column_blocks = ssize(block_sizes);
+  std::vector<std::vector<int>> neighbors(num_column_blocks);
+  for (int t = 0; t < num_column_blocks; ++t) {
+    neighbors[t].push_back(t);
+  }
+  for (int p = 0; p < num_jacobian_row_blocks; ++p) {
+    JacobianRow& row = rows_[p];
+    int num_cols = 0;
+    for (int j : row_to_triplet_list[p]) {
+      row.blocks.push_back(std::get<2>(jacobian_blocks[j]));
+      row.columns.push_back(std::get<1>(jacobian_blocks[j]));
+      num_cols += row.blocks.back().cols();
+    }
+    if (row.columns.size() == 2) {
+      neighbors[row.columns[0]].push_back(row.columns[1]);
+    }
+    num_rows_[p] = row.blocks.empty() ? 0 : row.blocks[0].rows();
+    row.JtGJ.resize(num_cols, num_cols);
+  }
+  H_ = std::make_unique<BlockSparseSymmetricMatrix>(
+      BlockSparsityPattern(block_sizes, std::move(neighbors)));
+  cholesky_ = std::make_unique<BlockSparseCholeskySolver>(
+      H_->sparsity_pattern(), parallelism);
+
+  SetMassBlocks(mass_matrices);
+}
+
+void SuperNodalSolver::BlockSparseSolver::SetMassBlocks(
+    const std::vector<Eigen::MatrixXd>& mass_matrices) {
+  // Each block of M lies within the diagonal block of a single block column.
+  const std::vector<int>& block_sizes = H_->sparsity_pattern().block_sizes();
+  mass_blocks_.resize(block_sizes.size());
+  for (int t = 0; t < ssize(block_sizes); ++t) {
+    mass_blocks_[t] = MatrixXd::Zero(block_sizes[t], block_sizes[t]);
+  }
+  int t = 0;
+  int offset = 0;
+  for (const MatrixXd& M : mass_matrices) {
+    if (t >= ssize(block_sizes) || offset + M.rows() > block_sizes[t] ||
+        M.rows() != M.cols()) {
+      throw std::runtime_error(
+          "Mass matrix sizes differ from the ones given at construction.");
+    }
+    mass_blocks_[t].block(offset, offset, M.rows(), M.cols()) = M;
+    offset += M.cols();
+    if (offset == block_sizes[t]) {
+      ++t;
+      offset = 0;
+    }
+  }
+  if (t != ssize(block_sizes)) {
+    throw std::runtime_error(
+        "Mass matrix sizes differ from the ones given at construction.");
+  }
+}
+
+void SuperNodalSolver::BlockSparseSolver::UpdateMatrices(
+    const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+    const std::vector<Eigen::MatrixXd>& mass_matrices) {
+  const vector<vector<int>> row_to_triplet_list =
+      GetRowToTripletMapping(ssize(rows_), jacobian_blocks);
+  for (int p = 0; p < ssize(rows_); ++p) {
+    JacobianRow& row = rows_[p];
+    for (size_t k = 0; k < row_to_triplet_list[p].size(); ++k) {
+      const MatrixBlock<double>& block =
+          std::get<2>(jacobian_blocks[row_to_triplet_list[p][k]]);
+      if (block.rows() != row.blocks[k].rows() ||
+          block.cols() != row.blocks[k].cols()) {
+        throw std::runtime_error(
+            "Jacobian blocks differ from the ones given at construction.");
+      }
+      row.blocks[k] = block;
+    }
+  }
+  SetMassBlocks(mass_matrices);
+}
+
+bool SuperNodalSolver::BlockSparseSolver::SetWeightMatrix(
+    const std::vector<Eigen::MatrixXd>& weight_matrix) {
+  if (!CalcWeightMatrixRanges(num_rows_, weight_matrix, &weight_ranges_)) {
+    return false;
+  }
+
+  // The products Jₚᵀ⋅Gₚ⋅Jₚ of each row block are independent.
+  const int num_row_blocks = ssize(rows_);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parallelism_.num_threads()) \
+    schedule(static)
+#endif
+  for (int p = 0; p < num_row_blocks; ++p) {
+    ComputeWeightMatrixTerms(rows_[p].blocks, weight_matrix,
+                             weight_ranges_[p].first, weight_ranges_[p].second,
+                             &rows_[p].JtGJ);
+  }
+
+  H_->SetZero();
+  for (int t = 0; t < ssize(mass_blocks_); ++t) {
+    H_->AddToBlock(t, t, mass_blocks_[t]);
+  }
+  for (const JacobianRow& row : rows_) {
+    if (row.columns.empty()) continue;
+    const int t1 = row.columns[0];
+    const int n1 = row.blocks[0].cols();
+    if (row.columns.size() == 1) {
+      H_->AddToBlock(t1, t1, row.JtGJ);
+      continue;
+    }
+    const int t2 = row.columns[1];
+    const int n2 = row.blocks[1].cols();
+    H_->AddToBlock(t1, t1, row.JtGJ.topLeftCorner(n1, n1));
+    H_->AddToBlock(t2, t2, row.JtGJ.bottomRightCorner(n2, n2));
+    H_->AddToBlock(t2, t1, row.JtGJ.bottomLeftCorner(n2, n1));
+  }
+  return true;
+}
+
 class SuperNodalSolver::CliqueAssembler final
     : public ::conex::SupernodalAssemblerBase {
  public:
@@ -202,9 +417,21 @@ class SuperNodalSolver::CliqueAssembler final
 
   // Updates a vector of mass matrices m_i satisfying
   // sub_matrix(M) = blkdiag(m_1, m_2, ..., m_n).
-  void AssignMassMatrix(int i, const Eigen::MatrixXd& A) {
+  // Returns the index of A in that vector.
+  int AssignMassMatrix(int i, const Eigen::MatrixXd& A) {
     mass_matrix_position_.push_back(i);
     mass_matrix_.push_back(A);
+    return static_cast<int>(mass_matrix_.size()) - 1;
+  }
+
+  // Replaces the values of the k-th mass matrix m_k.
+  void UpdateMassMatrix(int k, const Eigen::MatrixXd& A) {
+    if (A.rows() != mass_matrix_[k].rows() ||
+        A.cols() != mass_matrix_[k].cols()) {
+      throw std::runtime_error(
+          "Mass matrix sizes differ from the ones given at construction.");
+    }
+    mass_matrix_[k] = A;
   }
 
   int NumRows() { return jacobian_row_data_[0].rows(); }
@@ -212,6 +439,10 @@ class SuperNodalSolver::CliqueAssembler final
   // Copies in J_i and allocates memory for temporaries.
   void Initialize(std::vector<MatrixBlock<double>>&& jacobian_row);
 
+  // Replaces the values of J_i with those of `jacobian_row`, which must have
+  // the same number and sizes of blocks.
+  void UpdateJacobianRow(std::vector<MatrixBlock<double>>&& jacobian_row);
+
  private:
   void SetDenseData() override;
 
@@ -434,10 +665,13 @@ void SuperNodalSolver::Initialize(
   const std::vector<int> mass_matrix_starting_columns =
       GetMassMatrixStartingColumn(mass_matrices);
   int cnt = 0;
+  mass_matrix_locations_.clear();
   for (const auto& c : mass_matrix_starting_columns) {
     const std::pair<int, int> position = FindPositionInClique(c, cliques);
-    owned_clique_assemblers_[position.first]->AssignMassMatrix(
-        position.second, mass_matrices[cnt]);
+    const int index =
+        owned_clique_assemblers_[position.first]->AssignMassMatrix(
+            position.second, mass_matrices[cnt]);
+    mass_matrix_locations_.emplace_back(position.first, index);
     ++cnt;
   }
 
@@ -448,8 +682,20 @@ void SuperNodalSolver::Initialize(
 SuperNodalSolver::SuperNodalSolver(
     int num_jacobian_row_blocks,
     const std::vector<BlockMatrixTriplet>& jacobian_blocks,
-    const std::vector<Eigen::MatrixXd>& mass_matrices)
-    : owned_clique_assemblers_(num_jacobian_row_blocks) {
+    const std::vector<Eigen::MatrixXd>& mass_matrices,
+    Parallelism parallelism) {
+  jacobian_block_positions_.reserve(jacobian_blocks.size());
+  for (const BlockMatrixTriplet& triplet : jacobian_blocks) {
+    jacobian_block_positions_.emplace_back(std::get<0>(triplet),
+                                           std::get<1>(triplet));
+  }
+  if (parallelism.num_threads() > 1) {
+    block_sparse_solver_ = std::make_unique<BlockSparseSolver>(
+        num_jacobian_row_blocks, jacobian_blocks, mass_matrices, parallelism);
+    return;
+  }
+
+  owned_clique_assemblers_.resize(num_jacobian_row_blocks);
   SparsityData clique_data =
       GetEliminationOrdering(num_jacobian_row_blocks, jacobian_blocks);
 
@@ -462,8 +708,62 @@ SuperNodalSolver::SuperNodalSolver(
              jacobian_blocks, mass_matrices);
 }
 
+void SuperNodalSolver::UpdateMatrices(
+    const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+    const std::vector<Eigen::MatrixXd>& mass_matrices) {
+  factorization_ready_ = false;
+  matrix_ready_ = false;
+  bool same_positions =
+      jacobian_blocks.size() == jacobian_block_positions_.size();
+  for (size_t k = 0; same_positions && k < jacobian_blocks.size(); ++k) {
+    same_positions =
+        jacobian_block_positions_[k] ==
+        std::make_pair(std::get<0>(jacobian_blocks[k]),
+                       std::get<1>(jacobian_blocks[k]));
+  }
+  if (!same_positions) {
+    throw std::runtime_error(
+        "Jacobian blocks differ from the ones given at construction.");
+  }
+  if (block_sparse_solver_ != nullptr) {
+    block_sparse_solver_->UpdateMatrices(jacobian_blocks, mass_matrices);
+    return;
+  }
+
+  const int num_jacobian_row_blocks = owned_clique_assemblers_.size();
+  const vector<vector<int>> row_to_triplet_list =
+      GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks);
+  for (int i = 0; i < num_jacobian_row_blocks; ++i) {
+    std::vector<MatrixBlock<double>> jacobian_blocks_of_row;
+    jacobian_blocks_of_row.reserve(row_to_triplet_list[i].size());
+    for (const auto& j : row_to_triplet_list[i]) {
+      jacobian_blocks_of_row.push_back(std::get<2>(jacobian_blocks[j]));
+    }
+    owned_clique_assemblers_[i]->UpdateJacobianRow(
+        std::move(jacobian_blocks_of_row));
+  }
+
+  if (mass_matrices.size() != mass_matrix_locations_.size()) {
+    throw std::runtime_error(
+        "Mass matrix sizes differ from the ones given at construction.");
+  }
+  for (size_t k = 0; k < mass_matrices.size(); ++k) {
+    const auto& [i, j] = mass_matrix_locations_[k];
+    owned_clique_assemblers_[i]->UpdateMassMatrix(j, mass_matrices[k]);
+  }
+}
+
 void SuperNodalSolver::SetWeightMatrix(
     const std::vector<Eigen::MatrixXd>& weight_matrix) {
+  if (block_sparse_solver_ != nullptr) {
+    if (!block_sparse_solver_->SetWeightMatrix(weight_matrix)) {
+      throw std::runtime_error("Weight matrix incompatible with Jacobian.");
+    }
+    factorization_ready_ = false;
+    matrix_ready_ = true;
+    return;
+  }
+
   // We copy these pointers so that SetDenseData (a virtual function override)
   // can access the weight matrices when solver_->Assemble() is called
   // below. For safety, we replace these pointers with nullptr when
@@ -472,22 +772,19 @@ void SuperNodalSolver::SetWeightMatrix(
     c->SetWeightMatrixPointer(&weight_matrix);
   }
 
-  int e_last = -1;
-  bool weight_matrix_incompatible = false;
+  std::vector<int> num_rows;
+  num_rows.reserve(owned_clique_assemblers_.size());
   for (auto& c : owned_clique_assemblers_) {
-    int num_rows = c->NumRows();
-    int s = e_last + 1;
-    int e = s;
-    int num_rows_found = weight_matrix[e].rows();
-    while (num_rows_found < num_rows) {
-      ++e;
-      num_rows_found += weight_matrix[e].rows();
-    }
-    if (num_rows_found != num_rows) {
-      weight_matrix_incompatible = true;
+    num_rows.push_back(c->NumRows());
+  }
+  std::vector<std::pair<int, int>> ranges;
+  const bool weight_matrix_incompatible =
+      !CalcWeightMatrixRanges(num_rows, weight_matrix, &ranges);
+  if (!weight_matrix_incompatible) {
+    for (size_t i = 0; i < owned_clique_assemblers_.size(); ++i) {
+      owned_clique_assemblers_[i]->SetWeightMatrixIndex(ranges[i].first,
+                                                        ranges[i].second);
     }
-    e_last = e;
-    c->SetWeightMatrixIndex(s, e);
   }
 
   if (!weight_matrix_incompatible) {
@@ -511,7 +808,9 @@ bool SuperNodalSolver::Factor() {
   if (!matrix_ready_) {
     throw std::runtime_error("Call to Factor() failed: weight matrix not set.");
   }
-  bool success = solver_->Factor();
+  const bool success = block_sparse_solver_ != nullptr
+                           ? block_sparse_solver_->Factor()
+                           : solver_->Factor();
   factorization_ready_ = success;
   matrix_ready_ = false;
   return success;
@@ -523,6 +822,10 @@ Eigen::VectorXd SuperNodalSolver::Solve(const Eigen::VectorXd& b) const {
         "Call to Solve() failed: factorization not ready.");
   }
   Eigen::VectorXd y = b;
+  if (block_sparse_solver_ != nullptr) {
+    block_sparse_solver_->SolveInPlace(&y);
+    return y;
+  }
   // The supernodal solver uses a mapped MatrixXd as input, so we create this
   // map.
   Eigen::Map<MatrixXd, Eigen::Aligned> ymap(y.data(), b.rows(), 1);
@@ -535,6 +838,10 @@ void SuperNodalSolver::SolveInPlace(Eigen::VectorXd* b) const {
     throw std::runtime_error(
         "Call to Solve() failed: factorization not ready.");
   }
+  if (block_sparse_solver_ != nullptr) {
+    block_sparse_solver_->SolveInPlace(b);
+    return;
+  }
   Eigen::Map<MatrixXd, Eigen::Aligned> ymap(b->data(), b->rows(), 1);
   solver_->SolveInPlace(&ymap);
 }
@@ -545,6 +852,9 @@ Eigen::MatrixXd SuperNodalSolver::MakeFullMatrix() const {
         "Call to MakeFullMatrix() failed: weight matrix not set or matrix has "
         "been factored in place.");
   }
+  if (block_sparse_solver_ != nullptr) {
+    return block_sparse_solver_->MakeFullMatrix();
+  }
   return solver_->KKTMatrix();
 }
 
@@ -562,6 +872,21 @@ void SuperNodalSolver::CliqueAssembler::Initialize(
   SupernodalAssemblerBase::submatrix_data_.InitializeWorkspace(
       workspace_memory_.data());
 }
+
+void SuperNodalSolver::CliqueAssembler::UpdateJacobianRow(
+    std::vector<MatrixBlock<double>>&& r) {
+  bool same_sizes = r.size() == jacobian_row_data_.size();
+  for (size_t j = 0; same_sizes && j < r.size(); ++j) {
+    same_sizes = r[j].rows() == jacobian_row_data_[j].rows() &&
+                 r[j].cols() == jacobian_row_data_[j].cols();
+  }
+  if (!same_sizes) {
+    throw std::runtime_error(
+        "Jacobian blocks differ from the ones given at construction.");
+  }
+  jacobian_row_data_ = std::move(r);
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
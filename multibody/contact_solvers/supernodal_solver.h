@@ -8,6 +8,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/matrix_block.h"
 
 #ifndef DRAKE_DOXYGEN_CXX
@@ -48,6 +49,12 @@ using BlockMatrixTriplet = std::tuple<int, int, MatrixBlock<double>>;
 //  solver.Factor();
 //  // Solve H⋅x = b using updated factorization.
 //  x = solver.Solve(b);
+//
+// By default H is factored serially with conex's supernodal solver. When
+// constructed with more than one thread, H is instead assembled with one block
+// per block column of J and factored with a BlockSparseCholeskySolver, which
+// factors the independent branches of its elimination tree concurrently (e.g.
+// the separate stacks of a pile of objects).
 class SuperNodalSolver {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SuperNodalSolver)
@@ -77,12 +84,27 @@ class SuperNodalSolver {
   //     num_cols(J₁) =  ∑num_cols(Mₜ), t = 1…n
   //     num_cols(J₃) =  ∑num_cols(Mₜ), t = n+1…nᵥ
   //   If this condition fails, an exception is thrown.
+  // @param parallelism
+  //   The number of threads used to assemble, factor and solve. With a single
+  //   thread (the default), conex's serial supernodal solver is used.
   SuperNodalSolver(int num_jacobian_row_blocks,
                    const std::vector<BlockMatrixTriplet>& jacobian_blocks,
-                   const std::vector<Eigen::MatrixXd>& mass_matrices);
+                   const std::vector<Eigen::MatrixXd>& mass_matrices,
+                   Parallelism parallelism = Parallelism::None());
 
   ~SuperNodalSolver();
 
+  // Replaces the values of J and M with those of `jacobian_blocks` and
+  // `mass_matrices`, keeping the elimination ordering and the symbolic
+  // analysis performed at construction. For a sequence of problems with the
+  // same sparsity, this is much cheaper than constructing a new solver.
+  // SetWeightMatrix() must be called again before Factor().
+  // @throws std::exception if the triplets (p, t, Jₚₜ) in `jacobian_blocks` or
+  // the blocks of `mass_matrices` differ in number, position or size from the
+  // ones given at construction.
+  void UpdateMatrices(const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+                      const std::vector<Eigen::MatrixXd>& mass_matrices);
+
   // Sets the block-diagonal weight matrix G.  The block rows of J and G both
   // partition the set {1, 2, ..., num_rows(J)}. Similar to the mass_matrix,
   // the partition induced by G must refine the partition induced by J,
@@ -119,6 +141,10 @@ class SuperNodalSolver {
   // sub_matrix(M) = diag(Mₜ₁ Mₜ₂).
   class CliqueAssembler;
 
+  // Assembles H with one block per block column of J and factors it with a
+  // BlockSparseCholeskySolver, in place of conex. See the class documentation.
+  class BlockSparseSolver;
+
   void Initialize(const std::vector<std::vector<int>>& cliques,
                   int num_jacobian_row_blocks,
                   const std::vector<BlockMatrixTriplet>& jacobian_blocks,
@@ -127,11 +153,22 @@ class SuperNodalSolver {
   bool factorization_ready_ = false;
   bool matrix_ready_ = false;
 
+  // The (row, column) block indices (p, t) of each Jacobian triplet given at
+  // construction.
+  std::vector<std::pair<int, int>> jacobian_block_positions_;
+
   std::unique_ptr<::conex::SupernodalKKTSolver> solver_;
   // N.B. This array stores pointers to clique assemblers owned by
   // owned_clique_assemblers_.
   std::vector<CliqueAssembler*> clique_assemblers_ptrs_;
   std::vector<std::unique_ptr<CliqueAssembler>> owned_clique_assemblers_;
+  // The k-th mass matrix is the j-th mass matrix of clique assembler i, where
+  // (i, j) = mass_matrix_locations_[k].
+  std::vector<std::pair<int, int>> mass_matrix_locations_;
+
+  // Non-null if and only if the solver was constructed with more than one
+  // thread, in which case it is used in place of solver_.
+  std::unique_ptr<BlockSparseSolver> block_sparse_solver_;
 };
 
 }  // namespace internal
@@ -0,0 +1,168 @@
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/* Makes a symmetric positive definite matrix with the given sparsity pattern
+ and arbitrary (but diagonally dominant) values. */
+BlockSparseSymmetricMatrix MakeSpdMatrix(const BlockSparsityPattern& pattern,
+                                         unsigned int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  auto make_random = [&](int rows, int cols) {
+    MatrixXd A(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        A(i, j) = distribution(generator);
+      }
+    }
+    return A;
+  };
+  BlockSparseSymmetricMatrix A(pattern);
+  const std::vector<int>& sizes = pattern.block_sizes();
+  int size = 0;
+  for (int s : sizes) size += s;
+  for (int j = 0; j < ssize(sizes); ++j) {
+    for (int i : pattern.neighbors()[j]) {
+      if (i == j) {
+        const MatrixXd R = make_random(sizes[j], sizes[j]);
+        A.SetBlock(j, j,
+                   R * R.transpose() +
+                       size * MatrixXd::Identity(sizes[j], sizes[j]));
+      } else {
+        A.SetBlock(i, j, make_random(sizes[i], sizes[j]));
+      }
+    }
+  }
+  return A;
+}
+
+/* The pattern of a pile of objects: a few stacks of objects in which each
+ object touches the one below it, plus objects resting across neighboring
+ stacks. Objects have either six degrees of freedom (free bodies) or a few
+ more (articulated). */
+BlockSparsityPattern MakePilePattern() {
+  const int num_stacks = 6;
+  const int height = 5;
+  const int n = num_stacks * height;
+  std::vector<int> sizes(n);
+  std::vector<std::vector<int>> neighbors(n);
+  for (int s = 0; s < num_stacks; ++s) {
+    for (int h = 0; h < height; ++h) {
+      const int i = s * height + h;
+      sizes[i] = (i % 4 == 0) ? 9 : 6;
+      neighbors[i].push_back(i);
+      if (h + 1 < height) neighbors[i].push_back(i + 1);
+      // Every other stack leans on the next one at the top.
+      if (h == height - 1 && s % 2 == 0 && s + 1 < num_stacks) {
+        neighbors[i].push_back(i + height);
+      }
+    }
+  }
+  return BlockSparsityPattern(std::move(sizes), std::move(neighbors));
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, SolvesPileSystem) {
+  const BlockSparsityPattern pattern = MakePilePattern();
+  const BlockSparseSymmetricMatrix A = MakeSpdMatrix(pattern, 42);
+  const MatrixXd A_dense = A.MakeDenseMatrix();
+  const VectorXd x_expected = VectorXd::LinSpaced(A.rows(), -1.0, 2.0);
+  const VectorXd b = A_dense * x_expected;
+
+  VectorXd x_serial;
+  for (int num_threads : {1, 4}) {
+    BlockSparseCholeskySolver dut(pattern, Parallelism(num_threads));
+    EXPECT_EQ(dut.size(), A.rows());
+    // The stacks are independent branches of the elimination tree.
+    EXPECT_LT(dut.num_levels(), ssize(pattern.block_sizes()));
+    dut.SetMatrix(A);
+    ASSERT_TRUE(dut.Factor());
+    VectorXd x = b;
+    dut.SolveInPlace(&x);
+    EXPECT_TRUE(CompareMatrices(x, x_expected, 1e-12,
+                                MatrixCompareType::relative));
+    // The factorization is independent of the number of threads.
+    if (num_threads == 1) {
+      x_serial = x;
+    } else {
+      EXPECT_EQ(x, x_serial);
+    }
+
+    // Refactor with new values.
+    const BlockSparseSymmetricMatrix A2 = MakeSpdMatrix(pattern, 7);
+    dut.SetMatrix(A2);
+    ASSERT_TRUE(dut.Factor());
+    VectorXd x2 = A2.MakeDenseMatrix() * x_expected;
+    dut.SolveInPlace(&x2);
+    EXPECT_TRUE(CompareMatrices(x2, x_expected, 1e-12,
+                                MatrixCompareType::relative));
+  }
+}
+
+// The leaves of a star are eliminated before its (smaller) center, which
+// makes for two levels.
+GTEST_TEST(BlockSparseCholeskySolverTest, StarLevels) {
+  const int num_leaves = 5;
+  std::vector<int> sizes(num_leaves + 1, 6);
+  sizes[0] = 3;
+  std::vector<std::vector<int>> neighbors(num_leaves + 1);
+  neighbors[0] = {0, 1, 2, 3, 4, 5};
+  for (int i = 1; i <= num_leaves; ++i) neighbors[i] = {i};
+  const BlockSparsityPattern pattern(sizes, neighbors);
+  BlockSparseCholeskySolver dut(pattern, Parallelism(2));
+  EXPECT_EQ(dut.num_levels(), 2);
+  EXPECT_EQ(dut.elimination_order().back(), 0);
+
+  const BlockSparseSymmetricMatrix A = MakeSpdMatrix(pattern, 1);
+  dut.SetMatrix(A);
+  ASSERT_TRUE(dut.Factor());
+  const VectorXd x_expected = VectorXd::LinSpaced(A.rows(), 1.0, 3.0);
+  VectorXd x = A.MakeDenseMatrix() * x_expected;
+  dut.SolveInPlace(&x);
+  EXPECT_TRUE(
+      CompareMatrices(x, x_expected, 1e-12, MatrixCompareType::relative));
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, NotPositiveDefinite) {
+  const BlockSparsityPattern pattern = MakePilePattern();
+  BlockSparseSymmetricMatrix A = MakeSpdMatrix(pattern, 3);
+  const int last = A.block_cols() - 1;
+  A.SetBlock(last, last, -A.diagonal_block(last));
+  BlockSparseCholeskySolver dut(pattern, Parallelism(2));
+  dut.SetMatrix(A);
+  EXPECT_FALSE(dut.Factor());
+  VectorXd b = VectorXd::Ones(A.rows());
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.SolveInPlace(&b),
+                              ".*has not been successfully factored.*");
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, Misuse) {
+  const BlockSparsityPattern pattern = MakePilePattern();
+  BlockSparseCholeskySolver dut(pattern, Parallelism::None());
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Factor(), ".*call SetMatrix\\(\\) first.*");
+
+  const BlockSparsityPattern other({2, 2}, {{0, 1}, {1}});
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.SetMatrix(BlockSparseSymmetricMatrix(other)),
+      ".*sparsity pattern of the matrix differs.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
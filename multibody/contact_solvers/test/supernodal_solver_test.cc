@@ -173,16 +173,82 @@ GTEST_TEST(SupernodalSolver, InterfaceTest) {
 
   auto [G, blocks_of_G] = Make9x9SpdBlockDiagonalMatrixOf3x3SpdMatrices();
 
-  SuperNodalSolver solver(num_row_blocks_of_J, Jtriplets, blocks_of_M);
-  solver.SetWeightMatrix(blocks_of_G);
   const MatrixXd full_matrix_ref = M + J.transpose() * G * J;
-  EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-15);
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(2)}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", parallelism.num_threads()));
+    SuperNodalSolver solver(num_row_blocks_of_J, Jtriplets, blocks_of_M,
+                            parallelism);
+    solver.SetWeightMatrix(blocks_of_G);
+    EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-15);
+
+    // Make the block sizes of G incompatible with J and verify an exception is
+    // thrown.
+    std::vector<MatrixXd> bad_blocks_of_G = blocks_of_G;
+    bad_blocks_of_G.at(0) = MatrixXd::Ones(4, 4);
+    DRAKE_EXPECT_THROWS_MESSAGE(solver.SetWeightMatrix(bad_blocks_of_G),
+                                "Weight matrix incompatible with Jacobian.");
+  }
+}
+
+// Verifies that UpdateMatrices() replaces the values of J and M while keeping
+// the sparsity given at construction.
+GTEST_TEST(SupernodalSolver, UpdateMatrices) {
+  const auto [M, blocks_of_M] = Make6x6SpdBlockDiagonalMatrixOf2x2SpdMatrices();
+  const auto [G, blocks_of_G] = Make9x9SpdBlockDiagonalMatrixOf3x3SpdMatrices();
 
-  // Make the block sizes of G incompatible with J and verify an exception is
-  // thrown.
-  blocks_of_G.at(0) = MatrixXd::Ones(4, 4);
-  DRAKE_EXPECT_THROWS_MESSAGE(solver.SetWeightMatrix(blocks_of_G),
-                              "Weight matrix incompatible with Jacobian.");
+  const int num_row_blocks_of_J = 3;
+  MatrixXd J(9, 6);
+  // clang-format off
+  J << 0, 0, 0, 0, 1, 2,
+       0, 0, 0, 0, 2, 1,
+       0, 0, 0, 0, 2, 3,
+       1, 2, 0, 0, 2, 4,
+       0, 1, 0, 0, 1, 3,
+       1, 3, 0, 0, 2, 4,
+       0, 0, 1, 1, 0, 0,
+       0, 0, 2, 1, 0, 0,
+       0, 0, 3, 3, 0, 0;
+  // clang-format on
+  auto make_triplets = [](const MatrixXd& J_in) {
+    return MakeBlockTriplets(J_in, {{0, 2}, {1, 0}, {1, 2}, {2, 1}},
+                             {{0, 4}, {3, 0}, {3, 4}, {6, 2}},
+                             {{3, 2}, {3, 2}, {3, 2}, {3, 2}});
+  };
+
+  const MatrixXd J2 = 2.0 * J;
+  std::vector<MatrixXd> blocks_of_M2 = blocks_of_M;
+  for (MatrixXd& Mi : blocks_of_M2) Mi *= 3.0;
+  const MatrixXd full_matrix_ref = 3.0 * M + J2.transpose() * G * J2;
+  VectorXd x_ref;
+  x_ref.setLinSpaced(M.rows(), -1, 1);
+
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(2)}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", parallelism.num_threads()));
+    SuperNodalSolver solver(num_row_blocks_of_J, make_triplets(J), blocks_of_M,
+                            parallelism);
+    solver.SetWeightMatrix(blocks_of_G);
+    ASSERT_TRUE(solver.Factor());
+
+    solver.UpdateMatrices(make_triplets(J2), blocks_of_M2);
+    DRAKE_EXPECT_THROWS_MESSAGE(solver.Factor(), ".*weight matrix not set.*");
+    solver.SetWeightMatrix(blocks_of_G);
+    EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-13);
+    ASSERT_TRUE(solver.Factor());
+    EXPECT_NEAR((solver.Solve(full_matrix_ref * x_ref) - x_ref).norm(), 0,
+                1e-12);
+
+    // The sparsity must not change.
+    std::vector<BlockMatrixTriplet> moved_triplets = make_triplets(J2);
+    std::get<1>(moved_triplets[0]) = 1;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        solver.UpdateMatrices(moved_triplets, blocks_of_M2),
+        "Jacobian blocks differ from the ones given at construction.");
+    const std::vector<MatrixXd> bigger_blocks_of_M = {
+        MatrixXd::Identity(3, 3), MatrixXd::Identity(3, 3)};
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        solver.UpdateMatrices(make_triplets(J2), bigger_blocks_of_M),
+        "Mass matrix sizes differ from the ones given at construction.");
+  }
 }
 
 // In this test we are providing a Jacobian with an empty column block. The
@@ -543,20 +609,27 @@ GTEST_TEST(SupernodalSolver, FourStacks) {
     M.block(6 * i, 6 * i, 6, 6) = Mt;
     blocks_of_M.at(i) = Mt;
   }
-  SuperNodalSolver solver(num_row_blocks_of_J, Jtriplets, blocks_of_M);
-  solver.SetWeightMatrix(blocks_of_G);
-  MatrixXd full_matrix_ref = M + J.transpose() * G * J;
-  EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-12);
-
+  const MatrixXd full_matrix_ref = M + J.transpose() * G * J;
   // Construct arbitrary reference solution.
   VectorXd x_ref;
   x_ref.setLinSpaced(M.rows(), -1, 1);
-  solver.Factor();
-  EXPECT_NEAR((solver.Solve(full_matrix_ref * x_ref) - x_ref).norm(), 0, 1e-12);
 
-  VectorXd b = full_matrix_ref * x_ref;
-  solver.SolveInPlace(&b);
-  EXPECT_NEAR((b - x_ref).norm(), 0, 1e-8);
+  // Both the serial and the multithreaded algebra give the same answer.
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(3)}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", parallelism.num_threads()));
+    SuperNodalSolver solver(num_row_blocks_of_J, Jtriplets, blocks_of_M,
+                            parallelism);
+    solver.SetWeightMatrix(blocks_of_G);
+    EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-12);
+
+    solver.Factor();
+    EXPECT_NEAR((solver.Solve(full_matrix_ref * x_ref) - x_ref).norm(), 0,
+                1e-12);
+
+    VectorXd b = full_matrix_ref * x_ref;
+    solver.SolveInPlace(&b);
+    EXPECT_NEAR((b - x_ref).norm(), 0, 1e-8);
+  }
 }
 
 // Provide input with varying column sizes.  Verifies there
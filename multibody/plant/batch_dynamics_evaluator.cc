@@ -0,0 +1,188 @@
+#include "drake/multibody/plant/batch_dynamics_evaluator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/multibody/tree/acceleration_kinematics_cache.h"
+#include "drake/multibody/tree/articulated_body_force_cache.h"
+#include "drake/multibody/tree/multibody_tree.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+// Throws if `matrix` is not of size `rows x cols`.
+template <typename T>
+void ThrowIfWrongSize(const char* func, const char* name,
+                      const Eigen::Ref<const MatrixX<T>>& matrix, int rows,
+                      int cols) {
+  if (matrix.rows() != rows || matrix.cols() != cols) {
+    throw std::logic_error(fmt::format(
+        "BatchDynamicsEvaluator::{}(): expected '{}' to be of size {}x{} but "
+        "it is of size {}x{}.",
+        func, name, rows, cols, matrix.rows(), matrix.cols()));
+  }
+}
+
+}  // namespace
+
+template <typename T>
+struct BatchDynamicsEvaluator<T>::Worker {
+  explicit Worker(const MultibodyPlant<T>& plant)
+      : context(plant.CreateDefaultContext()),
+        forces(plant),
+        aba_force_cache(
+            internal::GetInternalTree(plant).get_topology()),
+        ac(internal::GetInternalTree(plant).get_topology()),
+        A_WB(plant.num_bodies()),
+        F_BMo_W(plant.num_bodies()),
+        vdot(plant.num_velocities()),
+        tau(plant.num_velocities()) {}
+
+  std::unique_ptr<systems::Context<T>> context;
+  MultibodyForces<T> forces;
+  internal::ArticulatedBodyForceCache<T> aba_force_cache;
+  internal::AccelerationKinematicsCache<T> ac;
+  std::vector<SpatialAcceleration<T>> A_WB;
+  std::vector<SpatialForce<T>> F_BMo_W;
+  VectorX<T> vdot;
+  VectorX<T> tau;
+};
+
+template <typename T>
+BatchDynamicsEvaluator<T>::BatchDynamicsEvaluator(
+    const MultibodyPlant<T>* plant, Parallelism parallelism)
+    : plant_(plant) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+  workers_.reserve(parallelism.num_threads());
+  for (int i = 0; i < parallelism.num_threads(); ++i) {
+    workers_.push_back(std::make_unique<Worker>(*plant));
+  }
+}
+
+template <typename T>
+BatchDynamicsEvaluator<T>::~BatchDynamicsEvaluator() = default;
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::SetParameters(
+    const systems::Context<T>& context) {
+  plant_->ValidateContext(context);
+  for (auto& worker : workers_) {
+    worker->context->get_mutable_parameters().SetFrom(
+        context.get_parameters());
+  }
+}
+
+template <typename T>
+template <typename CalcEntry>
+void BatchDynamicsEvaluator<T>::ForEachEntry(int batch_size,
+                                             const CalcEntry& calc) {
+  if (batch_size == 0) return;
+  // Never spawn more workers than entries in the batch.
+  const int num_workers = std::min(num_threads(), batch_size);
+  // We use a static partition of the batch into contiguous chunks so that
+  // each worker touches contiguous columns of the batch matrices and the
+  // assignment of entries to workers is deterministic.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_workers) schedule(static, 1)
+#endif
+  for (int w = 0; w < num_workers; ++w) {
+    Worker& worker = *workers_[w];
+    const int begin = static_cast<int>(
+        static_cast<int64_t>(batch_size) * w / num_workers);
+    const int end = static_cast<int>(
+        static_cast<int64_t>(batch_size) * (w + 1) / num_workers);
+    for (int i = begin; i < end; ++i) {
+      calc(&worker, i);
+    }
+  }
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::CalcMassMatrices(
+    const Eigen::Ref<const MatrixX<T>>& q, std::vector<MatrixX<T>>* M) {
+  DRAKE_THROW_UNLESS(M != nullptr);
+  const int nq = plant_->num_positions();
+  const int nv = plant_->num_velocities();
+  const int batch_size = q.cols();
+  ThrowIfWrongSize<T>("CalcMassMatrices", "q", q, nq, batch_size);
+
+  M->resize(batch_size);
+  for (MatrixX<T>& Mi : *M) {
+    Mi.resize(nv, nv);
+  }
+  ForEachEntry(batch_size, [this, &q, M](Worker* worker, int i) {
+    plant_->SetPositions(worker->context.get(), q.col(i));
+    plant_->CalcMassMatrix(*worker->context, &(*M)[i]);
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::CalcInverseDynamics(
+    const Eigen::Ref<const MatrixX<T>>& q,
+    const Eigen::Ref<const MatrixX<T>>& v,
+    const Eigen::Ref<const MatrixX<T>>& vdot, MatrixX<T>* tau) {
+  DRAKE_THROW_UNLESS(tau != nullptr);
+  const int nq = plant_->num_positions();
+  const int nv = plant_->num_velocities();
+  const int batch_size = q.cols();
+  ThrowIfWrongSize<T>("CalcInverseDynamics", "q", q, nq, batch_size);
+  ThrowIfWrongSize<T>("CalcInverseDynamics", "v", v, nv, batch_size);
+  ThrowIfWrongSize<T>("CalcInverseDynamics", "vdot", vdot, nv, batch_size);
+
+  tau->resize(nv, batch_size);
+  const internal::MultibodyTree<T>& tree = internal::GetInternalTree(*plant_);
+  ForEachEntry(batch_size, [&](Worker* worker, int i) {
+    systems::Context<T>& context = *worker->context;
+    plant_->SetPositions(&context, q.col(i));
+    plant_->SetVelocities(&context, v.col(i));
+    plant_->CalcForceElementsContribution(context, &worker->forces);
+    worker->vdot = vdot.col(i);
+    tree.CalcInverseDynamics(
+        context, worker->vdot, worker->forces.body_forces(),
+        worker->forces.generalized_forces(), &worker->A_WB,
+        &worker->F_BMo_W, &worker->tau);
+    tau->col(i) = worker->tau;
+  });
+}
+
+template <typename T>
+void BatchDynamicsEvaluator<T>::CalcForwardDynamics(
+    const Eigen::Ref<const MatrixX<T>>& q,
+    const Eigen::Ref<const MatrixX<T>>& v,
+    const Eigen::Ref<const MatrixX<T>>& tau, MatrixX<T>* vdot) {
+  DRAKE_THROW_UNLESS(vdot != nullptr);
+  const int nq = plant_->num_positions();
+  const int nv = plant_->num_velocities();
+  const int batch_size = q.cols();
+  ThrowIfWrongSize<T>("CalcForwardDynamics", "q", q, nq, batch_size);
+  ThrowIfWrongSize<T>("CalcForwardDynamics", "v", v, nv, batch_size);
+  ThrowIfWrongSize<T>("CalcForwardDynamics", "tau", tau, nv, batch_size);
+
+  vdot->resize(nv, batch_size);
+  const internal::MultibodyTree<T>& tree = internal::GetInternalTree(*plant_);
+  ForEachEntry(batch_size, [&](Worker* worker, int i) {
+    systems::Context<T>& context = *worker->context;
+    plant_->SetPositions(&context, q.col(i));
+    plant_->SetVelocities(&context, v.col(i));
+    plant_->CalcForceElementsContribution(context, &worker->forces);
+    worker->forces.mutable_generalized_forces() += tau.col(i);
+    // The articulated body inertias are cached in the context as a function
+    // of q only, while the force bias terms are recomputed for each entry.
+    tree.CalcArticulatedBodyForceCache(context, worker->forces,
+                                       &worker->aba_force_cache);
+    tree.CalcArticulatedBodyAccelerations(context, worker->aba_force_cache,
+                                          &worker->ac);
+    vdot->col(i) = worker->ac.get_vdot();
+  });
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BatchDynamicsEvaluator)
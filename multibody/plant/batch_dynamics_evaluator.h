@@ -0,0 +1,138 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/** %BatchDynamicsEvaluator evaluates the rigid body dynamics of a single
+MultibodyPlant model at a whole batch of states with one call.
+
+Applications such as Monte Carlo analysis, sampling-based planning or policy
+rollouts often evaluate the same model at thousands of (q, v) pairs. Doing so
+through the single-state MultibodyPlant APIs requires the caller to juggle one
+Context per state, which carries significant allocation and cache bookkeeping
+costs. This class instead owns a small, fixed set of scratch contexts and
+multibody workspaces (one per worker thread) that are allocated once at
+construction and reused for every entry of every batch. Batch entries are
+distributed in contiguous chunks over the workers, so results are independent
+of the degree of parallelism.
+
+Batches are provided in a "structure of arrays" layout: the i-th column of
+each argument stores the quantity for the i-th batch entry. For instance, for
+a batch of size N, the generalized positions are given as a `nq x N` matrix and
+the generalized velocities as a `nv x N` matrix, where `nq` and `nv` are the
+number of generalized positions and velocities of the plant, respectively.
+
+All evaluations use the parameters of a default context of the plant unless
+overridden with SetParameters(). Input ports are not evaluated and contact
+forces are not included; only forces produced by force elements (e.g.,
+gravity) are accounted for, together with any explicitly provided generalized
+forces.
+
+Calls into a given %BatchDynamicsEvaluator are not thread safe since the
+scratch workspaces are shared between calls; use one evaluator per calling
+thread if needed.
+
+@tparam_default_scalar */
+template <typename T>
+class BatchDynamicsEvaluator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchDynamicsEvaluator)
+
+  /** Constructs an evaluator for the given `plant`.
+  @param plant The model to evaluate. It is aliased and must outlive this
+    object.
+  @param parallelism The degree of parallelism used to evaluate the entries of
+    a batch. Parallel evaluation requires Drake to be built with OpenMP
+    enabled; otherwise entries are evaluated sequentially.
+  @throws std::exception if `plant` is nullptr or if it is not finalized. */
+  explicit BatchDynamicsEvaluator(
+      const MultibodyPlant<T>* plant,
+      Parallelism parallelism = Parallelism::None());
+
+  ~BatchDynamicsEvaluator();
+
+  /** Returns the plant this evaluator was constructed with. */
+  const MultibodyPlant<T>& plant() const { return *plant_; }
+
+  /** Returns the number of worker threads used to evaluate a batch. */
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+  /** Copies the parameters stored in the given `context` (e.g. masses and
+  inertias) so that they are used by all subsequent batch evaluations.
+  @throws std::exception if `context` does not belong to plant(). */
+  void SetParameters(const systems::Context<T>& context);
+
+  /** For each batch entry `i`, computes the mass matrix `M(q)` at the
+  configuration `q.col(i)`. See MultibodyPlant::CalcMassMatrix().
+  @param[in] q A `nq x N` matrix of generalized positions.
+  @param[out] M On output, a vector of size N with the `nv x nv` mass matrix
+    for each batch entry. Existing entries are reused when already of the
+    right size, so that repeated calls do not allocate.
+  @throws std::exception if `M` is nullptr or if `q` does not have nq rows. */
+  void CalcMassMatrices(const Eigen::Ref<const MatrixX<T>>& q,
+                        std::vector<MatrixX<T>>* M);
+
+  /** For each batch entry `i`, computes the generalized forces
+  `tau.col(i)` needed to attain the generalized accelerations `vdot.col(i)`
+  at the state given by `q.col(i)` and `v.col(i)`. That is, <pre>
+    tau = M(q)v̇ + C(q, v)v - tau_app
+  </pre>
+  where `tau_app` includes the forces exerted by force elements (e.g.,
+  gravity). See MultibodyPlant::CalcInverseDynamics().
+  @param[in] q A `nq x N` matrix of generalized positions.
+  @param[in] v A `nv x N` matrix of generalized velocities.
+  @param[in] vdot A `nv x N` matrix of generalized accelerations.
+  @param[out] tau On output, the `nv x N` matrix of generalized forces. It is
+    resized if needed.
+  @throws std::exception if `tau` is nullptr or if the sizes of the inputs
+    are inconsistent. */
+  void CalcInverseDynamics(const Eigen::Ref<const MatrixX<T>>& q,
+                           const Eigen::Ref<const MatrixX<T>>& v,
+                           const Eigen::Ref<const MatrixX<T>>& vdot,
+                           MatrixX<T>* tau);
+
+  /** For each batch entry `i`, computes the generalized accelerations
+  `vdot.col(i)` at the state given by `q.col(i)` and `v.col(i)` when the
+  generalized forces `tau.col(i)` are applied in addition to the forces exerted
+  by force elements (e.g. gravity). Accelerations are computed in `O(n)` with
+  the Articulated Body Algorithm.
+  @param[in] q A `nq x N` matrix of generalized positions.
+  @param[in] v A `nv x N` matrix of generalized velocities.
+  @param[in] tau A `nv x N` matrix of applied generalized forces.
+  @param[out] vdot On output, the `nv x N` matrix of generalized
+    accelerations. It is resized if needed.
+  @throws std::exception if `vdot` is nullptr or if the sizes of the inputs
+    are inconsistent. */
+  void CalcForwardDynamics(const Eigen::Ref<const MatrixX<T>>& q,
+                           const Eigen::Ref<const MatrixX<T>>& v,
+                           const Eigen::Ref<const MatrixX<T>>& tau,
+                           MatrixX<T>* vdot);
+
+ private:
+  // Per-thread scratch data. Defined in the .cc file.
+  struct Worker;
+
+  // Invokes calc(worker, i) for each batch entry i in [0, batch_size), where
+  // the batch is partitioned in contiguous chunks, one per worker.
+  template <typename CalcEntry>
+  void ForEachEntry(int batch_size, const CalcEntry& calc);
+
+  const MultibodyPlant<T>* const plant_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BatchDynamicsEvaluator)
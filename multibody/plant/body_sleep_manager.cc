@@ -0,0 +1,194 @@
+#include "drake/multibody/plant/body_sleep_manager.h"
+
+#include <algorithm>
+
+#include "drake/common/sorted_pair.h"
+#include "drake/geometry/collision_filter_declaration.h"
+#include "drake/geometry/geometry_set.h"
+#include "drake/geometry/query_object.h"
+
+namespace drake {
+namespace multibody {
+
+using geometry::CollisionFilterDeclaration;
+using geometry::GeometryId;
+using geometry::GeometrySet;
+using geometry::QueryObject;
+using systems::Context;
+
+BodySleepManager::BodySleepManager(
+    const MultibodyPlant<double>* plant,
+    const geometry::SceneGraph<double>* scene_graph,
+    const BodySleepParameters& parameters)
+    : plant_(plant), scene_graph_(scene_graph), parameters_(parameters) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(scene_graph != nullptr);
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+  DRAKE_THROW_UNLESS(plant->is_discrete());
+  DRAKE_THROW_UNLESS(plant->geometry_source_is_registered());
+  DRAKE_THROW_UNLESS(parameters.linear_velocity_threshold >= 0.0);
+  DRAKE_THROW_UNLESS(parameters.angular_velocity_threshold >= 0.0);
+  DRAKE_THROW_UNLESS(parameters.time_to_sleep >= 0.0);
+
+  const int num_bodies = plant->num_bodies();
+  is_managed_.resize(num_bodies, false);
+  is_sleeping_.resize(num_bodies, false);
+  rest_start_time_.resize(num_bodies);
+
+  for (BodyIndex b(0); b < num_bodies; ++b) {
+    is_managed_[b] = plant->get_body(b).is_floating();
+  }
+  // Floating bodies with outboard joints are the base of an articulated tree.
+  // Locking only the base would not freeze the tree, so those are not managed.
+  for (JointIndex j(0); j < plant->num_joints(); ++j) {
+    is_managed_[plant->get_joint(j).parent_body().index()] = false;
+  }
+
+  for (BodyIndex b(0); b < num_bodies; ++b) {
+    const Body<double>& body = plant->get_body(b);
+    if (plant->IsAnchored(body)) {
+      const std::vector<GeometryId>& ids =
+          plant->GetCollisionGeometriesForBody(body);
+      anchored_geometries_.insert(anchored_geometries_.end(), ids.begin(),
+                                  ids.end());
+    }
+  }
+}
+
+BodySleepManager::~BodySleepManager() = default;
+
+void BodySleepManager::Update(Context<double>* root_context) {
+  DRAKE_THROW_UNLESS(root_context != nullptr);
+  Context<double>& plant_context =
+      plant_->GetMyMutableContextFromRoot(root_context);
+  const double time = plant_context.get_time();
+  const int num_bodies = plant_->num_bodies();
+
+  // Classify every body, managed or not, as moving or at rest. Sleeping and
+  // anchored bodies have zero velocity and are never moving.
+  std::vector<bool> is_moving(num_bodies, false);
+  for (BodyIndex b(0); b < num_bodies; ++b) {
+    const SpatialVelocity<double>& V_WB =
+        plant_->EvalBodySpatialVelocityInWorld(plant_context,
+                                               plant_->get_body(b));
+    is_moving[b] = V_WB.translational().norm() >
+                       parameters_.linear_velocity_threshold ||
+                   V_WB.rotational().norm() >
+                       parameters_.angular_velocity_threshold;
+  }
+
+  for (BodyIndex b(0); b < num_bodies; ++b) {
+    if (!is_managed_[b] || is_sleeping_[b]) continue;
+    if (is_moving[b]) {
+      rest_start_time_[b] = std::nullopt;
+    } else if (!rest_start_time_[b].has_value()) {
+      rest_start_time_[b] = time;
+    }
+  }
+
+  // A body has a moving neighbor if the broad phase reports a candidate pair
+  // between any of its geometries and a geometry of a moving body.
+  std::vector<bool> has_moving_neighbor(num_bodies, false);
+  {
+    const auto& query_object =
+        plant_->get_geometry_query_input_port().Eval<QueryObject<double>>(
+            plant_context);
+    const auto& inspector = query_object.inspector();
+    const std::vector<SortedPair<GeometryId>> candidates =
+        query_object.FindCollisionCandidates();
+    for (const SortedPair<GeometryId>& pair : candidates) {
+      const Body<double>* body_A =
+          plant_->GetBodyFromFrameId(inspector.GetFrameId(pair.first()));
+      const Body<double>* body_B =
+          plant_->GetBodyFromFrameId(inspector.GetFrameId(pair.second()));
+      if (body_A == nullptr || body_B == nullptr) continue;
+      if (is_moving[body_A->index()]) {
+        has_moving_neighbor[body_B->index()] = true;
+      }
+      if (is_moving[body_B->index()]) {
+        has_moving_neighbor[body_A->index()] = true;
+      }
+    }
+  }
+
+  bool sleeping_set_changed = false;
+  for (BodyIndex b(0); b < num_bodies; ++b) {
+    if (!is_managed_[b]) continue;
+    const Body<double>& body = plant_->get_body(b);
+    if (is_sleeping_[b]) {
+      if (has_moving_neighbor[b]) {
+        body.Unlock(&plant_context);
+        is_sleeping_[b] = false;
+        rest_start_time_[b] = time;
+        sleeping_set_changed = true;
+      }
+    } else if (rest_start_time_[b].has_value() &&
+               time - *rest_start_time_[b] >= parameters_.time_to_sleep &&
+               !has_moving_neighbor[b] && !body.is_locked(plant_context)) {
+      body.Lock(&plant_context);
+      is_sleeping_[b] = true;
+      sleeping_set_changed = true;
+    }
+  }
+
+  if (sleeping_set_changed) UpdateCollisionFilters(root_context);
+}
+
+void BodySleepManager::WakeAll(Context<double>* root_context) {
+  DRAKE_THROW_UNLESS(root_context != nullptr);
+  Context<double>& plant_context =
+      plant_->GetMyMutableContextFromRoot(root_context);
+  const double time = plant_context.get_time();
+  bool sleeping_set_changed = false;
+  for (BodyIndex b(0); b < plant_->num_bodies(); ++b) {
+    if (!is_sleeping_[b]) continue;
+    plant_->get_body(b).Unlock(&plant_context);
+    is_sleeping_[b] = false;
+    rest_start_time_[b] = time;
+    sleeping_set_changed = true;
+  }
+  if (sleeping_set_changed) UpdateCollisionFilters(root_context);
+}
+
+bool BodySleepManager::is_managed(const Body<double>& body) const {
+  DRAKE_THROW_UNLESS(&body.GetParentPlant() == plant_);
+  return is_managed_[body.index()];
+}
+
+bool BodySleepManager::is_sleeping(const Body<double>& body) const {
+  DRAKE_THROW_UNLESS(&body.GetParentPlant() == plant_);
+  return is_sleeping_[body.index()];
+}
+
+int BodySleepManager::num_sleeping_bodies() const {
+  return std::count(is_sleeping_.begin(), is_sleeping_.end(), true);
+}
+
+void BodySleepManager::UpdateCollisionFilters(Context<double>* root_context) {
+  Context<double>& scene_graph_context =
+      scene_graph_->GetMyMutableContextFromRoot(root_context);
+  geometry::CollisionFilterManager filter_manager =
+      scene_graph_->collision_filter_manager(&scene_graph_context);
+  if (filter_id_.has_value()) {
+    filter_manager.RemoveDeclaration(*filter_id_);
+    filter_id_ = std::nullopt;
+  }
+
+  std::vector<GeometryId> sleeping_geometries;
+  for (BodyIndex b(0); b < plant_->num_bodies(); ++b) {
+    if (!is_sleeping_[b]) continue;
+    const std::vector<GeometryId>& ids =
+        plant_->GetCollisionGeometriesForBody(plant_->get_body(b));
+    sleeping_geometries.insert(sleeping_geometries.end(), ids.begin(),
+                               ids.end());
+  }
+  if (sleeping_geometries.empty()) return;
+
+  GeometrySet excluded(sleeping_geometries);
+  excluded.Add(anchored_geometries_);
+  filter_id_ = filter_manager.ApplyTransient(
+      CollisionFilterDeclaration().ExcludeWithin(excluded));
+}
+
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/** Parameters controlling when BodySleepManager deactivates ("puts to sleep")
+resting bodies. */
+struct BodySleepParameters {
+  /** Passes this object to an Archive.
+  Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(linear_velocity_threshold));
+    a->Visit(DRAKE_NVP(angular_velocity_threshold));
+    a->Visit(DRAKE_NVP(time_to_sleep));
+  }
+
+  /** Upper bound, in m/s, on the magnitude of the translational velocity of
+  the origin of a body considered to be at rest. */
+  double linear_velocity_threshold{1.0e-3};
+  /** Upper bound, in rad/s, on the magnitude of the angular velocity of a
+  body considered to be at rest. */
+  double angular_velocity_threshold{1.0e-2};
+  /** A body falls asleep once it has been continuously at rest for at least
+  this amount of time, in seconds, and none of its contact candidates is
+  moving. */
+  double time_to_sleep{0.5};
+};
+
+/** %BodySleepManager deactivates free bodies that come to rest in a discrete
+MultibodyPlant and reactivates them when a moving body approaches them.
+
+Scenes such as bin picking or clutter clearing contain many objects that sit
+still for most of a simulation. Still, every time step pays the full cost of
+their contact queries and of their degrees of freedom in the contact solver.
+This class puts such bodies to "sleep": their floating joint is locked (see
+Body::Lock()), which freezes their state and removes their degrees of freedom
+from the contact problem, and the collision filters of the SceneGraph context
+are updated so that sleeping bodies are excluded from the proximity queries
+against each other and against anchored geometry. A sleeping body is woken
+(unlocked) as soon as the broad phase reports a candidate pair between it and
+a body that is moving.
+
+Only free bodies are managed, i.e. floating bodies that are not the parent
+body of any other joint. Anchored bodies, as well as bodies locked by other
+means, are treated as static scenery. Since locked joints are only supported
+for discrete models, the plant must be discrete.
+
+Sleeping is opt-in: applications create a manager and call Update() between
+simulation steps, e.g.
+@code
+BodySleepManager sleep_manager(&plant, &scene_graph);
+for (double t = dt; t <= t_final; t += dt) {
+  simulator.AdvanceTo(t);
+  sleep_manager.Update(&simulator.get_mutable_context());
+}
+@endcode
+
+The manager keeps per body timers and therefore tracks a single Context; use
+one manager per simulated context.
+
+@experimental */
+class BodySleepManager {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BodySleepManager)
+
+  /** Constructs a manager for the free bodies of `plant`.
+  @param plant A finalized discrete model. It is aliased and must outlive this
+    object.
+  @param scene_graph The SceneGraph `plant` is registered with. It is aliased
+    and must outlive this object.
+  @throws std::exception if either pointer is nullptr, if `plant` is not
+    finalized, if `plant` is not discrete, if `plant` is not registered as a
+    source for geometry or if any of the thresholds in `parameters` is
+    negative. */
+  BodySleepManager(const MultibodyPlant<double>* plant,
+                   const geometry::SceneGraph<double>* scene_graph,
+                   const BodySleepParameters& parameters = {});
+
+  ~BodySleepManager();
+
+  /** Returns the parameters this manager was constructed with. */
+  const BodySleepParameters& parameters() const { return parameters_; }
+
+  /** Updates the sleeping state of each managed body given the state stored
+  in `root_context`, which must be the root context of a Diagram containing
+  both the plant and the scene graph given at construction. Bodies that have
+  rested for at least BodySleepParameters::time_to_sleep and that have no
+  moving neighbors are put to sleep, while sleeping bodies with a moving
+  neighbor are woken up. Collision filters are updated whenever the set of
+  sleeping bodies changes.
+  @throws std::exception if `root_context` is nullptr. */
+  void Update(systems::Context<double>* root_context);
+
+  /** Wakes up all sleeping bodies and removes the collision filters applied
+  by this manager, restoring `root_context` to its fully active state.
+  @throws std::exception if `root_context` is nullptr. */
+  void WakeAll(systems::Context<double>* root_context);
+
+  /** Returns `true` if `body` is a free body managed by `this` manager. */
+  bool is_managed(const Body<double>& body) const;
+
+  /** Returns `true` if `body` was put to sleep by `this` manager. */
+  bool is_sleeping(const Body<double>& body) const;
+
+  /** Returns the number of bodies currently asleep. */
+  int num_sleeping_bodies() const;
+
+ private:
+  // Replaces the collision filter declaration applied by this manager (if
+  // any) with one that excludes collisions among sleeping bodies and anchored
+  // geometry.
+  void UpdateCollisionFilters(systems::Context<double>* root_context);
+
+  const MultibodyPlant<double>* plant_{nullptr};
+  const geometry::SceneGraph<double>* scene_graph_{nullptr};
+  BodySleepParameters parameters_;
+
+  // Indexed by BodyIndex.
+  std::vector<bool> is_managed_;
+  std::vector<bool> is_sleeping_;
+  // The time at which a managed awake body was first seen at rest, or
+  // std::nullopt if it is moving.
+  std::vector<std::optional<double>> rest_start_time_;
+
+  // Geometries welded to the world, excluded from queries against sleeping
+  // bodies.
+  std::vector<geometry::GeometryId> anchored_geometries_;
+  // The transient filter declaration currently applied by this manager.
+  std::optional<geometry::FilterId> filter_id_;
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -2128,7 +2128,7 @@ void MultibodyPlant<T>::AddJointActuationForces(
   this->ValidateContext(context);
   DRAKE_DEMAND(forces != nullptr);
   if (num_actuators() > 0) {
-    const VectorX<T> u = AssembleActuationInput(context);
+    const VectorX<T>& u = AssembleActuationInput(context);
     for (JointActuatorIndex actuator_index(0);
          actuator_index < num_actuators(); ++actuator_index) {
       const JointActuator<T>& actuator =
@@ -2192,13 +2192,16 @@ void MultibodyPlant<T>::AddJointLimitsPenaltyForces(
 }
 
 template<typename T>
-VectorX<T> MultibodyPlant<T>::AssembleActuationInput(
+const VectorX<T>& MultibodyPlant<T>::AssembleActuationInput(
     const systems::Context<T>& context) const {
   this->ValidateContext(context);
 
   // Assemble the vector from the model instance input ports.
-  // TODO(sherm1) Heap allocation here. Get rid of it.
-  VectorX<T> actuation_input(num_actuated_dofs());
+  VectorX<T>& actuation_input =
+      this->get_cache_entry(cache_indexes_.actuation_input_scratch)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<VectorX<T>>();
+  DRAKE_DEMAND(actuation_input.size() == num_actuated_dofs());
 
   const auto& actuation_port = this->get_input_port(actuation_port_);
   const ModelInstanceIndex first_non_world_index(1);
@@ -2895,6 +2898,17 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
       {this->all_parameters_ticket()});
   cache_indexes_.joint_locking_data_per_tree =
       joint_locking_data_per_tree_cache_entry.cache_index();
+
+  // Scratch storage for AssembleActuationInput(), allocated as a cache entry
+  // to avoid heap operations during simulation. It has no prerequisites; its
+  // value is always overwritten before use.
+  cache_indexes_.actuation_input_scratch =
+      this->DeclareCacheEntry(
+              std::string("Actuation input scratch"),
+              systems::ValueProducer(VectorX<T>(num_actuated_dofs()),
+                                     &systems::ValueProducer::NoopCalc),
+              {this->nothing_ticket()})
+          .cache_index();
 }
 
 template <typename T>
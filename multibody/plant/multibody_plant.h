@@ -4646,6 +4646,7 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // MultibodyPlant specific cache entries. These are initialized at Finalize()
   // when the plant declares its cache entries.
   struct CacheIndexes {
+    systems::CacheIndex actuation_input_scratch;
     systems::CacheIndex contact_info_and_body_spatial_forces;
     systems::CacheIndex contact_results;
     systems::CacheIndex contact_surfaces;
@@ -4780,8 +4781,9 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   void EstimatePointContactParameters(double penetration_allowance);
 
   // Helper method to assemble actuation input vector from the appropriate
-  // ports.
-  VectorX<T> AssembleActuationInput(
+  // ports. The returned reference is to scratch storage in `context`; it is
+  // only valid until the next call.
+  const VectorX<T>& AssembleActuationInput(
       const systems::Context<T>& context) const;
 
   // Computes all non-contact applied forces including:
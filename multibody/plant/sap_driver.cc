@@ -81,6 +81,13 @@ void SapDriver<T>::DeclareCacheEntries(
                              &SapDriver<T>::CalcContactProblemCache),
       state_input_and_parameters);
   contact_problem_ = contact_problem_cache_entry.cache_index();
+
+  const auto& sap_solver_scratch_entry = mutable_manager->DeclareCacheEntry(
+      "SAP solver scratch",
+      systems::ValueProducer(SapSolverScratch<T>(),
+                             &systems::ValueProducer::NoopCalc),
+      {systems::SystemBase::nothing_ticket()});
+  sap_solver_scratch_ = sap_solver_scratch_entry.cache_index();
 }
 
 template <typename T>
@@ -725,8 +732,17 @@ void SapDriver<T>::CalcContactSolverResults(
     }
   }
 
-  // Solve contact problem.
-  SapSolver<T> sap;
+  // Solve contact problem. To reuse its symbolic analysis across time steps,
+  // the solver is kept in the context's scratch.
+  SapSolver<T> local_sap;
+  SapSolver<T>& sap =
+      sap_parameters_.reuse_symbolic_analysis
+          ? *plant()
+                 .get_cache_entry(sap_solver_scratch_)
+                 .get_mutable_cache_entry_value(context)
+                 .template GetMutableValueOrThrow<SapSolverScratch<T>>()
+                 .solver
+          : local_sap;
   sap.set_parameters(sap_parameters_);
   SapSolverResults<T> sap_results;
   const SapSolverStatus status =
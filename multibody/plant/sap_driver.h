@@ -46,6 +46,22 @@ struct ContactProblemCache {
   std::vector<math::RotationMatrix<T>> R_WC;
 };
 
+// Scratch cache entry value that keeps a SapSolver alive across discrete
+// updates so that it can reuse the symbolic analysis of its linear algebra.
+// See SapSolverParameters::reuse_symbolic_analysis. A copy starts with a fresh
+// solver, since the reusable data is only an optimization.
+template <typename T>
+struct SapSolverScratch {
+  SapSolverScratch()
+      : solver(std::make_unique<contact_solvers::internal::SapSolver<T>>()) {}
+  SapSolverScratch(const SapSolverScratch&) : SapSolverScratch() {}
+  SapSolverScratch& operator=(const SapSolverScratch&) {
+    solver = std::make_unique<contact_solvers::internal::SapSolver<T>>();
+    return *this;
+  }
+  std::unique_ptr<contact_solvers::internal::SapSolver<T>> solver;
+};
+
 // Performs the computations needed by CompliantContactManager for discrete
 // updates using the SAP solver. A const manager is provided at construction so
 // that the driver has access to the const model and computation services
@@ -224,6 +240,7 @@ class SapDriver {
   // Near rigid regime parameter for contact constraints.
   const double near_rigid_threshold_;
   systems::CacheIndex contact_problem_;
+  systems::CacheIndex sap_solver_scratch_;
   // Vector of joint damping coefficients, of size plant().num_velocities().
   // This information is extracted during the call to ExtractModelInfo().
   VectorX<T> joint_damping_;
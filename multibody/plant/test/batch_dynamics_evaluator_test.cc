@@ -0,0 +1,183 @@
+#include "drake/multibody/plant/batch_dynamics_evaluator.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+constexpr double kTolerance = 1.0e-12;
+
+// Fixture setting up a plant with a welded arm and a free floating body, so
+// that the number of generalized positions and velocities differ.
+class BatchDynamicsEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Parser parser(&plant_);
+    const ModelInstanceIndex arm = parser.AddModels(FindResourceOrThrow(
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_no_collision.sdf")).at(0);
+    plant_.WeldFrames(plant_.world_frame(),
+                      plant_.GetFrameByName("iiwa_link_0", arm));
+    box_ = &plant_.AddRigidBody(
+        "box", SpatialInertia<double>::SolidBoxWithMass(2.0, 0.1, 0.2, 0.3));
+    plant_.Finalize();
+    context_ = plant_.CreateDefaultContext();
+
+    // Make a batch of arbitrary, though valid, states.
+    q_.resize(plant_.num_positions(), kBatchSize);
+    v_.resize(plant_.num_velocities(), kBatchSize);
+    for (int i = 0; i < kBatchSize; ++i) {
+      const double s = 0.1 * (i + 1);
+      plant_.SetFreeBodyPose(
+          context_.get(), *box_,
+          RigidTransformd(RollPitchYawd(s, -2.0 * s, 0.5 * s),
+                          Vector3<double>(s, 1.0, -s)));
+      const VectorX<double> q_arm =
+          VectorX<double>::LinSpaced(7, -s, 2.0 * s);
+      plant_.SetPositions(context_.get(), arm, q_arm);
+      q_.col(i) = plant_.GetPositions(*context_);
+      v_.col(i) = VectorX<double>::LinSpaced(plant_.num_velocities(), s, -s);
+    }
+    vdot_ = 0.5 * v_;
+  }
+
+  static constexpr int kBatchSize = 7;
+  MultibodyPlant<double> plant_{0.0};
+  const RigidBody<double>* box_{nullptr};
+  std::unique_ptr<Context<double>> context_;
+  MatrixX<double> q_;
+  MatrixX<double> v_;
+  MatrixX<double> vdot_;
+};
+
+TEST_F(BatchDynamicsEvaluatorTest, Construction) {
+  const BatchDynamicsEvaluator<double> serial(&plant_);
+  EXPECT_EQ(&serial.plant(), &plant_);
+  EXPECT_EQ(serial.num_threads(), 1);
+  const BatchDynamicsEvaluator<double> parallel(&plant_, Parallelism(3));
+  EXPECT_EQ(parallel.num_threads(), 3);
+
+  MultibodyPlant<double> not_finalized(0.0);
+  EXPECT_THROW(BatchDynamicsEvaluator<double>{&not_finalized},
+               std::exception);
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, MassMatrices) {
+  BatchDynamicsEvaluator<double> dut(&plant_);
+  std::vector<MatrixX<double>> M;
+  dut.CalcMassMatrices(q_, &M);
+  ASSERT_EQ(ssize(M), kBatchSize);
+  MatrixX<double> M_expected(plant_.num_velocities(),
+                             plant_.num_velocities());
+  for (int i = 0; i < kBatchSize; ++i) {
+    plant_.SetPositions(context_.get(), q_.col(i));
+    plant_.CalcMassMatrix(*context_, &M_expected);
+    EXPECT_TRUE(CompareMatrices(M[i], M_expected, kTolerance));
+  }
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, InverseDynamics) {
+  BatchDynamicsEvaluator<double> dut(&plant_);
+  MatrixX<double> tau;
+  dut.CalcInverseDynamics(q_, v_, vdot_, &tau);
+  ASSERT_EQ(tau.rows(), plant_.num_velocities());
+  ASSERT_EQ(tau.cols(), kBatchSize);
+  MultibodyForces<double> forces(plant_);
+  for (int i = 0; i < kBatchSize; ++i) {
+    plant_.SetPositions(context_.get(), q_.col(i));
+    plant_.SetVelocities(context_.get(), v_.col(i));
+    plant_.CalcForceElementsContribution(*context_, &forces);
+    const VectorX<double> tau_expected =
+        plant_.CalcInverseDynamics(*context_, vdot_.col(i), forces);
+    EXPECT_TRUE(CompareMatrices(tau.col(i), tau_expected, kTolerance));
+  }
+}
+
+// Forward dynamics must invert inverse dynamics.
+TEST_F(BatchDynamicsEvaluatorTest, ForwardDynamics) {
+  BatchDynamicsEvaluator<double> dut(&plant_);
+  MatrixX<double> tau;
+  dut.CalcInverseDynamics(q_, v_, vdot_, &tau);
+  MatrixX<double> vdot;
+  dut.CalcForwardDynamics(q_, v_, tau, &vdot);
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_, 1.0e-10));
+}
+
+// Results must not depend on the degree of parallelism.
+TEST_F(BatchDynamicsEvaluatorTest, Parallel) {
+  BatchDynamicsEvaluator<double> serial(&plant_);
+  BatchDynamicsEvaluator<double> parallel(&plant_, Parallelism(3));
+
+  std::vector<MatrixX<double>> M_serial, M_parallel;
+  serial.CalcMassMatrices(q_, &M_serial);
+  parallel.CalcMassMatrices(q_, &M_parallel);
+  for (int i = 0; i < kBatchSize; ++i) {
+    EXPECT_EQ(M_serial[i], M_parallel[i]);
+  }
+
+  const MatrixX<double> tau = MatrixX<double>::Ones(
+      plant_.num_velocities(), kBatchSize);
+  MatrixX<double> vdot_serial, vdot_parallel;
+  serial.CalcForwardDynamics(q_, v_, tau, &vdot_serial);
+  parallel.CalcForwardDynamics(q_, v_, tau, &vdot_parallel);
+  EXPECT_EQ(vdot_serial, vdot_parallel);
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, SetParameters) {
+  BatchDynamicsEvaluator<double> dut(&plant_);
+  auto context = plant_.CreateDefaultContext();
+  box_->SetMass(context.get(), 7.0);
+  dut.SetParameters(*context);
+
+  std::vector<MatrixX<double>> M;
+  dut.CalcMassMatrices(q_, &M);
+  MatrixX<double> M_expected(plant_.num_velocities(),
+                             plant_.num_velocities());
+  plant_.SetPositions(context.get(), q_.col(0));
+  plant_.CalcMassMatrix(*context, &M_expected);
+  EXPECT_TRUE(CompareMatrices(M[0], M_expected, kTolerance));
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, EmptyBatch) {
+  BatchDynamicsEvaluator<double> dut(&plant_, Parallelism(2));
+  const MatrixX<double> q(plant_.num_positions(), 0);
+  const MatrixX<double> v(plant_.num_velocities(), 0);
+  MatrixX<double> vdot;
+  dut.CalcForwardDynamics(q, v, v, &vdot);
+  EXPECT_EQ(vdot.cols(), 0);
+}
+
+TEST_F(BatchDynamicsEvaluatorTest, WrongSizes) {
+  BatchDynamicsEvaluator<double> dut(&plant_);
+  MatrixX<double> tau;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.CalcInverseDynamics(q_, v_.leftCols(2), vdot_, &tau),
+      "BatchDynamicsEvaluator::CalcInverseDynamics\\(\\): expected 'v' to be "
+      "of size 13x7 but it is of size 13x2.");
+  std::vector<MatrixX<double>> M;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.CalcMassMatrices(v_, &M),
+      "BatchDynamicsEvaluator::CalcMassMatrices\\(\\): expected 'q' to be of "
+      "size 14x7 but it is of size 13x7.");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,165 @@
+#include "drake/multibody/plant/body_sleep_manager.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/query_object.h"
+#include "drake/multibody/plant/multibody_plant_config_functions.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::HalfSpace;
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::Sphere;
+using math::RigidTransformd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+using systems::Simulator;
+
+constexpr double kRadius = 0.05;
+constexpr double kMass = 0.1;
+
+// A ground half-space with two spheres resting on it, far apart from each
+// other, and a third sphere that falls onto the first one.
+class BodySleepManagerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    MultibodyPlantConfig config;
+    config.time_step = 1.0e-3;
+    config.discrete_contact_solver = "sap";
+    auto [plant, scene_graph] = AddMultibodyPlant(config, &builder);
+    plant_ = &plant;
+    scene_graph_ = &scene_graph;
+
+    const CoulombFriction<double> friction(1.0, 1.0);
+    plant.RegisterCollisionGeometry(plant.world_body(), RigidTransformd(),
+                                    HalfSpace(), "ground", friction);
+    resting_ = &AddSphere("resting", friction);
+    far_ = &AddSphere("far", friction);
+    falling_ = &AddSphere("falling", friction);
+    plant.Finalize();
+
+    diagram_ = builder.Build();
+    simulator_ = std::make_unique<Simulator<double>>(*diagram_);
+    Context<double>& plant_context =
+        plant.GetMyMutableContextFromRoot(&simulator_->get_mutable_context());
+    plant.SetFreeBodyPose(&plant_context, *resting_,
+                          RigidTransformd(Vector3d(0, 0, kRadius)));
+    plant.SetFreeBodyPose(&plant_context, *far_,
+                          RigidTransformd(Vector3d(1.0, 0, kRadius)));
+    plant.SetFreeBodyPose(&plant_context, *falling_,
+                          RigidTransformd(Vector3d(0, 0, 1.5)));
+  }
+
+  const RigidBody<double>& AddSphere(const std::string& name,
+                                     const CoulombFriction<double>& friction) {
+    const RigidBody<double>& body = plant_->AddRigidBody(
+        name, SpatialInertia<double>::SolidSphereWithMass(kMass, kRadius));
+    plant_->RegisterCollisionGeometry(body, RigidTransformd(), Sphere(kRadius),
+                                      name, friction);
+    return body;
+  }
+
+  // Advances the simulation to `time` in increments of 10 time steps,
+  // updating `manager` between each increment. Returns true if the body
+  // `resting_` was awake after any of the updates.
+  bool AdvanceTo(double time, BodySleepManager* manager) {
+    bool resting_was_awake = false;
+    Context<double>& root_context = simulator_->get_mutable_context();
+    while (root_context.get_time() < time - 1.0e-10) {
+      simulator_->AdvanceTo(root_context.get_time() + 0.01);
+      manager->Update(&root_context);
+      resting_was_awake |= !manager->is_sleeping(*resting_);
+    }
+    return resting_was_awake;
+  }
+
+  const Context<double>& plant_context() const {
+    return plant_->GetMyContextFromRoot(simulator_->get_context());
+  }
+
+  MultibodyPlant<double>* plant_{nullptr};
+  SceneGraph<double>* scene_graph_{nullptr};
+  const RigidBody<double>* resting_{nullptr};
+  const RigidBody<double>* far_{nullptr};
+  const RigidBody<double>* falling_{nullptr};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Simulator<double>> simulator_;
+};
+
+TEST_F(BodySleepManagerTest, Construction) {
+  BodySleepManager dut(plant_, scene_graph_);
+  EXPECT_TRUE(dut.is_managed(*resting_));
+  EXPECT_TRUE(dut.is_managed(*far_));
+  EXPECT_TRUE(dut.is_managed(*falling_));
+  EXPECT_FALSE(dut.is_managed(plant_->world_body()));
+  EXPECT_EQ(dut.num_sleeping_bodies(), 0);
+
+  BodySleepParameters bad_parameters;
+  bad_parameters.time_to_sleep = -1.0;
+  EXPECT_THROW(BodySleepManager(plant_, scene_graph_, bad_parameters),
+               std::exception);
+  EXPECT_THROW(BodySleepManager(nullptr, scene_graph_), std::exception);
+  EXPECT_THROW(BodySleepManager(plant_, nullptr), std::exception);
+}
+
+TEST_F(BodySleepManagerTest, ContinuousPlantThrows) {
+  MultibodyPlant<double> continuous_plant(0.0);
+  continuous_plant.Finalize();
+  EXPECT_THROW(BodySleepManager(&continuous_plant, scene_graph_),
+               std::exception);
+}
+
+TEST_F(BodySleepManagerTest, SleepAndWake) {
+  BodySleepParameters parameters;
+  parameters.time_to_sleep = 0.1;
+  BodySleepManager dut(plant_, scene_graph_, parameters);
+
+  // The resting spheres fall asleep while the falling sphere is in flight.
+  AdvanceTo(0.3, &dut);
+  EXPECT_TRUE(dut.is_sleeping(*resting_));
+  EXPECT_TRUE(dut.is_sleeping(*far_));
+  EXPECT_FALSE(dut.is_sleeping(*falling_));
+  EXPECT_EQ(dut.num_sleeping_bodies(), 2);
+  EXPECT_TRUE(resting_->is_locked(plant_context()));
+  EXPECT_TRUE(far_->is_locked(plant_context()));
+  EXPECT_EQ(plant_->EvalBodySpatialVelocityInWorld(plant_context(), *resting_)
+                .get_coeffs()
+                .norm(),
+            0.0);
+
+  // Sleeping bodies are filtered against the ground and against each other.
+  const auto& query_object =
+      plant_->get_geometry_query_input_port().Eval<QueryObject<double>>(
+          plant_context());
+  EXPECT_TRUE(query_object.ComputePointPairPenetration().empty());
+
+  // The falling sphere wakes up the sphere it lands on, but not the far away
+  // one.
+  EXPECT_TRUE(AdvanceTo(0.7, &dut));
+  EXPECT_TRUE(dut.is_sleeping(*far_));
+
+  // Waking all bodies restores the collision filters.
+  dut.WakeAll(&simulator_->get_mutable_context());
+  EXPECT_EQ(dut.num_sleeping_bodies(), 0);
+  EXPECT_FALSE(far_->is_locked(plant_context()));
+  EXPECT_FALSE(
+      plant_->get_geometry_query_input_port()
+          .Eval<QueryObject<double>>(plant_context())
+          .ComputePointPairPenetration()
+          .empty());
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
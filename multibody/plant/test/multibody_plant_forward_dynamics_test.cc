@@ -9,7 +9,9 @@
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/test/kuka_iiwa_model_tests.h"
 #include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/context.h"
+#include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/linear_system.h"
 
 using drake::math::RigidTransformd;
@@ -185,12 +187,8 @@ GTEST_TEST(MultibodyPlantForwardDynamics, AtlasRobot) {
       .FixValue(context.get(), VectorX<double>::Zero(num_actuators));
   auto derivatives = plant.AllocateTimeDerivatives();
   {
-    // CalcTimeDerivatives should not be allocating, but for now we have a few
-    // remaining fixes before it's down to zero:
-    //  2 temps in MbTS::CalcArticulatedBodyForceCache (F_B_W_, tau_).
-    //  1 temp  in MbP::AssembleActuationInput (actuation_input).
-    //  2 temps in MbTS::DoCalcTimeDerivatives (xdot, qdot).
-    LimitMalloc guard({ .max_num_allocations = 5 });
+    // CalcTimeDerivatives should not be allocating.
+    LimitMalloc guard({ .max_num_allocations = 0 });
     EXPECT_NO_THROW(plant.CalcTimeDerivatives(*context, derivatives.get()));
   }
 
@@ -202,6 +200,37 @@ GTEST_TEST(MultibodyPlantForwardDynamics, AtlasRobot) {
       residual, Eigen::VectorXd::Zero(plant.num_multibody_states()), 6e-13));
 }
 
+// Once warmed up, simulating a continuous-time plant in a Diagram with the
+// default (error-controlled) integrator should take steps without any heap
+// allocations.
+GTEST_TEST(MultibodyPlantForwardDynamics, SimulatorStepsDoNotAllocate) {
+  systems::DiagramBuilder<double> builder;
+  auto& plant = *builder.AddSystem<MultibodyPlant<double>>(0.0);
+  Parser(&plant).AddModels(FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/sdf/"
+      "iiwa14_no_collision.sdf"));
+  plant.WeldFrames(plant.world_frame(), plant.GetFrameByName("iiwa_link_0"));
+  plant.Finalize();
+  auto diagram = builder.Build();
+
+  systems::Simulator<double> simulator(*diagram);
+  Context<double>& plant_context =
+      plant.GetMyMutableContextFromRoot(&simulator.get_mutable_context());
+  plant.get_actuation_input_port().FixValue(
+      &plant_context, VectorXd::Zero(plant.num_actuated_dofs()));
+  plant.SetPositions(&plant_context,
+                     VectorXd::LinSpaced(plant.num_positions(), 0.1, 0.7));
+
+  // The first steps size the integrator's and simulator's scratch storage.
+  simulator.AdvanceTo(0.01);
+  const int64_t num_steps_before = simulator.get_num_steps_taken();
+  {
+    LimitMalloc guard({ .max_num_allocations = 0 });
+    simulator.AdvanceTo(0.2);
+  }
+  EXPECT_GT(simulator.get_num_steps_taken(), num_steps_before);
+}
+
 // Verifies we can do forward dynamics on a model with a zero-sized state.
 GTEST_TEST(WeldedBoxesTest, ForwardDynamicsViaArticulatedBodyAlgorithm) {
   // Problem parameters.
@@ -352,6 +352,27 @@ TEST_F(SpheresStackTest, SapFailureException) {
                               "The SAP solver failed to converge(.|\n)*");
 }
 
+// Unit test that the results do not depend on whether the solver is kept in
+// the context to reuse its symbolic analysis across discrete updates.
+TEST_F(SpheresStackTest, ReuseSymbolicAnalysis) {
+  SetupRigidGroundCompliantSphereAndNonHydroSphere();
+  ContactSolverResults<double> expected_results;
+  contact_manager_->CalcContactSolverResults(*plant_context_,
+                                             &expected_results);
+
+  SapSolverParameters parameters;
+  parameters.reuse_symbolic_analysis = true;
+  contact_manager_->set_sap_solver_parameters(parameters);
+  for (int i = 0; i < 2; ++i) {
+    ContactSolverResults<double> contact_results;
+    contact_manager_->CalcContactSolverResults(*plant_context_,
+                                               &contact_results);
+    EXPECT_TRUE(CompareMatrices(contact_results.v_next,
+                                expected_results.v_next, kEps,
+                                MatrixCompareType::relative));
+  }
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -74,6 +74,7 @@ class ArticulatedBodyInertiaCache {
   }
 
   // LLT factorization `llt_D_B` of the articulated body hinge inertia.
+  // Only computed for nodes with more than one mobility, see get_D_B().
   const math::LinearSolver<Eigen::LLT, MatrixUpTo6<T>>& get_llt_D_B(
       BodyNodeIndex body_node_index) const {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
@@ -87,6 +88,20 @@ class ArticulatedBodyInertiaCache {
     return llt_D_B_[body_node_index];
   }
 
+  // For nodes with a single mobility, the (scalar) articulated body hinge
+  // inertia `D_B`. These nodes store D_B directly in lieu of its
+  // factorization, given that D_B⁻¹ reduces to a division.
+  const T& get_D_B(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return D_B_[body_node_index];
+  }
+
+  // Mutable version of get_D_B().
+  T& get_mutable_D_B(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return D_B_[body_node_index];
+  }
+
   // The Kalman gain `g_PB_W` of the body.
   const Matrix6xUpTo6<T>& get_g_PB_W(
       BodyNodeIndex body_node_index) const {
@@ -107,6 +122,7 @@ class ArticulatedBodyInertiaCache {
     P_B_W_.resize(num_nodes_);
     Pplus_PB_W_.resize(num_nodes_);
     llt_D_B_.resize(num_nodes_);
+    D_B_.resize(num_nodes_, nan());
     g_PB_W_.resize(num_nodes_);
 
     // Initialize entries corresponding to world index to NaNs, since they
@@ -129,6 +145,7 @@ class ArticulatedBodyInertiaCache {
   std::vector<ArticulatedBodyInertia<T>> P_B_W_;
   std::vector<ArticulatedBodyInertia<T>> Pplus_PB_W_;
   std::vector<math::LinearSolver<Eigen::LLT, MatrixUpTo6<T>>> llt_D_B_;
+  std::vector<T> D_B_;
   std::vector<Matrix6xUpTo6<T>> g_PB_W_;
 };
 
@@ -6,6 +6,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/extract_double.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/math/spatial_algebra.h"
@@ -1051,7 +1052,27 @@ class BodyNode : public MultibodyElement<T> {
     // For weld joints (with nv = 0) or locked joints, terms involving the hinge
     // matrix H_PB_W go away and therefore Pplus_PB_W = P_B_W. We check this
     // below.
-    if (nv != 0 && !this->mobilizer_->is_locked(context)) {
+    if (nv == 1 && !this->mobilizer_->is_locked(context)) {
+      // Single mobility (e.g. revolute or prismatic) fast path. H_PB_W is a
+      // single column, D_B is a scalar and (5)-(7) reduce to fixed-size
+      // products and a rank-one update, with no factorization needed.
+      const Vector6<T> h_PB_W = H_PB_W.col(0);
+      // Since P_B_W is symmetric, U_B_Wᵀ = P_B_W H_PB_W.
+      const Vector6<T> U_B_W = P_B_W * h_PB_W;
+
+      T& D_B = get_mutable_D_B(abic);
+      D_B = h_PB_W.dot(U_B_W) + diagonal_inertias[this->velocity_start()];
+      if (ExtractDoubleOrThrow(D_B) <= 0.0) {
+        // Defer to the general factorization for a meaningful error message.
+        CalcArticulatedBodyHingeInertiaMatrixFactorization(
+            MatrixUpTo6<T>::Constant(1, 1, D_B), &get_mutable_llt_D_B(abic));
+      }
+
+      const Vector6<T> g_PB_W = U_B_W / D_B;
+      get_mutable_g_PB_W(abic) = g_PB_W;
+      Pplus_PB_W -=
+          ArticulatedBodyInertia<T>(Matrix6<T>(g_PB_W * U_B_W.transpose()));
+    } else if (nv != 0 && !this->mobilizer_->is_locked(context)) {
       // Compute common term U_B_W.
       const MatrixUpTo6<T> U_B_W = H_PB_W.transpose() * P_B_W;
 
@@ -1174,14 +1195,23 @@ class BodyNode : public MultibodyElement<T> {
       // Compute the articulated body inertia innovations generalized force,
       // e_B, according to (4).
       VectorUpTo6<T>& e_B = get_mutable_e_B(aba_force_cache);
-      e_B.noalias() = tau_applied - H_PB_W.transpose() * Z_Bo_W.get_coeffs();
 
       // Get the Kalman gain from cache.
       const Matrix6xUpTo6<T>& g_PB_W = get_g_PB_W(abic);
 
       // Compute the projected articulated body force bias Zplus_PB_W.
-      get_mutable_Zplus_PB_W(aba_force_cache) +=
-          SpatialForce<T>(g_PB_W * e_B);
+      if (nv == 1) {
+        // Single mobility fast path, with e_B a scalar.
+        e_B.resize(1);
+        e_B(0) = tau_applied(0) - H_PB_W.col(0).dot(Z_Bo_W.get_coeffs());
+        get_mutable_Zplus_PB_W(aba_force_cache) +=
+            SpatialForce<T>(Vector6<T>(g_PB_W.col(0) * e_B(0)));
+      } else {
+        e_B.noalias() =
+            tau_applied - H_PB_W.transpose() * Z_Bo_W.get_coeffs();
+        get_mutable_Zplus_PB_W(aba_force_cache) +=
+            SpatialForce<T>(g_PB_W * e_B);
+      }
     }
   }
 
@@ -1255,6 +1285,13 @@ class BodyNode : public MultibodyElement<T> {
     // locked mobilizers.
     if (this->mobilizer_->is_locked(context)) {
       get_mutable_accelerations(ac).setZero();
+    } else if (nv == 1) {
+      // Single mobility fast path, where D_B is a scalar.
+      const T nu_B = get_e_B(aba_force_cache)(0) / get_D_B(abic);
+      const T vmdot =
+          nu_B - get_g_PB_W(abic).col(0).dot(A_WB.get_coeffs());
+      get_mutable_accelerations(ac)(0) = vmdot;
+      A_WB += SpatialAcceleration<T>(Vector6<T>(H_PB_W.col(0) * vmdot));
     } else if (nv != 0) {
       // Compute nu_B, the articulated body inertia innovations generalized
       // acceleration.
@@ -1648,6 +1685,17 @@ class BodyNode : public MultibodyElement<T> {
     return abic->get_mutable_llt_D_B(topology_.index);
   }
 
+  // Returns the scalar articulated body hinge inertia `D_B` of a node with a
+  // single mobility.
+  const T& get_D_B(const ArticulatedBodyInertiaCache<T>& abic) const {
+    return abic.get_D_B(topology_.index);
+  }
+
+  // Mutable version of get_D_B().
+  T& get_mutable_D_B(ArticulatedBodyInertiaCache<T>* abic) const {
+    return abic->get_mutable_D_B(topology_.index);
+  }
+
   // Forms LLT factorization of articulated rigid body's hinge inertia matrix.
   // @param[in] D_B Articulated rigid body hinge matrix.
   // @param[out] llt_D_B Stores the LLT factorization of D_B.
@@ -3223,20 +3223,23 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   const std::vector<SpatialInertia<T>>& spatial_inertia_in_world_cache =
       EvalSpatialInertiaInWorldCache(context);
 
-  // Perform tip-to-base recursion, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+  // Perform tip-to-base recursion, skipping the world. Body nodes are
+  // numbered in depth-first order, so that every node has a larger index than
+  // its parent. Therefore sweeping indices in reverse is a valid tip-to-base
+  // ordering that, unlike a sweep by levels, accesses the per-node arrays in
+  // the cache entries sequentially.
+  for (BodyNodeIndex body_node_index(num_bodies() - 1); body_node_index > 0;
+       --body_node_index) {
+    const BodyNode<T>& node = *body_nodes_[body_node_index];
 
-      // Get hinge matrix and spatial inertia for this node.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-      const SpatialInertia<T>& M_B_W =
-          spatial_inertia_in_world_cache[body_node_index];
+    // Get hinge matrix and spatial inertia for this node.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const SpatialInertia<T>& M_B_W =
+        spatial_inertia_in_world_cache[body_node_index];
 
-      node.CalcArticulatedBodyInertiaCache_TipToBase(
-          context, pc, H_PB_W, M_B_W, diagonal_inertias, abic);
-    }
+    node.CalcArticulatedBodyInertiaCache_TipToBase(
+        context, pc, H_PB_W, M_B_W, diagonal_inertias, abic);
   }
 }
 
@@ -3266,27 +3269,27 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
   const std::vector<SpatialForce<T>>& dynamic_bias_cache =
       EvalDynamicBiasCache(context);
 
-  // Perform tip-to-base recursion, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+  // Perform tip-to-base recursion, skipping the world. See
+  // CalcArticulatedBodyInertiaCache() for the choice of ordering.
+  for (BodyNodeIndex body_node_index(num_bodies() - 1); body_node_index > 0;
+       --body_node_index) {
+    const BodyNode<T>& node = *body_nodes_[body_node_index];
 
-      // Get generalized force and body force for this node.
-      Eigen::Ref<const VectorX<T>> tau_applied =
-          node.get_mobilizer().get_generalized_forces_from_array(
-              generalized_forces);
-      const SpatialForce<T>& Fapplied_Bo_W = body_forces[body_node_index];
+    // Get generalized force and body force for this node.
+    Eigen::Ref<const VectorX<T>> tau_applied =
+        node.get_mobilizer().get_generalized_forces_from_array(
+            generalized_forces);
+    const SpatialForce<T>& Fapplied_Bo_W = body_forces[body_node_index];
 
-      // Get references to the hinge matrix and force bias for this node.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-      const SpatialForce<T>& Fb_B_W = dynamic_bias_cache[body_node_index];
-      const SpatialForce<T>& Zb_Bo_W = Zb_Bo_W_cache[body_node_index];
+    // Get references to the hinge matrix and force bias for this node.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const SpatialForce<T>& Fb_B_W = dynamic_bias_cache[body_node_index];
+    const SpatialForce<T>& Zb_Bo_W = Zb_Bo_W_cache[body_node_index];
 
-      node.CalcArticulatedBodyForceCache_TipToBase(
-          context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
-          H_PB_W, aba_force_cache);
-    }
+    node.CalcArticulatedBodyForceCache_TipToBase(
+        context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
+        H_PB_W, aba_force_cache);
   }
 }
 
@@ -3320,20 +3323,20 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
   const std::vector<SpatialAcceleration<T>>& Ab_WB_cache =
       EvalSpatialAccelerationBiasCache(context);
 
-  // Perform base-to-tip recursion, skipping the world.
-  for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+  // Perform base-to-tip recursion, skipping the world. Since body nodes are
+  // numbered in depth-first order, parents are visited before their children.
+  for (BodyNodeIndex body_node_index(1); body_node_index < num_bodies();
+       ++body_node_index) {
+    const BodyNode<T>& node = *body_nodes_[body_node_index];
 
-      const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[body_node_index];
+    const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[body_node_index];
 
-      // Get reference to the hinge mapping matrix.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
+    // Get reference to the hinge mapping matrix.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
 
-      node.CalcArticulatedBodyAccelerations_BaseToTip(
-          context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
-    }
+    node.CalcArticulatedBodyAccelerations_BaseToTip(
+        context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
   }
 }
 
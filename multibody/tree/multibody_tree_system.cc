@@ -238,6 +238,18 @@ void MultibodyTreeSystem<T>::Finalize() {
               {this->kinematics_ticket(), this->all_parameters_ticket()})
           .cache_index();
 
+  // Scratch space for the applied forces gathered by
+  // CalcArticulatedBodyForceCache() and
+  // DoCalcImplicitTimeDerivativesResidual(). It is only used within those
+  // functions (neither of which evaluates the other), but is allocated as a
+  // cache entry to avoid heap operations during simulation. It has no
+  // prerequisites; its value is always overwritten before use.
+  cache_indexes_.articulated_body_force_scratch = this->DeclareCacheEntry(
+      std::string("ABA applied forces scratch"),
+      systems::ValueProducer(MultibodyForces<T>(internal_tree()),
+                             &systems::ValueProducer::NoopCalc),
+      {this->nothing_ticket()}).cache_index();
+
   // Articulated Body Algorithm (ABA) force cache.
   cache_indexes_.articulated_body_forces = this->DeclareCacheEntry(
       std::string("ABA force cache"),
@@ -274,12 +286,13 @@ void MultibodyTreeSystem<T>::DoCalcTimeDerivatives(
 
   const VectorX<T>& vdot = this->EvalForwardDynamics(context).get_vdot();
 
-  // TODO(sherm1) Heap allocation here. Get rid of it.
-  VectorX<T> xdot(internal_tree().num_states());
-  VectorX<T> qdot(internal_tree().num_positions());
+  // The derivatives were allocated to match our BasicVector state, so we can
+  // write xdot = [qdot; vdot] directly into them without temporaries.
+  auto xdot = dynamic_cast<systems::BasicVector<T>&>(
+      derivatives->get_mutable_vector()).get_mutable_value();
+  auto qdot = xdot.head(internal_tree().num_positions());
   internal_tree().MapVelocityToQDot(context, v, &qdot);
-  xdot << qdot, vdot;
-  derivatives->SetFromVector(xdot);
+  xdot.tail(internal_tree().num_velocities()) = vdot;
 }
 
 template<typename T>
@@ -294,7 +307,13 @@ void MultibodyTreeSystem<T>::DoMapQDotToVelocity(
   DRAKE_DEMAND(generalized_velocity != nullptr);
   DRAKE_DEMAND(generalized_velocity->size() == nv);
 
-  // TODO(sherm1) Heap allocation. Make this go away.
+  // Write straight into the output when it is contiguous storage.
+  auto* basic_v = dynamic_cast<systems::BasicVector<T>*>(generalized_velocity);
+  if (basic_v != nullptr) {
+    auto v = basic_v->get_mutable_value();
+    internal_tree().MapQDotToVelocity(context, qdot, &v);
+    return;
+  }
   VectorX<T> v(nv);
   internal_tree().MapQDotToVelocity(context, qdot, &v);
   generalized_velocity->SetFromVector(v);
@@ -312,7 +331,14 @@ void MultibodyTreeSystem<T>::DoMapVelocityToQDot(
   DRAKE_DEMAND(positions_derivative != nullptr);
   DRAKE_DEMAND(positions_derivative->size() == nq);
 
-  // TODO(sherm1) Heap allocation. Make this go away.
+  // Write straight into the output when it is contiguous storage.
+  auto* basic_qdot =
+      dynamic_cast<systems::BasicVector<T>*>(positions_derivative);
+  if (basic_qdot != nullptr) {
+    auto qdot = basic_qdot->get_mutable_value();
+    internal_tree().MapVelocityToQDot(context, generalized_velocity, &qdot);
+    return;
+  }
   VectorX<T> qdot(nq);
   internal_tree().MapVelocityToQDot(context, generalized_velocity, &qdot);
   positions_derivative->SetFromVector(qdot);
@@ -332,8 +358,10 @@ void MultibodyTreeSystem<T>::DoCalcImplicitTimeDerivativesResidual(
   const int nq = internal_tree().num_positions();
   const int nv = internal_tree().num_velocities();
 
-  // TODO(sherm1) Heap allocation here. Get rid of it.
-  MultibodyForces<T> forces(*this);
+  MultibodyForces<T>& forces =
+      this->get_cache_entry(cache_indexes_.articulated_body_force_scratch)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<MultibodyForces<T>>();
 
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
   const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
@@ -369,8 +397,10 @@ void MultibodyTreeSystem<T>::CalcArticulatedBodyForceCache(
     ArticulatedBodyForceCache<T>* aba_force_cache) const {
   DRAKE_DEMAND(aba_force_cache != nullptr);
 
-  // TODO(sherm1) Heap allocation here. Get rid of it.
-  MultibodyForces<T> forces(*this);
+  MultibodyForces<T>& forces =
+      this->get_cache_entry(cache_indexes_.articulated_body_force_scratch)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<MultibodyForces<T>>();
 
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
   const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
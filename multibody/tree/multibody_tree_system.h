@@ -496,6 +496,7 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
     systems::CacheIndex across_node_jacobians;
     systems::CacheIndex articulated_body_forces;
     systems::CacheIndex articulated_body_force_bias;
+    systems::CacheIndex articulated_body_force_scratch;
     systems::CacheIndex dynamic_bias;
     systems::CacheIndex position_kinematics;
     systems::CacheIndex spatial_inertia_in_world;
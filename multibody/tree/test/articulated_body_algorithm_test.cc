@@ -1,13 +1,21 @@
+#include <memory>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/tree/fixed_offset_frame.h"
 #include "drake/multibody/tree/frame.h"
 #include "drake/multibody/tree/mobilizer_impl.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/space_xyz_mobilizer.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/unit_inertia.h"
@@ -370,6 +378,66 @@ GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ModifiedFeatherstoneExample) {
       P_WB_W_actual.CopyToFullMatrix6(), kEpsilon));
 }
 
+// Verifies the forward dynamics computed with the articulated body algorithm
+// for a branched tree that mixes nodes with one and multiple mobilities, by
+// checking that inverse dynamics recovers the applied generalized forces.
+GTEST_TEST(ArticulatedBodyInertiaAlgorithm, BranchedTreeForwardDynamics) {
+  auto tree_owned = std::make_unique<MultibodyTree<double>>();
+  auto& tree = *tree_owned;
+  const SpatialInertia<double> M_Bcm =
+      SpatialInertia<double>::SolidBoxWithMass(1.5, 0.3, 0.4, 0.5);
+
+  // The base has three rotational mobilities.
+  const RigidBody<double>& base = tree.AddBody<RigidBody>("base", M_Bcm);
+  tree.AddMobilizer<SpaceXYZMobilizer>(tree.world_frame(), base.body_frame());
+
+  // Adds a link with a single mobility, revolute or prismatic about `axis_F`,
+  // with its inboard frame F at an arbitrary offset from its parent.
+  auto add_link = [&tree, &M_Bcm](const std::string& name,
+                                  const Body<double>& parent,
+                                  const Vector3d& p_PF, const Vector3d& axis_F,
+                                  bool is_revolute) -> const Body<double>& {
+    const RigidBody<double>& link = tree.AddBody<RigidBody>(name, M_Bcm);
+    const Frame<double>& frame_F = tree.AddFrame<FixedOffsetFrame>(
+        name + "_F", parent.body_frame(),
+        math::RigidTransformd(math::RollPitchYawd(0.1, 0.2, 0.3), p_PF));
+    if (is_revolute) {
+      tree.AddMobilizer<RevoluteMobilizer>(frame_F, link.body_frame(), axis_F);
+    } else {
+      tree.AddMobilizer<PrismaticMobilizer>(frame_F, link.body_frame(),
+                                            axis_F);
+    }
+    return link;
+  };
+  const Body<double>& upper =
+      add_link("upper", base, Vector3d(0.5, 0.0, 0.0), Vector3d::UnitZ(), true);
+  add_link("lower", upper, Vector3d(0.0, 0.4, 0.0), Vector3d::UnitY(), true);
+  add_link("slider", upper, Vector3d(0.0, 0.0, -0.3),
+           Vector3d(1.0, 1.0, 0.0).normalized(), false);
+  add_link("arm", base, Vector3d(-0.5, 0.1, 0.0), Vector3d::UnitX(), true);
+
+  MultibodyTreeSystem<double> system(std::move(tree_owned));
+  auto context = system.CreateDefaultContext();
+  const int nq = tree.num_positions();
+  const int nv = tree.num_velocities();
+  ASSERT_EQ(nv, 7);
+  tree.GetMutablePositionsAndVelocities(context.get()) =
+      VectorXd::LinSpaced(nq + nv, -1.0, 1.5);
+
+  MultibodyForces<double> forces(tree);
+  forces.mutable_generalized_forces() = VectorXd::LinSpaced(nv, 2.0, -3.0);
+
+  ArticulatedBodyForceCache<double> aba_force_cache(tree.get_topology());
+  tree.CalcArticulatedBodyForceCache(*context, forces, &aba_force_cache);
+  AccelerationKinematicsCache<double> ac(tree.get_topology());
+  tree.CalcArticulatedBodyAccelerations(*context, aba_force_cache, &ac);
+
+  // Inverse dynamics computes M⋅v̇ + C(q, v)⋅v - τ, which must be zero.
+  const VectorXd residual =
+      tree.CalcInverseDynamics(*context, ac.get_vdot(), forces);
+  EXPECT_TRUE(CompareMatrices(residual, VectorXd::Zero(nv), 20 * kEpsilon));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
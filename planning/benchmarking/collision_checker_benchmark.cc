@@ -0,0 +1,165 @@
+// @file
+// Benchmarks for the throughput of configuration collision checks.
+//
+// This compares SphereCollisionChecker (spheres against a precomputed distance
+// grid) with SceneGraphCollisionChecker (exact geometry queries) on the same
+// scene: an iiwa arm next to a table, a shelf, and a pillar.
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/random.h"
+#include "drake/planning/robot_diagram_builder.h"
+#include "drake/planning/scene_graph_collision_checker.h"
+#include "drake/planning/sphere_collision_checker.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+constexpr char kEnvironment[] = R"""(
+<?xml version='1.0'?>
+<sdf version='1.7'>
+  <model name='environment'>
+    <static>true</static>
+    <link name='table'>
+      <pose>0 0 -0.06 0 0 0</pose>
+      <collision name='table_collision'>
+        <geometry><box><size>2.0 2.0 0.1</size></box></geometry>
+      </collision>
+    </link>
+    <link name='shelf'>
+      <pose>0.6 0 0.5 0 0 0</pose>
+      <collision name='shelf_collision'>
+        <geometry><box><size>0.3 0.8 0.02</size></box></geometry>
+      </collision>
+    </link>
+    <link name='pillar'>
+      <pose>-0.5 0.5 0.5 0 0 0</pose>
+      <collision name='pillar_collision'>
+        <geometry>
+          <cylinder><radius>0.05</radius><length>1.0</length></cylinder>
+        </geometry>
+      </collision>
+    </link>
+  </model>
+</sdf>
+)""";
+
+// The number of (precomputed) configurations that the checks cycle through.
+constexpr int kNumConfigurations = 1000;
+
+class CollisionCheckerBenchmark : public benchmark::Fixture {
+ public:
+  using benchmark::Fixture::SetUp;
+  void SetUp(const ::benchmark::State&) override {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+ protected:
+  static CollisionCheckerParams MakeParams() {
+    RobotDiagramBuilder<double> builder;
+    builder.parser().AddModelsFromString(kEnvironment, "sdf");
+    const multibody::ModelInstanceIndex iiwa =
+        builder.parser()
+            .AddModels(FindResourceOrThrow(
+                "drake/manipulation/models/iiwa_description/urdf/"
+                "iiwa14_primitive_collision.urdf"))
+            .at(0);
+    builder.plant().WeldFrames(builder.plant().world_frame(),
+                               builder.plant().GetFrameByName("base", iiwa));
+    CollisionCheckerParams params;
+    params.robot_model_instances.push_back(iiwa);
+    params.model = builder.Build();
+    params.configuration_distance_function = [](const VectorXd& q1,
+                                                const VectorXd& q2) {
+      return (q1 - q2).norm();
+    };
+    params.edge_step_size = 0.05;
+    return params;
+  }
+
+  // A grid that covers the arm's reach.
+  static SphereCollisionCheckerConfig MakeSphereConfig() {
+    SphereCollisionCheckerConfig config;
+    config.grid_lower = Vector3d(-1.0, -1.0, -0.2);
+    config.grid_upper = Vector3d(1.0, 1.0, 1.4);
+    return config;
+  }
+
+  // Returns configurations sampled uniformly within the joint limits, with a
+  // fixed seed so that every checker sees the same ones.
+  static std::vector<VectorXd> MakeConfigurations(
+      const CollisionChecker& checker) {
+    const VectorXd lower = checker.plant().GetPositionLowerLimits();
+    const VectorXd upper = checker.plant().GetPositionUpperLimits();
+    RandomGenerator generator;
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<VectorXd> result(kNumConfigurations);
+    for (VectorXd& q : result) {
+      q.resize(lower.size());
+      for (int i = 0; i < q.size(); ++i) {
+        q[i] = lower[i] + uniform(generator) * (upper[i] - lower[i]);
+      }
+    }
+    return result;
+  }
+
+  // Checks one configuration per iteration, on a single thread.
+  static void DoCheckConfigCollisionFree(const CollisionChecker& checker,
+                                         benchmark::State& state) {
+    const std::vector<VectorXd> configurations = MakeConfigurations(checker);
+    int i = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          checker.CheckConfigCollisionFree(configurations[i]));
+      i = (i + 1) % kNumConfigurations;
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, SphereConstruction)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    CollisionCheckerParams params = MakeParams();
+    state.ResumeTiming();
+    SphereCollisionChecker checker(std::move(params), MakeSphereConfig());
+  }
+}
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, SphereConstruction)
+    ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, SphereCheckConfig)
+(benchmark::State& state) {
+  const SphereCollisionChecker checker(MakeParams(), MakeSphereConfig());
+  DoCheckConfigCollisionFree(checker, state);
+}
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, SphereCheckConfig)
+    ->Unit(benchmark::kMicrosecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, SceneGraphCheckConfig)
+(benchmark::State& state) {
+  const SceneGraphCollisionChecker checker(MakeParams());
+  DoCheckConfigCollisionFree(checker, state);
+}
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, SceneGraphCheckConfig)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,12 +1,16 @@
 #include "drake/planning/collision_checker.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <limits>
+#include <list>
 #include <map>
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -15,9 +19,6 @@
 #include <common_robotics_utilities/openmp_helpers.hpp>
 #include <common_robotics_utilities/print.hpp>
 #include <common_robotics_utilities/utility.hpp>
-#if defined(_OPENMP)
-#include <omp.h>
-#endif
 
 #include "drake/common/drake_throw.h"
 #include "drake/common/fmt_eigen.h"
@@ -152,8 +153,266 @@ std::vector<int> CalcUncontrolledDofsThatKinematicallyAffectTheRobot(
   return result;
 }
 
+// Returns the smallest number of bits that can represent every integer in
+// [0, n).
+int CalcNumBits(int n) {
+  int num_bits = 0;
+  while ((1 << num_bits) < n) {
+    ++num_bits;
+  }
+  return num_bits;
+}
+
+// Returns the lowest `num_bits` bits of `value` in reverse order. Applied to
+// 0, 1, 2, ..., 2ⁿ - 1, this produces the (scaled) van der Corput sequence
+// 0, 2ⁿ⁻¹, 2ⁿ⁻², 3⋅2ⁿ⁻², ..., i.e., coarse-to-fine bisection.
+int ReverseBits(int value, int num_bits) {
+  int result = 0;
+  for (int i = 0; i < num_bits; ++i) {
+    result = (result << 1) | ((value >> i) & 1);
+  }
+  return result;
+}
+
+// Returns the steps 0, 1, ..., num_steps - 1 of an edge in coarse-to-fine
+// bisection order: the van der Corput fractions 0, 1/2, 1/4, 3/4, 1/8, ...
+// (with denominators up to the smallest power of two 2ⁿ ≥ num_steps), each
+// scaled by num_steps and rounded to the nearest step, skipping repeats.
+// Consecutive scaled fractions are at most one step apart, so every step
+// appears exactly once. A fraction that rounds to num_steps (the end of the
+// edge, which is checked separately) is skipped, too.
+std::vector<int> CalcBisectionOrder(int num_steps) {
+  const int num_bits = CalcNumBits(num_steps);
+  const int64_t num_fractions = int64_t{1} << num_bits;
+  std::vector<int> result;
+  result.reserve(num_steps);
+  std::vector<bool> visited(num_steps, false);
+  for (int k = 0; k < num_fractions; ++k) {
+    // round(ReverseBits(k) / 2ⁿ ⋅ num_steps), rounding halves up, in exact
+    // integer arithmetic.
+    const int64_t scaled = int64_t{ReverseBits(k, num_bits)} * num_steps;
+    const int step = static_cast<int>((2 * scaled + num_fractions) /
+                                      (2 * num_fractions));
+    if (step < num_steps && !visited[step]) {
+      visited[step] = true;
+      result.push_back(step);
+    }
+  }
+  DRAKE_DEMAND(static_cast<int>(result.size()) == num_steps);
+  return result;
+}
+
+// Returns the configuration distance from a sample within which `clearance`
+// (measured at that sample) certifies that the robot is collision free, given
+// the per-body motion bounds in `skipping`.
+double CalcCertifiedRadius(const RobotClearance& clearance,
+                           const EdgeClearanceSkipping& skipping) {
+  const std::vector<double>& bounds = skipping.body_motion_bounds;
+  const double max_bound = *std::max_element(bounds.begin(), bounds.end());
+  // Unreported pairs of bodies are at least the influence distance apart.
+  double radius = (max_bound > 0.0)
+                      ? skipping.influence_distance / (2.0 * max_bound)
+                      : std::numeric_limits<double>::infinity();
+  const auto distances = clearance.distances();
+  for (int i = 0; i < clearance.size(); ++i) {
+    if (distances[i] <= 0.0) {
+      return 0.0;
+    }
+    const double rate = bounds[clearance.robot_indices()[i]] +
+                        bounds[clearance.other_indices()[i]];
+    if (rate > 0.0) {
+      radius = std::min(radius, distances[i] / rate);
+    }
+  }
+  return radius;
+}
+
+// One or two quantized configurations, used as a result cache key.
+using CacheKey = std::vector<int64_t>;
+
+struct CacheKeyHash {
+  size_t operator()(const CacheKey& key) const {
+    size_t result = key.size();
+    for (const int64_t value : key) {
+      result ^= std::hash<int64_t>{}(value) + 0x9e3779b97f4a7c15 +
+                (result << 6) + (result >> 2);
+    }
+    return result;
+  }
+};
+
+// A thread-safe map from keys to check results, bounded in size. It is split
+// into independently locked shards (chosen by the hash of the key) to limit
+// contention between threads; each shard evicts its least recently used entry
+// when full.
+class BoundedResultMap {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BoundedResultMap);
+
+  explicit BoundedResultMap(int capacity) {
+    for (int i = 0; i < kNumShards; ++i) {
+      shards_[i].capacity =
+          capacity / kNumShards + ((i < capacity % kNumShards) ? 1 : 0);
+    }
+  }
+
+  std::optional<bool> Find(const CacheKey& key) {
+    Shard& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iter = shard.index.find(key);
+    if (iter == shard.index.end()) {
+      ++num_misses_;
+      return std::nullopt;
+    }
+    ++num_hits_;
+    // Move the entry to the front of the recently-used list.
+    shard.entries.splice(shard.entries.begin(), shard.entries, iter->second);
+    return iter->second->second;
+  }
+
+  void Insert(const CacheKey& key, bool value) {
+    Shard& shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.capacity == 0 || shard.index.contains(key)) {
+      return;
+    }
+    if (static_cast<int>(shard.entries.size()) == shard.capacity) {
+      shard.index.erase(shard.entries.back().first);
+      shard.entries.pop_back();
+    }
+    shard.entries.emplace_front(key, value);
+    shard.index.emplace(key, shard.entries.begin());
+  }
+
+  void Clear() {
+    for (Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.index.clear();
+      shard.entries.clear();
+    }
+  }
+
+  int size() const {
+    int result = 0;
+    for (const Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result += static_cast<int>(shard.entries.size());
+    }
+    return result;
+  }
+
+  int64_t num_hits() const { return num_hits_.load(); }
+  int64_t num_misses() const { return num_misses_.load(); }
+
+ private:
+  static constexpr int kNumShards = 16;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    int capacity{};
+    // The most recently used entry is at the front.
+    std::list<std::pair<CacheKey, bool>> entries;
+    std::unordered_map<CacheKey,
+                       std::list<std::pair<CacheKey, bool>>::iterator,
+                       CacheKeyHash>
+        index;
+  };
+
+  Shard& GetShard(const CacheKey& key) {
+    return shards_[CacheKeyHash{}(key) % kNumShards];
+  }
+
+  std::array<Shard, kNumShards> shards_;
+  std::atomic<int64_t> num_hits_{0};
+  std::atomic<int64_t> num_misses_{0};
+};
+
 }  // namespace
 
+class CollisionChecker::ResultCache {
+ public:
+  explicit ResultCache(const CollisionCheckerCacheConfig& config)
+      : config_(config),
+        configurations_(config.max_num_configurations),
+        edges_(config.max_num_edges) {}
+
+  // Copies the configuration, but none of the results or statistics.
+  ResultCache(const ResultCache& other) : ResultCache(other.config_) {}
+
+  const CollisionCheckerCacheConfig& config() const { return config_; }
+
+  std::optional<bool> FindConfiguration(const Eigen::VectorXd& q) {
+    const std::optional<CacheKey> key = MakeKey(q);
+    return key.has_value() ? configurations_.Find(*key) : std::nullopt;
+  }
+
+  void InsertConfiguration(const Eigen::VectorXd& q, bool collision_free) {
+    const std::optional<CacheKey> key = MakeKey(q);
+    if (key.has_value()) {
+      configurations_.Insert(*key, collision_free);
+    }
+  }
+
+  std::optional<bool> FindEdge(const Eigen::VectorXd& q1,
+                               const Eigen::VectorXd& q2) {
+    const std::optional<CacheKey> key = MakeKey(q1, &q2);
+    return key.has_value() ? edges_.Find(*key) : std::nullopt;
+  }
+
+  void InsertEdge(const Eigen::VectorXd& q1, const Eigen::VectorXd& q2,
+                  bool collision_free) {
+    const std::optional<CacheKey> key = MakeKey(q1, &q2);
+    if (key.has_value()) {
+      edges_.Insert(*key, collision_free);
+    }
+  }
+
+  void Clear() {
+    configurations_.Clear();
+    edges_.Clear();
+  }
+
+  void ClearEdges() { edges_.Clear(); }
+
+  CollisionCheckerCacheStatistics GetStatistics() const {
+    return CollisionCheckerCacheStatistics{
+        .num_configuration_hits = configurations_.num_hits(),
+        .num_configuration_misses = configurations_.num_misses(),
+        .num_edge_hits = edges_.num_hits(),
+        .num_edge_misses = edges_.num_misses(),
+        .num_configurations = configurations_.size(),
+        .num_edges = edges_.size()};
+  }
+
+ private:
+  // Returns the quantized `q1` followed by the quantized `q2` (if given), or
+  // nullopt if some value is not finite or is too large to quantize, in which
+  // case the result is not cached.
+  std::optional<CacheKey> MakeKey(const Eigen::VectorXd& q1,
+                                  const Eigen::VectorXd* q2 = nullptr) const {
+    CacheKey key;
+    key.reserve(q1.size() + (q2 != nullptr ? q2->size() : 0));
+    for (const Eigen::VectorXd* q : {&q1, q2}) {
+      if (q == nullptr) {
+        continue;
+      }
+      for (int i = 0; i < q->size(); ++i) {
+        const double scaled = std::round((*q)[i] / config_.quantization);
+        // This also rejects NaN.
+        if (!(std::abs(scaled) < 1e18)) {
+          return std::nullopt;
+        }
+        key.push_back(static_cast<int64_t>(scaled));
+      }
+    }
+    return key;
+  }
+
+  const CollisionCheckerCacheConfig config_;
+  BoundedResultMap configurations_;
+  BoundedResultMap edges_;
+};
+
 CollisionChecker::~CollisionChecker() = default;
 
 bool CollisionChecker::IsPartOfRobot(const Body<double>& body) const {
@@ -188,6 +447,8 @@ void CollisionChecker::PerformOperationAgainstAllModelContexts(
   owned_contexts_.PerformOperationAgainstAllOwnedContexts(model(), operation);
   standalone_contexts_.PerformOperationAgainstAllStandaloneContexts(  // BR
       model(), operation);
+  // The operation may have changed anything.
+  ClearResultCache();
 }
 
 bool CollisionChecker::AddCollisionShape(
@@ -242,6 +503,7 @@ bool CollisionChecker::AddCollisionShapeToBody(
     geometry_groups_[group_name].push_back(AddedShape{
         *maybe_geometry, bodyA.index(),
         BodyShapeDescription(shape, X_AG, model_instance_name, bodyA.name())});
+    ClearResultCache();
   }
   return maybe_geometry.has_value();
 }
@@ -265,6 +527,7 @@ void CollisionChecker::RemoveAllAddedCollisionShapes(
     drake::log()->debug("Removing geometries from group [{}].", group_name);
     RemoveAddedGeometries(iter->second);
     geometry_groups_.erase(iter);
+    ClearResultCache();
   }
 }
 
@@ -274,6 +537,7 @@ void CollisionChecker::RemoveAllAddedCollisionShapes() {
     RemoveAddedGeometries(group_ids);
   }
   geometry_groups_.clear();
+  ClearResultCache();
 }
 
 std::optional<double> CollisionChecker::MaybeGetUniformRobotEnvironmentPadding()
@@ -339,6 +603,7 @@ void CollisionChecker::SetPaddingBetween(BodyIndex bodyA_index,
   collision_padding_(int{bodyA_index}, int{bodyB_index}) = padding;
   collision_padding_(int{bodyB_index}, int{bodyA_index}) = padding;
   UpdateMaxCollisionPadding();
+  ClearResultCache();
 }
 
 void CollisionChecker::SetPaddingMatrix(
@@ -356,6 +621,7 @@ void CollisionChecker::SetPaddingMatrix(
   ValidatePaddingMatrix(requested_padding, __func__);
   collision_padding_ = requested_padding;
   UpdateMaxCollisionPadding();
+  ClearResultCache();
 }
 
 void CollisionChecker::SetPaddingOneRobotBodyAllEnvironmentPairs(
@@ -370,6 +636,7 @@ void CollisionChecker::SetPaddingOneRobotBodyAllEnvironmentPairs(
     }
   }
   UpdateMaxCollisionPadding();
+  ClearResultCache();
 }
 
 void CollisionChecker::SetPaddingAllRobotEnvironmentPairs(
@@ -387,6 +654,7 @@ void CollisionChecker::SetPaddingAllRobotEnvironmentPairs(
     }
   }
   UpdateMaxCollisionPadding();
+  ClearResultCache();
 }
 
 void CollisionChecker::SetPaddingAllRobotRobotPairs(const double padding) {
@@ -403,6 +671,7 @@ void CollisionChecker::SetPaddingAllRobotRobotPairs(const double padding) {
     }
   }
   UpdateMaxCollisionPadding();
+  ClearResultCache();
 }
 
 void CollisionChecker::SetCollisionFilterMatrix(
@@ -425,6 +694,7 @@ void CollisionChecker::SetCollisionFilterMatrix(
     filtered_collisions_ = filter_matrix;
     // Allow derived checkers to perform any post-filter-change work.
     UpdateCollisionFilters();
+    ClearResultCache();
   }
 }
 
@@ -464,6 +734,7 @@ void CollisionChecker::SetCollisionFilteredBetween(BodyIndex bodyA_index,
     filtered_collisions_(int{bodyB_index}, int{bodyA_index}) = new_value;
     // Allow derived checkers to perform any post-filter-change work.
     UpdateCollisionFilters();
+    ClearResultCache();
   }
 }
 
@@ -480,6 +751,7 @@ void CollisionChecker::SetCollisionFilteredWithAllBodies(BodyIndex body_index) {
   if (prior_filter_matrix != filtered_collisions_) {
     // Allow derived checkers to perform any post-filter-change work.
     UpdateCollisionFilters();
+    ClearResultCache();
   }
 }
 
@@ -491,6 +763,19 @@ bool CollisionChecker::CheckConfigCollisionFree(
 bool CollisionChecker::CheckContextConfigCollisionFree(
     CollisionCheckerContext* model_context, const Eigen::VectorXd& q) const {
   DRAKE_THROW_UNLESS(model_context != nullptr);
+  if (result_cache_ == nullptr) {
+    return CheckContextConfigCollisionFreeUncached(model_context, q);
+  }
+  if (const std::optional<bool> cached = result_cache_->FindConfiguration(q)) {
+    return *cached;
+  }
+  const bool result = CheckContextConfigCollisionFreeUncached(model_context, q);
+  result_cache_->InsertConfiguration(q, result);
+  return result;
+}
+
+bool CollisionChecker::CheckContextConfigCollisionFreeUncached(
+    CollisionCheckerContext* model_context, const Eigen::VectorXd& q) const {
   UpdateContextPositions(model_context, q);
   return DoCheckContextConfigCollisionFree(*model_context);
 }
@@ -500,15 +785,16 @@ std::vector<uint8_t> CollisionChecker::CheckConfigsCollisionFree(
   // Note: vector<uint8_t> is used since vector<bool> is not thread safe.
   std::vector<uint8_t> collision_checks(configs.size(), 0);
 
-  const bool check_in_parallel = CanEvaluateInParallel() && parallelize;
-  CRU_OMP_PARALLEL_FOR_IF(check_in_parallel)
-  for (size_t idx = 0; idx < configs.size(); ++idx) {
-    if (CheckConfigCollisionFree(configs.at(idx))) {
-      collision_checks.at(idx) = 1;
-    } else {
-      collision_checks.at(idx) = 0;
-    }
-  }
+  const ScopedCallerContext caller_context(*this);
+  ParallelForEachIndex(
+      caller_context.get(), configs.size(), parallelize,
+      [&](CollisionCheckerContext* model_context, int idx) {
+        if (CheckContextConfigCollisionFree(model_context, configs.at(idx))) {
+          collision_checks.at(idx) = 1;
+        } else {
+          collision_checks.at(idx) = 0;
+        }
+      });
 
   return collision_checks;
 }
@@ -520,6 +806,7 @@ void CollisionChecker::SetConfigurationDistanceFunction(
       distance_function(GetZeroConfiguration(), GetZeroConfiguration());
   DRAKE_THROW_UNLESS(test_distance == 0.0);
   configuration_distance_function_ = distance_function;
+  ClearEdgeResultCache();
 }
 
 ConfigurationDistanceFunction
@@ -546,6 +833,7 @@ void CollisionChecker::SetConfigurationInterpolationFunction(
                        GetZeroConfiguration()(index));
   }
   configuration_interpolation_function_ = interpolation_function;
+  ClearEdgeResultCache();
 }
 
 ConfigurationInterpolationFunction
@@ -556,6 +844,61 @@ CollisionChecker::MakeStandaloneConfigurationInterpolationFunction() const {
   };
 }
 
+void CollisionChecker::set_edge_clearance_skipping(
+    std::optional<EdgeClearanceSkipping> skipping) {
+  if (skipping.has_value()) {
+    DRAKE_THROW_UNLESS(static_cast<int>(skipping->body_motion_bounds.size()) ==
+                       plant().num_bodies());
+    for (const double bound : skipping->body_motion_bounds) {
+      DRAKE_THROW_UNLESS(bound >= 0.0 && std::isfinite(bound));
+    }
+    DRAKE_THROW_UNLESS(skipping->influence_distance > 0.0);
+    DRAKE_THROW_UNLESS(std::isfinite(skipping->influence_distance));
+  }
+  edge_clearance_skipping_ = std::move(skipping);
+}
+
+std::optional<CollisionCheckerCacheConfig>
+CollisionChecker::result_cache_config() const {
+  if (result_cache_ == nullptr) {
+    return std::nullopt;
+  }
+  return result_cache_->config();
+}
+
+void CollisionChecker::set_result_cache_config(
+    const std::optional<CollisionCheckerCacheConfig>& config) {
+  if (!config.has_value()) {
+    result_cache_.reset();
+    return;
+  }
+  DRAKE_THROW_UNLESS(config->quantization > 0.0);
+  DRAKE_THROW_UNLESS(std::isfinite(config->quantization));
+  DRAKE_THROW_UNLESS(config->max_num_configurations >= 0);
+  DRAKE_THROW_UNLESS(config->max_num_edges >= 0);
+  result_cache_ = std::make_unique<ResultCache>(*config);
+}
+
+void CollisionChecker::ClearResultCache() {
+  if (result_cache_ != nullptr) {
+    result_cache_->Clear();
+  }
+}
+
+CollisionCheckerCacheStatistics CollisionChecker::GetResultCacheStatistics()
+    const {
+  if (result_cache_ == nullptr) {
+    return {};
+  }
+  return result_cache_->GetStatistics();
+}
+
+void CollisionChecker::ClearEdgeResultCache() {
+  if (result_cache_ != nullptr) {
+    result_cache_->ClearEdges();
+  }
+}
+
 bool CollisionChecker::CheckEdgeCollisionFree(const Eigen::VectorXd& q1,
                                               const Eigen::VectorXd& q2) const {
   return CheckContextEdgeCollisionFree(&mutable_model_context(), q1, q2);
@@ -565,7 +908,21 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(
     CollisionCheckerContext* model_context, const Eigen::VectorXd& q1,
     const Eigen::VectorXd& q2) const {
   DRAKE_THROW_UNLESS(model_context != nullptr);
+  if (result_cache_ == nullptr) {
+    return CheckContextEdgeCollisionFreeUncached(model_context, q1, q2);
+  }
+  if (const std::optional<bool> cached = result_cache_->FindEdge(q1, q2)) {
+    return *cached;
+  }
+  const bool result =
+      CheckContextEdgeCollisionFreeUncached(model_context, q1, q2);
+  result_cache_->InsertEdge(q1, q2, result);
+  return result;
+}
 
+bool CollisionChecker::CheckContextEdgeCollisionFreeUncached(
+    CollisionCheckerContext* model_context, const Eigen::VectorXd& q1,
+    const Eigen::VectorXd& q2) const {
   // Fail fast if q2 is in collision. This method is used by motion planners
   // that extend/connect towards some target configuration, and thus require a
   // number of edge collision checks in which q1 is often known to be
@@ -581,12 +938,64 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(
   const double distance = ComputeConfigurationDistance(q1, q2);
   const int num_steps =
       static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
-  for (int step = 0; step < num_steps; ++step) {
+
+  // When skipping, certified[step] is set once that step's sample is known to
+  // be collision free; the sample at step = num_steps is q2.
+  std::vector<uint8_t> certified;
+  const auto certify_neighbors = [&](const Eigen::VectorXd& q, int step) {
+    const RobotClearance clearance = CalcContextRobotClearance(
+        model_context, q, edge_clearance_skipping_->influence_distance);
+    const double radius =
+        CalcCertifiedRadius(clearance, *edge_clearance_skipping_);
+    // The number of steps to either side that are strictly within radius.
+    const double step_distance = distance / num_steps;
+    int reach = 0;
+    if (step_distance * num_steps < radius) {
+      reach = num_steps;
+    } else if (radius > 0.0) {
+      reach = static_cast<int>(std::ceil(radius / step_distance)) - 1;
+    }
+    const int first = std::max(0, step - reach);
+    const int last = std::min(num_steps, step + reach);
+    std::fill(certified.begin() + first, certified.begin() + last + 1, 1);
+  };
+  if (edge_clearance_skipping_.has_value()) {
+    certified.resize(num_steps + 1, 0);
+    certify_neighbors(q2, num_steps);
+  }
+
+  const auto check_step = [&](int step) {
+    if (!certified.empty() && certified[step]) {
+      return true;
+    }
     const double ratio =
         static_cast<double>(step) / static_cast<double>(num_steps);
     const Eigen::VectorXd qinterp =
         InterpolateBetweenConfigurations(q1, q2, ratio);
-    if (!CheckContextConfigCollisionFree(model_context, qinterp)) {
+    // Only the end points of the edge go through the result cache.
+    const bool free =
+        (step == 0)
+            ? CheckContextConfigCollisionFree(model_context, qinterp)
+            : CheckContextConfigCollisionFreeUncached(model_context, qinterp);
+    if (!free) {
+      return false;
+    }
+    if (!certified.empty()) {
+      certify_neighbors(qinterp, step);
+    }
+    return true;
+  };
+
+  if (edge_check_order() == EdgeCheckOrder::kBisection) {
+    for (const int step : CalcBisectionOrder(num_steps)) {
+      if (!check_step(step)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  for (int step = 0; step < num_steps; ++step) {
+    if (!check_step(step)) {
       return false;
     }
   }
@@ -595,8 +1004,15 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(
 
 bool CollisionChecker::CheckEdgeCollisionFreeParallel(
     const Eigen::VectorXd& q1, const Eigen::VectorXd& q2) const {
-  // Only perform parallel operations if `omp parallel for` will use >1 thread.
+  // Only perform parallel operations if the loop will use >1 thread.
   if (CanEvaluateInParallel()) {
+    const ScopedCallerContext caller_context(*this);
+    if (result_cache_ != nullptr) {
+      if (const std::optional<bool> cached = result_cache_->FindEdge(q1, q2)) {
+        return *cached;
+      }
+    }
+
     // Fail fast if q2 is in collision. This method is used by motion planners
     // that extend/connect towards some target configuration, and thus require a
     // number of edge collision checks in which q1 is often known to be
@@ -606,31 +1022,48 @@ bool CollisionChecker::CheckEdgeCollisionFreeParallel(
     // colliding edges.
     // There is also no need to special case checking q1, since it will be the
     // first configuration checked in the loop.
-    if (!CheckConfigCollisionFree(q2)) {
+    if (!CheckContextConfigCollisionFree(caller_context.get(), q2)) {
+      if (result_cache_ != nullptr) {
+        result_cache_->InsertEdge(q1, q2, false);
+      }
       return false;
     }
 
     const double distance = ComputeConfigurationDistance(q1, q2);
     const int num_steps =
         static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
+    // In bisection order, each thread's share of the loop is spread along the
+    // whole edge rather than being one contiguous piece of it.
+    const bool bisection = edge_check_order() == EdgeCheckOrder::kBisection;
+    const std::vector<int> order =
+        bisection ? CalcBisectionOrder(num_steps) : std::vector<int>{};
     std::atomic<bool> edge_valid(true);
-#if defined(_OPENMP)
-#pragma omp parallel for
-#endif
-    for (int step = 0; step < num_steps; ++step) {
-      if (edge_valid.load()) {
-        const double ratio =
-            static_cast<double>(step) / static_cast<double>(num_steps);
-        const Eigen::VectorXd qinterp =
-            InterpolateBetweenConfigurations(q1, q2, ratio);
-        if (!CheckConfigCollisionFree(qinterp)) {
-          edge_valid.store(false);
-        }
-      }
+    ParallelForEachIndex(
+        caller_context.get(), num_steps, true /* parallelize */,
+        [&](CollisionCheckerContext* model_context, int k) {
+          const int step = bisection ? order[k] : k;
+          if (edge_valid.load()) {
+            const double ratio =
+                static_cast<double>(step) / static_cast<double>(num_steps);
+            const Eigen::VectorXd qinterp =
+                InterpolateBetweenConfigurations(q1, q2, ratio);
+            // Only the end points of the edge go through the result cache.
+            const bool free =
+                (step == 0)
+                    ? CheckContextConfigCollisionFree(model_context, qinterp)
+                    : CheckContextConfigCollisionFreeUncached(model_context,
+                                                              qinterp);
+            if (!free) {
+              edge_valid.store(false);
+            }
+          }
+        });
+    if (result_cache_ != nullptr) {
+      result_cache_->InsertEdge(q1, q2, edge_valid.load());
     }
     return edge_valid.load();
   } else {
-    // If OpenMP cannot parallelize, fall back to the serial version.
+    // If we cannot parallelize, fall back to the serial version.
     return CheckEdgeCollisionFree(q1, q2);
   }
 }
@@ -641,16 +1074,18 @@ std::vector<uint8_t> CollisionChecker::CheckEdgesCollisionFree(
   // Note: vector<uint8_t> is used since vector<bool> is not thread safe.
   std::vector<uint8_t> collision_checks(edges.size(), 0);
 
-  const bool check_in_parallel = CanEvaluateInParallel() && parallelize;
-  CRU_OMP_PARALLEL_FOR_IF(check_in_parallel)
-  for (size_t idx = 0; idx < edges.size(); ++idx) {
-    const std::pair<Eigen::VectorXd, Eigen::VectorXd>& edge = edges.at(idx);
-    if (CheckEdgeCollisionFree(edge.first, edge.second)) {
-      collision_checks.at(idx) = 1;
-    } else {
-      collision_checks.at(idx) = 0;
-    }
-  }
+  const ScopedCallerContext caller_context(*this);
+  ParallelForEachIndex(
+      caller_context.get(), edges.size(), parallelize,
+      [&](CollisionCheckerContext* model_context, int idx) {
+        const std::pair<Eigen::VectorXd, Eigen::VectorXd>& edge = edges.at(idx);
+        if (CheckContextEdgeCollisionFree(model_context, edge.first,
+                                          edge.second)) {
+          collision_checks.at(idx) = 1;
+        } else {
+          collision_checks.at(idx) = 0;
+        }
+      });
 
   return collision_checks;
 }
@@ -673,7 +1108,12 @@ EdgeMeasure CollisionChecker::MeasureContextEdgeCollisionFree(
         static_cast<double>(step) / static_cast<double>(num_steps);
     const Eigen::VectorXd qinterp =
         InterpolateBetweenConfigurations(q1, q2, ratio);
-    if (!CheckContextConfigCollisionFree(model_context, qinterp)) {
+    // Only the end points of the edge go through the result cache.
+    const bool free =
+        (step == 0 || step == num_steps)
+            ? CheckContextConfigCollisionFree(model_context, qinterp)
+            : CheckContextConfigCollisionFreeUncached(model_context, qinterp);
+    if (!free) {
       return EdgeMeasure(distance, last_valid_ratio);
     }
     last_valid_ratio = ratio;
@@ -683,8 +1123,9 @@ EdgeMeasure CollisionChecker::MeasureContextEdgeCollisionFree(
 
 EdgeMeasure CollisionChecker::MeasureEdgeCollisionFreeParallel(
     const Eigen::VectorXd& q1, const Eigen::VectorXd& q2) const {
-  // Only perform parallel operations if omp parallel for will use >1 thread.
+  // Only perform parallel operations if the loop will use >1 thread.
   if (CanEvaluateInParallel()) {
+    const ScopedCallerContext caller_context(*this);
     const double distance = ComputeConfigurationDistance(q1, q2);
     const int num_steps =
         static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
@@ -694,30 +1135,37 @@ EdgeMeasure CollisionChecker::MeasureEdgeCollisionFreeParallel(
     // Start by assuming the whole edge is fine; we'll whittle away at it.
     alpha.store(1.0);
     std::mutex alpha_mutex;
-#if defined(_OPENMP)
-#pragma omp parallel for
-#endif
-    for (int step = 0; step <= num_steps; ++step) {
-      const double ratio = step / static_cast<double>(num_steps);
-      // If this step fails, this is the alpha which we would report.
-      const double possible_alpha = (step - 1) / static_cast<double>(num_steps);
-      if (possible_alpha < alpha.load()) {
-        const Eigen::VectorXd qinterp =
-            InterpolateBetweenConfigurations(q1, q2, ratio);
-        if (!CheckConfigCollisionFree(qinterp)) {
-          std::lock_guard<std::mutex> update_lock(alpha_mutex);
-          // Between the initial decision to interpolate and check collisions
-          // and now, another thread may have proven a *lower* alpha is invalid;
-          // check again before setting *this* as the lowest known invalid step.
+    ParallelForEachIndex(
+        caller_context.get(), num_steps + 1, true /* parallelize */,
+        [&](CollisionCheckerContext* model_context, int step) {
+          const double ratio = step / static_cast<double>(num_steps);
+          // If this step fails, this is the alpha which we would report.
+          const double possible_alpha =
+              (step - 1) / static_cast<double>(num_steps);
           if (possible_alpha < alpha.load()) {
-            alpha.store(possible_alpha);
+            const Eigen::VectorXd qinterp =
+                InterpolateBetweenConfigurations(q1, q2, ratio);
+            // Only the end points of the edge go through the result cache.
+            const bool free =
+                (step == 0 || step == num_steps)
+                    ? CheckContextConfigCollisionFree(model_context, qinterp)
+                    : CheckContextConfigCollisionFreeUncached(model_context,
+                                                              qinterp);
+            if (!free) {
+              std::lock_guard<std::mutex> update_lock(alpha_mutex);
+              // Between the initial decision to interpolate and check
+              // collisions and now, another thread may have proven a *lower*
+              // alpha is invalid; check again before setting *this* as the
+              // lowest known invalid step.
+              if (possible_alpha < alpha.load()) {
+                alpha.store(possible_alpha);
+              }
+            }
           }
-        }
-      }
-    }
+        });
     return EdgeMeasure(distance, alpha.load());
   } else {
-    // If OpenMP cannot parallelize, fall back to the serial version.
+    // If we cannot parallelize, fall back to the serial version.
     return MeasureEdgeCollisionFree(q1, q2);
   }
 }
@@ -728,13 +1176,14 @@ std::vector<EdgeMeasure> CollisionChecker::MeasureEdgesCollisionFree(
   std::vector<EdgeMeasure> collision_checks(edges.size(),
                                             EdgeMeasure(0.0, -1.0));
 
-  const bool check_in_parallel = CanEvaluateInParallel() && parallelize;
-  CRU_OMP_PARALLEL_FOR_IF(check_in_parallel)
-  for (size_t idx = 0; idx < edges.size(); ++idx) {
-    const std::pair<Eigen::VectorXd, Eigen::VectorXd>& edge = edges.at(idx);
-    collision_checks.at(idx) =
-        MeasureEdgeCollisionFree(edge.first, edge.second);
-  }
+  const ScopedCallerContext caller_context(*this);
+  ParallelForEachIndex(
+      caller_context.get(), edges.size(), parallelize,
+      [&](CollisionCheckerContext* model_context, int idx) {
+        const std::pair<Eigen::VectorXd, Eigen::VectorXd>& edge = edges.at(idx);
+        collision_checks.at(idx) = MeasureContextEdgeCollisionFree(
+            model_context, edge.first, edge.second);
+      });
 
   return collision_checks;
 }
@@ -783,6 +1232,7 @@ std::vector<RobotCollisionType> CollisionChecker::ClassifyContextBodyCollisions(
 CollisionChecker::CollisionChecker(CollisionCheckerParams params,
                                    bool supports_parallel_checking)
     : setup_model_(std::move(params.model)),
+      executor_(std::move(params.executor)),
       robot_model_instances_([&params]() {
         // Sort (and de-duplicate) the robot model instances for faster lookups.
         DRAKE_THROW_UNLESS(params.robot_model_instances.size() > 0);
@@ -844,11 +1294,20 @@ void CollisionChecker::AllocateContexts() {
       "OpenMP enabled in build? {}",
       num_threads, num_omp_threads, max_num_omp_threads, omp_thread_limit,
       omp_enabled_in_build);
+  // The executor's workers get their own contexts after the OpenMP threads'.
+  const int num_executor_workers =
+      (executor_ != nullptr) ? executor_->num_workers() : 0;
+  if (executor_ != nullptr) {
+    log()->info("Allocating {} more contexts for the executor's workers",
+                num_executor_workers);
+  }
+  executor_context_offset_ = num_threads;
   // Make the prototype context.
   const std::unique_ptr<CollisionCheckerContext> prototype_context =
       CreatePrototypeContext();
   DRAKE_THROW_UNLESS(prototype_context != nullptr);
-  owned_contexts_.AllocateOwnedContexts(*prototype_context, num_threads);
+  owned_contexts_.AllocateOwnedContexts(*prototype_context,
+                                        num_threads + num_executor_workers);
 }
 
 void CollisionChecker::OwnedContextKeeper::AllocateOwnedContexts(
@@ -866,8 +1325,78 @@ void CollisionChecker::OwnedContextKeeper::AllocateOwnedContexts(
 }
 
 bool CollisionChecker::CanEvaluateInParallel() const {
-  return SupportsParallelChecking() &&
-         common_robotics_utilities::openmp_helpers::GetNumOmpThreads() > 1;
+  if (!SupportsParallelChecking()) {
+    return false;
+  }
+  if (executor_ != nullptr) {
+    return executor_->num_workers() > 0;
+  }
+  return common_robotics_utilities::openmp_helpers::GetNumOmpThreads() > 1;
+}
+
+void CollisionChecker::ParallelForEachIndex(
+    CollisionCheckerContext* caller_context, const int num_iterations,
+    const bool parallelize,
+    const std::function<void(CollisionCheckerContext*, int)>& body) const {
+  DRAKE_DEMAND(caller_context != nullptr);
+  if (!(parallelize && CanEvaluateInParallel())) {
+    for (int index = 0; index < num_iterations; ++index) {
+      body(caller_context, index);
+    }
+    return;
+  }
+  if (executor_ != nullptr) {
+    executor_->ParallelFor(num_iterations, [&](int worker, int index) {
+      CollisionCheckerContext* model_context =
+          (worker < 0) ? caller_context
+                       : &owned_contexts_.get_mutable_model_context(
+                             executor_context_offset_ + worker);
+      body(model_context, index);
+    });
+    return;
+  }
+  CRU_OMP_PARALLEL_FOR_IF(true)
+  for (int index = 0; index < num_iterations; ++index) {
+    body(&mutable_model_context(), index);
+  }
+}
+
+CollisionChecker::ScopedCallerContext::ScopedCallerContext(
+    const CollisionChecker& checker)
+    : checker_(checker) {
+  if (checker_.executor_ == nullptr) {
+    context_ = &checker_.mutable_model_context();
+    return;
+  }
+  borrowed_ = checker_.caller_contexts_.Take();
+  if (borrowed_ == nullptr) {
+    borrowed_ = checker_.MakeStandaloneModelContext();
+  }
+  context_ = borrowed_.get();
+}
+
+CollisionChecker::ScopedCallerContext::~ScopedCallerContext() {
+  if (borrowed_ != nullptr) {
+    checker_.caller_contexts_.Give(std::move(borrowed_));
+  }
+}
+
+std::shared_ptr<CollisionCheckerContext>
+CollisionChecker::CallerContextPool::Take() const {
+  std::lock_guard<std::mutex> lock(contexts_mutex_);
+  if (contexts_.empty()) {
+    return nullptr;
+  }
+  std::shared_ptr<CollisionCheckerContext> context =
+      std::move(contexts_.back());
+  contexts_.pop_back();
+  return context;
+}
+
+void CollisionChecker::CallerContextPool::Give(
+    std::shared_ptr<CollisionCheckerContext> context) const {
+  std::lock_guard<std::mutex> lock(contexts_mutex_);
+  contexts_.push_back(std::move(context));
 }
 
 std::string CollisionChecker::CriticizePaddingMatrix() const {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -9,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/drake_throw.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -138,6 +140,21 @@ namespace planning {
  from std::async) should have its own instance of a collision checker made using
  Clone(). Then each arbitrary thread will have its own implicit context pool.
 
+ @anchor ccb_executor_parallelism
+ <h5>Executor Parallelism</h5>
+
+ Instead of OpenMP, the parallel queries (CheckConfigsCollisionFree(),
+ CheckEdgeCollisionFreeParallel(), CheckEdgesCollisionFree(),
+ MeasureEdgeCollisionFreeParallel(), and MeasureEdgesCollisionFree()) can run
+ their loops on a CollisionCheckerExecutor given by
+ CollisionCheckerParams::executor. The checker then allocates an extra implicit
+ context for each of the executor's workers, and each thread that calls one of
+ those queries borrows a standalone context of its own for the duration of the
+ call. As a result, those queries may be called from arbitrary threads at once,
+ and the callers share the executor's workers instead of each starting an
+ OpenMP team of its own. A single executor (e.g., a CollisionCheckerThreadPool)
+ is meant to be shared by all of the checkers of a process.
+
  <h5>Implementing Derived Classes</h5>
 
  Collision checkers deriving from CollisionChecker *must* support parallel
@@ -690,10 +707,11 @@ class CollisionChecker {
   // TODO(SeanCurtis-TRI): This isn't tested.
   /** Checks a vector of configurations for collision, evaluating in parallel
    when supported and enabled by `parallelize`. Parallelization in configuration
-   collision checks is provided using OpenMP and is supported when both: (1) the
-   collision checker declares that parallelization is supported (i.e. when
-   SupportsParallelChecking() is true) and (2) when multiple OpenMP threads are
-   available for execution.
+   collision checks is provided using OpenMP (or the executor, if any; see
+   @ref ccb_executor_parallelism "Executor Parallelism") and is supported when
+   both: (1) the collision checker declares that parallelization is supported
+   (i.e. when SupportsParallelChecking() is true) and (2) when multiple OpenMP
+   threads (or at least one executor worker) are available for execution.
    See @ref collision_checker_parallel_edge "function-level parallelism" for
    guidance on proper usage.
    @param configs       Configurations to check
@@ -770,6 +788,29 @@ class CollisionChecker {
    any non-holonomic robot). You will need to provide your own interpolation
    function in such cases.
 
+   <u>Sample order and clearance-based skipping</u>
+
+   By default, the samples of an edge are checked in order from `q1` to `q2`
+   (after first checking `q2`, see CheckEdgeCollisionFree()). When edges are
+   often blocked in their interior, e.g., when building roadmaps, checking the
+   samples coarse-to-fine finds the collision sooner; see
+   set_edge_check_order(). The order never changes which samples are checked
+   on an edge that is collision free.
+
+   Optionally, a sample that is known to be far from any obstacle can vouch
+   for its neighbors: given bounds on how fast each body moves along an edge,
+   the clearance at a sample certifies that all samples within some distance
+   of it are collision free, and those are skipped; see
+   set_edge_clearance_skipping(). Each checked sample then costs an additional
+   clearance query, so this pays off when edges are long compared to the edge
+   step size and the robot is mostly far from obstacles.
+
+   Both options apply to CheckEdgeCollisionFree(),
+   CheckContextEdgeCollisionFree(), and CheckEdgesCollisionFree();
+   CheckEdgeCollisionFreeParallel() uses the sample order but never skips. The
+   MeasureEdgeCollisionFree() family must find the collision-free prefix of the
+   edge, so it always checks samples in order and ignores both options.
+
    @anchor collision_checker_parallel_edge
    <u>Function-level parallelism</u>
 
@@ -892,8 +933,32 @@ class CollisionChecker {
   void set_edge_step_size(double edge_step_size) {
     DRAKE_THROW_UNLESS(edge_step_size > 0.0);
     edge_step_size_ = edge_step_size;
+    ClearEdgeResultCache();
+  }
+
+  /** Gets the order in which edge samples are checked. */
+  EdgeCheckOrder edge_check_order() const { return edge_check_order_; }
+
+  /** Sets the order in which edge samples are checked. The default is
+   EdgeCheckOrder::kSequential. */
+  void set_edge_check_order(EdgeCheckOrder edge_check_order) {
+    edge_check_order_ = edge_check_order;
+  }
+
+  /** Gets the clearance-based skipping parameters, if enabled. */
+  const std::optional<EdgeClearanceSkipping>& edge_clearance_skipping() const {
+    return edge_clearance_skipping_;
   }
 
+  /** Enables (or, given nullopt, disables) skipping edge samples that are
+   certified collision free by the clearance at a nearby sample. It is
+   disabled by default.
+   @throws std::exception if `skipping` has the wrong number of body motion
+   bounds (one per plant body), or any invalid value (see
+   EdgeClearanceSkipping). */
+  void set_edge_clearance_skipping(
+      std::optional<EdgeClearanceSkipping> skipping);
+
   /** Checks a single configuration-to-configuration edge for collision, using
    the current thread's associated context.
    @param q1 Start configuration for edge.
@@ -911,7 +976,8 @@ class CollisionChecker {
                                      const Eigen::VectorXd& q2) const;
 
   /** Checks a single configuration-to-configuration edge for collision.
-   Collision check is parallelized via OpenMP when supported.
+   Collision check is parallelized via OpenMP (or the executor, if any) when
+   supported.
    See @ref collision_checker_parallel_edge "function-level parallelism" for
    guidance on proper usage.
    @param q1 Start configuration for edge.
@@ -921,8 +987,8 @@ class CollisionChecker {
                                       const Eigen::VectorXd& q2) const;
 
   /** Checks multiple configuration-to-configuration edges for collision.
-   Collision checks are parallelized via OpenMP when supported and enabled by
-   `parallelize`.
+   Collision checks are parallelized via OpenMP (or the executor, if any) when
+   supported and enabled by `parallelize`.
    See @ref collision_checker_parallel_edge "function-level parallelism" for
    guidance on proper usage.
    @param edges        Edges to check, each in the form of pair<q1, q2>.
@@ -950,7 +1016,8 @@ class CollisionChecker {
       const Eigen::VectorXd& q2) const;
 
   /** Checks a single configuration-to-configuration edge for collision.
-   Collision check is parallelized via OpenMP when supported.
+   Collision check is parallelized via OpenMP (or the executor, if any) when
+   supported.
    See @ref collision_checker_parallel_edge "function-level parallelism" for
    guidance on proper usage.
    @param q1 Start configuration for edge.
@@ -960,8 +1027,8 @@ class CollisionChecker {
                                                const Eigen::VectorXd& q2) const;
 
   /** Checks multiple configuration-to-configuration edge for collision.
-   Collision checks are parallelized via OpenMP when supported and enabled by
-   `parallelize`.
+   Collision checks are parallelized via OpenMP (or the executor, if any) when
+   supported and enabled by `parallelize`.
    See @ref collision_checker_parallel_edge "function-level parallelism" for
    guidance on proper usage.
    @param edges        Edges to check, each in the form of pair<q1, q2>.
@@ -974,6 +1041,56 @@ class CollisionChecker {
 
   //@}
 
+  /** @name Result caching
+
+   Planners that build and query roadmaps tend to check the same
+   configurations and edges over and over. When enabled (it is disabled by
+   default), %CollisionChecker remembers the results of
+   CheckConfigCollisionFree() and CheckEdgeCollisionFree() (and of their
+   Context-based, parallel, and plural variants) so that repeated queries
+   become lookups.
+
+   Results are keyed by the (quantized) configurations; see
+   CollisionCheckerCacheConfig. The samples in the interior of an edge are not
+   cached individually. The cache is bounded in size, evicting the least
+   recently used results, and may be used from multiple threads at once. Note
+   that a query answered by the cache does not update the positions in the
+   context it would otherwise have used.
+
+   The cache is cleared whenever a change to this checker could change a
+   result: adding or removing collision shapes, changing padding or collision
+   filters, or PerformOperationAgainstAllModelContexts(). Changes to the edge
+   step size, distance function, or interpolation function clear the cached
+   edge results. The cache knows nothing about changes made to a context by
+   other means (e.g., changes to the non-robot state of a context passed to
+   the explicit Context-based methods); call ClearResultCache() after such
+   changes.
+
+   A clone of this checker starts with an empty cache with the same
+   configuration. */
+  //@{
+
+  /** Returns the result cache configuration, or nullopt if the cache is
+   disabled. */
+  std::optional<CollisionCheckerCacheConfig> result_cache_config() const;
+
+  /** Enables the result cache with the given configuration (discarding any
+   previously cached results and statistics), or disables it given nullopt.
+   @throws std::exception if `config` is invalid (see
+   CollisionCheckerCacheConfig). */
+  void set_result_cache_config(
+      const std::optional<CollisionCheckerCacheConfig>& config);
+
+  /** Discards all cached results. The statistics are not reset. This is a
+   no-op if the cache is disabled. */
+  void ClearResultCache();
+
+  /** Returns the cache statistics accumulated since the cache was enabled.
+   All counts are zero if the cache is disabled. */
+  CollisionCheckerCacheStatistics GetResultCacheStatistics() const;
+
+  //@}
+
   /** @name Robot collision state
 
    These methods help characterize the robot's collision state with respect to
@@ -1047,6 +1164,10 @@ class CollisionChecker {
    @returns true if parallel checking is supported. */
   bool SupportsParallelChecking() const { return supports_parallel_checking_; }
 
+  /** Returns the executor that runs the parallel queries, or nullptr if they
+   use OpenMP. See @ref ccb_executor_parallelism "Executor Parallelism". */
+  CollisionCheckerExecutor* executor() const { return executor_.get(); }
+
  protected:
   /** Derived classes declare upon construction whether they support parallel
    checking (see SupportsParallelChecking()).
@@ -1162,7 +1283,8 @@ class CollisionChecker {
   //@}
 
   /** @returns true if this object SupportsParallelChecking() and more than one
-   thread is available. */
+   thread is available (i.e., more than one OpenMP thread, or, when there is an
+   executor, at least one executor worker besides the calling thread). */
   bool CanEvaluateInParallel() const;
 
   /* (Testing only.) Checks that the padding matrix in this instance is valid,
@@ -1210,6 +1332,20 @@ class CollisionChecker {
    padding matrix -- this excludes the meaningless zeros on the diagonal. */
   void UpdateMaxCollisionPadding();
 
+  /* Discards the cached edge results (if any), e.g., when the way that edges
+   are sampled changes. */
+  void ClearEdgeResultCache();
+
+  /* CheckContextConfigCollisionFree() without the result cache; used for the
+   samples in the interior of edges. */
+  bool CheckContextConfigCollisionFreeUncached(
+      CollisionCheckerContext* model_context, const Eigen::VectorXd& q) const;
+
+  /* CheckContextEdgeCollisionFree() without the edge result cache. */
+  bool CheckContextEdgeCollisionFreeUncached(
+      CollisionCheckerContext* model_context, const Eigen::VectorXd& q1,
+      const Eigen::VectorXd& q2) const;
+
   /* Tests the given collision padding matrix for several invariants, throwing
    if they are not satisfied:
 
@@ -1227,6 +1363,37 @@ class CollisionChecker {
   std::string CriticizePaddingMatrix(const Eigen::MatrixXd& padding,
                                      const char* func) const;
 
+  /* Calls `body(context, index)` for each index in [0, num_iterations), in
+   parallel if `parallelize` and CanEvaluateInParallel(). Each call gets a
+   context that no concurrent call is using: `caller_context` for calls made by
+   the calling thread when using an executor or when running serially, and the
+   worker's (or OpenMP thread's) implicit context otherwise. */
+  void ParallelForEachIndex(
+      CollisionCheckerContext* caller_context, int num_iterations,
+      bool parallelize,
+      const std::function<void(CollisionCheckerContext*, int)>& body) const;
+
+  /* The context that a thread calling a parallel query uses for its own share
+   of the work. Without an executor this is the thread's implicit context; with
+   one, it is a standalone context borrowed from caller_contexts_ for the
+   lifetime of this object. */
+  class ScopedCallerContext {
+   public:
+    explicit ScopedCallerContext(const CollisionChecker& checker);
+
+    ~ScopedCallerContext();
+
+    ScopedCallerContext(const ScopedCallerContext&) = delete;
+    void operator=(const ScopedCallerContext&) = delete;
+
+    CollisionCheckerContext* get() const { return context_; }
+
+   private:
+    const CollisionChecker& checker_;
+    std::shared_ptr<CollisionCheckerContext> borrowed_;
+    CollisionCheckerContext* context_{};
+  };
+
   /* This class allocates and maintains the contexts associated with OpenMP
    threads. When the CollisionChecker is evaluated in its implicit mode, the
    contexts used are drawn from this collection and each context is associated
@@ -1358,6 +1525,32 @@ class CollisionChecker {
     mutable std::mutex standalone_contexts_mutex_;
   };
 
+  /* A free list of the standalone contexts lent out by ScopedCallerContext, so
+   that they are reused across calls. The contexts stay registered with
+   standalone_contexts_ while they are in the list. */
+  class CallerContextPool {
+   public:
+    CallerContextPool() {}
+
+    /* The copy constructor is used to implement our outer class's Clone(). */
+    explicit CallerContextPool(const CallerContextPool&) {
+      // Nothing to do here; contexts should NOT be copied during Clone().
+    }
+
+    /* Does not allow assignment. */
+    void operator=(const CallerContextPool&) = delete;
+
+    /* Returns a pooled context, or nullptr if there is none. */
+    std::shared_ptr<CollisionCheckerContext> Take() const;
+
+    /* Returns `context` to the pool. */
+    void Give(std::shared_ptr<CollisionCheckerContext> context) const;
+
+   private:
+    mutable std::vector<std::shared_ptr<CollisionCheckerContext>> contexts_;
+    mutable std::mutex contexts_mutex_;
+  };
+
   /* Model of the robot used during initial setup only. */
   std::shared_ptr<RobotDiagram<double>> setup_model_;
 
@@ -1372,6 +1565,17 @@ class CollisionChecker {
    contexts alive indefinitely. */
   StandaloneContextReferenceKeeper standalone_contexts_;
 
+  /* The executor for the parallel queries, if any. */
+  std::shared_ptr<CollisionCheckerExecutor> executor_;
+
+  /* The index of the executor's worker 0 in owned_contexts_; the contexts
+   before it belong to the OpenMP threads. */
+  int executor_context_offset_{};
+
+  /* Contexts for the threads that call parallel queries, when there is an
+   executor. */
+  CallerContextPool caller_contexts_;
+
   /* We maintain a set of all robot model instances for lookups. This vector is
    already de-duplicated and sorted. */
   const std::vector<multibody::ModelInstanceIndex> robot_model_instances_;
@@ -1390,6 +1594,17 @@ class CollisionChecker {
   /* Step size for edge collision checking. */
   double edge_step_size_ = 0.0;
 
+  /* Order of samples for edge collision checking. */
+  EdgeCheckOrder edge_check_order_ = EdgeCheckOrder::kSequential;
+
+  /* Parameters for skipping edge samples, if enabled. */
+  std::optional<EdgeClearanceSkipping> edge_clearance_skipping_;
+
+  /* The cache of check results, if enabled; see set_result_cache_config().
+   Copying (for Clone()) produces an empty cache with the same configuration. */
+  class ResultCache;
+  copyable_unique_ptr<ResultCache> result_cache_;
+
   /* Storage for body-body collision padding. */
   Eigen::MatrixXd collision_padding_;
 
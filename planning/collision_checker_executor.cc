@@ -0,0 +1,176 @@
+#include "drake/planning/collision_checker_executor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace planning {
+
+CollisionCheckerExecutor::CollisionCheckerExecutor(int num_workers)
+    : num_workers_(num_workers) {
+  DRAKE_THROW_UNLESS(num_workers >= 0);
+}
+
+CollisionCheckerExecutor::~CollisionCheckerExecutor() = default;
+
+void CollisionCheckerExecutor::ParallelFor(
+    int num_iterations,
+    const std::function<void(int worker, int index)>& body) {
+  DRAKE_THROW_UNLESS(num_iterations >= 0);
+  DRAKE_THROW_UNLESS(body != nullptr);
+  if (num_iterations > 0) {
+    DoParallelFor(num_iterations, body);
+  }
+}
+
+// One call to ParallelFor(). Its chunks are claimed by incrementing `next`;
+// whoever completes the last outstanding iteration wakes the caller.
+struct CollisionCheckerThreadPool::Job {
+  Job(int num_iterations_in, int chunk_size_in,
+      const std::function<void(int, int)>* body_in)
+      : num_iterations(num_iterations_in),
+        chunk_size(chunk_size_in),
+        body(body_in),
+        num_remaining(num_iterations_in) {}
+
+  // Claims the next chunk and runs it as `worker`. Returns false when there
+  // was no chunk left to claim; in that case, `body` is not accessed (it may
+  // already be gone).
+  bool RunChunk(int worker) {
+    const int begin = next.fetch_add(chunk_size);
+    if (begin >= num_iterations) {
+      return false;
+    }
+    const int end = std::min(begin + chunk_size, num_iterations);
+    if (!failed.load()) {
+      try {
+        for (int index = begin; index < end; ++index) {
+          (*body)(worker, index);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error == nullptr) {
+          error = std::current_exception();
+        }
+        failed.store(true);
+      }
+    }
+    if (num_remaining.fetch_sub(end - begin) == end - begin) {
+      std::lock_guard<std::mutex> lock(mutex);
+      done.notify_all();
+    }
+    return true;
+  }
+
+  const int num_iterations;
+  const int chunk_size;
+  const std::function<void(int, int)>* const body;
+  std::atomic<int> next{0};
+  std::atomic<int> num_remaining;
+  std::atomic<bool> failed{false};
+  // Guards `error` and pairs with `done`.
+  std::mutex mutex;
+  std::condition_variable done;
+  std::exception_ptr error;
+};
+
+CollisionCheckerThreadPool::CollisionCheckerThreadPool(int num_workers)
+    : CollisionCheckerExecutor(num_workers) {
+  threads_.reserve(num_workers);
+  for (int worker = 0; worker < num_workers; ++worker) {
+    threads_.emplace_back([this, worker]() {
+      RunWorker(worker);
+    });
+  }
+}
+
+CollisionCheckerThreadPool::~CollisionCheckerThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void CollisionCheckerThreadPool::DoParallelFor(
+    int num_iterations, const std::function<void(int, int)>& body) {
+  if (num_iterations == 1 || threads_.empty()) {
+    for (int index = 0; index < num_iterations; ++index) {
+      body(-1, index);
+    }
+    return;
+  }
+
+  // A few chunks per participant balances uneven iterations without paying
+  // for a claim per iteration.
+  const int num_participants = static_cast<int>(threads_.size()) + 1;
+  const int chunk_size = std::max(1, num_iterations / (4 * num_participants));
+  const int num_chunks = (num_iterations + chunk_size - 1) / chunk_size;
+  const auto job = std::make_shared<Job>(num_iterations, chunk_size, &body);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(job);
+  }
+  // The caller takes (at least) one chunk, so only wake as many workers as
+  // there are other chunks.
+  if (num_chunks - 1 >= static_cast<int>(threads_.size())) {
+    wake_.notify_all();
+  } else {
+    for (int i = 0; i < num_chunks - 1; ++i) {
+      wake_.notify_one();
+    }
+  }
+
+  while (job->RunChunk(-1)) {
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveJob(job.get());
+  }
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->done.wait(lock, [&job]() {
+    return job->num_remaining.load() == 0;
+  });
+  if (job->error != nullptr) {
+    std::rethrow_exception(job->error);
+  }
+}
+
+void CollisionCheckerThreadPool::RunWorker(int worker) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [this]() {
+      return stop_ || !jobs_.empty();
+    });
+    if (stop_) {
+      return;
+    }
+    const std::shared_ptr<Job> job = jobs_[next_job_++ % jobs_.size()];
+    lock.unlock();
+    const bool ran = job->RunChunk(worker);
+    lock.lock();
+    if (!ran) {
+      RemoveJob(job.get());
+    }
+  }
+}
+
+void CollisionCheckerThreadPool::RemoveJob(const Job* job) {
+  const auto iter =
+      std::find_if(jobs_.begin(), jobs_.end(), [job](const auto& posted) {
+        return posted.get() == job;
+      });
+  if (iter != jobs_.end()) {
+    jobs_.erase(iter);
+  }
+}
+
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace planning {
+
+/** Runs the loops of CollisionChecker's parallel queries (e.g.,
+CollisionChecker::CheckConfigsCollisionFree()) in place of OpenMP; see
+CollisionCheckerParams::executor.
+
+An executor has a fixed number of workers. A CollisionChecker keeps one context
+per worker, so a single executor can be shared by many checkers (and their
+clones), and by many threads calling into them concurrently.
+
+Derived classes implement DoParallelFor(), and must honor the promises
+documented for ParallelFor().
+
+@ingroup planning_collision_checker */
+class CollisionCheckerExecutor {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CollisionCheckerExecutor);
+
+  virtual ~CollisionCheckerExecutor();
+
+  /** Returns the number of workers, not counting the threads that call
+  ParallelFor(). */
+  int num_workers() const { return num_workers_; }
+
+  /** Calls `body(worker, index)` once for each index in [0, num_iterations)
+  and returns once all of the calls have finished. The `worker` identifies the
+  thread making the call: it is in [0, num_workers()) for the executor's
+  workers, and is -1 for the thread that called ParallelFor(), which may make
+  some (or all) of the calls itself. Each worker makes one call at a time, even
+  when several threads call ParallelFor() concurrently.
+
+  If any call to `body` throws, the remaining calls might be skipped, and one of
+  the exceptions is rethrown here once the calls in progress have finished.
+
+  This method is thread safe, and may be called from within `body`.
+  @throws std::exception if `num_iterations` is negative. */
+  void ParallelFor(int num_iterations,
+                   const std::function<void(int worker, int index)>& body);
+
+ protected:
+  /** Constructs an executor with `num_workers` workers.
+  @throws std::exception if `num_workers` is negative. */
+  explicit CollisionCheckerExecutor(int num_workers);
+
+  /** Implements ParallelFor(). The `num_iterations` is positive. */
+  virtual void DoParallelFor(
+      int num_iterations, const std::function<void(int, int)>& body) = 0;
+
+ private:
+  const int num_workers_;
+};
+
+/** A CollisionCheckerExecutor backed by a persistent pool of threads.
+
+Each call to ParallelFor() posts its loop as a job, which is split into chunks
+of consecutive iterations. Idle workers visit the posted jobs round-robin and
+claim one chunk at a time, so that concurrent callers get an even share of the
+workers, while each calling thread claims chunks of its own job alongside them.
+Loops with a single iteration run directly on the calling thread, and no
+threads are created or joined per call.
+
+@ingroup planning_collision_checker */
+class CollisionCheckerThreadPool final : public CollisionCheckerExecutor {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CollisionCheckerThreadPool);
+
+  /** Starts `num_workers` threads. With zero workers, every loop runs on its
+  calling thread.
+  @throws std::exception if `num_workers` is negative. */
+  explicit CollisionCheckerThreadPool(int num_workers);
+
+  /** Stops and joins the threads.
+  @pre No calls to ParallelFor() are in progress. */
+  ~CollisionCheckerThreadPool() final;
+
+ private:
+  struct Job;
+
+  void DoParallelFor(int num_iterations,
+                     const std::function<void(int, int)>& body) final;
+
+  // The main loop of the worker thread with the given index.
+  void RunWorker(int worker);
+
+  // Removes `job` from jobs_, if it is still there.
+  // @pre mutex_ is held.
+  void RemoveJob(const Job* job);
+
+  // Guards all of the members below except threads_.
+  std::mutex mutex_;
+  // Signaled when a job is posted, or when the workers should stop.
+  std::condition_variable wake_;
+  // The jobs that may still have unclaimed chunks.
+  std::vector<std::shared_ptr<Job>> jobs_;
+  // The (unbounded) round-robin cursor into jobs_.
+  size_t next_job_{0};
+  bool stop_{false};
+
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace planning
+}  // namespace drake
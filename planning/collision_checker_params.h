@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -7,6 +8,7 @@
 #include <Eigen/Core>
 
 #include "drake/multibody/tree/multibody_tree_indexes.h"
+#include "drake/planning/collision_checker_executor.h"
 #include "drake/planning/robot_diagram.h"
 
 namespace drake {
@@ -38,6 +40,110 @@ To be valid, the function must satisfy the following conditions:
 using ConfigurationInterpolationFunction = std::function<Eigen::VectorXd(
     const Eigen::VectorXd&, const Eigen::VectorXd&, double)>;
 
+/** The order in which CollisionChecker visits the samples of an edge when
+checking whether the edge is collision free. Either order checks the same
+samples and so gives the same answer; they differ in how soon a colliding
+sample is found.
+
+@ingroup planning_collision_checker */
+enum class EdgeCheckOrder {
+  /** Samples are checked from the start of the edge to its end. */
+  kSequential,
+  /** Samples are checked coarse-to-fine, in van der Corput order: the start,
+  the midpoint, the quarter points, the eighth points, and so on, each rounded
+  to the nearest sample (skipping samples that were already checked). Obstacles
+  that block a large part of the edge are found after only a few checks. */
+  kBisection,
+};
+
+/** Parameters that let CollisionChecker skip edge samples that are certified
+collision free by the clearance (see CollisionChecker::CalcRobotClearance())
+at a nearby sample.
+
+If every point of body B moves at most `Lᴮ` meters per unit of configuration
+distance, then a pair of bodies R and O whose padded distance is ϕ at some
+sample cannot collide at any configuration within a configuration distance of
+ϕ / (Lᴿ + Lᴼ) along the edge. This assumes that the interpolation function
+traverses the edge at a constant rate with respect to the distance function
+(as the default interpolation does with any norm-based distance function).
+
+@ingroup planning_collision_checker */
+struct EdgeClearanceSkipping {
+  /** For each body in the plant (indexed by BodyIndex), an upper bound `Lᴮ` on
+  how far (in meters) any point of that body can move when the configuration
+  moves by one unit of configuration distance. Bodies that do not move along
+  edges (e.g., the environment) can use zero. All entries must be non-negative
+  and finite. */
+  std::vector<double> body_motion_bounds;
+
+  /** The influence distance passed to CalcRobotClearance(). Body pairs farther
+  apart than this are assumed to be exactly this far apart. Must be positive
+  and finite. Larger values allow larger skips, but make each clearance query
+  more expensive. */
+  double influence_distance{0.1};
+};
+
+/** Options for the (opt-in) cache of collision check results kept by a
+CollisionChecker; see CollisionChecker::set_result_cache_config().
+
+@ingroup planning_collision_checker */
+struct CollisionCheckerCacheConfig {
+  /** Configurations are rounded to a grid with this spacing (in the units of
+  q) to form cache keys, so configurations that round to the same grid point
+  share a cached result. Must be positive. The default is small enough that
+  only (numerically) identical configurations share a result; larger values
+  trade accuracy for more hits. */
+  double quantization{1e-9};
+
+  /** The maximum number of cached configuration results. When the cache is
+  full, the least recently used results are evicted. Must be non-negative;
+  zero disables caching of configurations. */
+  int max_num_configurations{100'000};
+
+  /** The maximum number of cached edge results, as for
+  `max_num_configurations`. */
+  int max_num_edges{100'000};
+};
+
+/** Counters that report the effectiveness of a CollisionChecker's result
+cache; see CollisionChecker::GetResultCacheStatistics().
+
+@ingroup planning_collision_checker */
+struct CollisionCheckerCacheStatistics {
+  /** Returns the fraction of configuration lookups that were hits, or zero if
+  there were no lookups. */
+  double configuration_hit_rate() const {
+    const int64_t total = num_configuration_hits + num_configuration_misses;
+    return total > 0 ? static_cast<double>(num_configuration_hits) / total
+                     : 0.0;
+  }
+
+  /** Returns the fraction of edge lookups that were hits, or zero if there
+  were no lookups. */
+  double edge_hit_rate() const {
+    const int64_t total = num_edge_hits + num_edge_misses;
+    return total > 0 ? static_cast<double>(num_edge_hits) / total : 0.0;
+  }
+
+  /** The number of configuration checks answered by the cache. */
+  int64_t num_configuration_hits{0};
+
+  /** The number of configuration checks that had to be computed. */
+  int64_t num_configuration_misses{0};
+
+  /** The number of edge checks answered by the cache. */
+  int64_t num_edge_hits{0};
+
+  /** The number of edge checks that had to be computed. */
+  int64_t num_edge_misses{0};
+
+  /** The number of configuration results currently cached. */
+  int num_configurations{0};
+
+  /** The number of edge results currently cached. */
+  int num_edges{0};
+};
+
 /** A set of common constructor parameters for a CollisionChecker.
 Not all subclasses of CollisionChecker will necessarily support this
 configuration struct, but many do so.
@@ -80,6 +186,14 @@ struct CollisionCheckerParams {
   distance between robot and itself is less than padding, the checker reports a
   collision. */
   double self_collision_padding{};
+
+  /** The executor that runs the loops of the parallel queries (e.g.,
+  CollisionChecker::CheckConfigsCollisionFree()), or nullptr to use OpenMP.
+  With an executor, the checker keeps one context per worker, and each thread
+  calling a parallel query works with a context of its own, so those queries
+  may be called from several threads at once. One executor may be shared by
+  any number of checkers. */
+  std::shared_ptr<CollisionCheckerExecutor> executor;
 };
 
 }  // namespace planning
@@ -0,0 +1,923 @@
+#include "drake/planning/sphere_collision_checker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "drake/common/fmt_eigen.h"
+#include "drake/geometry/geometry_instance.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/planning/robot_diagram.h"
+
+namespace drake {
+namespace planning {
+
+using Eigen::Matrix3Xd;
+using Eigen::Matrix4Xd;
+using Eigen::RowVectorXd;
+using Eigen::Vector3d;
+using Eigen::Vector3i;
+using geometry::Box;
+using geometry::Capsule;
+using geometry::Convex;
+using geometry::Cylinder;
+using geometry::Ellipsoid;
+using geometry::FrameId;
+using geometry::GeometryId;
+using geometry::GeometryInstance;
+using geometry::Mesh;
+using geometry::QueryObject;
+using geometry::Role;
+using geometry::SceneGraphInspector;
+using geometry::Shape;
+using geometry::ShapeReifier;
+using geometry::SignedDistanceToPoint;
+using geometry::Sphere;
+using math::RigidTransform;
+using math::RigidTransformd;
+using multibody::Body;
+using multibody::BodyIndex;
+using multibody::Frame;
+using systems::Context;
+
+namespace {
+
+// Returns the center and size of the axis-aligned bounding box (in the mesh's
+// frame) of the vertices of the given Wavefront .obj file.
+std::pair<Vector3d, Vector3d> CalcObjBoundingBox(const std::string& filename,
+                                                 double scale) {
+  return geometry::ReadObjToTriangleSurfaceMesh(filename, scale)
+      .CalcBoundingBox();
+}
+
+// Covers shapes with spheres, as (x, y, z, radius) columns in the shape's
+// frame G. Spheres are used as is; everything else is covered by spheres
+// centered on a lattice of cells no larger than `resolution`. In conservative
+// mode, each sphere contains its whole cell (so the union of the spheres
+// contains the shape); otherwise, each sphere only spans its cell's largest
+// extent.
+class SphereCoverer final : public ShapeReifier {
+ public:
+  SphereCoverer(double resolution, bool conservative)
+      : resolution_(resolution), conservative_(conservative) {}
+
+  Matrix4Xd Cover(const Shape& shape) {
+    spheres_.clear();
+    shape.Reify(this);
+    Matrix4Xd result(4, spheres_.size());
+    for (int i = 0; i < result.cols(); ++i) {
+      result.col(i) = spheres_[i];
+    }
+    return result;
+  }
+
+ private:
+  using ShapeReifier::ImplementGeometry;
+
+  void ImplementGeometry(const Box& box, void*) final {
+    CoverCells(Vector3d::Zero(), box.size() / 2, [](const Vector3d&) {
+      return true;
+    });
+  }
+
+  void ImplementGeometry(const Capsule& capsule, void*) final {
+    // The capsule is the union of the spheres of its radius centered on its
+    // axis; sample the axis and inflate the spheres to cover the gaps.
+    const double r = capsule.radius();
+    const double length = capsule.length();
+    const int num_segments =
+        std::max(1, static_cast<int>(std::ceil(length / resolution_)));
+    const double spacing = length / num_segments;
+    const double radius =
+        conservative_ ? std::sqrt(r * r + spacing * spacing / 4) : r;
+    for (int i = 0; i <= num_segments; ++i) {
+      AddSphere(Vector3d(0, 0, -length / 2 + i * spacing), radius);
+    }
+  }
+
+  void ImplementGeometry(const Convex& convex, void*) final {
+    const auto [center, size] =
+        CalcObjBoundingBox(convex.filename(), convex.scale());
+    CoverCells(center, size / 2, [](const Vector3d&) {
+      return true;
+    });
+  }
+
+  void ImplementGeometry(const Cylinder& cylinder, void*) final {
+    const double r = cylinder.radius();
+    CoverCells(Vector3d::Zero(), Vector3d(r, r, cylinder.length() / 2),
+               [r](const Vector3d& p_GC) {
+                 return p_GC.head<2>().squaredNorm() <= r * r;
+               });
+  }
+
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void*) final {
+    const Vector3d semi_axes(ellipsoid.a(), ellipsoid.b(), ellipsoid.c());
+    CoverCells(Vector3d::Zero(), semi_axes, [&semi_axes](const Vector3d& p_GC) {
+      return p_GC.cwiseQuotient(semi_axes).squaredNorm() <= 1;
+    });
+  }
+
+  void ImplementGeometry(const Mesh& mesh, void*) final {
+    const auto [center, size] =
+        CalcObjBoundingBox(mesh.filename(), mesh.scale());
+    CoverCells(center, size / 2, [](const Vector3d&) {
+      return true;
+    });
+  }
+
+  void ImplementGeometry(const Sphere& sphere, void*) final {
+    AddSphere(Vector3d::Zero(), sphere.radius());
+  }
+
+  // Splits the box with the given center and half size into cells, and adds a
+  // sphere for each cell that intersects the shape. A cell intersects the
+  // shape if `contains` accepts the cell's point closest to the box center
+  // (which is exact for the axis-aligned, centrally symmetric shapes above).
+  template <typename Predicate>
+  void CoverCells(const Vector3d& center, const Vector3d& half_size,
+                  const Predicate& contains) {
+    Vector3i num_cells;
+    Vector3d cell_size;
+    for (int i = 0; i < 3; ++i) {
+      num_cells[i] = std::max(
+          1, static_cast<int>(std::ceil(2 * half_size[i] / resolution_)));
+      cell_size[i] = 2 * half_size[i] / num_cells[i];
+    }
+    const double radius =
+        conservative_ ? cell_size.norm() / 2 : cell_size.maxCoeff() / 2;
+    for (int i = 0; i < num_cells.x(); ++i) {
+      for (int j = 0; j < num_cells.y(); ++j) {
+        for (int k = 0; k < num_cells.z(); ++k) {
+          const Vector3d lower =
+              -half_size + cell_size.cwiseProduct(Vector3d(i, j, k));
+          const Vector3d upper = lower + cell_size;
+          const Vector3d closest =
+              Vector3d::Zero().cwiseMax(lower).cwiseMin(upper);
+          if (contains(closest)) {
+            AddSphere(center + (lower + upper) / 2, radius);
+          }
+        }
+      }
+    }
+  }
+
+  void AddSphere(const Vector3d& p_GS, double radius) {
+    spheres_.emplace_back(p_GS.x(), p_GS.y(), p_GS.z(), radius);
+  }
+
+  const double resolution_;
+  const bool conservative_;
+  std::vector<Eigen::Vector4d> spheres_;
+};
+
+// Finds the bounding box of Mesh and Convex shapes, which SceneGraph's point
+// distance queries do not support.
+class MeshBoundingBoxFinder final : public ShapeReifier {
+ public:
+  // Returns the center and size of the bounding box if `shape` is a Mesh or
+  // Convex.
+  std::optional<std::pair<Vector3d, Vector3d>> Find(const Shape& shape) {
+    result_.reset();
+    shape.Reify(this);
+    return result_;
+  }
+
+ private:
+  using ShapeReifier::ImplementGeometry;
+
+  void ImplementGeometry(const Convex& convex, void*) final {
+    result_ = CalcObjBoundingBox(convex.filename(), convex.scale());
+  }
+
+  void ImplementGeometry(const Mesh& mesh, void*) final {
+    result_ = CalcObjBoundingBox(mesh.filename(), mesh.scale());
+  }
+
+  void DefaultImplementGeometry(const Shape&) final {}
+
+  std::optional<std::pair<Vector3d, Vector3d>> result_;
+};
+
+// Returns the signed distance from p_BQ to the box B with the given half size
+// centered at Bo.
+double CalcBoxSignedDistance(const Vector3d& half_size, const Vector3d& p_BQ) {
+  const Vector3d q = p_BQ.cwiseAbs() - half_size;
+  return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+}
+
+// The model context of a SphereCollisionChecker, which adds scratch storage
+// for the positions of the robot's spheres so that queries do not allocate.
+class SphereCollisionCheckerContext final : public CollisionCheckerContext {
+ public:
+  explicit SphereCollisionCheckerContext(const RobotDiagram<double>* model)
+      : CollisionCheckerContext(model) {}
+
+  // The centers of the robot's spheres (measured and expressed in the world
+  // frame). This is scratch storage that is not part of the context's value,
+  // so it may be changed through a const context; each context is only used
+  // by one thread at a time.
+  Matrix3Xd& mutable_p_WS() const { return p_WS_; }
+
+ private:
+  SphereCollisionCheckerContext(const SphereCollisionCheckerContext&) =
+      default;
+
+  std::unique_ptr<CollisionCheckerContext> DoClone() const final {
+    // N.B. We cannot use make_unique due to private-only access.
+    return std::unique_ptr<SphereCollisionCheckerContext>(
+        new SphereCollisionCheckerContext(*this));
+  }
+
+  mutable Matrix3Xd p_WS_;
+};
+
+}  // namespace
+
+// A truncated signed distance field sampled at the centers of a regular grid
+// of cubic voxels, along with the environment body nearest to each voxel
+// center. Values are looked up from the nearest voxel; points outside the grid
+// are bounded using the value at the nearest point of the grid and the fact
+// that signed distance is 1-Lipschitz.
+class SphereCollisionChecker::DistanceGrid {
+ public:
+  explicit DistanceGrid(const SphereCollisionCheckerConfig& config)
+      : voxel_size_(config.voxel_size),
+        lookup_error_(config.conservative ? std::sqrt(3.0) / 2 * voxel_size_
+                                          : 0.0) {
+    for (int i = 0; i < 3; ++i) {
+      num_voxels_[i] = std::max(
+          1, static_cast<int>(std::ceil(
+                 (config.grid_upper[i] - config.grid_lower[i]) / voxel_size_)));
+    }
+    first_center_ = config.grid_lower + Vector3d::Constant(voxel_size_ / 2);
+    last_center_ = voxel_center(num_voxels_ - Vector3i::Ones());
+    values_.resize(num_voxels_.prod(),
+                   static_cast<float>(config.truncation_distance));
+    nearest_.resize(num_voxels_.prod());
+  }
+
+  const Vector3i& num_voxels() const { return num_voxels_; }
+
+  Vector3d voxel_center(const Vector3i& voxel) const {
+    return first_center_ + voxel_size_ * voxel.cast<double>();
+  }
+
+  // Returns the index of `voxel` into the stored values, clamping it to the
+  // grid.
+  int Flatten(const Vector3i& voxel) const {
+    const Vector3i clamped =
+        voxel.cwiseMax(0).cwiseMin(num_voxels_ - Vector3i::Ones());
+    return (clamped.z() * num_voxels_.y() + clamped.y()) * num_voxels_.x() +
+           clamped.x();
+  }
+
+  // Lowers the value of voxel `index` to `distance`, if it's smaller, and
+  // records `body` as the nearest one. The value is rounded down when stored
+  // so that it still bounds the distance.
+  void Lower(int index, double distance, BodyIndex body) {
+    float value = static_cast<float>(distance);
+    if (value > distance) {
+      value = std::nextafter(value, -std::numeric_limits<float>::infinity());
+    }
+    if (value < values_[index]) {
+      values_[index] = value;
+      nearest_[index] = body;
+    }
+  }
+
+  double Lookup(const Vector3d& p_WQ) const {
+    const Vector3d p_WC = p_WQ.cwiseMax(first_center_).cwiseMin(last_center_);
+    return values_[FindVoxel(p_WC)] - (p_WQ - p_WC).norm() - lookup_error_;
+  }
+
+  // Returns the environment body nearest to the voxel that Lookup(p_WQ) uses,
+  // or an invalid index if no body is within the truncation distance of it.
+  BodyIndex LookupNearestBody(const Vector3d& p_WQ) const {
+    return nearest_[FindVoxel(p_WQ)];
+  }
+
+  // Returns the (central difference) gradient of Lookup() at `p_WQ`.
+  Vector3d CalcGradient(const Vector3d& p_WQ) const {
+    Vector3d gradient;
+    for (int i = 0; i < 3; ++i) {
+      const Vector3d step = voxel_size_ * Vector3d::Unit(i);
+      gradient[i] =
+          (Lookup(p_WQ + step) - Lookup(p_WQ - step)) / (2 * voxel_size_);
+    }
+    return gradient;
+  }
+
+ private:
+  // Returns the index of the voxel nearest to `p_WQ`.
+  int FindVoxel(const Vector3d& p_WQ) const {
+    return Flatten(((p_WQ - first_center_) / voxel_size_)
+                       .array()
+                       .round()
+                       .cast<int>()
+                       .matrix());
+  }
+
+  double voxel_size_{};
+  double lookup_error_{};
+  Vector3i num_voxels_;
+  Vector3d first_center_;
+  Vector3d last_center_;
+  std::vector<float> values_;
+  std::vector<BodyIndex> nearest_;
+};
+
+SphereCollisionChecker::SphereCollisionChecker(
+    CollisionCheckerParams params, const SphereCollisionCheckerConfig& config)
+    : CollisionChecker(std::move(params), true /* supports parallel */),
+      config_(config) {
+  DRAKE_THROW_UNLESS(std::isfinite(config_.sphere_resolution) &&
+                     config_.sphere_resolution > 0);
+  DRAKE_THROW_UNLESS(std::isfinite(config_.voxel_size) &&
+                     config_.voxel_size > 0);
+  DRAKE_THROW_UNLESS(config_.grid_lower.allFinite() &&
+                     config_.grid_upper.allFinite());
+  DRAKE_THROW_UNLESS((config_.grid_upper - config_.grid_lower).minCoeff() > 0);
+  DRAKE_THROW_UNLESS(std::isfinite(config_.truncation_distance) &&
+                     config_.truncation_distance > 0);
+  AllocateContexts();
+
+  const SceneGraphInspector<double>& inspector =
+      model_context().GetQueryObject().inspector();
+  body_spheres_.resize(plant().num_bodies());
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    if (!IsPartOfRobot(i)) {
+      continue;
+    }
+    const FrameId frame_id = plant().GetBodyFrameIdOrThrow(i);
+    for (const GeometryId geometry_id :
+         inspector.GetGeometries(frame_id, Role::kProximity)) {
+      AddBodySpheres(i, geometry_id, inspector.GetShape(geometry_id),
+                     inspector.GetPoseInFrame(geometry_id));
+    }
+  }
+  FlattenSpheres();
+  UpdateEnvironmentBodies();
+  UpdateBodyPairs();
+}
+
+SphereCollisionChecker::SphereCollisionChecker(const SphereCollisionChecker&) =
+    default;
+
+std::unique_ptr<CollisionChecker> SphereCollisionChecker::DoClone() const {
+  // N.B. We cannot use make_unique due to private-only access.
+  return std::unique_ptr<SphereCollisionChecker>(
+      new SphereCollisionChecker(*this));
+}
+
+std::unique_ptr<CollisionCheckerContext>
+SphereCollisionChecker::CreatePrototypeContext() const {
+  return std::make_unique<SphereCollisionCheckerContext>(&model());
+}
+
+Matrix4Xd SphereCollisionChecker::GetBodySpheres(BodyIndex body_index) const {
+  DRAKE_THROW_UNLESS(body_index < plant().num_bodies());
+  return body_spheres_[body_index].spheres;
+}
+
+double SphereCollisionChecker::CalcEnvironmentDistance(
+    BodyIndex body_index, const Vector3d& p_WQ) const {
+  DRAKE_THROW_UNLESS(body_index < plant().num_bodies());
+  DRAKE_THROW_UNLESS(IsPartOfRobot(body_index));
+  const DistanceGrid* grid = body_fields_[body_index].get();
+  return grid != nullptr ? grid->Lookup(p_WQ) : config_.truncation_distance;
+}
+
+void SphereCollisionChecker::DoUpdateContextPositions(
+    CollisionCheckerContext*) const {
+  // No additional actions are required to update positions.
+}
+
+bool SphereCollisionChecker::DoCheckContextConfigCollisionFree(
+    const CollisionCheckerContext& model_context) const {
+  const Matrix3Xd& p_WS = CalcSphereCentersInWorld(model_context);
+  for (const BodyIndex& robot_index : robot_environment_bodies_) {
+    if (CalcEnvironmentSphereDistance(robot_index, p_WS, nullptr) <= 0) {
+      log()->trace("Environment collision of body [{}]",
+                   get_body(robot_index).scoped_name());
+      return false;
+    }
+  }
+  for (const auto& [index_A, index_B] : robot_robot_pairs_) {
+    if (CalcSelfSphereDistance(index_A, index_B, p_WS, nullptr, nullptr) <=
+        0) {
+      log()->trace("Self collision between bodies [{}] and [{}]",
+                   get_body(index_A).scoped_name(),
+                   get_body(index_B).scoped_name());
+      return false;
+    }
+  }
+  // No relevant collisions found.
+  return true;
+}
+
+std::optional<GeometryId> SphereCollisionChecker::DoAddCollisionShapeToBody(
+    const std::string& group_name, const Body<double>& bodyA,
+    const Shape& shape, const RigidTransform<double>& X_AG) {
+  const FrameId body_frame_id = plant().GetBodyFrameIdOrThrow(bodyA.index());
+  log()->debug("Adding shape (group: [{}]) to {} (FrameID {}) at X_AG =\n{}",
+               group_name, bodyA.scoped_name(), body_frame_id,
+               fmt_eigen(X_AG.GetAsMatrix4()));
+
+  // Cover robot shapes before changing anything, in case the shape cannot be
+  // covered.
+  Matrix4Xd spheres;
+  if (IsPartOfRobot(bodyA)) {
+    spheres = SphereCoverer(config_.sphere_resolution, config_.conservative)
+                  .Cover(shape);
+  }
+
+  // Also register the shape in SceneGraph, so that environment shapes are
+  // part of the distance grids, and so the model contexts describe the same
+  // scene as this checker.
+  GeometryInstance geometry_template(X_AG, shape.Clone(), "temp");
+  geometry_template.set_name(fmt::format("Added collision geometry on {} ({})",
+                                         bodyA.scoped_name(),
+                                         geometry_template.id()));
+  geometry_template.set_proximity_properties({});
+  const auto operation = [&](const RobotDiagram<double>& model,
+                             CollisionCheckerContext* model_context) {
+    auto& sg_context = model_context->mutable_scene_graph_context();
+    model.scene_graph().RegisterGeometry(
+        &sg_context, model.plant().get_source_id().value(), body_frame_id,
+        std::make_unique<GeometryInstance>(geometry_template));
+  };
+  PerformOperationAgainstAllModelContexts(operation);
+
+  if (IsPartOfRobot(bodyA)) {
+    AddBodySpheres(bodyA.index(), geometry_template.id(), spheres, X_AG);
+    FlattenSpheres();
+  } else {
+    UpdateEnvironmentBodies();
+  }
+  UpdateBodyPairs();
+  return geometry_template.id();
+}
+
+void SphereCollisionChecker::RemoveAddedGeometries(
+    const std::vector<CollisionChecker::AddedShape>& shapes) {
+  const auto operation = [&shapes](const RobotDiagram<double>& model,
+                                   CollisionCheckerContext* model_context) {
+    for (const auto& checker_shape : shapes) {
+      const GeometryId geometry_id = checker_shape.geometry_id;
+      // Our public NVI wrapper logs "Removing geometries from group..." with
+      // no indentation; we'll whitespace-indent our detail logging under it.
+      log()->debug("  Removing geometry {}.", geometry_id);
+      model.scene_graph().RemoveGeometry(
+          &model_context->mutable_scene_graph_context(),
+          model.plant().get_source_id().value(), geometry_id);
+    }
+  };
+  PerformOperationAgainstAllModelContexts(operation);
+
+  bool environment_changed = false;
+  for (const auto& checker_shape : shapes) {
+    if (!IsPartOfRobot(checker_shape.body_index)) {
+      environment_changed = true;
+      continue;
+    }
+    BodySpheres& body_spheres = body_spheres_[checker_shape.body_index];
+    int kept = 0;
+    for (int i = 0; i < body_spheres.spheres.cols(); ++i) {
+      if (body_spheres.geometry_ids[i] != checker_shape.geometry_id) {
+        body_spheres.spheres.col(kept) = body_spheres.spheres.col(i);
+        body_spheres.geometry_ids[kept] = body_spheres.geometry_ids[i];
+        ++kept;
+      }
+    }
+    body_spheres.spheres.conservativeResize(4, kept);
+    body_spheres.geometry_ids.resize(kept);
+  }
+  FlattenSpheres();
+  if (environment_changed) {
+    UpdateEnvironmentBodies();
+  }
+  UpdateBodyPairs();
+}
+
+void SphereCollisionChecker::UpdateCollisionFilters() {
+  UpdateBodyPairs();
+}
+
+RobotClearance SphereCollisionChecker::DoCalcContextRobotClearance(
+    const CollisionCheckerContext& model_context,
+    const double influence_distance) const {
+  const Frame<double>& frame_W = plant().world_frame();
+  const Context<double>& plant_context = model_context.plant_context();
+  const Matrix3Xd& p_WS = CalcSphereCentersInWorld(model_context);
+
+  // For each robot body's distance grid and each pair of robot bodies we
+  // report the closest (pair of) spheres, computing ϕ and
+  // ∂ϕ/∂qᵣ = ∂ϕ/∂p_BAᵀ⋅∂p_BA/∂qᵣ (as documented in RobotClearance) at the
+  // sphere centers. See SceneGraphCollisionChecker for details on the terms.
+
+  // Temporary storage, reused each time though the loops.
+  Matrix3X<double> dp_BA_dq(3, plant().num_positions());
+  Matrix3X<double> partial_temp(3, plant().num_positions());
+  RowVectorXd ddist_dq(plant().num_positions());
+
+  RobotClearance result(plant().num_positions());
+  result.Reserve(static_cast<int>(robot_environment_bodies_.size() +
+                                  robot_robot_pairs_.size()));
+  for (const BodyIndex& robot_index : robot_environment_bodies_) {
+    int sphere{};
+    const double distance =
+        CalcEnvironmentSphereDistance(robot_index, p_WS, &sphere);
+    if (distance > influence_distance) {
+      continue;
+    }
+    const DistanceGrid& grid = *body_fields_[robot_index];
+    const Vector3d p_WS_sphere = p_WS.col(sphere);
+    // Report the environment body nearest to the closest sphere; if the
+    // sphere is beyond the truncation distance of all of them, any one will do.
+    BodyIndex env_index = grid.LookupNearestBody(p_WS_sphere);
+    if (!env_index.is_valid()) {
+      env_index = body_environments_[robot_index].front();
+    }
+    const Vector3d ddist_dp_BA =
+        grid.CalcGradient(p_WS_sphere).stableNormalized();
+    plant().CalcJacobianPositionVector(
+        plant_context, get_body(robot_index).body_frame(), p_BS_.col(sphere),
+        frame_W, frame_W, &dp_BA_dq);
+    ddist_dq.noalias() = ddist_dp_BA.transpose() * dp_BA_dq;
+    result.Append(robot_index, env_index,
+                  RobotCollisionType::kEnvironmentCollision, distance,
+                  ddist_dq);
+  }
+  for (const auto& [index_A, index_B] : robot_robot_pairs_) {
+    int sphere_A{};
+    int sphere_B{};
+    const double distance =
+        CalcSelfSphereDistance(index_A, index_B, p_WS, &sphere_A, &sphere_B);
+    if (distance > influence_distance) {
+      continue;
+    }
+    const Vector3d ddist_dp_BA =
+        (p_WS.col(sphere_A) - p_WS.col(sphere_B)).stableNormalized();
+    plant().CalcJacobianPositionVector(
+        plant_context, get_body(index_A).body_frame(), p_BS_.col(sphere_A),
+        frame_W, frame_W, &dp_BA_dq);
+    plant().CalcJacobianPositionVector(
+        plant_context, get_body(index_B).body_frame(), p_BS_.col(sphere_B),
+        frame_W, frame_W, &partial_temp);
+    dp_BA_dq -= partial_temp;
+    ddist_dq.noalias() = ddist_dp_BA.transpose() * dp_BA_dq;
+    result.Append(index_A, index_B, RobotCollisionType::kSelfCollision,
+                  distance, ddist_dq);
+  }
+  return result;
+}
+
+std::vector<RobotCollisionType>
+SphereCollisionChecker::DoClassifyContextBodyCollisions(
+    const CollisionCheckerContext& model_context) const {
+  const Matrix3Xd& p_WS = CalcSphereCentersInWorld(model_context);
+  std::vector<RobotCollisionType> robot_collision_types(
+      plant().num_bodies(), RobotCollisionType::kNoCollision);
+
+  for (const BodyIndex& robot_index : robot_environment_bodies_) {
+    if (CalcEnvironmentSphereDistance(robot_index, p_WS, nullptr) <= 0) {
+      robot_collision_types.at(robot_index) = SetInEnvironmentCollision(
+          robot_collision_types.at(robot_index), true);
+    }
+  }
+  for (const auto& [index_A, index_B] : robot_robot_pairs_) {
+    if (CalcSelfSphereDistance(index_A, index_B, p_WS, nullptr, nullptr) <=
+        0) {
+      robot_collision_types.at(index_A) =
+          SetInSelfCollision(robot_collision_types.at(index_A), true);
+      robot_collision_types.at(index_B) =
+          SetInSelfCollision(robot_collision_types.at(index_B), true);
+    }
+  }
+  return robot_collision_types;
+}
+
+int SphereCollisionChecker::DoMaxContextNumDistances(
+    const CollisionCheckerContext&) const {
+  // One distance per robot body for the environment, and one per pair of robot
+  // bodies.
+  return static_cast<int>(robot_environment_bodies_.size() +
+                          robot_robot_pairs_.size());
+}
+
+void SphereCollisionChecker::AddBodySpheres(BodyIndex body_index,
+                                            GeometryId geometry_id,
+                                            const Shape& shape,
+                                            const RigidTransformd& X_BG) {
+  AddBodySpheres(
+      body_index, geometry_id,
+      SphereCoverer(config_.sphere_resolution, config_.conservative)
+          .Cover(shape),
+      X_BG);
+}
+
+void SphereCollisionChecker::AddBodySpheres(BodyIndex body_index,
+                                            GeometryId geometry_id,
+                                            const Matrix4Xd& spheres_G,
+                                            const RigidTransformd& X_BG) {
+  BodySpheres& body_spheres = body_spheres_[body_index];
+  const int old_size = body_spheres.spheres.cols();
+  const int num_new = spheres_G.cols();
+  body_spheres.spheres.conservativeResize(4, old_size + num_new);
+  auto new_spheres = body_spheres.spheres.rightCols(num_new);
+  new_spheres.topRows<3>() = X_BG * spheres_G.topRows<3>();
+  new_spheres.row(3) = spheres_G.row(3);
+  body_spheres.geometry_ids.resize(old_size + num_new, geometry_id);
+}
+
+void SphereCollisionChecker::FlattenSpheres() {
+  const int num_bodies = plant().num_bodies();
+  sphere_start_.assign(num_bodies + 1, 0);
+  for (int i = 0; i < num_bodies; ++i) {
+    sphere_start_[i + 1] = sphere_start_[i] + body_spheres_[i].spheres.cols();
+  }
+  p_BS_.resize(3, sphere_start_.back());
+  radii_.resize(sphere_start_.back());
+  for (int i = 0; i < num_bodies; ++i) {
+    const Matrix4Xd& spheres = body_spheres_[i].spheres;
+    p_BS_.middleCols(sphere_start_[i], spheres.cols()) = spheres.topRows<3>();
+    radii_.segment(sphere_start_[i], spheres.cols()) =
+        spheres.row(3).transpose();
+  }
+}
+
+void SphereCollisionChecker::UpdateEnvironmentBodies() {
+  const SceneGraphInspector<double>& inspector =
+      model_context().GetQueryObject().inspector();
+  environment_bodies_.clear();
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    if (!IsPartOfRobot(i) &&
+        !inspector
+             .GetGeometries(plant().GetBodyFrameIdOrThrow(i), Role::kProximity)
+             .empty()) {
+      environment_bodies_.push_back(i);
+    }
+  }
+  distance_fields_.clear();
+}
+
+void SphereCollisionChecker::BuildDistanceGrids(
+    const std::vector<std::vector<BodyIndex>>& environments) {
+  if (environments.empty()) {
+    return;
+  }
+
+  // Evaluate SceneGraph at the default configuration, using a scratch copy of
+  // the model context (which includes any added geometries).
+  const std::unique_ptr<CollisionCheckerContext> context =
+      model_context().Clone();
+  plant().SetDefaultContext(&context->mutable_plant_context());
+  const QueryObject<double>& query_object = context->GetQueryObject();
+  const SceneGraphInspector<double>& inspector = query_object.inspector();
+
+  // The grids that each environment body contributes to.
+  std::vector<std::shared_ptr<DistanceGrid>> grids;
+  std::vector<std::vector<int>> body_grids(plant().num_bodies());
+  for (const std::vector<BodyIndex>& environment : environments) {
+    for (const BodyIndex& body_index : environment) {
+      body_grids[body_index].push_back(static_cast<int>(grids.size()));
+    }
+    grids.push_back(std::make_shared<DistanceGrid>(config_));
+  }
+
+  // Sort the environment's geometries into those SceneGraph can measure, and
+  // meshes (which we replace with their bounding boxes B).
+  struct MeshBox {
+    BodyIndex body_index;
+    RigidTransformd X_BW;
+    Vector3d half_size;
+  };
+  std::unordered_map<GeometryId, BodyIndex> geometry_bodies;
+  std::vector<MeshBox> mesh_boxes;
+  for (const BodyIndex& i : environment_bodies_) {
+    if (body_grids[i].empty()) {
+      continue;
+    }
+    const FrameId frame_id = plant().GetBodyFrameIdOrThrow(i);
+    for (const GeometryId geometry_id :
+         inspector.GetGeometries(frame_id, Role::kProximity)) {
+      const auto box =
+          MeshBoundingBoxFinder().Find(inspector.GetShape(geometry_id));
+      if (box.has_value()) {
+        const RigidTransformd X_WB = query_object.GetPoseInWorld(geometry_id) *
+                                     RigidTransformd(box->first);
+        mesh_boxes.push_back({i, X_WB.inverse(), box->second / 2});
+      } else {
+        geometry_bodies[geometry_id] = i;
+      }
+    }
+  }
+
+  // Returns true if any of the environment's geometries is within `threshold`
+  // of `p_WQ`.
+  const auto is_near = [&](const Vector3d& p_WQ, double threshold) {
+    for (const auto& result :
+         query_object.ComputeSignedDistanceToPoint(p_WQ, threshold)) {
+      if (geometry_bodies.contains(result.id_G)) {
+        return true;
+      }
+    }
+    for (const auto& mesh_box : mesh_boxes) {
+      if (CalcBoxSignedDistance(mesh_box.half_size, mesh_box.X_BW * p_WQ) <=
+          threshold) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Lowers voxel `v` of every grid that `body_index` contributes to.
+  const auto lower = [&](int v, BodyIndex body_index, double distance) {
+    for (const int g : body_grids[body_index]) {
+      grids[g]->Lower(v, distance, body_index);
+    }
+  };
+
+  // All grids share the same voxels, so one point query per voxel serves all
+  // of them. Voxels are visited in blocks; since signed distance is
+  // 1-Lipschitz, a block whose center is farther than the truncation distance
+  // plus the block's radius from all of the geometries keeps the truncated
+  // value throughout, and is skipped after a single query.
+  constexpr int kBlockSize = 4;
+  const DistanceGrid& layout = *grids.front();
+  const Vector3i& num_voxels = layout.num_voxels();
+  for (int k0 = 0; k0 < num_voxels.z(); k0 += kBlockSize) {
+    for (int j0 = 0; j0 < num_voxels.y(); j0 += kBlockSize) {
+      for (int i0 = 0; i0 < num_voxels.x(); i0 += kBlockSize) {
+        const Vector3i first(i0, j0, k0);
+        const Vector3i last =
+            (first + Vector3i::Constant(kBlockSize - 1))
+                .cwiseMin(num_voxels - Vector3i::Ones());
+        const Vector3d p_WFirst = layout.voxel_center(first);
+        const Vector3d p_WLast = layout.voxel_center(last);
+        const double radius = (p_WLast - p_WFirst).norm() / 2;
+        if (!is_near((p_WFirst + p_WLast) / 2,
+                     config_.truncation_distance + radius)) {
+          continue;
+        }
+        for (int k = k0; k <= last.z(); ++k) {
+          for (int j = j0; j <= last.y(); ++j) {
+            for (int i = i0; i <= last.x(); ++i) {
+              const Vector3i voxel(i, j, k);
+              const int v = layout.Flatten(voxel);
+              const Vector3d p_WQ = layout.voxel_center(voxel);
+              for (const auto& result :
+                   query_object.ComputeSignedDistanceToPoint(
+                       p_WQ, config_.truncation_distance)) {
+                const auto iter = geometry_bodies.find(result.id_G);
+                if (iter != geometry_bodies.end()) {
+                  lower(v, iter->second, result.distance);
+                }
+              }
+              for (const auto& mesh_box : mesh_boxes) {
+                lower(v, mesh_box.body_index,
+                      CalcBoxSignedDistance(mesh_box.half_size,
+                                            mesh_box.X_BW * p_WQ));
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (int g = 0; g < static_cast<int>(grids.size()); ++g) {
+    distance_fields_[environments[g]] = std::move(grids[g]);
+  }
+}
+
+void SphereCollisionChecker::UpdateBodyPairs() {
+  const int num_bodies = plant().num_bodies();
+  body_environments_.assign(num_bodies, {});
+  robot_robot_pairs_.clear();
+  for (BodyIndex i(0); i < num_bodies; ++i) {
+    if (!IsPartOfRobot(i) || body_spheres_[i].spheres.cols() == 0) {
+      continue;
+    }
+    for (const BodyIndex& j : environment_bodies_) {
+      if (!IsCollisionFilteredBetween(i, j)) {
+        body_environments_[i].push_back(j);
+      }
+    }
+    for (BodyIndex j(i + 1); j < num_bodies; ++j) {
+      if (IsPartOfRobot(j) && body_spheres_[j].spheres.cols() > 0 &&
+          !IsCollisionFilteredBetween(i, j)) {
+        robot_robot_pairs_.emplace_back(i, j);
+      }
+    }
+  }
+
+  // Keep the grids that are still in use, and build the missing ones.
+  std::map<std::vector<BodyIndex>, std::shared_ptr<const DistanceGrid>>
+      fields;
+  for (const std::vector<BodyIndex>& environment : body_environments_) {
+    if (!environment.empty()) {
+      fields.emplace(environment, nullptr);
+    }
+  }
+  std::vector<std::vector<BodyIndex>> missing;
+  for (auto& [environment, field] : fields) {
+    const auto iter = distance_fields_.find(environment);
+    if (iter != distance_fields_.end()) {
+      field = iter->second;
+    } else {
+      missing.push_back(environment);
+    }
+  }
+  distance_fields_ = std::move(fields);
+  BuildDistanceGrids(missing);
+
+  body_fields_.assign(num_bodies, nullptr);
+  robot_environment_bodies_.clear();
+  for (BodyIndex i(0); i < num_bodies; ++i) {
+    if (!body_environments_[i].empty()) {
+      body_fields_[i] = distance_fields_.at(body_environments_[i]);
+      robot_environment_bodies_.push_back(i);
+    }
+  }
+}
+
+const Matrix3Xd& SphereCollisionChecker::CalcSphereCentersInWorld(
+    const CollisionCheckerContext& model_context) const {
+  const Context<double>& plant_context = model_context.plant_context();
+  Matrix3Xd& p_WS =
+      static_cast<const SphereCollisionCheckerContext&>(model_context)
+          .mutable_p_WS();
+  p_WS.resize(3, num_spheres());
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    const int start = sphere_start_[i];
+    const int count = sphere_start_[i + 1] - start;
+    if (count == 0) {
+      continue;
+    }
+    const RigidTransformd& X_WB =
+        plant().EvalBodyPoseInWorld(plant_context, get_body(i));
+    auto p_WS_i = p_WS.middleCols(start, count);
+    p_WS_i.noalias() =
+        X_WB.rotation().matrix() * p_BS_.middleCols(start, count);
+    p_WS_i.colwise() += X_WB.translation();
+  }
+  return p_WS;
+}
+
+double SphereCollisionChecker::CalcEnvironmentPadding(
+    BodyIndex robot_index) const {
+  double padding = -std::numeric_limits<double>::infinity();
+  for (const BodyIndex& env_index : body_environments_[robot_index]) {
+    padding = std::max(padding, GetPaddingBetween(robot_index, env_index));
+  }
+  return padding;
+}
+
+double SphereCollisionChecker::CalcEnvironmentSphereDistance(
+    BodyIndex robot_index, const Matrix3Xd& p_WS, int* closest_sphere) const {
+  const DistanceGrid& grid = *body_fields_[robot_index];
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (int s = sphere_start_[robot_index]; s < sphere_start_[robot_index + 1];
+       ++s) {
+    const double distance = grid.Lookup(p_WS.col(s)) - radii_[s];
+    if (distance < min_distance) {
+      min_distance = distance;
+      if (closest_sphere != nullptr) {
+        *closest_sphere = s;
+      }
+    }
+  }
+  return min_distance - CalcEnvironmentPadding(robot_index);
+}
+
+double SphereCollisionChecker::CalcSelfSphereDistance(BodyIndex index_A,
+                                                      BodyIndex index_B,
+                                                      const Matrix3Xd& p_WS,
+                                                      int* sphere_A,
+                                                      int* sphere_B) const {
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (int a = sphere_start_[index_A]; a < sphere_start_[index_A + 1]; ++a) {
+    for (int b = sphere_start_[index_B]; b < sphere_start_[index_B + 1]; ++b) {
+      const double distance =
+          (p_WS.col(a) - p_WS.col(b)).norm() - radii_[a] - radii_[b];
+      if (distance < min_distance) {
+        min_distance = distance;
+        if (sphere_A != nullptr) {
+          *sphere_A = a;
+          *sphere_B = b;
+        }
+      }
+    }
+  }
+  return min_distance - GetPaddingBetween(index_A, index_B);
+}
+
+}  // namespace planning
+}  // namespace drake
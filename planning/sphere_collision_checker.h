@@ -0,0 +1,275 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/planning/collision_checker.h"
+#include "drake/planning/collision_checker_params.h"
+
+namespace drake {
+namespace planning {
+
+/** Parameters for the approximations made by a SphereCollisionChecker.
+
+@ingroup planning_collision_checker */
+struct SphereCollisionCheckerConfig {
+  /** The robot's geometries are covered with spheres whose centers are spaced
+  at most this far apart (in meters) along each axis of the geometry. Smaller
+  values give tighter approximations and more spheres. Must be positive. */
+  double sphere_resolution{0.05};
+
+  /** The edge length (in meters) of the cubic voxels of the environment's
+  distance grid. Must be positive. */
+  double voxel_size{0.02};
+
+  /** The lower corner of the box (measured and expressed in the world frame)
+  covered by the environment's distance grid. Distances outside of the box are
+  bounded from the distances on its boundary. */
+  Eigen::Vector3d grid_lower{-1.0, -1.0, -1.0};
+
+  /** The upper corner of the box covered by the environment's distance grid.
+  Must be strictly greater than `grid_lower` in every axis. */
+  Eigen::Vector3d grid_upper{1.0, 1.0, 1.0};
+
+  /** The distance (in meters) at which the environment's distance grid is
+  truncated; distances larger than this are stored as this value. It should
+  exceed the largest padding and the influence distance of clearance queries.
+  Must be positive. */
+  double truncation_distance{0.5};
+
+  /** When true, the spheres fully contain the robot's geometries and the
+  error of the distance grid is subtracted from every lookup, so that any
+  configuration this checker reports as collision free is also collision free
+  for the exact geometries. When false, the spheres and lookups are tighter
+  (with fewer spurious collisions), but shallow collisions may be missed. */
+  bool conservative{true};
+};
+
+/** An implementation of CollisionChecker that approximates the robot's
+geometries with sets of spheres and the environment with a truncated signed
+distance field sampled on a voxel grid. Configuration checks only need the
+poses of the robot's bodies, a table lookup per sphere, and sphere-sphere
+tests for self collision. The sphere centers are computed into scratch storage
+owned by each (per-thread) context, so configuration checks do not allocate
+memory of their own.
+
+The spheres are generated automatically from each robot body's proximity
+geometries when the checker is constructed (see
+SphereCollisionCheckerConfig::sphere_resolution). Spheres are exact, and
+boxes, cylinders, ellipsoids and capsules are covered with spheres centered on
+a regular lattice. Meshes and convex hulls are approximated by the bounding box
+of their vertices. Half spaces cannot be attached to the robot.
+
+The distance grid holds the signed distance to the environment's proximity
+geometries (computed with SceneGraph; meshes and convex hulls are again
+replaced by their bounding boxes). It is computed once, at the model's default
+configuration, so this checker assumes that the environment does not move. Use
+SceneGraphCollisionChecker if it does. While building it, blocks of voxels that
+are farther than the truncation distance from every environment geometry are
+skipped with a single point query.
+
+Rather than one grid per environment body, robot bodies share a grid of the
+minimum distance to all of the environment bodies they are checked against.
+Robot bodies whose collision filters exclude the same set of environment bodies
+share the same grid, so without filters between robot and environment bodies
+there is exactly one grid; see num_distance_fields(). Grids for new sets of
+environment bodies are built when the collision filters change.
+
+Collision filters are applied per body pair exactly as in
+SceneGraphCollisionChecker. Because the environment bodies are merged into one
+grid, the padding between a robot body and the environment is the largest
+padding between that body and any environment body it is checked against; this
+is exact when the padding is uniform, and conservative otherwise. Robot
+clearance reports one distance per robot body for the environment (against the
+environment body nearest to its closest sphere) and one distance per pair of
+robot bodies, each the smallest over the spheres involved.
+
+@ingroup planning_collision_checker */
+class SphereCollisionChecker final : public CollisionChecker {
+ public:
+  /** @name     Does not allow copy, move, or assignment. */
+  /** @{ */
+  // N.B. The copy constructor is private for use in implementing Clone().
+  void operator=(const SphereCollisionChecker&) = delete;
+  /** @} */
+
+  /** Creates a new checker with the given params and approximation config.
+  @throws std::exception if `config` is invalid, or if a robot body has a
+  HalfSpace geometry. */
+  explicit SphereCollisionChecker(CollisionCheckerParams params,
+                                  const SphereCollisionCheckerConfig& config =
+                                      SphereCollisionCheckerConfig{});
+
+  /** Gets the approximation config. */
+  const SphereCollisionCheckerConfig& config() const { return config_; }
+
+  /** Returns the spheres that approximate body `body_index`, one per column;
+  the first three rows hold the sphere's center (measured and expressed in
+  the body frame) and the last row holds its radius. The result is empty for
+  environment bodies and for robot bodies without proximity geometry. */
+  Eigen::Matrix4Xd GetBodySpheres(multibody::BodyIndex body_index) const;
+
+  /** Returns the total number of spheres that approximate the robot. */
+  int num_spheres() const { return static_cast<int>(radii_.size()); }
+
+  /** Returns the approximate signed distance (in meters) from the point
+  `p_WQ` (measured and expressed in the world frame) to the geometries of the
+  environment bodies that robot body `body_index` is checked against (i.e.,
+  that are not collision filtered with it), as looked up in the distance grid.
+  Padding is not included. In conservative mode this never exceeds the exact
+  distance. The result is `truncation_distance` if robot body `body_index` or
+  all of those environment bodies lack proximity geometry.
+  @throws std::exception if `body_index` is not part of the robot. */
+  double CalcEnvironmentDistance(multibody::BodyIndex body_index,
+                                 const Eigen::Vector3d& p_WQ) const;
+
+  /** Returns the number of distinct distance grids currently in use; one for
+  each distinct set of environment bodies that the robot's bodies are checked
+  against. */
+  int num_distance_fields() const {
+    return static_cast<int>(distance_fields_.size());
+  }
+
+ private:
+  class DistanceGrid;
+
+  // To support Clone(), allow copying (but not move nor assign).
+  explicit SphereCollisionChecker(const SphereCollisionChecker&);
+
+  std::unique_ptr<CollisionChecker> DoClone() const final;
+
+  std::unique_ptr<CollisionCheckerContext> CreatePrototypeContext()
+      const final;
+
+  void DoUpdateContextPositions(CollisionCheckerContext*) const final;
+
+  bool DoCheckContextConfigCollisionFree(
+      const CollisionCheckerContext& model_context) const final;
+
+  std::optional<geometry::GeometryId> DoAddCollisionShapeToBody(
+      const std::string& group_name, const multibody::Body<double>& bodyA,
+      const geometry::Shape& shape,
+      const math::RigidTransform<double>& X_AG) final;
+
+  void RemoveAddedGeometries(
+      const std::vector<CollisionChecker::AddedShape>& shapes) final;
+
+  void UpdateCollisionFilters() final;
+
+  RobotClearance DoCalcContextRobotClearance(
+      const CollisionCheckerContext& model_context,
+      double influence_distance) const final;
+
+  std::vector<RobotCollisionType> DoClassifyContextBodyCollisions(
+      const CollisionCheckerContext& model_context) const final;
+
+  int DoMaxContextNumDistances(
+      const CollisionCheckerContext& model_context) const final;
+
+  // Appends the spheres covering `shape` (posed in body B's frame at X_BG) to
+  // body B's spheres, tagged with `geometry_id`. FlattenSpheres() must be
+  // called afterwards.
+  void AddBodySpheres(multibody::BodyIndex body_index,
+                      geometry::GeometryId geometry_id,
+                      const geometry::Shape& shape,
+                      const math::RigidTransform<double>& X_BG);
+
+  // As above, for spheres that have already been computed in the shape's
+  // frame G.
+  void AddBodySpheres(multibody::BodyIndex body_index,
+                      geometry::GeometryId geometry_id,
+                      const Eigen::Matrix4Xd& spheres_G,
+                      const math::RigidTransform<double>& X_BG);
+
+  // Rebuilds p_BS_, radii_, and sphere_start_ from body_spheres_.
+  void FlattenSpheres();
+
+  // Recomputes the list of environment bodies with proximity geometry from
+  // the geometries currently registered in the model context, and discards
+  // all of the distance grids.
+  void UpdateEnvironmentBodies();
+
+  // Builds the distance grids for the given sets of environment bodies, and
+  // adds them to distance_fields_.
+  void BuildDistanceGrids(
+      const std::vector<std::vector<multibody::BodyIndex>>& environments);
+
+  // Recomputes the body pairs to be checked from the collision filters,
+  // building any distance grids that are missing and discarding the ones that
+  // are no longer used.
+  void UpdateBodyPairs();
+
+  // Computes the positions in world of the centers of all of the robot's
+  // spheres, one per column in the same order as p_BS_, into the scratch
+  // storage of `model_context`.
+  const Eigen::Matrix3Xd& CalcSphereCentersInWorld(
+      const CollisionCheckerContext& model_context) const;
+
+  // Returns the largest padding between robot body `robot_index` and the
+  // environment bodies it is checked against.
+  double CalcEnvironmentPadding(multibody::BodyIndex robot_index) const;
+
+  // Returns the smallest padded distance between the spheres of robot body
+  // `robot_index` and its distance grid, given the centers of all spheres
+  // `p_WS`. The (flattened) index of the closest sphere is written to
+  // `closest_sphere` when it is non-null.
+  double CalcEnvironmentSphereDistance(multibody::BodyIndex robot_index,
+                                       const Eigen::Matrix3Xd& p_WS,
+                                       int* closest_sphere) const;
+
+  // Returns the smallest padded distance between the spheres of robot bodies
+  // A and B, given the centers of all spheres `p_WS`. The (flattened) indices
+  // of the closest pair of spheres are written to `sphere_A` and `sphere_B`
+  // when they are non-null.
+  double CalcSelfSphereDistance(multibody::BodyIndex index_A,
+                                multibody::BodyIndex index_B,
+                                const Eigen::Matrix3Xd& p_WS, int* sphere_A,
+                                int* sphere_B) const;
+
+  SphereCollisionCheckerConfig config_;
+
+  // The spheres of each body (indexed by BodyIndex), as (x, y, z, radius)
+  // columns in the body frame, along with the geometry each sphere came from.
+  struct BodySpheres {
+    Eigen::Matrix4Xd spheres;
+    std::vector<geometry::GeometryId> geometry_ids;
+  };
+  std::vector<BodySpheres> body_spheres_;
+
+  // The flattened copy of body_spheres_ used by the queries; the spheres of
+  // body i are columns [sphere_start_[i], sphere_start_[i + 1]).
+  Eigen::Matrix3Xd p_BS_;
+  Eigen::VectorXd radii_;
+  std::vector<int> sphere_start_;
+
+  // The environment bodies that have proximity geometry.
+  std::vector<multibody::BodyIndex> environment_bodies_;
+
+  // The distance grids in use, keyed by the (sorted) environment bodies whose
+  // minimum distance they hold. The grids are immutable once built, so clones
+  // share them.
+  std::map<std::vector<multibody::BodyIndex>,
+           std::shared_ptr<const DistanceGrid>>
+      distance_fields_;
+
+  // The environment bodies that each body (indexed by BodyIndex) is checked
+  // against, and their distance grid; empty (resp. null) for environment
+  // bodies and robot bodies without spheres.
+  std::vector<std::vector<multibody::BodyIndex>> body_environments_;
+  std::vector<std::shared_ptr<const DistanceGrid>> body_fields_;
+
+  // The robot bodies with spheres and a distance grid, and the (robot, robot)
+  // body pairs that are neither filtered nor missing spheres.
+  std::vector<multibody::BodyIndex> robot_environment_bodies_;
+  std::vector<std::pair<multibody::BodyIndex, multibody::BodyIndex>>
+      robot_robot_pairs_;
+};
+
+}  // namespace planning
+}  // namespace drake
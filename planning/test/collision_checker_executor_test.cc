@@ -0,0 +1,113 @@
+#include "drake/planning/collision_checker_executor.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+GTEST_TEST(CollisionCheckerThreadPoolTest, BadArguments) {
+  EXPECT_THROW(CollisionCheckerThreadPool(-1), std::exception);
+  CollisionCheckerThreadPool dut(2);
+  EXPECT_EQ(dut.num_workers(), 2);
+  EXPECT_THROW(dut.ParallelFor(-1, [](int, int) {}), std::exception);
+  // An empty loop is fine.
+  dut.ParallelFor(0, [](int, int) {
+    FAIL();
+  });
+}
+
+// Every index is visited exactly once, each worker makes one call at a time,
+// and the worker indices are in range.
+GTEST_TEST(CollisionCheckerThreadPoolTest, VisitsEachIndexOnce) {
+  for (const int num_workers : {0, 1, 3}) {
+    CollisionCheckerThreadPool dut(num_workers);
+    for (const int num_iterations : {1, 2, 7, 1000}) {
+      std::vector<std::atomic<int>> visits(num_iterations);
+      std::vector<std::atomic<int>> busy(num_workers);
+      std::atomic<bool> overlapped{false};
+      std::atomic<bool> out_of_range{false};
+      dut.ParallelFor(num_iterations, [&](int worker, int index) {
+        if (worker < -1 || worker >= num_workers) {
+          out_of_range = true;
+          return;
+        }
+        if (worker >= 0 && busy[worker]++ != 0) {
+          overlapped = true;
+        }
+        ++visits[index];
+        if (worker >= 0) {
+          --busy[worker];
+        }
+      });
+      EXPECT_FALSE(out_of_range);
+      EXPECT_FALSE(overlapped);
+      for (int i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(visits[i].load(), 1) << i;
+      }
+    }
+  }
+}
+
+// A loop with a single iteration runs on the calling thread.
+GTEST_TEST(CollisionCheckerThreadPoolTest, SingleIteration) {
+  CollisionCheckerThreadPool dut(2);
+  const std::thread::id caller = std::this_thread::get_id();
+  dut.ParallelFor(1, [&](int worker, int index) {
+    EXPECT_EQ(worker, -1);
+    EXPECT_EQ(index, 0);
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+  });
+}
+
+// Several threads may share the pool at once, including from within a loop.
+GTEST_TEST(CollisionCheckerThreadPoolTest, ConcurrentAndNestedCallers) {
+  CollisionCheckerThreadPool dut(3);
+  constexpr int kNumCallers = 4;
+  constexpr int kNumOuter = 20;
+  constexpr int kNumInner = 50;
+  std::atomic<int> total{0};
+  std::vector<std::thread> callers;
+  for (int i = 0; i < kNumCallers; ++i) {
+    callers.emplace_back([&]() {
+      dut.ParallelFor(kNumOuter, [&](int, int) {
+        dut.ParallelFor(kNumInner, [&](int, int) {
+          ++total;
+        });
+      });
+    });
+  }
+  for (std::thread& caller : callers) {
+    caller.join();
+  }
+  EXPECT_EQ(total.load(), kNumCallers * kNumOuter * kNumInner);
+}
+
+GTEST_TEST(CollisionCheckerThreadPoolTest, Exceptions) {
+  CollisionCheckerThreadPool dut(2);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.ParallelFor(100,
+                                              [](int, int index) {
+                                                if (index == 42) {
+                                                  throw std::runtime_error(
+                                                      "bad index");
+                                                }
+                                              }),
+                              "bad index");
+  // The pool is still usable afterwards.
+  std::atomic<int> count{0};
+  dut.ParallelFor(100, [&count](int, int) {
+    ++count;
+  });
+  EXPECT_EQ(count.load(), 100);
+}
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
@@ -1,12 +1,15 @@
 #include "drake/planning/collision_checker.h"
 
+#include <algorithm>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 #include <utility>
 #include <vector>
 
-#include <common_robotics_utilities/openmp_helpers.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -1335,7 +1338,9 @@ template <typename CheckerType>
 CheckerType MakeEdgeChecker(ConfigurationDistanceFunction calc_dist,
                             double step_size = 0.25,
                             ConfigurationInterpolationFunction interp = nullptr,
-                            bool welded = true, int N = 2) {
+                            bool welded = true, int N = 2,
+                            std::shared_ptr<CollisionCheckerExecutor> executor =
+                                nullptr) {
   RobotDiagramBuilder<double> builder;
   // We need just enough state so we can save values in q.
   auto& plant = builder.plant();
@@ -1352,7 +1357,8 @@ CheckerType MakeEdgeChecker(ConfigurationDistanceFunction calc_dist,
                        .configuration_distance_function = calc_dist,
                        .edge_step_size = step_size,
                        .env_collision_padding = 0,
-                       .self_collision_padding = 0});
+                       .self_collision_padding = 0,
+                       .executor = std::move(executor)});
   checker.SetConfigurationInterpolationFunction(interp);
   return checker;
 }
@@ -1613,19 +1619,14 @@ class MockEdgeChecker : public UnimplementedCollisionChecker {
       : UnimplementedCollisionChecker(std::move(params), true) {
     DRAKE_DEMAND(plant().num_positions() >= kQSize);
     AllocateContexts();
-    const int num_omp_threads =
-        common_robotics_utilities::openmp_helpers::GetNumOmpThreads();
-    const int max_num_omp_threads =
-        common_robotics_utilities::openmp_helpers::GetMaxNumOmpThreads();
-    const int num_threads = std::max(num_omp_threads, max_num_omp_threads);
-    thread_signals_ = vector<int>(num_threads, 0);
   }
 
   using CollisionChecker::CanEvaluateInParallel;
 
   // Returns the number of threads this was evaluated on.
   int thread_count() const {
-    return std::accumulate(thread_signals_.begin(), thread_signals_.end(), 0);
+    std::lock_guard<std::mutex> lock(threads_->mutex);
+    return static_cast<int>(threads_->ids.size());
   }
 
   // Force five samples based on the given `step_size`.
@@ -1683,9 +1684,10 @@ class MockEdgeChecker : public UnimplementedCollisionChecker {
     // Make this call artificially more expensive so that parallel edge checks
     // will actually perform work in multiple OpenMP threads.
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    const int thread_index =
-        common_robotics_utilities::openmp_helpers::GetContextOmpThreadNum();
-    thread_signals_[thread_index] = 1;
+    {
+      std::lock_guard<std::mutex> lock(threads_->mutex);
+      threads_->ids.insert(std::this_thread::get_id());
+    }
     const auto q = plant().GetPositions(model_context.plant_context());
     const double s = q(2);
     const bool free = s <= q(0) || q(1) < s;
@@ -1695,9 +1697,13 @@ class MockEdgeChecker : public UnimplementedCollisionChecker {
   // We just want this to *not* throw.
   void DoUpdateContextPositions(CollisionCheckerContext*) const override {}
 
-  // A per-thread signal; if the code was exercised in thread i, the value
-  // at the ith index is one, otherwise zero.
-  mutable vector<int> thread_signals_;
+  // The threads that the code was exercised in. (Executor workers are not
+  // OpenMP threads, so we can't index by OpenMP thread number.)
+  struct Threads {
+    std::set<std::thread::id> ids;
+    std::mutex mutex;
+  };
+  std::shared_ptr<Threads> threads_{std::make_shared<Threads>()};
 };
 
 std::vector<EdgeTestConfig> MakeEdgeTestCases() {
@@ -1997,6 +2003,385 @@ GTEST_TEST(EdgeCheckTest, CheckMultipleEdgesFree) {
   }
 }
 
+// With an executor, the parallel queries run on its workers (whether or not
+// OpenMP is available) and give the same results as the serial queries, even
+// when called from several threads at once.
+GTEST_TEST(EdgeCheckTest, Executor) {
+  const double step_size = 0.05;
+  auto calc_dist = MockEdgeChecker::MakeEdgeDistance(step_size);
+  auto interp = MockEdgeChecker::MakeEdgeInterpolation();
+  const int q_size = MockEdgeChecker::kQSize;
+
+  const VectorXd q_start = VectorXd::Constant(q_size, 0.75);
+  vector<std::pair<VectorXd, VectorXd>> edges;
+  edges.emplace_back(q_start,
+                     MockEdgeChecker::EncodeConfiguration(q_size, 1.0, 1.5));
+  edges.emplace_back(q_start,
+                     MockEdgeChecker::EncodeConfiguration(q_size, 0.25, 0.75));
+  edges.emplace_back(q_start,
+                     MockEdgeChecker::EncodeConfiguration(q_size, 0.75, 1.25));
+  const double edge_dist = calc_dist(edges[0].first, edges[0].second);
+  const vector<EdgeMeasure> expected_measures{
+      EdgeMeasure(edge_dist, 1.0), EdgeMeasure(edge_dist, 0.25),
+      EdgeMeasure(edge_dist, 0.75)};
+  const vector<uint8_t> expected_checks{1, 0, 0};
+
+  const auto executor = std::make_shared<CollisionCheckerThreadPool>(2);
+  auto dut = MakeEdgeChecker<MockEdgeChecker>(calc_dist, step_size, interp,
+                                              true /* welded */, q_size + 1,
+                                              executor);
+  EXPECT_EQ(dut.executor(), executor.get());
+  ASSERT_TRUE(dut.CanEvaluateInParallel());
+
+  EXPECT_EQ(dut.MeasureEdgesCollisionFree(edges), expected_measures);
+  EXPECT_GT(dut.thread_count(), 1);
+  EXPECT_EQ(dut.CheckEdgesCollisionFree(edges), expected_checks);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(dut.MeasureEdgeCollisionFreeParallel(edges[i].first,
+                                                   edges[i].second),
+              expected_measures[i]);
+    EXPECT_EQ(dut.CheckEdgeCollisionFreeParallel(edges[i].first,
+                                                 edges[i].second),
+              expected_checks[i] == 1);
+  }
+  vector<VectorXd> configs;
+  for (const double s : {0.0, 0.5, 1.0}) {
+    configs.push_back(interp(q_start, edges[1].second, s));
+  }
+  EXPECT_THAT(dut.CheckConfigsCollisionFree(configs), ElementsAre(1, 0, 1));
+
+  // Concurrent callers each get a context of their own.
+  vector<vector<EdgeMeasure>> results(3);
+  vector<std::thread> callers;
+  for (auto& result : results) {
+    callers.emplace_back([&dut, &edges, &result]() {
+      result = dut.MeasureEdgesCollisionFree(edges);
+    });
+  }
+  for (std::thread& caller : callers) {
+    caller.join();
+  }
+  for (const auto& result : results) {
+    EXPECT_EQ(result, expected_measures);
+  }
+}
+
+// A checker for a one-dof robot (a two-link chain whose base is welded) that
+// collides when its joint angle lies in an "obstacle" interval. It records
+// every configuration it checks, and reports the distance from the joint angle
+// to the obstacle interval as the clearance of the moving body.
+class ObstacleIntervalChecker : public UnimplementedCollisionChecker {
+ public:
+  explicit ObstacleIntervalChecker(CollisionCheckerParams params)
+      : UnimplementedCollisionChecker(std::move(params), false) {
+    AllocateContexts();
+  }
+
+  void set_obstacle(double lower, double upper) {
+    lower_ = lower;
+    upper_ = upper;
+  }
+
+  // The joint angles checked so far.
+  const vector<double>& checked() const { return checked_; }
+
+  int num_clearance_queries() const { return num_clearance_queries_; }
+
+  void Reset() {
+    checked_.clear();
+    num_clearance_queries_ = 0;
+  }
+
+ protected:
+  bool DoCheckContextConfigCollisionFree(
+      const CollisionCheckerContext& model_context) const override {
+    const double q = plant().GetPositions(model_context.plant_context())[0];
+    checked_.push_back(q);
+    return q < lower_ || q > upper_;
+  }
+
+  RobotClearance DoCalcContextRobotClearance(
+      const CollisionCheckerContext& model_context,
+      double) const override {
+    ++num_clearance_queries_;
+    const double q = plant().GetPositions(model_context.plant_context())[0];
+    const double distance = std::max(lower_ - q, q - upper_);
+    RobotClearance result(plant().num_positions());
+    result.Append(plant().GetBodyByName("b1").index(), BodyIndex(0),
+                  RobotCollisionType::kEnvironmentCollision, distance,
+                  Eigen::RowVectorXd::Zero(plant().num_positions()));
+    return result;
+  }
+
+  void DoUpdateContextPositions(CollisionCheckerContext*) const override {}
+
+  // Shapes and filters are accepted, but ignored.
+  std::optional<GeometryId> DoAddCollisionShapeToBody(
+      const std::string&, const Body<double>&, const Shape&,
+      const RigidTransform<double>&) override {
+    return GeometryId::get_new_id();
+  }
+  void RemoveAddedGeometries(const vector<AddedShape>&) override {}
+  void UpdateCollisionFilters() override {}
+
+ private:
+  double lower_{};
+  double upper_{};
+  mutable vector<double> checked_;
+  mutable int num_clearance_queries_{0};
+};
+
+// The edge sample order is configurable; bisection checks the same samples
+// on a free edge, but finds an obstacle in the interior of the edge sooner.
+GTEST_TEST(EdgeCheckTest, BisectionOrder) {
+  const ConfigurationDistanceFunction dist = [](const VectorXd& a,
+                                                const VectorXd& b) {
+    return (b - a).norm();
+  };
+  auto dut = MakeEdgeChecker<ObstacleIntervalChecker>(dist, 0.01);
+  EXPECT_EQ(dut.edge_check_order(), EdgeCheckOrder::kSequential);
+  const VectorXd q1 = VectorXd::Constant(1, 0.0);
+  const VectorXd q2 = VectorXd::Constant(1, 1.0);
+
+  // A free edge: both orders check q2 and then the other 100 samples.
+  dut.set_obstacle(2.0, 3.0);
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  vector<double> sequential = dut.checked();
+  EXPECT_EQ(sequential.size(), 101);
+  EXPECT_EQ(sequential[0], 1.0);
+  EXPECT_EQ(sequential[1], 0.0);
+  EXPECT_NEAR(sequential[2], 0.01, 1e-15);
+
+  dut.Reset();
+  dut.set_edge_check_order(EdgeCheckOrder::kBisection);
+  EXPECT_EQ(dut.edge_check_order(), EdgeCheckOrder::kBisection);
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  vector<double> bisection = dut.checked();
+  // The coarse samples come first.
+  ASSERT_EQ(bisection.size(), 101);
+  EXPECT_EQ(bisection[0], 1.0);
+  EXPECT_EQ(bisection[1], 0.0);
+  EXPECT_EQ(bisection[2], 0.5);
+  EXPECT_EQ(bisection[3], 0.25);
+  EXPECT_EQ(bisection[4], 0.75);
+  // The eighth points are rounded to the nearest sample, halves up.
+  EXPECT_NEAR(bisection[5], 0.13, 1e-15);
+  EXPECT_NEAR(bisection[6], 0.63, 1e-15);
+  std::sort(sequential.begin(), sequential.end());
+  std::sort(bisection.begin(), bisection.end());
+  EXPECT_EQ(bisection, sequential);
+
+  // An edge blocked over a large part of its far half; both orders detect it,
+  // but bisection needs far fewer checks: q2, the start, the midpoint, and the
+  // quarter points.
+  dut.set_obstacle(0.705, 0.905);
+  dut.Reset();
+  dut.set_edge_check_order(EdgeCheckOrder::kSequential);
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(q1, q2));
+  const int num_sequential = static_cast<int>(dut.checked().size());
+  EXPECT_EQ(num_sequential, 73);
+
+  dut.Reset();
+  dut.set_edge_check_order(EdgeCheckOrder::kBisection);
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(q1, q2));
+  const int num_bisection = static_cast<int>(dut.checked().size());
+  EXPECT_EQ(num_bisection, 5);
+
+  // The plural and parallel variants honor the order, too.
+  dut.Reset();
+  EXPECT_EQ(dut.CheckEdgesCollisionFree({{q1, q2}}), vector<uint8_t>{0});
+  EXPECT_EQ(dut.checked().size(), num_bisection);
+  EXPECT_FALSE(dut.CheckEdgeCollisionFreeParallel(q1, q2));
+
+  // Measuring an edge ignores the order.
+  dut.Reset();
+  EXPECT_NEAR(dut.MeasureEdgeCollisionFree(q1, q2).alpha(), 0.70, 1e-15);
+  EXPECT_EQ(dut.checked().size(), 72);
+}
+
+// With clearance-based skipping, samples near a sample with large clearance
+// are not checked, without changing the result.
+GTEST_TEST(EdgeCheckTest, ClearanceSkipping) {
+  const ConfigurationDistanceFunction dist = [](const VectorXd& a,
+                                                const VectorXd& b) {
+    return (b - a).norm();
+  };
+  auto dut = MakeEdgeChecker<ObstacleIntervalChecker>(dist, 0.01);
+  EXPECT_FALSE(dut.edge_clearance_skipping().has_value());
+  const VectorXd q1 = VectorXd::Constant(1, 0.0);
+  const VectorXd q2 = VectorXd::Constant(1, 1.0);
+
+  // The bodies are the world, b0 (welded to the world), and b1. The mock's
+  // clearance changes by one meter per radian, so that is b1's motion bound.
+  ASSERT_EQ(dut.plant().num_bodies(), 3);
+  const EdgeClearanceSkipping skipping{.body_motion_bounds = {0.0, 0.0, 1.0},
+                                       .influence_distance = 2.0};
+  dut.set_edge_clearance_skipping(skipping);
+  ASSERT_TRUE(dut.edge_clearance_skipping().has_value());
+  EXPECT_EQ(dut.edge_clearance_skipping()->body_motion_bounds,
+            skipping.body_motion_bounds);
+
+  for (const EdgeCheckOrder order :
+       {EdgeCheckOrder::kSequential, EdgeCheckOrder::kBisection}) {
+    dut.set_edge_check_order(order);
+
+    // A free edge: the clearances at q2 and q1 vouch for all other samples.
+    dut.set_obstacle(2.0, 3.0);
+    dut.Reset();
+    EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+    EXPECT_EQ(dut.checked(), vector<double>({1.0, 0.0}));
+    EXPECT_EQ(dut.num_clearance_queries(), 2);
+
+    // A blocked edge is still found to be blocked, after only a few checks.
+    dut.set_obstacle(0.595, 0.625);
+    dut.Reset();
+    EXPECT_FALSE(dut.CheckEdgeCollisionFree(q1, q2));
+    EXPECT_LE(dut.checked().size(), 6);
+
+    // An obstacle that lies between two samples is not detected by either
+    // sampling or skipping.
+    dut.set_obstacle(0.5001, 0.5002);
+    dut.Reset();
+    EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  }
+
+  // Disabling.
+  dut.set_edge_clearance_skipping(std::nullopt);
+  EXPECT_FALSE(dut.edge_clearance_skipping().has_value());
+  dut.set_obstacle(2.0, 3.0);
+  dut.Reset();
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  EXPECT_EQ(dut.checked().size(), 101);
+  EXPECT_EQ(dut.num_clearance_queries(), 0);
+
+  // Invalid parameters.
+  EXPECT_THROW(dut.set_edge_clearance_skipping(
+                   EdgeClearanceSkipping{.body_motion_bounds = {1.0}}),
+               std::exception);
+  EXPECT_THROW(dut.set_edge_clearance_skipping(EdgeClearanceSkipping{
+                   .body_motion_bounds = {0.0, 0.0, -1.0}}),
+               std::exception);
+  EXPECT_THROW(dut.set_edge_clearance_skipping(
+                   EdgeClearanceSkipping{.body_motion_bounds = {0.0, 0.0, 1.0},
+                                         .influence_distance = 0.0}),
+               std::exception);
+}
+
+// Repeated queries are answered by the (opt-in) result cache, which is
+// cleared by changes that could affect the results.
+GTEST_TEST(EdgeCheckTest, ResultCache) {
+  const ConfigurationDistanceFunction dist = [](const VectorXd& a,
+                                                const VectorXd& b) {
+    return (b - a).norm();
+  };
+  auto dut = MakeEdgeChecker<ObstacleIntervalChecker>(dist, 0.25);
+  dut.set_obstacle(2.0, 3.0);
+  const VectorXd q1 = VectorXd::Constant(1, 0.0);
+  const VectorXd q2 = VectorXd::Constant(1, 1.0);
+
+  // Disabled by default; every query is computed.
+  EXPECT_FALSE(dut.result_cache_config().has_value());
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(q2));
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(q2));
+  EXPECT_EQ(dut.checked().size(), 2);
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_configuration_misses, 0);
+
+  dut.set_result_cache_config(CollisionCheckerCacheConfig{});
+  ASSERT_TRUE(dut.result_cache_config().has_value());
+  EXPECT_EQ(dut.result_cache_config()->quantization, 1e-9);
+  dut.Reset();
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(q2));
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(q2));
+  // Configurations that round to the same grid point share the result.
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(q2 + VectorXd::Constant(1, 1e-12)));
+  EXPECT_EQ(dut.checked().size(), 1);
+  CollisionCheckerCacheStatistics stats = dut.GetResultCacheStatistics();
+  EXPECT_EQ(stats.num_configuration_hits, 2);
+  EXPECT_EQ(stats.num_configuration_misses, 1);
+  EXPECT_EQ(stats.num_configurations, 1);
+  EXPECT_NEAR(stats.configuration_hit_rate(), 2.0 / 3.0, 1e-15);
+
+  // An edge computes its samples (except for q2, which is cached) only once.
+  // Of the samples, only the end points are cached.
+  dut.Reset();
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  EXPECT_EQ(dut.checked(), vector<double>({0.0, 0.25, 0.5, 0.75}));
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  EXPECT_EQ(dut.CheckEdgesCollisionFree({{q1, q2}}), vector<uint8_t>{1});
+  EXPECT_TRUE(dut.CheckEdgeCollisionFreeParallel(q1, q2));
+  EXPECT_EQ(dut.checked().size(), 4);
+  stats = dut.GetResultCacheStatistics();
+  EXPECT_EQ(stats.num_edge_hits, 3);
+  EXPECT_EQ(stats.num_edge_misses, 1);
+  EXPECT_EQ(stats.num_edges, 1);
+  EXPECT_EQ(stats.num_configurations, 2);
+  EXPECT_EQ(stats.edge_hit_rate(), 0.75);
+
+  // Measuring an edge caches its end points, but not its interior samples.
+  const VectorXd q3 = VectorXd::Constant(1, 1.75);
+  EXPECT_TRUE(dut.MeasureEdgeCollisionFree(q2, q3).completely_free());
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_configurations, 3);
+  EXPECT_TRUE(dut.MeasureEdgeCollisionFreeParallel(q1, q3).completely_free());
+  EXPECT_TRUE(dut.MeasureEdgesCollisionFree({{q3, q1}})[0].completely_free());
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_configurations, 3);
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_edges, 1);
+
+  // Changing how edges are sampled only discards the edge results.
+  dut.set_edge_step_size(0.5);
+  dut.Reset();
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  EXPECT_EQ(dut.checked(), vector<double>({0.5}));
+
+  // Changes to the collision model discard everything.
+  const auto expect_cleared = [&]() {
+    EXPECT_EQ(dut.GetResultCacheStatistics().num_configurations, 0);
+    EXPECT_EQ(dut.GetResultCacheStatistics().num_edges, 0);
+    EXPECT_TRUE(dut.CheckEdgeCollisionFree(q1, q2));
+  };
+  dut.SetPaddingAllRobotEnvironmentPairs(0.01);
+  expect_cleared();
+  const BodyIndex b1 = dut.plant().GetBodyByName("b1").index();
+  dut.SetCollisionFilteredBetween(b1, BodyIndex(0), true);
+  expect_cleared();
+  dut.AddCollisionShapeToBody("extra", dut.get_body(b1), Sphere(0.1),
+                              RigidTransformd());
+  expect_cleared();
+  dut.RemoveAllAddedCollisionShapes();
+  expect_cleared();
+  dut.PerformOperationAgainstAllModelContexts(
+      [](const RobotDiagram<double>&, CollisionCheckerContext*) {});
+  expect_cleared();
+
+  // Explicit clearing keeps the statistics.
+  stats = dut.GetResultCacheStatistics();
+  EXPECT_GT(stats.num_configurations, 0);
+  dut.ClearResultCache();
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_configurations, 0);
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_configuration_misses,
+            stats.num_configuration_misses);
+
+  // A tiny cache evicts results.
+  dut.set_result_cache_config(
+      CollisionCheckerCacheConfig{.max_num_configurations = 2});
+  for (int i = 0; i < 10; ++i) {
+    dut.CheckConfigCollisionFree(VectorXd::Constant(1, 0.1 * i));
+  }
+  EXPECT_LE(dut.GetResultCacheStatistics().num_configurations, 2);
+
+  // Disabling.
+  dut.set_result_cache_config(std::nullopt);
+  EXPECT_FALSE(dut.result_cache_config().has_value());
+  EXPECT_EQ(dut.GetResultCacheStatistics().num_configuration_misses, 0);
+
+  // Invalid configurations.
+  EXPECT_THROW(dut.set_result_cache_config(
+                   CollisionCheckerCacheConfig{.quantization = 0.0}),
+               std::exception);
+  EXPECT_THROW(dut.set_result_cache_config(
+                   CollisionCheckerCacheConfig{.max_num_edges = -1}),
+               std::exception);
+}
+
 // Additional test cases for basic EdgeMeasure functionality not covered already
 // in the above cases.
 GTEST_TEST(EdgeMeasureTest, Test) {
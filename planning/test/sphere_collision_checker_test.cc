@@ -0,0 +1,263 @@
+#include "drake/planning/sphere_collision_checker.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/planning/robot_diagram_builder.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+using Eigen::Matrix4Xd;
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using multibody::BodyIndex;
+
+// A robot made of a ball (radius 0.1) that slides along the world's x axis and
+// a cube (side 0.1) that slides along the world's y axis starting from
+// (0, 0.5, 0), next to a fixed wall that spans 0.4 ≤ x ≤ 0.6 and a fixed post
+// (side 0.1) out of reach at (-0.8, 0.8, 0).
+constexpr char kModel[] = R"""(
+<?xml version='1.0'?>
+<sdf version='1.7'>
+<world name='default'>
+  <model name='robot'>
+    <link name='ball'>
+      <collision name='ball_collision'>
+        <geometry><sphere><radius>0.1</radius></sphere></geometry>
+      </collision>
+    </link>
+    <joint name='ball_joint' type='prismatic'>
+      <parent>world</parent>
+      <child>ball</child>
+      <axis><xyz>1 0 0</xyz></axis>
+    </joint>
+    <link name='cube'>
+      <pose>0 0.5 0 0 0 0</pose>
+      <collision name='cube_collision'>
+        <geometry><box><size>0.1 0.1 0.1</size></box></geometry>
+      </collision>
+    </link>
+    <joint name='cube_joint' type='prismatic'>
+      <parent>world</parent>
+      <child>cube</child>
+      <axis><xyz>0 1 0</xyz></axis>
+    </joint>
+  </model>
+  <model name='env'>
+    <static>true</static>
+    <link name='wall'>
+      <pose>0.5 0 0 0 0 0</pose>
+      <collision name='wall_collision'>
+        <geometry><box><size>0.2 2.0 2.0</size></box></geometry>
+      </collision>
+    </link>
+    <link name='post'>
+      <pose>-0.8 0.8 0 0 0 0</pose>
+      <collision name='post_collision'>
+        <geometry><box><size>0.1 0.1 0.1</size></box></geometry>
+      </collision>
+    </link>
+  </model>
+</world>
+</sdf>
+)""";
+
+class SphereCollisionCheckerTest : public testing::Test {
+ protected:
+  SphereCollisionCheckerTest() {
+    RobotDiagramBuilder<double> builder;
+    builder.parser().AddModelsFromString(kModel, "sdf");
+    params_.robot_model_instances.push_back(
+        builder.plant().GetModelInstanceByName("robot"));
+    params_.model = builder.Build();
+    params_.configuration_distance_function = [](const VectorXd& q1,
+                                                 const VectorXd& q2) {
+      return (q1 - q2).norm();
+    };
+    params_.edge_step_size = 0.01;
+  }
+
+  std::unique_ptr<SphereCollisionChecker> MakeChecker(
+      const SphereCollisionCheckerConfig& config) {
+    return std::make_unique<SphereCollisionChecker>(std::move(params_),
+                                                    config);
+  }
+
+  CollisionCheckerParams params_;
+};
+
+TEST_F(SphereCollisionCheckerTest, BadConfig) {
+  SphereCollisionCheckerConfig config;
+  config.voxel_size = 0;
+  EXPECT_THROW(MakeChecker(config), std::exception);
+}
+
+TEST_F(SphereCollisionCheckerTest, Spheres) {
+  SphereCollisionCheckerConfig config;
+  config.sphere_resolution = 0.05;
+  const auto dut = MakeChecker(config);
+  const BodyIndex ball = dut->plant().GetBodyByName("ball").index();
+  const BodyIndex cube = dut->plant().GetBodyByName("cube").index();
+  const BodyIndex wall = dut->plant().GetBodyByName("wall").index();
+
+  // Spheres are used as is.
+  const Matrix4Xd ball_spheres = dut->GetBodySpheres(ball);
+  ASSERT_EQ(ball_spheres.cols(), 1);
+  EXPECT_TRUE(CompareMatrices(ball_spheres.col(0),
+                              Eigen::Vector4d(0, 0, 0, 0.1)));
+
+  // The cube is split into 2x2x2 cells, each covered by its circumsphere.
+  const Matrix4Xd cube_spheres = dut->GetBodySpheres(cube);
+  ASSERT_EQ(cube_spheres.cols(), 8);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(CompareMatrices(cube_spheres.col(i).head<3>().cwiseAbs(),
+                                Vector3d::Constant(0.025), 1e-14));
+    EXPECT_NEAR(cube_spheres(3, i), std::sqrt(3.0) * 0.025, 1e-14);
+  }
+  EXPECT_EQ(dut->num_spheres(), 9);
+
+  // The environment has no spheres.
+  EXPECT_EQ(dut->GetBodySpheres(wall).cols(), 0);
+}
+
+TEST_F(SphereCollisionCheckerTest, EnvironmentDistance) {
+  SphereCollisionCheckerConfig config;
+  config.voxel_size = 0.02;
+  const auto dut = MakeChecker(config);
+  const BodyIndex ball = dut->plant().GetBodyByName("ball").index();
+  const BodyIndex wall = dut->plant().GetBodyByName("wall").index();
+
+  // In conservative mode, lookups never overestimate the distance, and are
+  // off by no more than the voxel diagonal.
+  const double tolerance = std::sqrt(3.0) * config.voxel_size;
+  for (const double x : {-0.5, -0.1, 0.0, 0.2, 0.35, 0.45}) {
+    const Vector3d p_WQ(x, 0.013, -0.007);
+    const double expected = std::abs(x - 0.5) - 0.1;
+    const double distance = dut->CalcEnvironmentDistance(ball, p_WQ);
+    EXPECT_LE(distance, expected);
+    EXPECT_GE(distance, expected - tolerance);
+  }
+
+  // Points past the end of the grid are still bounded from below.
+  EXPECT_LE(dut->CalcEnvironmentDistance(ball, Vector3d(-3.0, 0, 0)),
+            config.truncation_distance);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut->CalcEnvironmentDistance(wall, Vector3d::Zero()),
+      ".*IsPartOfRobot.*");
+}
+
+TEST_F(SphereCollisionCheckerTest, CheckConfigCollisionFree) {
+  const auto dut = MakeChecker(SphereCollisionCheckerConfig{});
+  const BodyIndex ball = dut->plant().GetBodyByName("ball").index();
+  const BodyIndex cube = dut->plant().GetBodyByName("cube").index();
+
+  EXPECT_TRUE(dut->CheckConfigCollisionFree(Vector2d(0.0, 0.0)));
+  EXPECT_TRUE(dut->CheckConfigCollisionFree(Vector2d(0.1, 0.0)));
+
+  // The ball hits the wall.
+  EXPECT_FALSE(dut->CheckConfigCollisionFree(Vector2d(0.35, 0.0)));
+  std::vector<RobotCollisionType> types =
+      dut->ClassifyBodyCollisions(Vector2d(0.35, 0.0));
+  EXPECT_EQ(types[ball], RobotCollisionType::kEnvironmentCollision);
+  EXPECT_EQ(types[cube], RobotCollisionType::kNoCollision);
+
+  // The cube hits the ball.
+  EXPECT_FALSE(dut->CheckConfigCollisionFree(Vector2d(0.0, -0.45)));
+  types = dut->ClassifyBodyCollisions(Vector2d(0.0, -0.45));
+  EXPECT_EQ(types[ball], RobotCollisionType::kSelfCollision);
+  EXPECT_EQ(types[cube], RobotCollisionType::kSelfCollision);
+
+  // Padding applies to the environment as a whole.
+  dut->SetPaddingBetween(ball, dut->plant().GetBodyByName("wall").index(),
+                         0.2);
+  EXPECT_FALSE(dut->CheckConfigCollisionFree(Vector2d(0.1, 0.0)));
+
+  // Filtered pairs are skipped.
+  dut->SetCollisionFilteredBetween(ball, cube, true);
+  EXPECT_TRUE(dut->CheckConfigCollisionFree(Vector2d(0.0, -0.45)));
+
+  // Clones carry the same spheres, grids, and filters.
+  const std::unique_ptr<CollisionChecker> clone = dut->Clone();
+  EXPECT_TRUE(clone->CheckConfigCollisionFree(Vector2d(0.0, -0.45)));
+  EXPECT_FALSE(clone->CheckConfigCollisionFree(Vector2d(0.1, 0.0)));
+}
+
+TEST_F(SphereCollisionCheckerTest, RobotClearance) {
+  const auto dut = MakeChecker(SphereCollisionCheckerConfig{});
+  const BodyIndex ball = dut->plant().GetBodyByName("ball").index();
+  const BodyIndex wall = dut->plant().GetBodyByName("wall").index();
+
+  const RobotClearance clearance =
+      dut->CalcRobotClearance(Vector2d(0.1, 0.0), 0.25);
+  ASSERT_EQ(clearance.size(), 1);
+  EXPECT_EQ(clearance.robot_indices()[0], ball);
+  EXPECT_EQ(clearance.other_indices()[0], wall);
+  EXPECT_EQ(clearance.collision_types()[0],
+            RobotCollisionType::kEnvironmentCollision);
+  EXPECT_LE(clearance.distances()[0], 0.2);
+  EXPECT_GT(clearance.distances()[0], 0.15);
+  // Moving the ball towards the wall reduces the distance.
+  EXPECT_NEAR(clearance.jacobians()(0, 0), -1.0, 1e-6);
+  EXPECT_EQ(clearance.jacobians()(0, 1), 0.0);
+  EXPECT_EQ(dut->MaxNumDistances(), 3);
+}
+
+TEST_F(SphereCollisionCheckerTest, SharedDistanceFields) {
+  const auto dut = MakeChecker(SphereCollisionCheckerConfig{});
+  const BodyIndex ball = dut->plant().GetBodyByName("ball").index();
+  const BodyIndex cube = dut->plant().GetBodyByName("cube").index();
+  const BodyIndex post = dut->plant().GetBodyByName("post").index();
+  const Vector3d p_WQ(-0.8, 0.6, 0.0);
+
+  // Both robot bodies are checked against the wall and the post, so they share
+  // one distance field.
+  EXPECT_EQ(dut->num_distance_fields(), 1);
+  EXPECT_LT(dut->CalcEnvironmentDistance(ball, p_WQ), 0.15);
+  EXPECT_LT(dut->CalcEnvironmentDistance(cube, p_WQ), 0.15);
+
+  // Filtering the post from the ball gives the ball a field of its own.
+  dut->SetCollisionFilteredBetween(ball, post, true);
+  EXPECT_EQ(dut->num_distance_fields(), 2);
+  EXPECT_GT(dut->CalcEnvironmentDistance(ball, p_WQ), 0.15);
+  EXPECT_LT(dut->CalcEnvironmentDistance(cube, p_WQ), 0.15);
+
+  // Once the cube's filters match, the fields are shared again.
+  dut->SetCollisionFilteredBetween(cube, post, true);
+  EXPECT_EQ(dut->num_distance_fields(), 1);
+  EXPECT_GT(dut->CalcEnvironmentDistance(cube, p_WQ), 0.15);
+}
+
+TEST_F(SphereCollisionCheckerTest, AddedShapes) {
+  const auto dut = MakeChecker(SphereCollisionCheckerConfig{});
+  const auto& ball = dut->plant().GetBodyByName("ball");
+  const auto& wall = dut->plant().GetBodyByName("wall");
+  const int num_spheres = dut->num_spheres();
+
+  // Robot shapes add spheres.
+  EXPECT_TRUE(dut->AddCollisionShapeToBody("tool", ball,
+                                           geometry::Sphere(0.05),
+                                           math::RigidTransformd()));
+  EXPECT_EQ(dut->num_spheres(), num_spheres + 1);
+
+  // Environment shapes are added to the distance grid.
+  EXPECT_TRUE(dut->CheckConfigCollisionFree(Vector2d(0.0, 0.0)));
+  EXPECT_TRUE(dut->AddCollisionShapeToBody(
+      "obstacle", wall, geometry::Sphere(0.1),
+      math::RigidTransformd(Vector3d(-0.5, 0, 0))));
+  EXPECT_FALSE(dut->CheckConfigCollisionFree(Vector2d(0.0, 0.0)));
+
+  dut->RemoveAllAddedCollisionShapes();
+  EXPECT_EQ(dut->num_spheres(), num_spheres);
+  EXPECT_TRUE(dut->CheckConfigCollisionFree(Vector2d(0.0, 0.0)));
+}
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
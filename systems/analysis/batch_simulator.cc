@@ -0,0 +1,117 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace systems {
+
+template <typename T>
+BatchSimulator<T>::BatchSimulator(
+    const System<T>& system, std::vector<std::unique_ptr<Context<T>>> contexts,
+    double time_step)
+    : system_(system), time_step_(time_step), contexts_(std::move(contexts)) {
+  DRAKE_THROW_UNLESS(!contexts_.empty());
+  DRAKE_THROW_UNLESS(time_step_ > 0.0);
+  if (system_.num_discrete_state_groups() > 0 ||
+      system_.num_abstract_states() > 0) {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator: the System '{}' has discrete or abstract state, "
+        "which is not supported; only continuous state can be simulated in "
+        "lockstep.",
+        system_.GetSystemPathname()));
+  }
+  const int num_instances = static_cast<int>(contexts_.size());
+  context_pointers_.reserve(num_instances);
+  derivs0_.reserve(num_instances);
+  derivs1_.reserve(num_instances);
+  derivs0_pointers_.reserve(num_instances);
+  derivs1_pointers_.reserve(num_instances);
+  for (const auto& context : contexts_) {
+    DRAKE_THROW_UNLESS(context != nullptr);
+    system_.ValidateContext(*context);
+    if (context->get_time() != contexts_[0]->get_time()) {
+      throw std::logic_error(fmt::format(
+          "BatchSimulator: all contexts must have the same time, but found "
+          "both {} and {}.",
+          ExtractDoubleOrThrow(contexts_[0]->get_time()),
+          ExtractDoubleOrThrow(context->get_time())));
+    }
+    context_pointers_.push_back(context.get());
+    derivs0_.push_back(system_.AllocateTimeDerivatives());
+    derivs1_.push_back(system_.AllocateTimeDerivatives());
+    derivs0_pointers_.push_back(derivs0_.back().get());
+    derivs1_pointers_.push_back(derivs1_.back().get());
+  }
+}
+
+template <typename T>
+BatchSimulator<T>::~BatchSimulator() = default;
+
+template <typename T>
+const Context<T>& BatchSimulator<T>::get_context(int i) const {
+  DRAKE_THROW_UNLESS(i >= 0 && i < num_instances());
+  return *contexts_[i];
+}
+
+template <typename T>
+Context<T>& BatchSimulator<T>::get_mutable_context(int i) {
+  DRAKE_THROW_UNLESS(i >= 0 && i < num_instances());
+  return *contexts_[i];
+}
+
+template <typename T>
+void BatchSimulator<T>::AdvanceTo(const T& boundary_time) {
+  if (boundary_time < get_time()) {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator::AdvanceTo(): the boundary time {} is earlier than "
+        "the current time {}.",
+        ExtractDoubleOrThrow(boundary_time), ExtractDoubleOrThrow(get_time())));
+  }
+  while (get_time() < boundary_time) {
+    // As IntegratorBase does, stretch the last step slightly rather than
+    // leave a tiny sliver of time for one more step.
+    const T remaining = boundary_time - get_time();
+    const T h = (remaining <= 1.01 * time_step_) ? remaining : T(time_step_);
+    Step(h);
+  }
+}
+
+// This is the same scheme as RungeKutta2Integrator::DoStep(), applied to all
+// instances at each stage; see there for the notation.
+template <typename T>
+void BatchSimulator<T>::Step(const T& h) {
+  const int n = num_instances();
+
+  // xcdot₀ ← xcdot(t₀, x(t₀), u(t₀)) for every instance.
+  system_.CalcTimeDerivativesBatch(context_pointers_, derivs0_pointers_);
+
+  // xc⁽ᵃ⁾ ← xc₀ + h * xcdot₀, at t⁽ᵃ⁾ = t₁ = t₀ + h.
+  for (int k = 0; k < n; ++k) {
+    Context<T>& context = *contexts_[k];
+    VectorBase<T>& xc = context.SetTimeAndGetMutableContinuousStateVector(
+        context.get_time() + h);
+    xc.PlusEqScaled(h, derivs0_[k]->get_vector());
+  }
+
+  // xcdot⁽ᵃ⁾ ← xcdot(t⁽ᵃ⁾, x⁽ᵃ⁾, u⁽ᵃ⁾) for every instance.
+  system_.CalcTimeDerivativesBatch(context_pointers_, derivs1_pointers_);
+
+  // xc₁ = xc⁽ᵃ⁾ + h * (xcdot⁽ᵃ⁾ - xcdot₀)/2
+  for (int k = 0; k < n; ++k) {
+    contexts_[k]->get_mutable_continuous_state_vector().PlusEqScaled(
+        {{h / 2, derivs1_[k]->get_vector()},
+         {-h / 2, derivs0_[k]->get_vector()}});
+  }
+  ++num_steps_taken_;
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::systems::BatchSimulator)
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ * Advances many instances of one System in lockstep, sharing a single time
+ * axis. Each instance has its own Context (and so its own state, parameters,
+ * and fixed inputs), but all of them take the same fixed-size steps, and at
+ * every stage of every step the time derivatives of the whole batch are
+ * computed by a single call to System::CalcTimeDerivativesBatch(). Systems
+ * that override the batch hooks (System::DoCalcTimeDerivativesBatch() and
+ * System::DoEvalOutputBatch()) can then replace N matrix-vector products
+ * with one matrix-matrix product; a Diagram forwards the batch to each of its
+ * subsystems. All other systems are evaluated one Context at a time, which
+ * gives the same results as separate simulations.
+ *
+ * Integration uses the same explicit second-order Runge-Kutta scheme as
+ * RungeKutta2Integrator, with a fixed step size. Unlike Simulator, this
+ * class supports only systems whose state is entirely continuous, and it
+ * does not dispatch any events (publish, discrete, or unrestricted updates)
+ * and does not monitor witness functions.
+ *
+ * @tparam_nonsymbolic_scalar
+ */
+template <typename T>
+class BatchSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchSimulator);
+
+  /**
+   * Creates a simulator for the instances of `system` given by `contexts`.
+   * The system must remain alive for the lifetime of this simulator.
+   *
+   * @param time_step The fixed step size, which must be positive. The last
+   *   step before a boundary time is shortened (or stretched by up to 1%) as
+   *   needed to land on it exactly.
+   * @throws std::exception if `contexts` is empty, if any context is null or
+   *   was not created for `system`, if the contexts do not all have the same
+   *   time, if `time_step` is not positive, or if `system` has discrete or
+   *   abstract state.
+   */
+  BatchSimulator(const System<T>& system,
+                 std::vector<std::unique_ptr<Context<T>>> contexts,
+                 double time_step);
+
+  ~BatchSimulator();
+
+  /** Returns the system being simulated. */
+  const System<T>& get_system() const { return system_; }
+
+  /** Returns the number of simulated instances. */
+  int num_instances() const { return static_cast<int>(contexts_.size()); }
+
+  /** Returns the fixed step size. */
+  double get_time_step() const { return time_step_; }
+
+  /** Returns the current (shared) time. */
+  const T& get_time() const { return contexts_[0]->get_time(); }
+
+  /** Returns the context of the instance `i`.
+  @throws std::exception if `i` is out of range. */
+  const Context<T>& get_context(int i) const;
+
+  /** Returns a mutable reference to the context of the instance `i`. Do not
+  change its time; all instances must share the same time.
+  @throws std::exception if `i` is out of range. */
+  Context<T>& get_mutable_context(int i);
+
+  /** Returns the number of steps taken since construction. */
+  int64_t get_num_steps_taken() const { return num_steps_taken_; }
+
+  /**
+   * Advances all instances to `boundary_time`.
+   * @throws std::exception if `boundary_time` is earlier than get_time().
+   */
+  void AdvanceTo(const T& boundary_time);
+
+ private:
+  // Takes one step of size `h` for every instance.
+  void Step(const T& h);
+
+  const System<T>& system_;
+  const double time_step_;
+  std::vector<std::unique_ptr<Context<T>>> contexts_;
+  int64_t num_steps_taken_{0};
+
+  // Pre-allocated storage, one entry per instance, so that stepping does not
+  // allocate (beyond what the system's own batch hooks may need).
+  std::vector<const Context<T>*> context_pointers_;
+  std::vector<std::unique_ptr<ContinuousState<T>>> derivs0_;
+  std::vector<std::unique_ptr<ContinuousState<T>>> derivs1_;
+  std::vector<ContinuousState<T>*> derivs0_pointers_;
+  std::vector<ContinuousState<T>*> derivs1_pointers_;
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::systems::BatchSimulator)
@@ -1,7 +1,10 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
@@ -23,6 +26,7 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
 template <class T>
 void ImplicitIntegrator<T>::DoReset() {
   J_.resize(0, 0);
+  jacobian_sparsity_.clear();
   DoResetCachedJacobianRelatedMatrices();
   // Call any Reset() provided by child integrator classes.
   DoImplicitIntegratorReset();
@@ -204,19 +208,185 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
   }
 }
 
+namespace {
+// Returns `true` if the two compressed sparse matrices have identical
+// dimensions and nonzero structure.
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<double>& A,
+                             const Eigen::SparseMatrix<double>& B) {
+  if (A.rows() != B.rows() || A.cols() != B.cols() ||
+      A.nonZeros() != B.nonZeros()) {
+    return false;
+  }
+  DRAKE_ASSERT(A.isCompressed() && B.isCompressed());
+  return std::equal(A.outerIndexPtr(), A.outerIndexPtr() + A.outerSize() + 1,
+                    B.outerIndexPtr()) &&
+         std::equal(A.innerIndexPtr(), A.innerIndexPtr() + A.nonZeros(),
+                    B.innerIndexPtr());
+}
+
+// Computes a good increment for numerically differentiating with respect to
+// a variable with value `xi` using approximately 1/eps digits of precision.
+// Note that if |xi| is large, the increment will be large as well. If |xi| is
+// small, the increment will be no smaller than eps.
+template <typename T>
+T CalcDifferencingIncrement(const T& xi, double eps) {
+  using std::abs;
+  const T abs_xi = abs(xi);
+  return (abs_xi <= 1) ? T(eps) : T(eps * abs_xi);
+}
+}  // namespace
+
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
-  LU_.compute(iteration_matrix);
   matrix_factored_ = true;
+  sparse_factored_ = false;
+  if (use_sparse_factorization_) {
+    // Only the nonzero entries are retained; the symbolic analysis (fill-
+    // reducing ordering and elimination tree) is recomputed only when the
+    // structure changes.
+    Eigen::SparseMatrix<double> A = iteration_matrix.sparseView();
+    A.makeCompressed();
+    if (sparse_LU_ == nullptr) {
+      sparse_LU_ = std::make_unique<Eigen::SparseLU<
+          Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>>();
+    }
+    if (!HaveSameSparsityPattern(A, sparse_matrix_)) {
+      sparse_LU_->analyzePattern(A);
+    }
+    sparse_LU_->factorize(A);
+    sparse_matrix_ = std::move(A);
+    if (sparse_LU_->info() == Eigen::Success) {
+      sparse_factored_ = true;
+      return;
+    }
+
+    // The sparse factorization does not pivot for stability as aggressively
+    // as the dense one; fall back to the latter on failure.
+    DRAKE_LOGGER_DEBUG("Sparse LU factorization failed; using dense LU.");
+    sparse_matrix_ = Eigen::SparseMatrix<double>();
+  }
+  LU_.compute(iteration_matrix);
 }
 
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_factored_) return sparse_LU_->solve(b);
   return LU_.solve(b);
 }
 
+template <class T>
+void ImplicitIntegrator<T>::JacobianSparsity::SetFromJacobian(
+    const MatrixX<T>& J) {
+  DRAKE_DEMAND(J.rows() == J.cols());
+  const int n = J.cols();
+
+  // Record the nonzero rows of each column, and the nonzero columns of each
+  // row (needed for the coloring).
+  column_rows_.assign(n, {});
+  std::vector<std::vector<int>> row_columns(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      if (i == j || J(i, j) != 0.0) {
+        column_rows_[j].push_back(i);
+        row_columns[i].push_back(j);
+      }
+    }
+  }
+
+  // Greedily assign each column the smallest color not already assigned to a
+  // column with which it shares a nonzero row.
+  color_columns_.clear();
+  std::vector<int> colors(n, -1);
+  std::vector<int> forbidden_for_column;  // Indexed by color.
+  for (int j = 0; j < n; ++j) {
+    forbidden_for_column.assign(color_columns_.size() + 1, -1);
+    for (int i : column_rows_[j]) {
+      for (int k : row_columns[i]) {
+        if (colors[k] >= 0) forbidden_for_column[colors[k]] = j;
+      }
+    }
+    int c = 0;
+    while (forbidden_for_column[c] == j) ++c;
+    colors[j] = c;
+    if (c == static_cast<int>(color_columns_.size()))
+      color_columns_.emplace_back();
+    color_columns_[c].push_back(j);
+  }
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeColoredDiffJacobian(
+    const std::function<void(const VectorX<T>&, VectorX<T>*)>& f,
+    const VectorX<T>& x, bool central, const JacobianSparsity& sparsity,
+    MatrixX<T>* J) const {
+  DRAKE_DEMAND(J != nullptr);
+  DRAKE_DEMAND(sparsity.size() == x.size());
+  const int n = x.size();
+
+  // Use the same powers of machine epsilon as the dense methods.
+  const double eps = central ?
+      std::pow(std::numeric_limits<double>::epsilon(), 5.0/12) :
+      std::sqrt(std::numeric_limits<double>::epsilon());
+
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator Compute Colored {}-Jacobian using {} colors",
+      n, sparsity.num_colors());
+
+  J->setZero(n, n);
+
+  // Evaluate f(x), if necessary.
+  VectorX<T> f0;
+  if (!central) f(x, &f0);
+
+  // Each color is perturbed at once. As in the dense methods, the increments
+  // are adjusted so that x and x + dx differ by exactly representable numbers.
+  VectorX<T> x_prime = x;
+  VectorX<T> dx_plus(n), dx_minus(n), f_plus, f_minus;
+  for (int c = 0; c < sparsity.num_colors(); ++c) {
+    const std::vector<int>& columns = sparsity.color_columns(c);
+    for (int j : columns) {
+      x_prime(j) = x(j) + CalcDifferencingIncrement(x(j), eps);
+      dx_plus(j) = x_prime(j) - x(j);
+    }
+    f(x_prime, &f_plus);
+
+    if (central) {
+      for (int j : columns) {
+        x_prime(j) = x(j) - CalcDifferencingIncrement(x(j), eps);
+        dx_minus(j) = x(j) - x_prime(j);
+      }
+      f(x_prime, &f_minus);
+    }
+
+    // Since no two columns of this color share a nonzero row, each nonzero
+    // entry of the perturbed function difference belongs to exactly one
+    // column.
+    for (int j : columns) {
+      for (int i : sparsity.column_rows(j)) {
+        (*J)(i, j) = central ?
+            T((f_plus(i) - f_minus(i)) / (dx_plus(j) + dx_minus(j))) :
+            T((f_plus(i) - f0(i)) / dx_plus(j));
+      }
+      x_prime(j) = x(j);
+    }
+  }
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeAndFactorIterationMatrix(
+    const std::function<void(const MatrixX<T>&, const T&,
+        typename ImplicitIntegrator<T>::IterationMatrix*)>&
+        compute_and_factor_iteration_matrix,
+    const MatrixX<T>& J, const T& h,
+    typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+  DRAKE_DEMAND(iteration_matrix != nullptr);
+  ++num_iter_factorizations_;
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
+  compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+}
+
 template <typename T>
 typename ImplicitIntegrator<T>::ConvergenceStatus
 ImplicitIntegrator<T>::CheckNewtonConvergence(
@@ -299,6 +469,25 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
 
   // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
   [this, context, &system, &t, &x]() {
+    // When exploiting sparsity with a numerically differentiated Jacobian, use
+    // compressed differencing once the sparsity pattern is known. Otherwise,
+    // the dense Jacobian computed below is used to discover the pattern.
+    const bool numerical =
+        jacobian_scheme_ != JacobianComputationScheme::kAutomatic;
+    if (use_sparse_jacobian_ && numerical &&
+        jacobian_sparsity_.size() == x.size()) {
+      const std::function<void(const VectorX<T>&, VectorX<T>*)> f =
+          [this, context, &t](const VectorX<T>& x_prime, VectorX<T>* xdot) {
+            context->SetTimeAndContinuousState(t, x_prime);
+            *xdot = this->EvalTimeDerivatives(*context).CopyToVector();
+          };
+      ComputeColoredDiffJacobian(
+          f, x,
+          jacobian_scheme_ == JacobianComputationScheme::kCentralDifference,
+          jacobian_sparsity_, &J_);
+      return;
+    }
+
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
         ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
@@ -312,6 +501,8 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
         ComputeAutoDiffJacobian(system, t, x, *context, &J_);
         break;
     }
+    if (use_sparse_jacobian_ && numerical)
+      jacobian_sparsity_.SetFromJacobian(J_);
   }();
 
   // Use the new number of ODE evaluations to determine the number of Jacobian
@@ -344,8 +535,8 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
   // Compute the initial Jacobian and iteration matrices and factor them.
   MatrixX<T>& J = get_mutable_jacobian();
   J = CalcJacobian(t, xt);
-  ++num_iter_factorizations_;
-  compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+  ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix, J, h,
+                                  iteration_matrix);
 }
 
 template <class T>
@@ -360,8 +551,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix, J, h,
+                                    iteration_matrix);
     return true;  // Indicate success.
   }
 
@@ -378,8 +569,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
   // implicit Trapezoid iteration matrix is not factorized, and so this block
   // of code will factorize it.
   if (!iteration_matrix->matrix_factored()) {
-    ++num_iter_factorizations_;
-    compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+    ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix, J, h,
+                                    iteration_matrix);
     return true;  // Indicate success.
   }
 
@@ -413,8 +604,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // which requires the same iteration matrix (so the matrix is correct
       // and does not actually need recomputation).
       // In both cases, the right thing to do would be to skip to trial 3.
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix, J,
+                                      h, iteration_matrix);
       return true;
     }
 
@@ -432,8 +623,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
       // Otherwise, we can reform the Jacobian matrix and refactor the
       // iteration matrix.
       J = CalcJacobian(t, xt);
-      ++num_iter_factorizations_;
-      compute_and_factor_iteration_matrix(J, h, iteration_matrix);
+      ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix, J,
+                                      h, iteration_matrix);
       return true;
 
       case 4: {
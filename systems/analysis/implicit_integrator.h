@@ -1,11 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
@@ -109,11 +113,12 @@ class ImplicitIntegrator : public IntegratorBase<T> {
 
   /// Sets the Jacobian computation scheme. This function can be safely called
   /// at any time (i.e., the integrator need not be re-initialized afterward).
-  /// @note Discards any already-computed Jacobian matrices if the scheme
-  ///       changes.
+  /// @note Discards any already-computed Jacobian matrices (and any
+  ///       discovered Jacobian sparsity pattern) if the scheme changes.
   void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
     if (jacobian_scheme_ != scheme) {
       J_.resize(0, 0);
+      jacobian_sparsity_.clear();
       // Reset the Jacobian and any matrices cached by child integrators.
       DoResetCachedJacobianRelatedMatrices();
     }
@@ -123,6 +128,55 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   JacobianComputationScheme get_jacobian_computation_scheme() const {
     return jacobian_scheme_;
   }
+
+  /// Sets whether the integrator exploits sparsity in the Jacobian matrix
+  /// (default is `false`). Systems with many weakly coupled state variables
+  /// (e.g., discretized PDEs or large collections of independent subsystems)
+  /// have Jacobian matrices that are mostly zero; for such systems enabling
+  /// this option can dramatically reduce both the number of derivative
+  /// evaluations needed to form a Jacobian and the cost of factoring the
+  /// iteration matrix.
+  ///
+  /// When enabled and a finite differencing scheme is selected, the first
+  /// Jacobian is computed densely (one derivative evaluation per state
+  /// variable for forward differencing) and its nonzero entries are recorded
+  /// as the sparsity pattern. The columns of the pattern are then partitioned
+  /// into groups ("colors") of structurally orthogonal columns, i.e., columns
+  /// that share no nonzero row. Subsequent Jacobians are formed by perturbing
+  /// all state variables of a color simultaneously ([Curtis 1974]), requiring
+  /// only one derivative evaluation per color (two for central differencing)
+  /// plus one unperturbed evaluation for forward differencing. Iteration
+  /// matrices are factored with a sparse LU factorization when `T` is
+  /// `double`; dense factorizations are retained for other scalar types.
+  ///
+  /// @warning The sparsity pattern is discovered from the Jacobian at a
+  ///          single state. Entries that happen to be exactly zero at that
+  ///          state but not elsewhere (e.g., the partial derivative of a
+  ///          product of state variables, evaluated where one of them is zero)
+  ///          will be treated as structural zeros until the pattern is
+  ///          rediscovered, which occurs when this integrator is reset, when
+  ///          the Jacobian computation scheme changes, or when this option is
+  ///          toggled. Jacobian accuracy affects only Newton-Raphson
+  ///          convergence (and thus efficiency), not the accuracy of the
+  ///          integration result.
+  /// @note This setting has no effect on the Jacobian formation when the
+  ///       Jacobian computation scheme is
+  ///       JacobianComputationScheme::kAutomatic.
+  ///
+  /// - [Curtis 1974] A. Curtis, M. Powell, and J. Reid. On the estimation of
+  ///                 sparse Jacobian matrices. IMA J. Appl. Math.,
+  ///                 13(1):117-119, 1974.
+  void set_use_sparse_jacobian(bool flag) {
+    if (use_sparse_jacobian_ != flag) {
+      jacobian_sparsity_.clear();
+      DoResetCachedJacobianRelatedMatrices();
+    }
+    use_sparse_jacobian_ = flag;
+  }
+
+  /// Gets whether the integrator exploits sparsity in the Jacobian matrix.
+  /// @see set_use_sparse_jacobian()
+  bool get_use_sparse_jacobian() const { return use_sparse_jacobian_; }
   /// @}
 
   /// @name Cumulative statistics functions.
@@ -219,7 +273,10 @@ class ImplicitIntegrator : public IntegratorBase<T> {
    public:
     /// Factors a dense matrix (the iteration matrix) using LU factorization,
     /// which should be faster than the QR factorization used in the specialized
-    /// template method for AutoDiffXd below.
+    /// template method for AutoDiffXd below. If sparse factorization has been
+    /// requested (see set_use_sparse_factorization()), the matrix is instead
+    /// factored using a sparse LU factorization, falling back to the dense
+    /// factorization should the sparse one fail.
     void SetAndFactorIterationMatrix(const MatrixX<T>& iteration_matrix);
 
     /// Solves a linear system Ax = b for x using the iteration matrix (A)
@@ -230,8 +287,20 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Sets whether subsequent calls to SetAndFactorIterationMatrix() should
+    /// use a sparse factorization. This setting is ignored for scalar types
+    /// other than `double`.
+    void set_use_sparse_factorization(bool flag) {
+      use_sparse_factorization_ = flag;
+    }
+
+    /// Returns whether the currently stored factorization is sparse.
+    bool is_factorization_sparse() const { return sparse_factored_; }
+
    private:
     bool matrix_factored_{false};
+    bool use_sparse_factorization_{false};
+    bool sparse_factored_{false};
 
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
@@ -239,6 +308,14 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     // serves to minimize heap allocations and deallocations.
     Eigen::PartialPivLU<MatrixX<double>> LU_;
 
+    // The sparse counterparts of LU_, used only for scalar type `double`. The
+    // last factored sparse matrix is kept so that the (comparatively costly)
+    // symbolic analysis can be skipped when the sparsity pattern is unchanged.
+    // Eigen's sparse solvers are not copyable, hence the indirection.
+    std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>,
+                                    Eigen::COLAMDOrdering<int>>> sparse_LU_;
+    Eigen::SparseMatrix<double> sparse_matrix_;
+
     // The only factorization supported by automatic differentiation in Eigen is
     // currently QR. When ImplicitIntegrator is templated on type AutoDiffXd,
     // this will be the factorization that is used.
@@ -302,6 +379,48 @@ class ImplicitIntegrator : public IntegratorBase<T> {
       compute_and_factor_iteration_matrix,
       typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix);
 
+  /// Stores the sparsity pattern of a Jacobian matrix together with a
+  /// partitioning of its columns into structurally orthogonal groups
+  /// ("colors"); no two columns of the same color have a nonzero entry in the
+  /// same row. All columns of a color can thus be computed from a single
+  /// perturbation of the function being differentiated.
+  /// @see set_use_sparse_jacobian()
+  class JacobianSparsity {
+   public:
+    /// Records the nonzero entries of `J` (diagonal entries are always
+    /// considered nonzero) and colors its columns using a greedy
+    /// (first-fit) coloring of the column intersection graph.
+    /// @pre `J` is square.
+    void SetFromJacobian(const MatrixX<T>& J);
+
+    /// Discards the stored pattern.
+    void clear() {
+      column_rows_.clear();
+      color_columns_.clear();
+    }
+
+    /// Returns the number of columns of the Jacobian matrix this pattern was
+    /// computed from (zero if no pattern is stored).
+    int size() const { return static_cast<int>(column_rows_.size()); }
+
+    /// Returns the number of colors used to partition the columns.
+    int num_colors() const { return static_cast<int>(color_columns_.size()); }
+
+    /// Returns the indices of the rows with nonzero entries in column `j`.
+    const std::vector<int>& column_rows(int j) const {
+      return column_rows_[j];
+    }
+
+    /// Returns the indices of the columns assigned to color `c`.
+    const std::vector<int>& color_columns(int c) const {
+      return color_columns_[c];
+    }
+
+   private:
+    std::vector<std::vector<int>> column_rows_;
+    std::vector<std::vector<int>> color_columns_;
+  };
+
   /// Checks whether a proposed update is effectively zero, indicating that the
   /// Newton-Raphson process converged.
   /// @param xc the continuous state.
@@ -452,6 +571,37 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   void ComputeAutoDiffJacobian(const System<T>& system, const T& t,
       const VectorX<T>& xt, const Context<T>& context, MatrixX<T>* J);
 
+  // Computes the Jacobian of a function `f` around `x` using compressed
+  // (column-colored) forward or central differencing, so that only
+  // `sparsity.num_colors()` perturbed evaluations of `f` (twice that for
+  // central differencing) are needed. Increments are chosen as in
+  // ComputeForwardDiffJacobian() and ComputeCentralDiffJacobian().
+  // @param f the function to differentiate, which evaluates f(x) into its
+  //        second argument.
+  // @param x the point around which to compute the Jacobian matrix.
+  // @param central `true` to use central differencing, `false` to use forward
+  //        differencing.
+  // @param sparsity the sparsity pattern and coloring of the Jacobian matrix.
+  // @param[out] J the Jacobian matrix around `x`; entries outside of the
+  //        sparsity pattern are set to zero.
+  // @pre sparsity.size() == x.size().
+  void ComputeColoredDiffJacobian(
+      const std::function<void(const VectorX<T>&, VectorX<T>*)>& f,
+      const VectorX<T>& x, bool central, const JacobianSparsity& sparsity,
+      MatrixX<T>* J) const;
+
+  // Increments the iteration matrix factorization count and then forms and
+  // factors the iteration matrix using `compute_and_factor_iteration_matrix`,
+  // requesting a sparse factorization if get_use_sparse_jacobian() is `true`.
+  // Derived classes that manage their own Jacobian matrices should use this
+  // method in lieu of invoking the function directly.
+  void ComputeAndFactorIterationMatrix(
+      const std::function<void(const MatrixX<T>& J, const T& h,
+          typename ImplicitIntegrator<T>::IterationMatrix*)>&
+      compute_and_factor_iteration_matrix,
+      const MatrixX<T>& J, const T& h,
+      typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix);
+
   /// @copydoc IntegratorBase::DoStep()
   virtual bool DoImplicitIntegratorStep(const T& h) = 0;
 
@@ -500,6 +650,11 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // The last computed Jacobian matrix.
   MatrixX<T> J_;
 
+  // Whether to exploit Jacobian sparsity and, if so, the sparsity pattern of
+  // J_ (empty until it has been discovered).
+  bool use_sparse_jacobian_{false};
+  JacobianSparsity jacobian_sparsity_;
+
   // Indicates whether the Jacobian matrix is fresh. We say the Jacobian is
   // "fresh" if it was last computed at a state (t0, x0) from the beginning of
   // the current step. This indicates to MaybeFreshenMatrices that it should
@@ -546,6 +701,7 @@ inline void ImplicitIntegrator<AutoDiffXd>::IterationMatrix::
     SetAndFactorIterationMatrix(const MatrixX<AutoDiffXd>& iteration_matrix) {
   QR_.compute(iteration_matrix);
   matrix_factored_ = true;
+  sparse_factored_ = false;
 }
 
 // Solves the linear system Ax = b for x using the iteration matrix (A)
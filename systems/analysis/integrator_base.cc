@@ -20,7 +20,8 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& h_max) {
   const T current_time = context.get_time();
   VectorBase<T>& xc =
       get_mutable_context()->get_mutable_continuous_state_vector();
-  xc0_save_ = xc.CopyToVector();
+  xc0_save_.resize(xc.size());
+  xc.CopyToPreSizedVector(&xc0_save_);
 
   // Set the step size to attempt.
   T step_size_to_attempt = get_ideal_next_step_size();
@@ -169,25 +170,31 @@ T IntegratorBase<T>::CalcStateChangeNorm(
   //                 (i.e., modify the System to provide this value).
   const double characteristic_time = 1.0;
 
+  // The scratch vector is large enough to hold any one of the substates; each
+  // computation below uses only its leading elements, so that nothing is
+  // reallocated from one step to the next.
+  if (unweighted_substate_change_.size() != dx_state.size())
+    unweighted_substate_change_.resize(dx_state.size());
+
   // Computes the infinity norm of the weighted velocity variables.
-  unweighted_substate_change_ = dgv.CopyToVector();
-  T v_nrm = qbar_v_weight.cwiseProduct(unweighted_substate_change_).
+  auto dv = unweighted_substate_change_.head(dgv.size());
+  dgv.CopyToPreSizedVector(&dv);
+  T v_nrm = qbar_v_weight.cwiseProduct(dv).
       template lpNorm<Eigen::Infinity>() * characteristic_time;
 
   // Compute the infinity norm of the weighted auxiliary variables.
-  unweighted_substate_change_ = dgz.CopyToVector();
-  T z_nrm = (z_weight.cwiseProduct(unweighted_substate_change_))
-                .template lpNorm<Eigen::Infinity>();
+  auto dz = unweighted_substate_change_.head(dgz.size());
+  dgz.CopyToPreSizedVector(&dz);
+  T z_nrm = (z_weight.cwiseProduct(dz)).template lpNorm<Eigen::Infinity>();
 
   // Compute N * Wq * dq = N * Wꝗ * N+ * dq.
-  unweighted_substate_change_ = dgq.CopyToVector();
-  system.MapQDotToVelocity(context, unweighted_substate_change_,
-                           pinvN_dq_change_.get());
-  system.MapVelocityToQDot(
-      context, qbar_v_weight.cwiseProduct(pinvN_dq_change_->CopyToVector()),
-      weighted_q_change_.get());
-  T q_nrm = weighted_q_change_->CopyToVector().
-      template lpNorm<Eigen::Infinity>();
+  auto dq = unweighted_substate_change_.head(dgq.size());
+  dgq.CopyToPreSizedVector(&dq);
+  system.MapQDotToVelocity(context, dq, pinvN_dq_change_.get());
+  auto weighted_v = unweighted_substate_change_.head(dgv.size());
+  weighted_v = qbar_v_weight.cwiseProduct(pinvN_dq_change_->value());
+  system.MapVelocityToQDot(context, weighted_v, weighted_q_change_.get());
+  T q_nrm = weighted_q_change_->value().template lpNorm<Eigen::Infinity>();
   DRAKE_LOGGER_DEBUG("dq norm: {}, dv norm: {}, dz norm: {}",
       q_nrm, v_nrm, z_nrm);
 
@@ -13,6 +13,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/vector_base.h"
@@ -1663,11 +1664,11 @@ class IntegratorBase {
   // generalized coordinates to generalized velocities, multiplied by the
   // change in the generalized coordinates (used in state change norm
   // calculations).
-  mutable std::unique_ptr<VectorBase<T>> pinvN_dq_change_;
+  mutable std::unique_ptr<BasicVector<T>> pinvN_dq_change_;
 
   // Vectors used in state change norm calculations.
   mutable VectorX<T> unweighted_substate_change_;
-  mutable std::unique_ptr<VectorBase<T>> weighted_q_change_;
+  mutable std::unique_ptr<BasicVector<T>> weighted_q_change_;
 
   // Variable for indicating when an integrator has been initialized.
   bool initialization_done_{false};
@@ -1,10 +1,17 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
-#include <future>
-#include <list>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <mutex>
+#include <optional>
 #include <thread>
 
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/scope_exit.h"
+#include "drake/common/text_logging.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -27,105 +34,219 @@ double RandomSimulation(
 
 namespace {
 
+// The Simulator used to run a sample, along with what is needed to reuse it
+// for subsequent samples.
+struct SampleSimulator {
+  std::unique_ptr<Simulator<double>> simulator;
+  // The Context as provided by the SimulatorFactory (only set when reusing).
+  std::unique_ptr<Context<double>> initial_context;
+  // True iff the Context was restored from `initial_context` for this sample,
+  // so the Simulator must be initialized again before advancing.
+  bool needs_initialize{false};
+};
+
+// Prepares `sample_simulator` to run the next sample drawn from `generator`,
+// either by making a new Simulator or, when reusing simulators, by restoring
+// the Context of the existing one. In both cases the random quantities of the
+// Context are then drawn, consuming `generator` exactly as RandomSimulation()
+// does.
+void PrepareSampleSimulator(
+    const SimulatorFactory& make_simulator, const bool reuse_simulators,
+    RandomGenerator* const generator, SampleSimulator* sample_simulator) {
+  sample_simulator->needs_initialize = false;
+  if (!reuse_simulators) {
+    sample_simulator->simulator = make_simulator(generator);
+  } else if (sample_simulator->simulator == nullptr) {
+    // Reuse is only faithful to RandomSimulation() if the factory does not
+    // draw from the generator; detect this by offering it a copy.
+    RandomGenerator factory_generator(*generator);
+    sample_simulator->simulator = make_simulator(&factory_generator);
+    RandomGenerator unused_generator(*generator);
+    if (factory_generator() != unused_generator()) {
+      throw std::logic_error(
+          "MonteCarloSimulation(): reuse_simulators requires a "
+          "SimulatorFactory that does not use its RandomGenerator argument");
+    }
+    sample_simulator->initial_context =
+        sample_simulator->simulator->get_context().Clone();
+  } else {
+    sample_simulator->simulator->get_mutable_context()
+        .SetTimeStateAndParametersFrom(*sample_simulator->initial_context);
+    sample_simulator->needs_initialize = true;
+  }
+
+  Simulator<double>& simulator = *sample_simulator->simulator;
+  simulator.get_system().SetRandomContext(&simulator.get_mutable_context(),
+                                          generator);
+}
+
+// Runs a simulation prepared by PrepareSampleSimulator() and returns its
+// output. As in RandomSimulation(), a fresh Simulator is left for AdvanceTo()
+// to initialize (if the factory has not already done so); only a reused
+// Simulator, whose Context was restored, is explicitly re-initialized.
+double RunSampleSimulation(const ScalarSystemFunction& output,
+                           const double final_time,
+                           SampleSimulator* const sample_simulator) {
+  Simulator<double>* const simulator = sample_simulator->simulator.get();
+  if (sample_simulator->needs_initialize) {
+    simulator->Initialize();
+  }
+  simulator->AdvanceTo(final_time);
+  return output(simulator->get_system(), simulator->get_context());
+}
+
 // Serial (single-threaded) implementation of MonteCarloSimulation.
-std::vector<RandomSimulationResult> MonteCarloSimulationSerial(
+void MonteCarloSimulationSerial(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
     const double final_time, const int num_samples,
-    RandomGenerator* const generator) {
-  std::vector<RandomSimulationResult> simulation_results;
-  simulation_results.reserve(num_samples);
-
+    RandomGenerator* const generator, const RandomSimulationResultSink& sink,
+    const bool reuse_simulators) {
+  SampleSimulator sample_simulator;
   for (int sample = 0; sample < num_samples; ++sample) {
     RandomSimulationResult simulation_result(*generator);
+    PrepareSampleSimulator(make_simulator, reuse_simulators, generator,
+                           &sample_simulator);
     simulation_result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    simulation_results.push_back(std::move(simulation_result));
+        RunSampleSimulation(output, final_time, &sample_simulator);
+    sink(sample, std::move(simulation_result));
   }
-
-  return simulation_results;
-}
-
-// Checks if a future has completed execution.
-template <typename T>
-bool IsFutureReady(const std::future<T>& future) {
-  // future.wait_for() is the only method to check the status of a future
-  // without waiting for it to complete.
-  const std::future_status status =
-      future.wait_for(std::chrono::milliseconds(1));
-  return (status == std::future_status::ready);
 }
 
-// Parallel (multi-threaded) implementation of MonteCarloSimulation.
-std::vector<RandomSimulationResult> MonteCarloSimulationParallel(
+// A worker thread of MonteCarloSimulationParallel, along with the sample it
+// has been assigned. All members other than `work_available` are guarded by
+// the pool's mutex whenever the worker is not idle.
+struct Worker {
+  SampleSimulator sample_simulator;
+  int sample{-1};
+  std::optional<RandomSimulationResult> result;
+  bool has_work{false};
+  std::condition_variable work_available;
+};
+
+// Parallel (multi-threaded) implementation of MonteCarloSimulation, using a
+// fixed pool of worker threads. Every use of `make_simulator` and `generator`
+// happens on the calling thread, in sample order, so that the results do not
+// depend on the number of threads; the calling thread hands each prepared
+// sample to the next idle worker, which runs the simulation. Results are
+// passed to `sink` (also on the calling thread) when the worker that produced
+// them is next found idle.
+void MonteCarloSimulationParallel(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
     const double final_time, const int num_samples,
-    RandomGenerator* const generator, const int num_threads) {
-  // Initialize storage for all simulation results. The full vector must be
-  // constructed up front (i.e. we can't use reserve()) to avoid a race
-  // condition on checking the size of the vector when the worker threads write
-  // simulation results.
-  std::vector<RandomSimulationResult> simulation_results(
-      num_samples, RandomSimulationResult(RandomGenerator()));
-
-  // Storage for active parallel simulation operations.
-  std::list<std::future<int>> active_operations;
-  // Keep track of how many simulations have been dispatched already.
-  int simulations_dispatched = 0;
-
-  while (active_operations.size() > 0 ||
-         simulations_dispatched < num_samples) {
-    // Check for completed operations.
-    for (auto operation = active_operations.begin();
-         operation != active_operations.end();) {
-      if (IsFutureReady(*operation)) {
-        // This call to future.get() is necessary to propagate any exception
-        // thrown during simulation execution.
-        const int sample_num = operation->get();
-        drake::log()->debug("Simulation {} completed", sample_num);
-        // Erase returns iterator to the next node in the list.
-        operation = active_operations.erase(operation);
-      } else {
-        // Advance to next node in the list.
-        ++operation;
+    RandomGenerator* const generator, const RandomSimulationResultSink& sink,
+    const bool reuse_simulators, const int num_threads) {
+  std::vector<Worker> workers(num_threads);
+  std::mutex mutex;
+  std::condition_variable worker_idle;
+  std::deque<int> idle_workers;
+  bool shutdown = false;
+  // The first exception thrown by a worker, if any.
+  std::exception_ptr worker_exception;
+
+  auto worker_loop = [&](const int worker_index) {
+    Worker& worker = workers[worker_index];
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        worker.work_available.wait(
+            lock, [&worker, &shutdown]() {
+              return worker.has_work || shutdown;
+            });
+        if (!worker.has_work) return;
+      }
+      try {
+        worker.result->output = RunSampleSimulation(
+            output, final_time, &worker.sample_simulator);
+        drake::log()->debug("Simulation {} completed", worker.sample);
+      } catch (...) {
+        worker.result.reset();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!worker_exception) worker_exception = std::current_exception();
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        worker.has_work = false;
+        idle_workers.push_back(worker_index);
       }
+      worker_idle.notify_one();
     }
+  };
 
-    // Dispatch new operations.
-    while (static_cast<int>(active_operations.size()) < num_threads
-           && simulations_dispatched < num_samples) {
-      // Create the simulation result using the current generator state.
-      simulation_results.at(simulations_dispatched) =
-          RandomSimulationResult(*generator);
-
-      // Make the simulator.
-      auto simulator = make_simulator(generator);
-      const auto& system = simulator->get_system();
-      system.SetRandomContext(&simulator->get_mutable_context(), generator);
-
-      auto perform_simulation =
-          [simulator = std::move(simulator), &simulation_results, &output,
-           final_time, sample_num = simulations_dispatched] () {
-        simulator->AdvanceTo(final_time);
-        simulation_results.at(sample_num).output =
-            output(simulator->get_system(), simulator->get_context());
-        return sample_num;
-      };
-
-      active_operations.emplace_back(
-          std::async(std::launch::async, std::move(perform_simulation)));
-      drake::log()->debug("Simulation {} dispatched", simulations_dispatched);
-      ++simulations_dispatched;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    idle_workers.push_back(i);
+    threads.emplace_back(worker_loop, i);
+  }
+
+  // Waits for all of the workers to become idle, then stops and joins them.
+  // This must happen before returning, even if an exception is thrown on the
+  // calling thread (e.g., by `make_simulator` or `sink`).
+  bool joined = false;
+  auto join_workers = [&]() {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      worker_idle.wait(lock, [&]() {
+        return static_cast<int>(idle_workers.size()) == num_threads;
+      });
+      shutdown = true;
+    }
+    for (Worker& worker : workers) worker.work_available.notify_one();
+    for (std::thread& thread : threads) thread.join();
+    joined = true;
+  };
+  ScopeExit guard([&]() {
+    if (!joined) join_workers();
+  });
+
+  // Passes the result of the sample most recently run by an idle worker (if
+  // any) to the sink.
+  auto deliver_result = [&sink](Worker* worker) {
+    if (worker->result.has_value()) {
+      sink(worker->sample, std::move(*worker->result));
+      worker->result.reset();
     }
+  };
 
-    // Wait a bit before checking for completion.
-    // TODO(calderpg-tri) When std::when_any([std::future,...]) or equivalent is
-    // available, this can be replaced.
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  for (int sample = 0; sample < num_samples; ++sample) {
+    // Only this thread removes workers from the idle queue, so the worker
+    // remains at its front until it is dispatched below. (Leaving it in the
+    // queue while its sample is prepared ensures that join_workers() does not
+    // wait on it should preparation throw.)
+    int worker_index{};
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      worker_idle.wait(lock, [&]() { return !idle_workers.empty(); });
+      if (worker_exception) break;
+      worker_index = idle_workers.front();
+    }
+    Worker& worker = workers[worker_index];
+    deliver_result(&worker);
+
+    // Create the simulation result using the current generator state, and
+    // prepare the simulator.
+    worker.sample = sample;
+    worker.result.emplace(*generator);
+    PrepareSampleSimulator(make_simulator, reuse_simulators, generator,
+                           &worker.sample_simulator);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      DRAKE_DEMAND(idle_workers.front() == worker_index);
+      idle_workers.pop_front();
+      worker.has_work = true;
+    }
+    worker.work_available.notify_one();
+    drake::log()->debug("Simulation {} dispatched", sample);
   }
 
-  return simulation_results;
-}
+  join_workers();
 
+  // Propagate any exception thrown during simulation execution.
+  if (worker_exception) std::rethrow_exception(worker_exception);
+
+  for (Worker& worker : workers) deliver_result(&worker);
+}
 }  // namespace
 
 namespace internal {
@@ -173,6 +294,24 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
     const double final_time, const int num_samples, RandomGenerator* generator,
     const int num_parallel_executions) {
+  std::vector<RandomSimulationResult> simulation_results(
+      num_samples, RandomSimulationResult(RandomGenerator()));
+  MonteCarloSimulation(
+      make_simulator, output, final_time, num_samples, generator,
+      [&simulation_results](int sample, RandomSimulationResult result) {
+        simulation_results.at(sample) = std::move(result);
+      },
+      num_parallel_executions);
+  return simulation_results;
+}
+
+void MonteCarloSimulation(
+    const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
+    const double final_time, const int num_samples, RandomGenerator* generator,
+    const RandomSimulationResultSink& sink, const int num_parallel_executions,
+    const bool reuse_simulators) {
+  DRAKE_THROW_UNLESS(sink != nullptr);
+
   // Create a generator if the user didn't provide one.
   std::unique_ptr<RandomGenerator> owned_generator;
   if (generator == nullptr) {
@@ -182,18 +321,20 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
 
   // Check num_parallel_executions vs the available hardware concurrency.
   // This also serves to sanity-check the num_parallel_executions argument.
-  const int num_threads =
-      internal::SelectNumberOfThreadsToUse(num_parallel_executions);
+  const int num_threads = std::min(
+      internal::SelectNumberOfThreadsToUse(num_parallel_executions),
+      std::max(num_samples, 1));
 
   // Since the parallel implementation incurs additional overhead even in the
   // num_threads=1 case, dispatch to the serial implementation in these cases.
   if (num_threads > 1) {
-    return MonteCarloSimulationParallel(
-        make_simulator, output, final_time, num_samples, generator,
-        num_threads);
+    MonteCarloSimulationParallel(
+        make_simulator, output, final_time, num_samples, generator, sink,
+        reuse_simulators, num_threads);
   } else {
-    return MonteCarloSimulationSerial(
-        make_simulator, output, final_time, num_samples, generator);
+    MonteCarloSimulationSerial(
+        make_simulator, output, final_time, num_samples, generator, sink,
+        reuse_simulators);
   }
 }
 
@@ -122,6 +122,14 @@ struct RandomSimulationResult {
   double output{};
 };
 
+/***
+ * Defines a function that consumes the results of MonteCarloSimulation() one
+ * sample at a time, as they become available.  The function receives the index
+ * of the sample (in the range [0, num_samples)) and its result.
+ */
+typedef std::function<void(int sample, RandomSimulationResult result)>
+    RandomSimulationResultSink;
+
 /**
  * Generates samples of a scalar random variable output by running many
  * random simulations drawn from independent samples of the
@@ -179,6 +187,58 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     double final_time, int num_samples, RandomGenerator* generator = nullptr,
     int num_parallel_executions = kNoConcurrency);
 
+/**
+ * Generates samples of a scalar random variable output, exactly as the
+ * MonteCarloSimulation() overload above does, but passes each
+ * RandomSimulationResult to @p sink during the run instead of returning all of
+ * them at the end.  When running in parallel, a result is handed over when the
+ * worker that produced it is next dispatched a sample, or once all samples
+ * have completed; at most one undelivered result per worker is held at a time.
+ * Use this variant when @p num_samples is large enough that holding every
+ * result in memory is undesirable.
+ *
+ * @see MonteCarloSimulation() for details about @p make_simulator, @p output,
+ * @p final_time, @p num_samples, @p generator, and @p num_parallel_executions.
+ *
+ * @param sink Called exactly once per sample with the sample's index and
+ * result.  When running in parallel, results are delivered in the order in
+ * which their workers are redispatched (see above), which need not be sample
+ * order.
+ *
+ * @param reuse_simulators If `false` (the default), @p make_simulator is
+ * called once per sample.  If `true`, it is called only once per worker
+ * thread, and each resulting Simulator (and its Context) is reused for all of
+ * the samples run by that worker: before each sample, the time, state, and
+ * parameters of the Context are restored to those of the Context supplied by
+ * @p make_simulator, SetRandomContext() is applied, and the Simulator is
+ * re-initialized.  This avoids repeatedly constructing Systems (e.g., large
+ * Diagrams) and Contexts, and yields the same results as `false`, but it is
+ * only possible when the System itself is not random.
+ * @throws std::exception if @p reuse_simulators is `true` and
+ * @p make_simulator uses its RandomGenerator argument.
+ *
+ * Thread safety when parallel execution is specified:
+ * - @p make_simulator, @p generator, and @p sink are only accessed from the
+ *   calling thread; in particular, @p sink is never called concurrently.
+ *
+ * - The simulations are run by a fixed pool of worker threads, which persists
+ *   for the duration of this call. Each simulator and its context are only
+ *   accessed from one worker thread at a time (but a reused simulator may be
+ *   accessed by the calling thread, to prepare its next sample, in between);
+ *   any resource shared between simulators must be safe for concurrent use.
+ *
+ * - @p output is called from within worker threads, as described for
+ *   MonteCarloSimulation() above.
+ *
+ * @ingroup analysis
+ */
+void MonteCarloSimulation(
+    const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
+    double final_time, int num_samples, RandomGenerator* generator,
+    const RandomSimulationResultSink& sink,
+    int num_parallel_executions = kNoConcurrency,
+    bool reuse_simulators = false);
+
 // The below functions are exposed for unit testing only.
 namespace internal {
 
@@ -5,9 +5,35 @@
 #include "drake/common/extract_double.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/framework/diagram_context.h"
 
 namespace drake {
 namespace systems {
+namespace {
+
+// Fixes each input port of `target` (and, for a Diagram, of its subcontexts)
+// that is fixed in `source`, to the same value. The two contexts must have
+// the same structure.
+template <typename T>
+void FixSameInputPorts(const Context<T>& source, Context<T>* target) {
+  for (int i = 0; i < source.num_input_ports(); ++i) {
+    const FixedInputPortValue* value = source.MaybeGetFixedInputPortValue(i);
+    if (value != nullptr) {
+      target->FixInputPort(i, value->get_value());
+    }
+  }
+  const auto* diagram_source = dynamic_cast<const DiagramContext<T>*>(&source);
+  if (diagram_source == nullptr) {
+    return;
+  }
+  auto& diagram_target = dynamic_cast<DiagramContext<T>&>(*target);
+  for (SubsystemIndex i(0); i < diagram_source->num_subcontexts(); ++i) {
+    FixSameInputPorts(diagram_source->GetSubsystemContext(i),
+                      &diagram_target.GetMutableSubsystemContext(i));
+  }
+}
+
+}  // namespace
 
 template <typename T>
 Simulator<T>::Simulator(const System<T>& system,
@@ -95,6 +121,11 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   timed_events_ = system_.AllocateCompositeEventCollection();
   DRAKE_DEMAND(timed_events_ != nullptr);
 
+  // Allocate the scratch used by set_interpolate_publish_events(). The
+  // lookahead context is created on first use, since it must match context_.
+  lookahead_events_ = system_.AllocateCompositeEventCollection();
+  lookahead_context_.reset();
+
   // Ensure that CalcNextUpdateTime() can return the current time by perturbing
   // current time as slightly toward negative infinity as we can allow.
   const T slightly_before_current_time =
@@ -266,6 +297,27 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
       next_publish_time = time_of_next_timed_event;
     }
 
+    // If requested, publish-only events do not limit the step; they are
+    // dispatched after it, at interpolated states. The step must then still
+    // end at the first update event beyond them (if any).
+    const bool interpolate_publishes =
+        interpolate_publish_events_ && isfinite(next_publish_time) &&
+        !isfinite(next_update_time) &&
+        context_->num_continuous_states() > 0 &&
+        isfinite(integrator_->get_maximum_step_size());
+    if (interpolate_publishes) {
+      using std::min;
+      next_update_time = CalcNextUpdateTimeAfterPublishes(
+          next_publish_time,
+          min(boundary_time,
+              step_start_time + integrator_->get_maximum_step_size()));
+      next_publish_time = std::numeric_limits<double>::infinity();
+      const VectorBase<T>& xcdot =
+          system_.EvalTimeDerivatives(*context_).get_vector();
+      xcdot0_.resize(xcdot.size());
+      xcdot.CopyToPreSizedVector(&xcdot0_);
+    }
+
     // Integrate the continuous state forward in time. Note that if
     // time_of_next_timed_event is the current time, this will return
     // immediately without time having advanced. That still counts as a step.
@@ -275,6 +327,11 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
         boundary_time,
         witnessed_events_.get());
 
+    if (interpolate_publishes) {
+      HandleInterpolatedPublishes(step_start_time, time_of_next_timed_event,
+                                  next_update_time);
+    }
+
     // Update the number of simulation steps taken.
     ++num_steps_taken_;
 
@@ -417,7 +474,7 @@ void Simulator<T>::IsolateWitnessTriggers(
     return;
 
   // Mini function for integrating the system forward in time from t0.
-  std::function<void(const T&)> integrate_forward =
+  auto integrate_forward =
       [&t0, &x0, &context, this](const T& t_des) {
     const T inf = std::numeric_limits<double>::infinity();
     context.SetTime(t0);
@@ -434,7 +491,8 @@ void Simulator<T>::IsolateWitnessTriggers(
   DRAKE_LOGGER_DEBUG(
       "Isolating witness functions using isolation window of {} over [{}, {}]",
       witness_iso_len.value(), t0, tf);
-  VectorX<T> wc(witnesses.size());
+  VectorX<T>& wc = wc_;
+  wc.resize(witnesses.size());
   T a = t0;
   T b = tf;
   do {
@@ -477,16 +535,16 @@ void Simulator<T>::IsolateWitnessTriggers(
   }
 }
 
-// Evaluates the given vector of witness functions.
+// Evaluates the given vector of witness functions into `weval`, which is
+// resized only if the number of witness functions has changed.
 template <class T>
-VectorX<T> Simulator<T>::EvaluateWitnessFunctions(
+void Simulator<T>::EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const {
+    const Context<T>& context, VectorX<T>* weval) const {
   const System<T>& system = get_system();
-  VectorX<T> weval(witness_functions.size());
+  weval->resize(witness_functions.size());
   for (size_t i = 0; i < witness_functions.size(); ++i)
-    weval[i] = system.CalcWitnessValue(context, *witness_functions[i]);
-  return weval;
+    (*weval)[i] = system.CalcWitnessValue(context, *witness_functions[i]);
 }
 
 // Determines whether at least one of a collection of witness functions
@@ -574,14 +632,17 @@ Simulator<T>::IntegrateContinuousState(
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const VectorBase<T>& xc = context.get_continuous_state_vector();
+  x0_.resize(xc.size());
+  xc.CopyToPreSizedVector(&x0_);
+  const VectorX<T>& x0 = x0_;
 
   // Get the set of witness functions active at the current state.
   RedetermineActiveWitnessFunctionsIfNecessary();
   const auto& witness_functions = *witness_functions_;
 
   // Evaluate the witness functions.
-  w0_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &w0_);
 
   // Attempt to integrate. Updates and boundary times are consciously
   // distinguished between. See internal documentation for
@@ -592,7 +653,7 @@ Simulator<T>::IntegrateContinuousState(
   const T tf = context.get_time();
 
   // Evaluate the witness functions again.
-  wf_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &wf_);
 
   // Triggering requires isolating the witness function time.
   if (DidWitnessTrigger(witness_functions, w0_, wf_, &triggered_witnesses_)) {
@@ -689,6 +750,85 @@ Simulator<T>::IntegrateContinuousState(
   DRAKE_UNREACHABLE();
 }
 
+template <class T>
+T Simulator<T>::CalcNextUpdateTimeAfterPublishes(const T& publish_time,
+                                                 const T& horizon) {
+  // Avoid copying the Context when no publish falls within the horizon; the
+  // step then is not limited by the lookahead at all.
+  if (publish_time > horizon) {
+    return std::numeric_limits<double>::infinity();
+  }
+  if (lookahead_context_ == nullptr) {
+    // Rather than a Clone(), which would also copy context_'s cache values,
+    // some of which may not be copyable (e.g., a VectorLogSink log that has
+    // spilled to disk). Only the state and fixed inputs matter here.
+    lookahead_context_ = system_.CreateDefaultContext();
+    FixSameInputPorts(*context_, lookahead_context_.get());
+  }
+  lookahead_context_->SetFrom(*context_);
+  T time = publish_time;
+  while (time <= horizon) {
+    lookahead_context_->SetTime(time);
+    time = system_.CalcNextUpdateTime(*lookahead_context_,
+                                      lookahead_events_.get());
+    if (lookahead_events_->HasDiscreteUpdateEvents() ||
+        lookahead_events_->HasUnrestrictedUpdateEvents()) {
+      return time;
+    }
+  }
+  return std::numeric_limits<double>::infinity();
+}
+
+template <class T>
+void Simulator<T>::HandleInterpolatedPublishes(const T& t0,
+                                               const T& publish_time,
+                                               const T& update_time) {
+  const T tf = context_->get_time();
+  if (publish_time > tf) return;
+
+  const VectorBase<T>& xc = context_->get_continuous_state_vector();
+  xcf_.resize(xc.size());
+  xc.CopyToPreSizedVector(&xcf_);
+  const VectorBase<T>& xcdot =
+      system_.EvalTimeDerivatives(*context_).get_vector();
+  xcdotf_.resize(xcdot.size());
+  xcdot.CopyToPreSizedVector(&xcdotf_);
+
+  const T h = tf - t0;
+  T time = publish_time;
+  while (time <= tf && !timed_events_->HasDiscreteUpdateEvents() &&
+         !timed_events_->HasUnrestrictedUpdateEvents()) {
+    if (time == tf) {
+      xc_interpolated_ = xcf_;
+    } else {
+      // The cubic Hermite basis functions on [t0, tf].
+      const T s = (time - t0) / h;
+      const T s2 = s * s;
+      const T s3 = s2 * s;
+      xc_interpolated_ = (2 * s3 - 3 * s2 + 1) * x0_ +
+                         ((s3 - 2 * s2 + s) * h) * xcdot0_ +
+                         (3 * s2 - 2 * s3) * xcf_ + ((s3 - s2) * h) * xcdotf_;
+    }
+    context_->SetTimeAndContinuousState(time, xc_interpolated_);
+    HandlePublish(timed_events_->get_publish_events());
+    time = system_.CalcNextUpdateTime(*context_, timed_events_.get());
+  }
+  context_->SetTimeAndContinuousState(tf, xcf_);
+
+  // The events now in timed_events_ must agree with the lookahead that chose
+  // the end of the step: an update may not have been stepped over, and if the
+  // step ended at an update, that update must be what comes next.
+  const bool has_update = timed_events_->HasDiscreteUpdateEvents() ||
+                          timed_events_->HasUnrestrictedUpdateEvents();
+  if (time < tf || (tf == update_time && !(has_update && time == tf))) {
+    throw std::logic_error(fmt::format(
+        "Simulator: the timed events after time {} changed while publishing "
+        "at interpolated states; set_interpolate_publish_events() requires "
+        "that event times not depend on the continuous state.",
+        publish_time));
+  }
+}
+
 template <typename T>
 void Simulator<T>::PauseIfTooFast() const {
   if (target_realtime_rate_ <= 0) return;  // Run at full speed.
@@ -532,6 +532,40 @@ class Simulator {
   /// enabled. By default, returns false.
   bool get_publish_every_time_step() const { return publish_every_time_step_; }
 
+  /// Sets whether timed (periodic or one-shot) publish events are allowed to
+  /// fall in the middle of an integration step. By default (false), the
+  /// Simulator ends a continuous integration step at the time of every timed
+  /// publish event, so that a high-rate publisher (e.g., for visualization or
+  /// logging) limits the step size of even an error-controlled integrator.
+  ///
+  /// When enabled, a timed event that consists only of publishes no longer
+  /// limits the step. Instead, after each step the Simulator dispatches every
+  /// publish event whose time the step passed over, in order, with the
+  /// Context temporarily set to that time and to the continuous state
+  /// interpolated by the cubic Hermite polynomial that matches the state and
+  /// its time derivative at both ends of the step (the same interpolant as
+  /// the integrator's dense output). The Context is then restored to the end
+  /// of the step. Discrete and unrestricted update events, and publish events
+  /// that coincide with them, still end the step exactly at their time, as do
+  /// per-step and witness-triggered events.
+  ///
+  /// The interpolated values are only as accurate as the interpolant, which
+  /// is third order in the step size, so the published data may be less
+  /// accurate than the integrated trajectory. Publish event handlers must not
+  /// rely on the state being exactly on the integrated trajectory.
+  ///
+  /// Enabling this has no effect on systems without continuous state, or when
+  /// the integrator's maximum step size is infinite.
+  void set_interpolate_publish_events(bool interpolate) {
+    interpolate_publish_events_ = interpolate;
+  }
+
+  /// Returns true if the set_interpolate_publish_events() option has been
+  /// enabled. By default, returns false.
+  bool get_interpolate_publish_events() const {
+    return interpolate_publish_events_;
+  }
+
   /// Returns a const reference to the internally-maintained Context holding the
   /// most recent step in the trajectory. This is suitable for publishing or
   /// extracting information about this trajectory step. Do not call this method
@@ -742,6 +776,21 @@ class Simulator {
       const T& boundary_time,
       CompositeEventCollection<T>* witnessed_events);
 
+  // Support for set_interpolate_publish_events(). Given that the timed events
+  // due at `publish_time` are publishes only, returns the time of the first
+  // timed event after that which includes an update, or infinity if there is
+  // none before `horizon`.
+  T CalcNextUpdateTimeAfterPublishes(const T& publish_time,
+                                     const T& horizon);
+
+  // Support for set_interpolate_publish_events(). Dispatches, at interpolated
+  // states, the publish-only timed events from `publish_time` up to the end
+  // of the step that just finished, which started at time `t0` with state
+  // x0_ and time derivatives xcdot0_ and was limited by an update event at
+  // `update_time`. Leaves timed_events_ holding the first events after those.
+  void HandleInterpolatedPublishes(const T& t0, const T& publish_time,
+                                   const T& update_time);
+
   // Private methods related to witness functions.
   void IsolateWitnessTriggers(
       const std::vector<const WitnessFunction<T>*>& witnesses,
@@ -756,9 +805,9 @@ class Simulator {
     const VectorX<T>& w0,
     const VectorX<T>& wf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses);
-  VectorX<T> EvaluateWitnessFunctions(
+  void EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const;
+    const Context<T>& context, VectorX<T>* weval) const;
   void RedetermineActiveWitnessFunctionsIfNecessary();
 
   // The steady_clock is immune to system clock changes so increases
@@ -790,15 +839,32 @@ class Simulator {
   const System<T>& system_;              // Just a reference; not owned.
   std::unique_ptr<Context<T>> context_;  // The trajectory Context.
 
-  // Temporaries used for witness function isolation.
+  // Temporaries used for witness function isolation. These (and x0_) are
+  // members rather than locals so that steady-state stepping does not touch
+  // the heap.
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
-  VectorX<T> w0_, wf_;
+  VectorX<T> w0_, wf_, wc_;
+
+  // The continuous state at the start of the current step.
+  VectorX<T> x0_;
+
+  // Temporaries used for set_interpolate_publish_events(): the time
+  // derivatives at the start of the step, the state and time derivatives at
+  // its end, and the interpolated state.
+  VectorX<T> xcdot0_, xcf_, xcdotf_, xc_interpolated_;
+
+  // A scratch Context, and events, used to look for the next update event
+  // beyond a sequence of publish events without disturbing context_.
+  std::unique_ptr<Context<T>> lookahead_context_;
+  std::unique_ptr<CompositeEventCollection<T>> lookahead_events_;
 
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{SimulatorConfig{}.target_realtime_rate};
 
   bool publish_every_time_step_{SimulatorConfig{}.publish_every_time_step};
 
+  bool interpolate_publish_events_{false};
+
   bool publish_at_initialization_{SimulatorConfig{}.publish_every_time_step};
 
   // These are recorded at initialization or statistics reset.
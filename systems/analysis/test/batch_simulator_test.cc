@@ -0,0 +1,188 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_output_port.h"
+#include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/primitives/matrix_gain.h"
+#include "drake/systems/primitives/multilayer_perceptron.h"
+#include "drake/systems/primitives/zero_order_hold.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Matrix2d;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+// A double integrator stabilized by full-state feedback, u = -Kx.
+std::unique_ptr<Diagram<double>> MakeClosedLoop() {
+  DiagramBuilder<double> builder;
+  Matrix2d A;
+  A << 0, 1, 0, 0;
+  const Eigen::Vector2d B(0, 1);
+  auto plant = builder.AddSystem<LinearSystem<double>>(
+      A, B, Matrix2d::Identity(), Vector2d::Zero());
+  plant->set_name("plant");
+  auto controller =
+      builder.AddSystem<MatrixGain<double>>(Eigen::RowVector2d(-2.0, -3.0));
+  controller->set_name("controller");
+  builder.Connect(plant->get_output_port(), controller->get_input_port());
+  builder.Connect(controller->get_output_port(), plant->get_input_port());
+  builder.ExportOutput(controller->get_output_port(), "u");
+  return builder.Build();
+}
+
+// Returns `num_instances` contexts with distinct initial states.
+std::vector<std::unique_ptr<Context<double>>> MakeContexts(
+    const System<double>& system, int num_instances) {
+  std::vector<std::unique_ptr<Context<double>>> contexts;
+  for (int k = 0; k < num_instances; ++k) {
+    contexts.push_back(system.CreateDefaultContext());
+    contexts.back()->SetContinuousState(Vector2d(1.0 + k, -0.5 * k));
+  }
+  return contexts;
+}
+
+// The lockstep simulation matches independent fixed-step RK2 simulations.
+GTEST_TEST(BatchSimulatorTest, MatchesSimulator) {
+  const auto diagram = MakeClosedLoop();
+  constexpr int kNumInstances = 5;
+  constexpr double kTimeStep = 0.01;
+  BatchSimulator<double> dut(*diagram, MakeContexts(*diagram, kNumInstances),
+                             kTimeStep);
+  EXPECT_EQ(&dut.get_system(), diagram.get());
+  EXPECT_EQ(dut.num_instances(), kNumInstances);
+  EXPECT_EQ(dut.get_time_step(), kTimeStep);
+  dut.AdvanceTo(1.0);
+  EXPECT_EQ(dut.get_time(), 1.0);
+  EXPECT_EQ(dut.get_num_steps_taken(), 100);
+
+  auto expected_contexts = MakeContexts(*diagram, kNumInstances);
+  for (int k = 0; k < kNumInstances; ++k) {
+    Simulator<double> simulator(*diagram, std::move(expected_contexts[k]));
+    simulator.reset_integrator<RungeKutta2Integrator<double>>(kTimeStep);
+    simulator.AdvanceTo(1.0);
+    EXPECT_TRUE(CompareMatrices(
+        dut.get_context(k).get_continuous_state_vector().CopyToVector(),
+        simulator.get_context().get_continuous_state_vector().CopyToVector(),
+        1e-12));
+  }
+
+  // Advancing to a time that is not a multiple of the step lands on it.
+  dut.AdvanceTo(1.025);
+  EXPECT_EQ(dut.get_time(), 1.025);
+  EXPECT_EQ(dut.get_num_steps_taken(), 103);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.AdvanceTo(0.5),
+                              ".*0.5 is earlier than the current time.*");
+  EXPECT_THROW(dut.get_context(kNumInstances), std::exception);
+}
+
+// A diagram's batch output matches its per-context output, and leaves the
+// value cached.
+GTEST_TEST(BatchSimulatorTest, DiagramOutputBatch) {
+  const auto diagram = MakeClosedLoop();
+  auto contexts = MakeContexts(*diagram, 3);
+  std::vector<const Context<double>*> pointers;
+  for (const auto& context : contexts) {
+    pointers.push_back(context.get());
+  }
+  diagram->EvalOutputBatch(OutputPortIndex(0), pointers);
+  const auto& controller = dynamic_cast<const MatrixGain<double>&>(
+      diagram->GetSubsystemByName("controller"));
+  const auto& port = dynamic_cast<const LeafOutputPort<double>&>(
+      controller.get_output_port());
+  for (int k = 0; k < 3; ++k) {
+    const Context<double>& subcontext =
+        controller.GetMyContextFromRoot(*contexts[k]);
+    EXPECT_FALSE(port.cache_entry().is_out_of_date(subcontext));
+    const Vector2d x(1.0 + k, -0.5 * k);
+    EXPECT_NEAR(diagram->get_output_port().Eval(*contexts[k])[0],
+                -2.0 * x[0] - 3.0 * x[1], 1e-14);
+  }
+
+  // Evaluating again (with every value already cached) is harmless.
+  diagram->EvalOutputBatch(OutputPortIndex(0), pointers);
+  EXPECT_NEAR(diagram->get_output_port().Eval(*contexts[0])[0], -2.0, 1e-14);
+}
+
+// The perceptron evaluates a batch in one pass when the parameters are
+// shared, and one context at a time otherwise; both match per-context
+// evaluation.
+GTEST_TEST(BatchSimulatorTest, PerceptronOutputBatch) {
+  const MultilayerPerceptron<double> mlp({2, 4, 3});
+  RandomGenerator generator(1234);
+  auto prototype = mlp.CreateDefaultContext();
+  mlp.SetRandomContext(prototype.get(), &generator);
+
+  std::vector<std::unique_ptr<Context<double>>> contexts;
+  std::vector<const Context<double>*> pointers;
+  for (int k = 0; k < 4; ++k) {
+    contexts.push_back(prototype->Clone());
+    mlp.get_input_port().FixValue(contexts.back().get(),
+                                  Vector2d(0.1 * k, 1.0 - 0.3 * k));
+    pointers.push_back(contexts.back().get());
+  }
+
+  const auto expect_matches_per_context = [&]() {
+    const auto& port =
+        dynamic_cast<const LeafOutputPort<double>&>(mlp.get_output_port());
+    for (const auto& context : contexts) {
+      EXPECT_FALSE(port.cache_entry().is_out_of_date(*context));
+      auto fresh = context->Clone();
+      fresh->get_mutable_cache().SetAllEntriesOutOfDate();
+      EXPECT_TRUE(CompareMatrices(mlp.get_output_port().Eval(*context),
+                                  mlp.get_output_port().Eval(*fresh), 1e-14));
+    }
+  };
+
+  mlp.EvalOutputBatch(OutputPortIndex(0), pointers);
+  expect_matches_per_context();
+
+  // Perturbing one instance's parameters disables the shared-weights path
+  // but still gives the same answers.
+  VectorXd params = mlp.GetParameters(*contexts[2]);
+  params[0] += 0.5;
+  mlp.SetParameters(contexts[2].get(), params);
+  mlp.EvalOutputBatch(OutputPortIndex(0), pointers);
+  expect_matches_per_context();
+}
+
+GTEST_TEST(BatchSimulatorTest, Errors) {
+  const auto diagram = MakeClosedLoop();
+  constexpr double kTimeStep = 0.01;
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchSimulator<double>(*diagram, {}, kTimeStep), ".*empty.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchSimulator<double>(*diagram, MakeContexts(*diagram, 2), 0.0),
+      ".*time_step.*");
+
+  auto contexts = MakeContexts(*diagram, 2);
+  contexts[1]->SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchSimulator<double>(*diagram, std::move(contexts), kTimeStep),
+      ".*same time.*");
+
+  const ZeroOrderHold<double> zoh(0.1, 1);
+  std::vector<std::unique_ptr<Context<double>>> zoh_contexts;
+  zoh_contexts.push_back(zoh.CreateDefaultContext());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchSimulator<double>(zoh, std::move(zoh_contexts), kTimeStep),
+      ".*discrete or abstract state.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -2,8 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
+#include "drake/systems/framework/leaf_system.h"
 
+using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 namespace drake {
@@ -21,7 +24,10 @@ class DummyImplicitIntegrator final : public ImplicitIntegrator<double> {
   bool supports_error_estimation() const override { return false; }
   int get_error_estimate_order() const override { return 0; }
 
+  using ImplicitIntegrator<double>::CalcJacobian;
   using ImplicitIntegrator<double>::IsUpdateZero;
+  using ImplicitIntegrator<double>::IterationMatrix;
+  using ImplicitIntegrator<double>::JacobianSparsity;
 
   // Returns whether DoResetCachedMatrices() has been called.
   bool get_has_reset_cached_matrices() {
@@ -135,6 +141,147 @@ GTEST_TEST(ImplicitIntegratorTest, SetComputationSchemeResetsCachedMatrices) {
             ImplicitIntegrator<double>
             ::JacobianComputationScheme::kAutomatic);
 }
+
+// A chain of n nonlinearly coupled states, each of which depends only upon
+// itself and its immediate neighbors, giving a tridiagonal Jacobian matrix.
+class ChainSystem final : public LeafSystem<double> {
+ public:
+  explicit ChainSystem(int n) {
+    this->DeclareContinuousState(n);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorXd x = context.get_continuous_state_vector().CopyToVector();
+    const int n = x.size();
+    VectorXd xdot(n);
+    for (int i = 0; i < n; ++i) {
+      const double left = (i > 0) ? x[i - 1] : 0.0;
+      const double right = (i < n - 1) ? x[i + 1] : 0.0;
+      xdot[i] = left - 2 * x[i] + right - x[i] * x[i] * x[i];
+    }
+    derivatives->SetFromVector(xdot);
+  }
+};
+
+// Verifies that, once the sparsity pattern of the Jacobian has been
+// discovered, compressed differencing needs only one derivative evaluation per
+// color (plus the unperturbed one for forward differencing) and reproduces the
+// dense Jacobian.
+GTEST_TEST(ImplicitIntegratorTest, SparseJacobian) {
+  const int n = 30;
+  ChainSystem chain(n);
+  std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+  VectorXd x(n);
+  for (int i = 0; i < n; ++i) x[i] = std::sin(i + 1.0);
+  context->SetContinuousState(x);
+  DummyImplicitIntegrator integrator(chain, context.get());
+  EXPECT_FALSE(integrator.get_use_sparse_jacobian());
+
+  // The dense Jacobian, for comparison.
+  const MatrixXd J_dense = integrator.CalcJacobian(0.0, x);
+  EXPECT_EQ(integrator.get_num_derivative_evaluations_for_jacobian(), n + 1);
+
+  using Scheme = ImplicitIntegrator<double>::JacobianComputationScheme;
+  for (const Scheme scheme :
+       {Scheme::kForwardDifference, Scheme::kCentralDifference}) {
+    integrator.set_jacobian_computation_scheme(scheme);
+    integrator.set_use_sparse_jacobian(true);
+    EXPECT_TRUE(integrator.get_use_sparse_jacobian());
+    const int evals_per_color = (scheme == Scheme::kCentralDifference) ? 2 : 1;
+    const int unperturbed_evals =
+        (scheme == Scheme::kCentralDifference) ? 0 : 1;
+
+    // The first Jacobian is computed densely to discover the sparsity pattern.
+    // (The dense methods always evaluate the unperturbed derivatives.)
+    integrator.ResetStatistics();
+    const MatrixXd J_probe = integrator.CalcJacobian(0.0, x);
+    EXPECT_EQ(integrator.get_num_derivative_evaluations_for_jacobian(),
+              evals_per_color * n + 1);
+
+    // A tridiagonal matrix needs three colors.
+    integrator.ResetStatistics();
+    const MatrixXd J_colored = integrator.CalcJacobian(0.0, x);
+    EXPECT_EQ(integrator.get_num_derivative_evaluations_for_jacobian(),
+              evals_per_color * 3 + unperturbed_evals);
+    EXPECT_TRUE(CompareMatrices(J_colored, J_probe, 1e-14));
+    EXPECT_TRUE(CompareMatrices(J_colored, J_dense, 1e-6));
+
+    // Turning sparsity off (and back on) forces rediscovery.
+    integrator.set_use_sparse_jacobian(false);
+  }
+}
+
+// Verifies the coloring computed for a known sparsity pattern.
+GTEST_TEST(ImplicitIntegratorTest, JacobianSparsityColoring) {
+  // Columns 0 and 3 share row 0, columns 1 and 2 share row 2; columns 0 and 1
+  // share no row (and neither do 2 and 3 or 0 and 2), so two colors suffice.
+  MatrixXd J(4, 4);
+  // clang-format off
+  J << 1, 0, 0, 1,
+       0, 1, 0, 0,
+       0, 1, 1, 0,
+       0, 0, 0, 1;
+  // clang-format on
+  DummyImplicitIntegrator::JacobianSparsity sparsity;
+  EXPECT_EQ(sparsity.size(), 0);
+  sparsity.SetFromJacobian(J);
+  EXPECT_EQ(sparsity.size(), 4);
+  EXPECT_EQ(sparsity.num_colors(), 2);
+  EXPECT_EQ(sparsity.column_rows(0), std::vector<int>({0}));
+  EXPECT_EQ(sparsity.column_rows(1), std::vector<int>({1, 2}));
+  EXPECT_EQ(sparsity.column_rows(3), std::vector<int>({0, 3}));
+  EXPECT_EQ(sparsity.color_columns(0), std::vector<int>({0, 1}));
+  EXPECT_EQ(sparsity.color_columns(1), std::vector<int>({2, 3}));
+
+  // A dense matrix requires as many colors as columns.
+  sparsity.SetFromJacobian(MatrixXd::Ones(3, 3));
+  EXPECT_EQ(sparsity.num_colors(), 3);
+  sparsity.clear();
+  EXPECT_EQ(sparsity.size(), 0);
+}
+
+// Verifies that the sparse factorization of the iteration matrix yields the
+// same solutions as the dense one, including after refactoring a matrix with
+// the same (or a different) sparsity pattern.
+GTEST_TEST(ImplicitIntegratorTest, SparseIterationMatrix) {
+  const int n = 20;
+  MatrixXd A = MatrixXd::Identity(n, n);
+  for (int i = 0; i < n - 1; ++i) {
+    A(i, i + 1) = 0.3;
+    A(i + 1, i) = -0.2;
+  }
+  const VectorXd b = VectorXd::LinSpaced(n, -1.0, 1.0);
+
+  DummyImplicitIntegrator::IterationMatrix dense, sparse;
+  sparse.set_use_sparse_factorization(true);
+  dense.SetAndFactorIterationMatrix(A);
+  sparse.SetAndFactorIterationMatrix(A);
+  EXPECT_FALSE(dense.is_factorization_sparse());
+  EXPECT_TRUE(sparse.is_factorization_sparse());
+  EXPECT_TRUE(CompareMatrices(sparse.Solve(b), dense.Solve(b), 1e-14));
+
+  // Same pattern, different values.
+  A.diagonal() *= 2.0;
+  dense.SetAndFactorIterationMatrix(A);
+  sparse.SetAndFactorIterationMatrix(A);
+  EXPECT_TRUE(CompareMatrices(sparse.Solve(b), dense.Solve(b), 1e-14));
+
+  // Different pattern.
+  A(0, n - 1) = 0.1;
+  dense.SetAndFactorIterationMatrix(A);
+  sparse.SetAndFactorIterationMatrix(A);
+  EXPECT_TRUE(CompareMatrices(sparse.Solve(b), dense.Solve(b), 1e-14));
+
+  // A singular matrix cannot be factored sparsely; the dense factorization is
+  // used instead.
+  sparse.SetAndFactorIterationMatrix(MatrixXd::Zero(n, n));
+  EXPECT_TRUE(sparse.matrix_factored());
+  EXPECT_FALSE(sparse.is_factorization_sparse());
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
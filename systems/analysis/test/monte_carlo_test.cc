@@ -1,12 +1,15 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <atomic>
 #include <cmath>
 #include <thread>
+#include <unordered_set>
 
 #include <gtest/gtest.h>
 
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/framework/vector_system.h"
 #include "drake/systems/primitives/constant_vector_source.h"
 #include "drake/systems/primitives/pass_through.h"
@@ -219,6 +222,151 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// Checks that the streaming MonteCarloSimulation delivers every sample
+// exactly once and produces the same results as the non-streaming version,
+// whether or not simulators are reused.
+GTEST_TEST(MonteCarloSimulationTest, StreamingResults) {
+  std::atomic<int> num_simulators_made{0};
+  const SimulatorFactory make_simulator =
+      [&num_simulators_made](RandomGenerator*) {
+        ++num_simulators_made;
+        auto system = std::make_unique<RandomContextSystem>();
+        return std::make_unique<Simulator<double>>(std::move(system));
+      };
+  const double final_time = 0.1;
+  const int num_samples = 50;
+
+  const RandomGenerator prototype_generator;
+  RandomGenerator expected_generator(prototype_generator);
+  const auto expected_results = MonteCarloSimulation(
+      make_simulator, &GetScalarOutput, final_time, num_samples,
+      &expected_generator);
+
+  for (const int num_parallel_executions : {kNoConcurrency, kTestConcurrency}) {
+    for (const bool reuse_simulators : {false, true}) {
+      SCOPED_TRACE(fmt::format("num_parallel_executions = {}, reuse = {}",
+                               num_parallel_executions, reuse_simulators));
+      num_simulators_made = 0;
+      std::vector<int> times_delivered(num_samples, 0);
+      std::vector<double> outputs(num_samples);
+      RandomGenerator generator(prototype_generator);
+      MonteCarloSimulation(
+          make_simulator, &GetScalarOutput, final_time, num_samples,
+          &generator,
+          [&](int sample, RandomSimulationResult result) {
+            ++times_delivered.at(sample);
+            outputs.at(sample) = result.output;
+            // The snapshot reproduces the sample.
+            EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput,
+                                       final_time, &result.generator_snapshot),
+                      result.output);
+          },
+          num_parallel_executions, reuse_simulators);
+
+      for (int sample = 0; sample < num_samples; ++sample) {
+        EXPECT_EQ(times_delivered[sample], 1);
+        EXPECT_EQ(outputs[sample], expected_results[sample].output);
+      }
+
+      // Each worker makes only one simulator when reusing; otherwise one is
+      // made per sample (plus one per reproduction above).
+      if (reuse_simulators) {
+        EXPECT_EQ(num_simulators_made, num_samples + num_parallel_executions);
+      } else {
+        EXPECT_EQ(num_simulators_made, 2 * num_samples);
+      }
+
+      // The generator has been advanced exactly as in the non-streaming case.
+      EXPECT_EQ(generator(), RandomGenerator(expected_generator)());
+    }
+  }
+}
+
+// Reusing simulators is not possible when the System itself is random.
+GTEST_TEST(MonteCarloSimulationTest, ReuseWithRandomSimulatorThrows) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    std::normal_distribution<> distribution;
+    auto system = std::make_unique<ConstantVectorSource<double>>(
+        distribution(*generator));
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  for (const int num_parallel_executions : {kNoConcurrency, kTestConcurrency}) {
+    RandomGenerator generator;
+    EXPECT_THROW(MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, 0.1, 10, &generator,
+        [](int, RandomSimulationResult) {}, num_parallel_executions,
+        true /* reuse_simulators */),
+        std::exception);
+  }
+}
+
+// A System that counts how many times its initialization event is handled.
+class InitializationCountingSystem : public LeafSystem<double> {
+ public:
+  explicit InitializationCountingSystem(std::atomic<int>* num_initializations)
+      : num_initializations_(num_initializations) {
+    this->DeclareVectorOutputPort("zero", 1,
+                                  [](const Context<double>&,
+                                     BasicVector<double>* output) {
+                                    output->SetZero();
+                                  });
+    this->DeclareInitializationPublishEvent(
+        &InitializationCountingSystem::CountInitialization);
+  }
+
+ private:
+  EventStatus CountInitialization(const Context<double>&) const {
+    ++(*num_initializations_);
+    return EventStatus::Succeeded();
+  }
+
+  std::atomic<int>* const num_initializations_;
+};
+
+// Each sample handles initialization events exactly as often as the
+// equivalent RandomSimulation() does, whether or not simulators are reused
+// and whether or not the factory initializes the Simulator itself.
+GTEST_TEST(MonteCarloSimulationTest, InitializationEvents) {
+  std::atomic<int> num_initializations{0};
+  const double final_time = 0.1;
+  const int num_samples = 10;
+  for (const bool factory_initializes : {false, true}) {
+    const SimulatorFactory make_simulator =
+        [&num_initializations, factory_initializes](RandomGenerator*) {
+          auto simulator = std::make_unique<Simulator<double>>(
+              std::make_unique<InitializationCountingSystem>(
+                  &num_initializations));
+          if (factory_initializes) {
+            simulator->Initialize();
+          }
+          return simulator;
+        };
+
+    num_initializations = 0;
+    RandomGenerator expected_generator;
+    RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                     &expected_generator);
+    EXPECT_EQ(num_initializations, 1);
+
+    for (const int num_parallel_executions :
+         {kNoConcurrency, kTestConcurrency}) {
+      for (const bool reuse_simulators : {false, true}) {
+        SCOPED_TRACE(fmt::format(
+            "factory_initializes = {}, num_parallel_executions = {}, "
+            "reuse = {}",
+            factory_initializes, num_parallel_executions, reuse_simulators));
+        num_initializations = 0;
+        RandomGenerator generator;
+        MonteCarloSimulation(
+            make_simulator, &GetScalarOutput, final_time, num_samples,
+            &generator, [](int, RandomSimulationResult) {},
+            num_parallel_executions, reuse_simulators);
+        EXPECT_EQ(num_initializations, num_samples);
+      }
+    }
+  }
+}
+
 // Simple system that outputs constant scalar, where this scalar is stored in
 // the discrete state of the system.  The scalar value is randomized in
 // SetRandomState(). If the state value (cast to int) is odd, DoCalcVectorOutput
@@ -270,6 +418,22 @@ GTEST_TEST(MonteCarloSimulationExceptionTest, BasicTest) {
       make_simulator, &GetScalarOutput, final_time, num_samples,
       &parallel_generator, kTestConcurrency),
       std::exception);
+
+  // Exceptions thrown by the sink are also propagated (after the worker
+  // threads have been stopped).
+  const SimulatorFactory make_good_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  RandomGenerator sink_generator(prototype_generator);
+  EXPECT_THROW(MonteCarloSimulation(
+      make_good_simulator, &GetScalarOutput, final_time, num_samples,
+      &sink_generator,
+      [](int, RandomSimulationResult) {
+        throw std::runtime_error("Sink failure");
+      },
+      kTestConcurrency, true /* reuse_simulators */),
+      std::exception);
 }
 
 }  // namespace
@@ -51,10 +51,51 @@ class EventfulSystem final : public LeafSystem<double> {
   }
 };
 
+// A harmonic oscillator (q̈ = -q) with a periodic publish event and a witness
+// function. The witness never crosses zero, so it is evaluated on every step
+// but never triggers.
+class OscillatorWithWitness final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OscillatorWithWitness)
+
+  OscillatorWithWitness() {
+    DeclareContinuousState(1, 1, 0);
+    DeclarePeriodicPublishEvent(0.25, 0.0, &OscillatorWithWitness::Publish);
+    witness_ = MakeWitnessFunction(
+        "far away", WitnessFunctionDirection::kCrossesZero,
+        &OscillatorWithWitness::CalcWitness);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    VectorBase<double>& xdot = derivatives->get_mutable_vector();
+    xdot[0] = x[1];
+    xdot[1] = -x[0];
+  }
+
+  void DoGetWitnessFunctions(
+      const Context<double>&,
+      std::vector<const WitnessFunction<double>*>* witnesses) const final {
+    witnesses->push_back(witness_.get());
+  }
+
+  double CalcWitness(const Context<double>& context) const {
+    return context.get_continuous_state_vector()[0] - 10.0;
+  }
+
+  EventStatus Publish(const Context<double>&) const {
+    return EventStatus::Succeeded();
+  }
+
+  std::unique_ptr<WitnessFunction<double>> witness_;
+};
+
 // Tests that heap allocations do not occur from Simulator and the systems
 // framework for systems that do various event updates and do not have
 // continuous state.
-// TODO(rpoyner-tri): add testing for witness functions.
 GTEST_TEST(SimulatorLimitMallocTest,
            NoHeapAllocsInSimulatorForSystemsWithoutContinuousState) {
   // Build a Diagram containing the test system so we can test both Diagrams
@@ -84,6 +125,31 @@ GTEST_TEST(SimulatorLimitMallocTest,
   }
 }
 
+// Tests that, once warmed up, error-controlled integration of continuous state
+// with witness functions and timed events takes steps without heap
+// allocations.
+GTEST_TEST(SimulatorLimitMallocTest,
+           NoHeapAllocsInSimulatorForContinuousStateWithWitnesses) {
+  DiagramBuilder<double> builder;
+  builder.AddSystem<OscillatorWithWitness>();
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.get_mutable_context().SetContinuousState(
+      Eigen::Vector2d(1.0, 0.0));
+  // The first step sizes the integrator's and simulator's scratch storage.
+  simulator.AdvanceTo(0.5);
+  const int64_t num_steps_before = simulator.get_num_steps_taken();
+  {
+    test::LimitMalloc heap_alloc_checker({.max_num_allocations = 0});
+    simulator.AdvanceTo(1.0);
+    simulator.AdvanceTo(2.0);
+    simulator.AdvanceTo(3.0);
+  }
+  // Make sure that the guarded region did in fact take many steps.
+  EXPECT_GT(simulator.get_num_steps_taken() - num_steps_before, 10);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
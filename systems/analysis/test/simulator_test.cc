@@ -4,6 +4,8 @@
 #include <complex>
 #include <functional>
 #include <map>
+#include <optional>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -12,6 +14,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
 #include "drake/common/text_logging.h"
@@ -1727,6 +1730,176 @@ GTEST_TEST(SimulatorTest, UpdateThenPublishThenIntegrate) {
   EXPECT_TRUE(triggers[kIntegrate]);
 }
 
+// A harmonic oscillator (q̈ = -q) that records the time and position at each
+// of its 1 kHz periodic publishes and, optionally, at each of its slower
+// periodic discrete updates.
+class PublishingOscillator final : public LeafSystem<double> {
+ public:
+  static constexpr double kPublishPeriod = 0.001;
+
+  explicit PublishingOscillator(std::optional<double> update_period) {
+    this->DeclareContinuousState(1, 1, 0);
+    this->DeclarePeriodicPublishEvent(kPublishPeriod, 0.0,
+                                      &PublishingOscillator::Record);
+    if (update_period.has_value()) {
+      this->DeclareDiscreteState(1);
+      this->DeclarePeriodicDiscreteUpdateEvent(
+          *update_period, 0.0, &PublishingOscillator::Update);
+    }
+  }
+
+  mutable std::vector<double> publish_times;
+  mutable std::vector<double> publish_positions;
+  mutable std::vector<double> update_times;
+  mutable std::vector<double> update_positions;
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    derivatives->get_mutable_vector().SetAtIndex(0, x[1]);
+    derivatives->get_mutable_vector().SetAtIndex(1, -x[0]);
+  }
+
+  EventStatus Record(const Context<double>& context) const {
+    publish_times.push_back(context.get_time());
+    publish_positions.push_back(context.get_continuous_state_vector()[0]);
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* discrete_state) const {
+    update_times.push_back(context.get_time());
+    update_positions.push_back(context.get_continuous_state_vector()[0]);
+    discrete_state->get_mutable_value()[0] += 1;
+    return EventStatus::Succeeded();
+  }
+};
+
+// With set_interpolate_publish_events(), a high-rate publisher no longer
+// limits the integrator's step size, but still sees every publish time, at
+// (accurately) interpolated states. Update events still end a step exactly.
+GTEST_TEST(SimulatorTest, InterpolatedPublish) {
+  struct Result {
+    int64_t num_steps{};
+    std::vector<double> publish_times;
+    std::vector<double> update_times;
+  };
+  const auto simulate = [](bool interpolate,
+                           std::optional<double> update_period) {
+    PublishingOscillator system(update_period);
+    Simulator<double> simulator(system);
+    EXPECT_FALSE(simulator.get_interpolate_publish_events());
+    simulator.set_interpolate_publish_events(interpolate);
+    EXPECT_EQ(simulator.get_interpolate_publish_events(), interpolate);
+    simulator.get_mutable_integrator().set_target_accuracy(1e-7);
+    simulator.get_mutable_context().SetContinuousState(
+        Eigen::Vector2d(1.0, 0.0));
+    simulator.AdvanceTo(1.0);
+
+    // The position is cos(t).
+    for (size_t i = 0; i < system.publish_times.size(); ++i) {
+      EXPECT_NEAR(system.publish_positions[i],
+                  std::cos(system.publish_times[i]), 1e-5);
+    }
+    for (size_t i = 0; i < system.update_times.size(); ++i) {
+      EXPECT_NEAR(system.update_positions[i],
+                  std::cos(system.update_times[i]), 1e-5);
+    }
+    // The publishes left the trajectory itself undisturbed.
+    EXPECT_NEAR(simulator.get_context().get_continuous_state_vector()[0],
+                std::cos(1.0), 1e-5);
+    return Result{simulator.get_integrator().get_num_steps_taken(),
+                  system.publish_times, system.update_times};
+  };
+
+  for (const std::optional<double> update_period :
+       {std::optional<double>(), std::optional<double>(0.0137)}) {
+    const Result truncated = simulate(false, update_period);
+    const Result interpolated = simulate(true, update_period);
+    // Every publish (including the one at initialization) and update happens
+    // at the same time either way.
+    EXPECT_EQ(truncated.publish_times.size(), 1001);
+    EXPECT_EQ(interpolated.publish_times, truncated.publish_times);
+    EXPECT_EQ(interpolated.update_times, truncated.update_times);
+    EXPECT_GE(truncated.num_steps, 1000);
+    EXPECT_LT(5 * interpolated.num_steps, truncated.num_steps);
+  }
+}
+
+// With set_interpolate_publish_events(), the Simulator rejects a system whose
+// event times depend on its continuous state. This one (with x = t) publishes
+// every 10 ms until x reaches 0.045, and then asks for a discrete update every
+// 1 ms; the lookahead at the start of a step sees only the publishes.
+GTEST_TEST(SimulatorTest, InterpolatedPublishStateDependentEvents) {
+  class StateDependentEventSystem final : public LeafSystem<double> {
+   public:
+    StateDependentEventSystem() {
+      this->DeclareContinuousState(1);
+      this->DeclareDiscreteState(1);
+    }
+
+   private:
+    void DoCalcTimeDerivatives(
+        const Context<double>&,
+        ContinuousState<double>* derivatives) const final {
+      derivatives->get_mutable_vector().SetAtIndex(0, 1.0);
+    }
+
+    void DoCalcNextUpdateTime(const Context<double>& context,
+                              CompositeEventCollection<double>* event_info,
+                              double* time) const final {
+      if (context.get_continuous_state_vector()[0] < 0.045) {
+        *time = context.get_time() + 0.01;
+        PublishEvent<double>(TriggerType::kTimed).AddToComposite(event_info);
+      } else {
+        *time = context.get_time() + 0.001;
+        DiscreteUpdateEvent<double>(TriggerType::kTimed)
+            .AddToComposite(event_info);
+      }
+    }
+  };
+
+  StateDependentEventSystem system;
+  Simulator<double> simulator(system);
+  simulator.set_interpolate_publish_events(true);
+  simulator.reset_integrator<RungeKutta2Integrator<double>>(0.1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      simulator.AdvanceTo(1.0),
+      ".*changed while publishing at interpolated states.*");
+}
+
+// The lookahead used by set_interpolate_publish_events() must not copy the
+// Context's cache, which here holds a VectorLogSink log that has spilled to
+// disk and so cannot be copied. Re-initializing (which discards the lookahead)
+// after the spill must still work.
+GTEST_TEST(SimulatorTest, InterpolatedPublishSpilledLog) {
+  DiagramBuilder<double> builder;
+  const auto* source =
+      builder.AddSystem<ConstantVectorSource<double>>(Vector1d(1.0));
+  const auto* integrator = builder.AddSystem<Integrator<double>>(1);
+  builder.Connect(source->get_output_port(), integrator->get_input_port());
+  const auto* sink = LogVectorOutput(
+      integrator->get_output_port(), &builder, {TriggerType::kPeriodic}, 0.01,
+      ChunkedVectorLogConfig{.chunk_size = 4,
+                             .spill_directory = temp_directory()});
+  const auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.set_interpolate_publish_events(true);
+  simulator.reset_integrator<RungeKutta2Integrator<double>>(0.1);
+  simulator.AdvanceTo(1.0);
+  const int64_t num_samples =
+      sink->FindChunkedLog(simulator.get_context()).num_samples();
+  EXPECT_GT(num_samples, 4);
+
+  simulator.Initialize();
+  EXPECT_NO_THROW(simulator.AdvanceTo(2.0));
+  EXPECT_GT(sink->FindChunkedLog(simulator.get_context()).num_samples(),
+            num_samples);
+}
+
 // A basic sanity check that AutoDiff works.
 GTEST_TEST(SimulatorTest, AutodiffBasic) {
   SpringMassSystem<AutoDiffXd> spring_mass(1., 1., 0.);
@@ -1089,6 +1089,59 @@ TYPED_TEST_P(ImplicitIntegratorTest, LinearTest) {
   }
 }
 
+// Verifies that integration exploiting Jacobian sparsity (colored finite
+// differencing and sparse iteration matrix factorizations) is as accurate as
+// integration using dense computations, using both finite differencing
+// schemes. The Jacobian matrices differ only by truncation and roundoff error,
+// which affect Newton-Raphson convergence (and hence, possibly, the step sizes
+// taken) but not the accuracy of the solution.
+TYPED_TEST_P(ImplicitIntegratorTest, SparseJacobian) {
+  using Integrator = TypeParam;
+  Context<double>* context = this->dspring_context_.get();
+  const std::unique_ptr<State<double>> initial_state = context->CloneState();
+
+  // Get the solution at the target time; see DoubleSpringMassDamperTest() for
+  // the tolerances.
+  const double t_final = 1.0;
+  std::unique_ptr<State<double>> solution = context->CloneState();
+  this->stiff_double_system_->GetSolution(
+      *context, t_final, &solution->get_mutable_continuous_state());
+  const VectorX<double> x_final =
+      solution->get_continuous_state().get_vector().CopyToVector();
+  const double sol_tol_pos = 2e-2;
+  const double sol_tol_vel = 1.2e-1;
+
+  for (const auto scheme :
+       {Integrator::JacobianComputationScheme::kForwardDifference,
+        Integrator::JacobianComputationScheme::kCentralDifference}) {
+    for (const bool use_sparse_jacobian : {false, true}) {
+      context->SetTime(0.0);
+      context->get_mutable_state().SetFrom(*initial_state);
+      Integrator integrator(*this->stiff_double_system_, context);
+      integrator.set_jacobian_computation_scheme(scheme);
+      integrator.set_use_sparse_jacobian(use_sparse_jacobian);
+      EXPECT_EQ(integrator.get_use_sparse_jacobian(), use_sparse_jacobian);
+      const double h = integrator.supports_error_estimation() ? 1e-1 : 1e-4;
+      integrator.set_maximum_step_size(h);
+      if (integrator.supports_error_estimation()) {
+        integrator.request_initial_step_size_target(h);
+        integrator.set_target_accuracy(1e-5);
+      }
+      integrator.Initialize();
+      integrator.IntegrateWithMultipleStepsToTime(t_final);
+
+      const VectorX<double> x =
+          context->get_continuous_state_vector().CopyToVector();
+      for (int i = 0; i < 2; ++i) {
+        EXPECT_NEAR(x(i), x_final(i), sol_tol_pos);
+        EXPECT_NEAR(x(2 + i), x_final(2 + i), sol_tol_vel);
+      }
+      ImplicitIntegratorTest<Integrator>::CheckGeneralStatsValidity(
+          &integrator);
+    }
+  }
+}
+
 TYPED_TEST_P(ImplicitIntegratorTest, DoubleSpringMassDamperNoReuse) {
   this->DoubleSpringMassDamperTest(kNoReuse);
 }
@@ -1145,7 +1198,8 @@ REGISTER_TYPED_TEST_SUITE_P(
     SpringMassDamperStiffReuse, DiscontinuousSpringMassDamperNoReuse,
     DiscontinuousSpringMassDamperReuse, SpringMassStepNoReuse,
     SpringMassStepReuse, ErrorEstimationNoReuse, ErrorEstimationReuse,
-    SpringMassStepAccuracyEffectsNoReuse, SpringMassStepAccuracyEffectsReuse);
+    SpringMassStepAccuracyEffectsNoReuse, SpringMassStepAccuracyEffectsReuse,
+    SparseJacobian);
 
 }  // namespace analysis_test
 }  // namespace systems
@@ -63,6 +63,7 @@ void VelocityImplicitEulerIntegrator<T>::DoInitialize() {
 
   // Reset the Jacobian matrix (so that recomputation is forced).
   this->Jy_vie_.resize(0, 0);
+  this->jy_sparsity_vie_.clear();
 }
 
 template <class T>
@@ -121,7 +122,22 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
     // miscellaneous states (z), we can reuse the position so that the context
     // needs only one modification. Investigate how to refactor this logic to
     // achieve this performance benefit while maintaining code readability.
-    *Jy = math::ComputeNumericalGradient(l_of_y, y, numerical_gradient_method);
+    // When exploiting sparsity, the first (dense) Jacobian is used to
+    // discover the sparsity pattern, after which compressed differencing is
+    // used instead.
+    if (this->get_use_sparse_jacobian() &&
+        jy_sparsity_vie_.size() == y.size()) {
+      this->ComputeColoredDiffJacobian(
+          l_of_y, y,
+          numerical_gradient_method.method() ==
+              math::NumericalGradientMethod::kCentral,
+          jy_sparsity_vie_, Jy);
+    } else {
+      *Jy = math::ComputeNumericalGradient(l_of_y, y,
+                                           numerical_gradient_method);
+      if (this->get_use_sparse_jacobian())
+        jy_sparsity_vie_.SetFromJacobian(*Jy);
+    }
   } else if (
       this->get_jacobian_computation_scheme() ==
       ImplicitIntegrator<T>::JacobianComputationScheme::kAutomatic) {
@@ -203,16 +219,16 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
   // necessary.
   if (!this->get_reuse() || Jy->rows() == 0 || this->IsBadJacobian(*Jy)) {
     CalcVelocityJacobian(t, h, y, qk, qn, Jy);
-    this->increment_num_iter_factorizations();
-    compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
+    this->ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix,
+                                          *Jy, h, iteration_matrix);
     return true;  // Indicate success.
   }
 
   // Reuse is activated, Jacobian is fully sized, and Jacobian is not "bad".
   // If the iteration matrix has not been set and factored, do only that.
   if (!iteration_matrix->matrix_factored()) {
-    this->increment_num_iter_factorizations();
-    compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
+    this->ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix,
+                                          *Jy, h, iteration_matrix);
     return true;  // Indicate success.
   }
 
@@ -231,8 +247,8 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
       // the iteration matrix, using the last computed Jacobian. The last
       // computed Jacobian may be from a previous time-step or a previously-
       // attempted step size.
-      this->increment_num_iter_factorizations();
-      compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
+      this->ComputeAndFactorIterationMatrix(
+          compute_and_factor_iteration_matrix, *Jy, h, iteration_matrix);
       return true;
     }
 
@@ -247,8 +263,8 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
       // ImplicitIntegrator<T>::MaybeFreshenMatrices() does not significantly
       // help here, especially because our Jacobian depends on step size h.
       CalcVelocityJacobian(t, h, y, qk, qn, Jy);
-      this->increment_num_iter_factorizations();
-      compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
+      this->ComputeAndFactorIterationMatrix(
+          compute_and_factor_iteration_matrix, *Jy, h, iteration_matrix);
       return true;
 
       case 4: {
@@ -279,8 +295,8 @@ void VelocityImplicitEulerIntegrator<T>::FreshenVelocityMatricesIfFullNewton(
 
   // Compute the initial Jacobian and iteration matrices and factor them.
   CalcVelocityJacobian(t, h, y, qk, qn, Jy);
-  this->increment_num_iter_factorizations();
-  compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
+  this->ComputeAndFactorIterationMatrix(compute_and_factor_iteration_matrix,
+                                        *Jy, h, iteration_matrix);
 }
 
 template <class T>
@@ -327,6 +327,7 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
 
   void DoResetCachedJacobianRelatedMatrices() final {
       Jy_vie_.resize(0, 0);
+      jy_sparsity_vie_.clear();
       iteration_matrix_vie_ = {};
   }
 
@@ -640,6 +641,10 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // The last computed velocity+misc Jacobian matrix.
   MatrixX<T> Jy_vie_;
 
+  // The sparsity pattern of Jy_vie_, used only when get_use_sparse_jacobian()
+  // is `true` (empty until it has been discovered).
+  typename ImplicitIntegrator<T>::JacobianSparsity jy_sparsity_vie_;
+
   // Various statistics.
   int64_t num_nr_iterations_{0};
 
@@ -1,6 +1,9 @@
 /* @file
 Measures the performance of the MultilayerPerceptron implementation.
-Refer to the README.md for more information. */
+Refer to the README.md for more information.
+
+Every case reports its throughput (items_per_second, where an item is one
+column of the batch); the *Throughput cases sweep the batch size. */
 
 #include <gflags/gflags.h>
 
@@ -38,8 +41,8 @@ class Mlp : public benchmark::Fixture {
     // Use 1 output so that we can call BatchOutput with gradients.
     const int num_outputs = 1;
     // Number of batch evaluations.
-    const int batch_size = state.range(3);
-    DRAKE_DEMAND(batch_size >= 1);
+    batch_size_ = state.range(3);
+    DRAKE_DEMAND(batch_size_ >= 1);
 
     // Create the MLP.
     std::vector<int> layers;
@@ -51,11 +54,11 @@ class Mlp : public benchmark::Fixture {
     mlp_ = std::make_unique<MultilayerPerceptron<double>>(layers);
 
     // Prepare the input/output matrix storage.
-    X_ = MatrixXd::Ones(num_inputs, batch_size);
-    Y_.resize(batch_size);
+    X_ = MatrixXd::Ones(num_inputs, batch_size_);
+    Y_.resize(batch_size_);
     dloss_dparams_.resize(mlp_->num_parameters());
-    Yd_ = RowVectorXd::Ones(batch_size);
-    dYdX_.resize(num_inputs, batch_size);
+    Yd_ = RowVectorXd::Ones(batch_size_);
+    dYdX_.resize(num_inputs, batch_size_);
 
     // Prepare a random context.
     context_ = mlp_->CreateDefaultContext();
@@ -64,6 +67,19 @@ class Mlp : public benchmark::Fixture {
   }
 
  protected:
+  // Reports the throughput in batch columns per second.
+  void SetItemsProcessed(benchmark::State* state) const {
+    state->SetItemsProcessed(state->iterations() * batch_size_);
+  }
+
+  // Returns the PerceptronBatchOptions encoded in the fifth and sixth
+  // benchmark arguments as { num_threads, use_float32 }.
+  static PerceptronBatchOptions GetBatchOptions(const benchmark::State& state) {
+    return {.parallelism = Parallelism(static_cast<int>(state.range(4))),
+            .use_float32 = (state.range(5) != 0)};
+  }
+
+  int batch_size_{};
   std::unique_ptr<MultilayerPerceptron<double>> mlp_;
   std::unique_ptr<Context<double>> context_;
 
@@ -78,6 +94,7 @@ BENCHMARK_DEFINE_F(Mlp, Backprop)(benchmark::State& state) {  // NOLINT
   for (auto _ : state) {
     mlp_->BackpropagationMeanSquaredError(*context_, X_, Yd_, &dloss_dparams_);
   }
+  SetItemsProcessed(&state);
 }
 
 // The Args are { num_inputs, num_layers, width, batch_size }. A few notes
@@ -100,6 +117,7 @@ BENCHMARK_DEFINE_F(Mlp, Output)(benchmark::State& state) {  // NOLINT
   for (auto _ : state) {
     mlp_->BatchOutput(*context_, X_, &Y_);
   }
+  SetItemsProcessed(&state);
 }
 // The Args are { num_inputs, num_layers, width, batch_size }.
 BENCHMARK_REGISTER_F(Mlp, Output)
@@ -116,6 +134,7 @@ BENCHMARK_DEFINE_F(Mlp, OutputGradient)(benchmark::State& state) {  // NOLINT
   for (auto _ : state) {
     mlp_->BatchOutput(*context_, X_, &Y_, &dYdX_);
   }
+  SetItemsProcessed(&state);
 }
 // The Args are { num_inputs, num_layers, width, batch_size }.
 BENCHMARK_REGISTER_F(Mlp, OutputGradient)
@@ -128,6 +147,70 @@ BENCHMARK_REGISTER_F(Mlp, OutputGradient)
     ->Args({128, 4, 64, 256})
     ->Args({128, 8, 64, 256});
 
+// The batch sizes swept by the *Throughput cases, which all use the default
+// stablebaselines3 architecture (10 inputs, 4 layers, width 64).
+constexpr int kSweepBatchSizes[] = {1, 4, 16, 64, 256, 1024, 4096};
+
+// The Args are { num_inputs, num_layers, width, batch_size }.
+void UnblockedThroughputArgs(benchmark::internal::Benchmark* benchmark) {
+  for (const int batch_size : kSweepBatchSizes) {
+    benchmark->Args({10, 4, 64, batch_size});
+  }
+}
+
+// The Args are { num_inputs, num_layers, width, batch_size, num_threads,
+// use_float32 }. With multiple threads the CPU time of the main thread is
+// meaningless, so these cases measure wall-clock time.
+void BlockedThroughputArgs(benchmark::internal::Benchmark* benchmark) {
+  benchmark->UseRealTime();
+  for (const int batch_size : kSweepBatchSizes) {
+    for (const int num_threads : {1, 4}) {
+      for (const int use_float32 : {0, 1}) {
+        benchmark->Args({10, 4, 64, batch_size, num_threads, use_float32});
+      }
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(Mlp, OutputThroughput)(benchmark::State& state) {  // NOLINT
+  for (auto _ : state) {
+    mlp_->BatchOutput(*context_, X_, &Y_);
+  }
+  SetItemsProcessed(&state);
+}
+BENCHMARK_REGISTER_F(Mlp, OutputThroughput)->Apply(UnblockedThroughputArgs);
+
+BENCHMARK_DEFINE_F(Mlp, BlockedOutputThroughput)
+(benchmark::State& state) {  // NOLINT
+  const PerceptronBatchOptions options = GetBatchOptions(state);
+  for (auto _ : state) {
+    mlp_->BlockedBatchOutput(*context_, X_, options, &Y_);
+  }
+  SetItemsProcessed(&state);
+}
+BENCHMARK_REGISTER_F(Mlp, BlockedOutputThroughput)
+    ->Apply(BlockedThroughputArgs);
+
+BENCHMARK_DEFINE_F(Mlp, BackpropThroughput)
+(benchmark::State& state) {  // NOLINT
+  for (auto _ : state) {
+    mlp_->BackpropagationMeanSquaredError(*context_, X_, Yd_, &dloss_dparams_);
+  }
+  SetItemsProcessed(&state);
+}
+BENCHMARK_REGISTER_F(Mlp, BackpropThroughput)->Apply(UnblockedThroughputArgs);
+
+BENCHMARK_DEFINE_F(Mlp, BlockedBackpropThroughput)
+(benchmark::State& state) {  // NOLINT
+  const PerceptronBatchOptions options = GetBatchOptions(state);
+  for (auto _ : state) {
+    mlp_->BlockedBackpropagationMeanSquaredError(*context_, X_, Yd_, options,
+                                                 &dloss_dparams_);
+  }
+  SetItemsProcessed(&state);
+}
+BENCHMARK_REGISTER_F(Mlp, BlockedBackpropThroughput)
+    ->Apply(BlockedThroughputArgs);
 
 }  // namespace
 }  // namespace systems
@@ -24,7 +24,9 @@ void CacheEntryValue::ThrowIfBadCacheEntryValue(
   if (owning_subcontext && owning_subcontext_ != owning_subcontext) {
     throw std::logic_error(FormatName(__func__) + "wrong owning subcontext.");
   }
-  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0) {
+  constexpr int kAllFlags =
+      kValueIsOutOfDate | kCacheEntryIsDisabled | kIsProfiling;
+  if ((flags_ & ~kAllFlags) != 0) {
     throw std::logic_error(FormatName(__func__) +
                            "flags value is out of range.");
   }
@@ -120,6 +122,21 @@ void Cache::EnableCaching() {
     if (entry) entry->enable_caching();
 }
 
+void Cache::EnableProfiling() {
+  for (auto& entry : store_)
+    if (entry) entry->enable_profiling();
+}
+
+void Cache::DisableProfiling() {
+  for (auto& entry : store_)
+    if (entry) entry->disable_profiling();
+}
+
+void Cache::ResetProfile() {
+  for (auto& entry : store_)
+    if (entry) entry->reset_profile();
+}
+
 void Cache::SetAllEntriesOutOfDate() {
   for (auto& entry : store_)
     if (entry) entry->mark_out_of_date();
@@ -5,6 +5,7 @@ Declares CacheEntryValue and Cache, which is the container for cache entry
 values. */
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
@@ -23,6 +24,37 @@ namespace systems {
 
 class DependencyGraph;
 
+/** (Debugging) Statistics gathered for one CacheEntryValue while cache
+profiling is enabled. See ContextBase::EnableCacheProfiling(). */
+struct CacheEntryProfile {
+  /** One recomputation of the value, measured in seconds since the epoch of
+  `std::chrono::steady_clock`. */
+  struct CalcInterval {
+    double start{};
+    double end{};
+  };
+
+  /** The number of `Eval()` calls that returned the already-computed value. */
+  int64_t num_hits{0};
+
+  /** The number of `Eval()` calls that had to recompute the value. */
+  int64_t num_misses{0};
+
+  /** The number of times an up-to-date value was marked out of date. */
+  int64_t num_invalidations{0};
+
+  /** The total wall-clock time spent recomputing the value, in seconds. */
+  double calc_time{0.0};
+
+  /** For each prerequisite (identified by its path description) that marked
+  an up-to-date value out of date, the number of times it did so. */
+  std::map<std::string, int64_t> invalidation_causes;
+
+  /** Every recomputation, in the order performed. This grows without bound
+  while profiling is enabled; see ContextBase::ResetCacheProfile(). */
+  std::vector<CalcInterval> calc_intervals;
+};
+
 //==============================================================================
 //                             CACHE ENTRY VALUE
 //==============================================================================
@@ -332,6 +364,15 @@ class CacheEntryValue {
   However, operation of _this_ method is unaffected by whether the cache
   is frozen. */
   bool needs_recomputation() const {
+    DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
+    return (flags_ & (kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0;
+  }
+
+  /** Returns `true` if needs_recomputation() is true or if profiling is
+  enabled for this entry. This is the single test Eval() makes before taking
+  the (slower, out-of-line) update path, so profiling costs nothing when it is
+  disabled. */
+  bool needs_recomputation_or_profiling() const {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
     return flags_ != kReadyToUse;
   }
@@ -448,6 +489,60 @@ class CacheEntryValue {
   bool is_cache_entry_disabled() const {
     return (flags_ & kCacheEntryIsDisabled) != 0;
   }
+
+  /** (Debugging) Starts gathering a CacheEntryProfile for this entry, keeping
+  any statistics gathered previously. */
+  void enable_profiling() {
+    if (profile_ == nullptr) profile_ = std::make_unique<CacheEntryProfile>();
+    flags_ |= kIsProfiling;
+  }
+
+  /** (Debugging) Stops gathering statistics for this entry. Statistics
+  already gathered remain available via profile(). */
+  void disable_profiling() {
+    flags_ &= ~kIsProfiling;
+  }
+
+  /** (Debugging) Discards all statistics gathered for this entry so far,
+  without changing whether profiling is enabled. */
+  void reset_profile() {
+    if (profile_ != nullptr) *profile_ = CacheEntryProfile{};
+  }
+
+  /** (Debugging) Returns `true` if profiling is enabled for this entry. */
+  bool is_profiling() const {
+    return (flags_ & kIsProfiling) != 0;
+  }
+
+  /** (Debugging) Returns the statistics gathered for this entry, or nullptr
+  if profiling has never been enabled for it. */
+  const CacheEntryProfile* profile() const { return profile_.get(); }
+
+  /** (Internal use only) Records an Eval() that found the value up to date.
+  @pre is_profiling() */
+  void RecordProfileHit() {
+    DRAKE_ASSERT(profile_ != nullptr);
+    ++profile_->num_hits;
+  }
+
+  /** (Internal use only) Records an Eval() that recomputed the value over the
+  given interval (see CacheEntryProfile::CalcInterval).
+  @pre is_profiling() */
+  void RecordProfileMiss(double start, double end) {
+    DRAKE_ASSERT(profile_ != nullptr);
+    ++profile_->num_misses;
+    profile_->calc_time += end - start;
+    profile_->calc_intervals.push_back({start, end});
+  }
+
+  /** (Internal use only) Records that the prerequisite with the given path
+  description marked this up-to-date value out of date.
+  @pre is_profiling() */
+  void RecordProfileInvalidation(const std::string& cause) {
+    DRAKE_ASSERT(profile_ != nullptr);
+    ++profile_->num_invalidations;
+    ++profile_->invalidation_causes[cause];
+  }
   //@}
 
  private:
@@ -581,11 +676,13 @@ class CacheEntryValue {
 
   // The sense of these flag bits is chosen so that Eval() can check in a single
   // instruction whether it must recalculate. Only if flags==0 (kReadyToUse) can
-  // we reuse the existing value. See needs_recomputation() above.
+  // we reuse the existing value without further ado. See
+  // needs_recomputation_or_profiling() above.
   enum Flags : int {
-    kReadyToUse           = 0b00,
-    kValueIsOutOfDate     = 0b01,
-    kCacheEntryIsDisabled = 0b10
+    kReadyToUse           = 0b000,
+    kValueIsOutOfDate     = 0b001,
+    kCacheEntryIsDisabled = 0b010,
+    kIsProfiling          = 0b100
   };
 
   // The index for this CacheEntryValue within its containing subcontext.
@@ -610,6 +707,10 @@ class CacheEntryValue {
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // Statistics gathered while profiling; null until profiling is first
+  // enabled.
+  copyable_unique_ptr<CacheEntryProfile> profile_;
 };
 
 //==============================================================================
@@ -709,6 +810,18 @@ class Cache {
   SetAllEntriesOutOfDate() if you want to force recomputation. */
   void EnableCaching();
 
+  /** (Debugging) Enables profiling for all entries in this %Cache. See
+  ContextBase::EnableCacheProfiling() for the user-facing API. */
+  void EnableProfiling();
+
+  /** (Debugging) Disables profiling for all entries in this %Cache, keeping
+  the statistics gathered so far. */
+  void DisableProfiling();
+
+  /** (Debugging) Discards the profiling statistics of all entries in this
+  %Cache. */
+  void ResetProfile();
+
   /** (Advanced) Mark every entry in this cache as "out of date". This forces
   the next Eval() request for an entry to perform a recalculation. After that
   normal caching behavior resumes. */
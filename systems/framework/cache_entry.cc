@@ -1,5 +1,6 @@
 #include "drake/systems/framework/cache_entry.h"
 
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <typeinfo>
@@ -51,6 +52,31 @@ void CacheEntry::Calc(const ContextBase& context,
   value_producer_.Calc(context, value);
 }
 
+namespace {
+// Returns the current time in seconds since the steady_clock epoch.
+double SteadyNow() {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+void CacheEntry::UpdateValueWithProfiling(const ContextBase& context,
+                                          CacheEntryValue* cache_value) const {
+  DRAKE_DEMAND(cache_value != nullptr);
+  if (!cache_value->needs_recomputation()) {
+    cache_value->RecordProfileHit();
+    return;
+  }
+  AbstractValue& value = cache_value->GetMutableAbstractValueOrThrow();
+  const double start = SteadyNow();
+  // If Calc() throws a recoverable exception, the cache remains out of date
+  // and nothing is recorded.
+  Calc(context, &value);
+  cache_value->mark_up_to_date();
+  cache_value->RecordProfileMiss(start, SteadyNow());
+}
+
 void CacheEntry::CheckValidAbstractValue(const ContextBase& context,
                                          const AbstractValue& proposed) const {
   const CacheEntryValue& cache_value = get_cache_entry_value(context);
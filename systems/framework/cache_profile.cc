@@ -0,0 +1,135 @@
+#include "drake/systems/framework/cache_profile.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <fmt/format.h>
+
+#include "drake/systems/framework/diagram_context.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+template <typename T>
+void CollectCacheProfileHelper(const Context<T>& context,
+                               std::vector<CacheProfileRecord>* records) {
+  const Cache& cache = context.get_cache();
+  for (CacheIndex i(0); i < cache.cache_size(); ++i) {
+    if (!cache.has_cache_entry_value(i)) continue;
+    const CacheEntryValue& value = cache.get_cache_entry_value(i);
+    if (value.profile() == nullptr) continue;
+    records->push_back(CacheProfileRecord{
+        context.GetSystemPathname(), value.description(), *value.profile()});
+  }
+  const auto* diagram_context = dynamic_cast<const DiagramContext<T>*>(&context);
+  if (diagram_context != nullptr) {
+    for (SubsystemIndex i(0); i < diagram_context->num_subcontexts(); ++i) {
+      CollectCacheProfileHelper(diagram_context->GetSubsystemContext(i),
+                                records);
+    }
+  }
+}
+
+std::string GetRecordName(const CacheProfileRecord& record) {
+  return record.system_pathname + ":" + record.description;
+}
+
+// Escapes the characters that may not appear verbatim in a JSON string.
+std::string JsonEscape(const std::string& text) {
+  std::string result;
+  result.reserve(text.size());
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+      result.push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += fmt::format("\\u{:04x}", static_cast<int>(c));
+    } else {
+      result.push_back(c);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+template <typename T>
+std::vector<CacheProfileRecord> CollectCacheProfile(const Context<T>& context) {
+  std::vector<CacheProfileRecord> records;
+  CollectCacheProfileHelper(context, &records);
+  return records;
+}
+
+std::string FormatCacheProfileTable(
+    const std::vector<CacheProfileRecord>& records) {
+  std::vector<const CacheProfileRecord*> sorted;
+  sorted.reserve(records.size());
+  for (const CacheProfileRecord& record : records) {
+    sorted.push_back(&record);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const CacheProfileRecord* a, const CacheProfileRecord* b) {
+                     return a->profile.calc_time > b->profile.calc_time;
+                   });
+
+  std::string result = fmt::format(
+      "{:>12} {:>12} {:>10} {:>10} {:>10}  {} [top invalidation cause]\n",
+      "total [ms]", "mean [us]", "misses", "hits", "invalid.", "cache entry");
+  for (const CacheProfileRecord* record : sorted) {
+    const CacheEntryProfile& profile = record->profile;
+    const double mean_us =
+        profile.num_misses > 0 ? 1e6 * profile.calc_time / profile.num_misses
+                               : 0.0;
+    std::string top_cause;
+    int64_t top_count = 0;
+    for (const auto& [cause, count] : profile.invalidation_causes) {
+      if (count > top_count) {
+        top_cause = cause;
+        top_count = count;
+      }
+    }
+    result += fmt::format("{:>12.3f} {:>12.3f} {:>10} {:>10} {:>10}  {}",
+                          1e3 * profile.calc_time, mean_us, profile.num_misses,
+                          profile.num_hits, profile.num_invalidations,
+                          GetRecordName(*record));
+    if (top_count > 0) {
+      result += fmt::format(" [{} x{}]", top_cause, top_count);
+    }
+    result += "\n";
+  }
+  return result;
+}
+
+std::string FormatCacheProfileChromeTrace(
+    const std::vector<CacheProfileRecord>& records) {
+  double origin = std::numeric_limits<double>::infinity();
+  for (const CacheProfileRecord& record : records) {
+    for (const auto& interval : record.profile.calc_intervals) {
+      origin = std::min(origin, interval.start);
+    }
+  }
+
+  std::string result = "{\"traceEvents\":[";
+  bool first = true;
+  for (const CacheProfileRecord& record : records) {
+    const std::string name = JsonEscape(GetRecordName(record));
+    for (const auto& interval : record.profile.calc_intervals) {
+      result += fmt::format(
+          "{}\n{{\"name\":\"{}\",\"cat\":\"cache\",\"ph\":\"X\",\"pid\":0,"
+          "\"tid\":0,\"ts\":{:.3f},\"dur\":{:.3f}}}",
+          first ? "" : ",", name, 1e6 * (interval.start - origin),
+          1e6 * (interval.end - interval.start));
+      first = false;
+    }
+  }
+  result += "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return result;
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
+    &CollectCacheProfile<T>
+))
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,55 @@
+#pragma once
+
+/** @file
+Declares functions for gathering and reporting the cache profiling statistics
+recorded by ContextBase::EnableCacheProfiling(). */
+
+#include <string>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/systems/framework/cache.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** (Debugging) The profiling statistics of one cache entry in one
+subcontext. */
+struct CacheProfileRecord {
+  /** The full pathname of the subsystem that owns the cache entry. */
+  std::string system_pathname;
+
+  /** The cache entry's description. */
+  std::string description;
+
+  /** The statistics gathered for the entry. */
+  CacheEntryProfile profile;
+};
+
+/** (Debugging) Gathers the statistics of every cache entry in `context` and
+its subcontexts (depth first) for which profiling has ever been enabled.
+@see ContextBase::EnableCacheProfiling()
+@tparam_default_scalar */
+template <typename T>
+std::vector<CacheProfileRecord> CollectCacheProfile(const Context<T>& context);
+
+/** (Debugging) Formats the given records as a human-readable table with one
+row per cache entry, sorted by decreasing total calculation time. For each
+entry the table shows the total and mean calculation time, the number of hits
+and misses, the number of invalidations, and the prerequisite responsible for
+most of those invalidations. */
+std::string FormatCacheProfileTable(
+    const std::vector<CacheProfileRecord>& records);
+
+/** (Debugging) Formats the recomputations in the given records as a Chrome
+Trace Event Format JSON document, which can be loaded into chrome://tracing or
+https://ui.perfetto.dev. Each recomputation is a complete event named after
+its cache entry; because one entry's Calc() often evaluates other entries, the
+events nest to show where the time was spent. Times are in microseconds,
+relative to the earliest recomputation. */
+std::string FormatCacheProfileChromeTrace(
+    const std::vector<CacheProfileRecord>& records);
+
+}  // namespace systems
+}  // namespace drake
@@ -19,6 +19,14 @@ void Context<T>::SetAccuracy(const std::optional<double>& accuracy) {
   PropagateAccuracyChange(this, accuracy, change_event);
 }
 
+template <typename T>
+void Context<T>::SetFrom(const Context<T>& source) {
+  ThrowIfNotRootContext(__func__, "Time");
+  DRAKE_THROW_UNLESS(source.get_system_id() == this->get_system_id());
+  ContextBase::CopyFixedInputPortValues(source, this);
+  SetTimeStateAndParametersFrom(source);
+}
+
 template <typename T>
 State<T>& Context<T>::get_mutable_state() {
   const int64_t change_event = this->start_new_change_event();
@@ -476,6 +476,19 @@ class Context : public ContextBase {
     SetStateAndParametersFromHelper(source, change_event);
   }
 
+  /** Copies time, accuracy, all state, all parameters, and the values of all
+  fixed input ports in `source` to `this` context, which must be a root
+  context with the same structure as `source` (typically both are clones of
+  the same context). Unlike Clone(), no new context is allocated: values are
+  assigned into the storage `this` context already owns, and a single change
+  event invalidates all dependent computations in bulk. This is the cheap way
+  to recycle a context; see ContextPool.
+  @throws std::exception if this is not the root context.
+  @throws std::exception if `source` was not created by the same System.
+  @throws std::exception if an input port is fixed in only one of the two
+  contexts. */
+  void SetFrom(const Context<T>& source);
+
   // Allow access to the base class method (takes an AbstractValue).
   using ContextBase::FixInputPort;
 
@@ -337,5 +337,27 @@ void ContextBase::FixContextPointers(
   clone->DoPropagateFixContextPointers(source, tracker_map);
 }
 
+void ContextBase::CopyFixedInputPortValues(const ContextBase& source,
+                                           ContextBase* context) {
+  DRAKE_DEMAND(context != nullptr);
+  DRAKE_DEMAND(source.num_input_ports() == context->num_input_ports());
+  for (int i = 0; i < context->num_input_ports(); ++i) {
+    const FixedInputPortValue* source_value =
+        source.input_port_values_[i].get();
+    FixedInputPortValue* value = context->input_port_values_[i].get_mutable();
+    if (source_value == nullptr && value == nullptr) continue;
+    if (source_value == nullptr || value == nullptr) {
+      throw std::logic_error(fmt::format(
+          "CopyFixedInputPortValues(): input port {} of {} is fixed in only "
+          "one of the two contexts.",
+          i, context->GetSystemPathname()));
+    }
+    value->GetMutableData()->SetFrom(source_value->get_value());
+  }
+
+  // Then recursively ask our descendants to copy theirs.
+  context->DoPropagateCopyFixedInputPortValues(source);
+}
+
 }  // namespace systems
 }  // namespace drake
@@ -94,6 +94,29 @@ class ContextBase : public internal::ContextMessageInterface {
     PropagateCachingChange(*this, &Cache::SetAllEntriesOutOfDate);
   }
 
+  /** (Debugging) Enables cache profiling recursively for this context and all
+  its subcontexts. While enabled, every cache entry records how many `Eval()`
+  calls found its value up to date (hits) or had to recompute it (misses), how
+  long each recomputation took, and which prerequisites invalidated it; see
+  CacheEntryProfile. Use CollectCacheProfile() to gather the results. When
+  profiling is disabled (the default) the only cost is a single branch on the
+  already-checked cache entry flags. */
+  void EnableCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::EnableProfiling);
+  }
+
+  /** (Debugging) Disables cache profiling recursively for this context and all
+  its subcontexts. Statistics gathered so far are kept. */
+  void DisableCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::DisableProfiling);
+  }
+
+  /** (Debugging) Discards the cache profiling statistics gathered so far,
+  recursively for this context and all its subcontexts. */
+  void ResetCacheProfile() const {
+    PropagateCachingChange(*this, &Cache::ResetProfile);
+  }
+
   /** (Advanced) Freezes the cache at its current contents, preventing any
   further cache updates. When frozen, accessing an out-of-date cache entry
   causes an exception to be throw. This is applied recursively to this
@@ -480,6 +503,18 @@ class ContextBase : public internal::ContextMessageInterface {
       const DependencyTracker::PointerMap& tracker_map,
       ContextBase* clone);
 
+  /** (Internal use only) Copies the values of all fixed input ports in
+  `source` into the corresponding, already-allocated fixed input ports of
+  `context`, and recursively does the same for subcontexts if these are
+  DiagramContexts. Each value is assigned in place and its dependents are
+  notified of the change.
+  @throws std::exception if an input port is fixed in one context but not in
+  the other. */
+  // Structuring this as a static method allows DiagramContext to invoke this
+  // protected function on its children.
+  static void CopyFixedInputPortValues(const ContextBase& source,
+                                       ContextBase* context);
+
   /** (Internal use only) Applies the given caching-change notification method
   to `context`, and propagates the notification to subcontexts if `context` is
   a DiagramContext. Used, for example, to enable and disable the cache. The
@@ -553,6 +588,13 @@ class ContextBase : public internal::ContextMessageInterface {
     unused(source, tracker_map);
   }
 
+  /** DiagramContext must implement this to invoke CopyFixedInputPortValues()
+  on each of its subcontexts. The default implementation does nothing which is
+  fine for a LeafContext. */
+  virtual void DoPropagateCopyFixedInputPortValues(const ContextBase& source) {
+    unused(source);
+  }
+
   /** DiagramContext must implement this to invoke a caching behavior change on
   each of its subcontexts. The default implementation does nothing which is
   fine for a LeafContext. */
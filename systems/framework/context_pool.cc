@@ -0,0 +1,153 @@
+#include "drake/systems/framework/context_pool.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/systems/framework/diagram_context.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns true iff `a` and `b` (which must share a System) have fixed values
+// for the same input ports, recursively, as Context::SetFrom() requires.
+template <typename T>
+bool HaveSameFixedInputPorts(const Context<T>& a, const Context<T>& b) {
+  for (int i = 0; i < a.num_input_ports(); ++i) {
+    if ((a.MaybeGetFixedInputPortValue(i) == nullptr) !=
+        (b.MaybeGetFixedInputPortValue(i) == nullptr)) {
+      return false;
+    }
+  }
+  const auto* diagram_a = dynamic_cast<const DiagramContext<T>*>(&a);
+  if (diagram_a == nullptr) {
+    return true;
+  }
+  const auto& diagram_b = dynamic_cast<const DiagramContext<T>&>(b);
+  for (SubsystemIndex i(0); i < diagram_a->num_subcontexts(); ++i) {
+    if (!HaveSameFixedInputPorts(diagram_a->GetSubsystemContext(i),
+                                 diagram_b.GetSubsystemContext(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+template <typename T>
+ContextPool<T>::Lease::Lease(Lease&& other) noexcept
+    : context_(other.context_),
+      in_use_(other.in_use_),
+      overflow_(std::move(other.overflow_)) {
+  other.context_ = nullptr;
+  other.in_use_ = nullptr;
+}
+
+template <typename T>
+typename ContextPool<T>::Lease& ContextPool<T>::Lease::operator=(
+    Lease&& other) noexcept {
+  if (this != &other) {
+    Release();
+    context_ = other.context_;
+    in_use_ = other.in_use_;
+    overflow_ = std::move(other.overflow_);
+    other.context_ = nullptr;
+    other.in_use_ = nullptr;
+  }
+  return *this;
+}
+
+template <typename T>
+ContextPool<T>::Lease::~Lease() {
+  Release();
+}
+
+template <typename T>
+void ContextPool<T>::Lease::Release() {
+  if (in_use_ != nullptr) {
+    in_use_->store(false, std::memory_order_release);
+    in_use_ = nullptr;
+  }
+  overflow_.reset();
+  context_ = nullptr;
+}
+
+template <typename T>
+ContextPool<T>::ContextPool(const Context<T>& prototype, int num_contexts) {
+  DRAKE_THROW_UNLESS(prototype.is_root_context());
+  DRAKE_THROW_UNLESS(num_contexts >= 1);
+  prototype_ = prototype.Clone();
+  contexts_.reserve(num_contexts);
+  for (int i = 0; i < num_contexts; ++i) {
+    contexts_.push_back(prototype.Clone());
+  }
+  in_use_ = std::make_unique<std::atomic<bool>[]>(num_contexts);
+  for (int i = 0; i < num_contexts; ++i) {
+    in_use_[i].store(false, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+ContextPool<T>::~ContextPool() = default;
+
+template <typename T>
+void ContextPool<T>::SetPrototypeFrom(const Context<T>& source) {
+  DRAKE_THROW_UNLESS(num_leased() == 0);
+  prototype_->SetFrom(source);
+}
+
+template <typename T>
+Context<T>& ContextPool<T>::get_mutable_context(int index) const {
+  if (index < 0 || index >= num_contexts()) {
+    throw std::out_of_range(fmt::format(
+        "ContextPool::get_mutable_context(): index {} is out of range for a "
+        "pool of {} contexts.",
+        index, num_contexts()));
+  }
+  return *contexts_[index];
+}
+
+template <typename T>
+typename ContextPool<T>::Lease ContextPool<T>::Acquire() const {
+  const int n = num_contexts();
+  const int start = static_cast<int>(
+      next_slot_.fetch_add(1, std::memory_order_relaxed) % n);
+  for (int k = 0; k < n; ++k) {
+    const int i = (start + k) % n;
+    bool expected = false;
+    // Cheaply skip slots that are obviously taken before attempting the CAS.
+    if (in_use_[i].load(std::memory_order_relaxed)) continue;
+    if (in_use_[i].compare_exchange_strong(expected, true,
+                                           std::memory_order_acquire)) {
+      // A previous lessee may have fixed an input port that the prototype
+      // leaves unfixed, which SetFrom() cannot undo; replace such a context
+      // with a fresh clone instead.
+      if (HaveSameFixedInputPorts(*contexts_[i], *prototype_)) {
+        contexts_[i]->SetFrom(*prototype_);
+      } else {
+        contexts_[i] = prototype_->Clone();
+      }
+      return Lease(contexts_[i].get(), &in_use_[i]);
+    }
+  }
+  // Every pooled context is busy; hand out a private clone instead.
+  return Lease(prototype_->Clone());
+}
+
+template <typename T>
+int ContextPool<T>::num_leased() const {
+  int result = 0;
+  for (int i = 0; i < num_contexts(); ++i) {
+    if (in_use_[i].load(std::memory_order_relaxed)) ++result;
+  }
+  return result;
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextPool)
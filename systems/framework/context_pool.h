@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/// A fixed-size collection of pre-allocated Context objects, all cloned from a
+/// single prototype, that can be handed out to concurrent workers (threads,
+/// rollouts, samples) and recycled without allocating.
+///
+/// Contexts can be obtained in two ways:
+///
+/// - By index, via get_mutable_context(). This suits OpenMP-style code where
+///   each thread number owns exactly one context for the duration of a
+///   parallel region; no synchronization is performed.
+/// - By lease, via Acquire(). Any thread may call Acquire() concurrently; a
+///   free context is claimed with a single atomic compare-and-swap (no locks)
+///   and is returned to the pool when the Lease is destroyed. A leased
+///   context is reset to match the prototype (see Context::SetFrom()), which
+///   copies time, state, parameters, and fixed input port values into the
+///   existing storage rather than re-cloning the whole context.
+///
+/// Lessees may fix input ports that the prototype leaves unfixed. SetFrom()
+/// cannot unfix them, so when such a context is next leased it is replaced by
+/// a fresh clone of the prototype (which allocates, once); any reference to
+/// it previously obtained from get_mutable_context() is then invalidated.
+///
+/// If every pooled context is already leased, Acquire() falls back to cloning
+/// the prototype into a context owned by the Lease, so callers never block.
+/// Size the pool to the expected number of concurrent users to avoid that.
+///
+/// The prototype must not be modified while any context is leased from the
+/// pool; use SetPrototypeFrom() between batches of work.
+///
+/// @tparam_default_scalar
+template <typename T>
+class ContextPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContextPool);
+
+  /// Exclusive, scoped access to one context from a ContextPool. Returns the
+  /// context to its pool upon destruction.
+  class Lease {
+   public:
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease(Lease&& other) noexcept;
+    Lease& operator=(Lease&& other) noexcept;
+    ~Lease();
+
+    /// Returns the leased context.
+    Context<T>& get() const { return *context_; }
+    Context<T>& operator*() const { return *context_; }
+    Context<T>* operator->() const { return context_; }
+
+    /// Returns true iff the leased context is owned by the pool, or false if
+    /// the pool was exhausted and the context was cloned for this lease only.
+    bool is_pooled() const { return in_use_ != nullptr; }
+
+   private:
+    friend class ContextPool<T>;
+
+    Lease(Context<T>* context, std::atomic<bool>* in_use)
+        : context_(context), in_use_(in_use) {}
+    explicit Lease(std::unique_ptr<Context<T>> overflow)
+        : context_(overflow.get()), overflow_(std::move(overflow)) {}
+
+    void Release();
+
+    Context<T>* context_{};
+    // When non-null, the pool's flag to clear when this lease ends.
+    std::atomic<bool>* in_use_{};
+    // When the pool is exhausted, the context is owned here instead.
+    std::unique_ptr<Context<T>> overflow_;
+  };
+
+  /// Constructs a pool of `num_contexts` clones of `prototype`, plus one more
+  /// private clone that serves as the prototype for subsequent resets.
+  /// @throws std::exception if `prototype` is not a root context.
+  /// @throws std::exception if `num_contexts` < 1.
+  ContextPool(const Context<T>& prototype, int num_contexts);
+
+  ~ContextPool();
+
+  /// Returns the number of pooled contexts.
+  int num_contexts() const { return static_cast<int>(contexts_.size()); }
+
+  /// Returns the prototype that leased contexts are reset to.
+  const Context<T>& prototype() const { return *prototype_; }
+
+  /// Replaces the prototype's values with those of `source` (see
+  /// Context::SetFrom()).
+  /// @throws std::exception if any context is currently leased from this
+  /// pool.
+  void SetPrototypeFrom(const Context<T>& source);
+
+  /// Returns the pooled context with the given `index`, without leasing it
+  /// or resetting it. The caller is responsible for ensuring that each index
+  /// is used by at most one thread at a time, and that no Lease for it is
+  /// outstanding.
+  /// @throws std::exception if `index` is out of range.
+  Context<T>& get_mutable_context(int index) const;
+
+  /// Leases a free context, resetting it to the prototype first. This is
+  /// lock-free and safe to call from multiple threads concurrently.
+  Lease Acquire() const;
+
+  /// Returns the number of contexts currently leased from the pool (which
+  /// might be stale by the time it is returned).
+  int num_leased() const;
+
+ private:
+  std::unique_ptr<Context<T>> prototype_;
+  // Mutable so that Acquire() can replace a context whose fixed input ports
+  // no longer match the prototype's.
+  mutable std::vector<std::unique_ptr<Context<T>>> contexts_;
+  // One flag per context, set while that context is leased.
+  std::unique_ptr<std::atomic<bool>[]> in_use_;
+  // The slot at which the next Acquire() starts searching, so that
+  // successive leases spread over the pool rather than contending for the
+  // first slot.
+  mutable std::atomic<unsigned> next_slot_{0};
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextPool)
@@ -61,6 +61,10 @@ void DependencyTracker::NotePrerequisiteChange(
   }
   last_change_event_ = change_event;
   // Invalidate associated cache entry value if any.
+  if (cache_value_->is_profiling() && !cache_value_->is_out_of_date()) {
+    cache_value_->RecordProfileInvalidation(
+        prerequisite.GetPathDescription());
+  }
   cache_value_->mark_out_of_date();
   // Follow up with downstream subscribers.
   NotifySubscribers(change_event, depth);
@@ -1,10 +1,14 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <algorithm>
+#include <exception>
 #include <limits>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_bool.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/abstract_value_cloner.h"
 #include "drake/systems/framework/subvector.h"
@@ -304,12 +308,101 @@ void Diagram<T>::DoCalcTimeDerivatives(const Context<T>& context,
   DRAKE_DEMAND(num_subsystems() == n);
 
   // Evaluate the derivatives of each constituent system.
-  for (SubsystemIndex i(0); i < n; ++i) {
+  ForEachSubsystemMaybeInParallel(*diagram_context, [&](SubsystemIndex i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     ContinuousState<T>& subderivatives =
         diagram_derivatives->get_mutable_substate(i);
     registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
+  });
+}
+
+template <typename T>
+void Diagram<T>::DoCalcTimeDerivativesBatch(
+    const std::vector<const Context<T>*>& contexts,
+    const std::vector<ContinuousState<T>*>& derivatives) const {
+  std::vector<const DiagramContext<T>*> diagram_contexts;
+  std::vector<DiagramContinuousState<T>*> diagram_derivatives;
+  diagram_contexts.reserve(contexts.size());
+  diagram_derivatives.reserve(contexts.size());
+  for (size_t k = 0; k < contexts.size(); ++k) {
+    diagram_contexts.push_back(
+        dynamic_cast<const DiagramContext<T>*>(contexts[k]));
+    DRAKE_DEMAND(diagram_contexts.back() != nullptr);
+    diagram_derivatives.push_back(
+        dynamic_cast<DiagramContinuousState<T>*>(derivatives[k]));
+    DRAKE_DEMAND(diagram_derivatives.back() != nullptr);
+    DRAKE_DEMAND(diagram_derivatives.back()->num_substates() ==
+                 num_subsystems());
+  }
+
+  // First prime (in batches) the outputs that feed the subsystems that have
+  // continuous state.
+  std::set<OutputPortLocator> visited;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const System<T>* const subsystem = registered_systems_[i].get();
+    if (subsystem->num_continuous_states() == 0) continue;
+    for (InputPortIndex j(0); j < subsystem->num_input_ports(); ++j) {
+      const auto iter = connection_map_.find(InputPortLocator{subsystem, j});
+      if (iter != connection_map_.end()) {
+        EvalSubsystemOutputBatch(diagram_contexts, iter->second, &visited);
+      }
+    }
+  }
+
+  // Then evaluate the derivatives of each such subsystem, as a batch.
+  std::vector<ContinuousState<T>*> subderivatives(contexts.size());
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const System<T>& subsystem = *registered_systems_[i];
+    if (subsystem.num_continuous_states() == 0) continue;
+    for (size_t k = 0; k < contexts.size(); ++k) {
+      subderivatives[k] = &diagram_derivatives[k]->get_mutable_substate(i);
+    }
+    subsystem.CalcTimeDerivativesBatch(
+        GetSubsystemContexts(diagram_contexts, i), subderivatives);
+  }
+}
+
+template <typename T>
+void Diagram<T>::DoEvalOutputBatch(
+    OutputPortIndex port_index,
+    const std::vector<const Context<T>*>& contexts) const {
+  std::vector<const DiagramContext<T>*> diagram_contexts;
+  diagram_contexts.reserve(contexts.size());
+  for (const Context<T>* context : contexts) {
+    diagram_contexts.push_back(dynamic_cast<const DiagramContext<T>*>(context));
+    DRAKE_DEMAND(diagram_contexts.back() != nullptr);
   }
+  std::set<OutputPortLocator> visited;
+  EvalSubsystemOutputBatch(diagram_contexts, output_port_ids_[port_index],
+                           &visited);
+}
+
+template <typename T>
+void Diagram<T>::EvalSubsystemOutputBatch(
+    const std::vector<const DiagramContext<T>*>& contexts,
+    const OutputPortLocator& id, std::set<OutputPortLocator>* visited) const {
+  if (!visited->insert(id).second) return;
+  const System<T>* const subsystem = id.first;
+  for (InputPortIndex j(0); j < subsystem->num_input_ports(); ++j) {
+    const auto iter = connection_map_.find(InputPortLocator{subsystem, j});
+    if (iter != connection_map_.end()) {
+      EvalSubsystemOutputBatch(contexts, iter->second, visited);
+    }
+  }
+  const SubsystemIndex index = GetSystemIndexOrAbort(subsystem);
+  subsystem->EvalOutputBatch(id.second, GetSubsystemContexts(contexts, index));
+}
+
+template <typename T>
+std::vector<const Context<T>*> Diagram<T>::GetSubsystemContexts(
+    const std::vector<const DiagramContext<T>*>& contexts,
+    SubsystemIndex index) {
+  std::vector<const Context<T>*> result;
+  result.reserve(contexts.size());
+  for (const DiagramContext<T>* context : contexts) {
+    result.push_back(&context->GetSubsystemContext(index));
+  }
+  return result;
 }
 
 template <typename T>
@@ -668,13 +761,18 @@ template <typename T>
 void Diagram<T>::DoGetWitnessFunctions(
     const Context<T>& context,
     std::vector<const WitnessFunction<T>*>* witnesses) const {
-  // A temporary vector is necessary since the vector of witnesses is
-  // declared to be empty on entry to DoGetWitnessFunctions().
-  std::vector<const WitnessFunction<T>*> temp_witnesses;
-
   auto diagram_context = dynamic_cast<const DiagramContext<T>*>(&context);
   DRAKE_DEMAND(diagram_context != nullptr);
 
+  // A temporary vector is necessary since the vector of witnesses is
+  // declared to be empty on entry to DoGetWitnessFunctions(). It is kept in
+  // the cache so that its capacity is reused from one call to the next.
+  std::vector<const WitnessFunction<T>*>& temp_witnesses =
+      this->get_cache_entry(witness_functions_buffer_cache_index_)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<
+              std::vector<const WitnessFunction<T>*>>();
+
   SubsystemIndex index(0);
 
   for (const auto& system : registered_systems_) {
@@ -1192,7 +1290,7 @@ void Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
           events);
 
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+  ForEachSubsystemMaybeInParallel(*diagram_context, [&](SubsystemIndex i) {
     const EventCollection<DiscreteUpdateEvent<T>>& subevents =
         diagram_events.get_subevent_collection(i);
 
@@ -1204,7 +1302,7 @@ void Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       registered_systems_[i]->CalcDiscreteVariableUpdate(
           subcontext, subevents, &subdiscrete);
     }
-  }
+  });
 }
 
 template <typename T>
@@ -1248,7 +1346,7 @@ void Diagram<T>::DispatchUnrestrictedUpdateHandler(
       dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
           events);
 
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+  ForEachSubsystemMaybeInParallel(*diagram_context, [&](SubsystemIndex i) {
     const EventCollection<UnrestrictedUpdateEvent<T>>& subevents =
         diagram_events.get_subevent_collection(i);
 
@@ -1259,7 +1357,7 @@ void Diagram<T>::DispatchUnrestrictedUpdateHandler(
       registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subevents,
                                                      &substate);
     }
-  }
+  });
 }
 
 template <typename T>
@@ -1382,6 +1480,7 @@ Diagram<T>::ConvertScalarType() const {
   }
   // Move the new systems into the blueprint.
   blueprint->systems = std::move(new_systems);
+  blueprint->parallelism = parallelism_;
 
   return blueprint;
 }
@@ -1503,6 +1602,7 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
   connection_map_ = std::move(blueprint->connection_map);
   output_port_ids_ = std::move(blueprint->output_port_ids);
   registered_systems_ = std::move(blueprint->systems);
+  parallelism_ = blueprint->parallelism;
 
   // This cache entry just maintains temporary storage. It is only ever used
   // by DoCalcNextUpdateTime(). Since this declaration of the cache entry
@@ -1516,6 +1616,15 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
               &ValueProducer::NoopCalc),
           {this->nothing_ticket()}).cache_index();
 
+  // Likewise, this cache entry is only ever used by DoGetWitnessFunctions(),
+  // which clears it before use.
+  witness_functions_buffer_cache_index_ =
+      this->DeclareCacheEntry(
+          "witness_functions_buffer", ValueProducer(
+              std::vector<const WitnessFunction<T>*>(),
+              &ValueProducer::NoopCalc),
+          {this->nothing_ticket()}).cache_index();
+
   // Generate a map from the System pointer to its index in the registered
   // order.
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
@@ -1541,6 +1650,7 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
 
   // Every system must appear exactly once.
   DRAKE_DEMAND(registered_systems_.size() == system_index_map_.size());
+  CalcSubsystemGroups();
   // Every port named in the connection_map_ must actually exist.
   DRAKE_ASSERT(PortsAreValid());
   // Every subsystem must have a unique name.
@@ -1704,6 +1814,80 @@ int Diagram<T>::num_subsystems() const {
   return static_cast<int>(registered_systems_.size());
 }
 
+template <typename T>
+void Diagram<T>::CalcSubsystemGroups() {
+  // Union-find over the subsystems, joining the two ends of every connection.
+  const int n = num_subsystems();
+  std::vector<int> parent(n);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find_root = [&parent](int i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  for (const auto& [input_locator, output_locator] : connection_map_) {
+    const int a = find_root(GetSystemIndexOrAbort(input_locator.first));
+    const int b = find_root(GetSystemIndexOrAbort(output_locator.first));
+    if (a != b) parent[std::max(a, b)] = std::min(a, b);
+  }
+
+  // Number the groups in order of their lowest subsystem index.
+  subsystem_groups_.clear();
+  std::vector<int> group_of_root(n, -1);
+  for (SubsystemIndex i(0); i < n; ++i) {
+    const int root = find_root(i);
+    if (group_of_root[root] < 0) {
+      group_of_root[root] = static_cast<int>(subsystem_groups_.size());
+      subsystem_groups_.emplace_back();
+    }
+    subsystem_groups_[group_of_root[root]].push_back(i);
+  }
+}
+
+template <typename T>
+template <typename CalcSubsystem>
+void Diagram<T>::ForEachSubsystemMaybeInParallel(
+    const DiagramContext<T>& context, const CalcSubsystem& calc) const {
+  const int num_groups = static_cast<int>(subsystem_groups_.size());
+  const int num_threads = std::min(parallelism_.num_threads(), num_groups);
+  // Symbolic expressions share reference-counted cells that are not safe to
+  // manipulate concurrently, so only numeric scalar types are parallelized.
+  if (num_threads <= 1 || !scalar_predicate<T>::is_bool) {
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      calc(i);
+    }
+    return;
+  }
+
+  // Each group owns its subcontexts (and thus their caches) exclusively. The
+  // only data that groups may share are this Diagram's input ports, which
+  // might be connected to an output port (cache entry) of some system outside
+  // of this Diagram. Evaluate them all up front so that every subsequent
+  // evaluation is a read-only access of an up-to-date value.
+  for (InputPortIndex k(0); k < this->num_input_ports(); ++k) {
+    this->EvalAbstractInput(context, k);
+  }
+
+  std::vector<std::exception_ptr> errors(num_groups);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int g = 0; g < num_groups; ++g) {
+    try {
+      for (const SubsystemIndex i : subsystem_groups_[g]) {
+        calc(i);
+      }
+    } catch (...) {
+      errors[g] = std::current_exception();
+    }
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
 }  // namespace systems
 }  // namespace drake
 
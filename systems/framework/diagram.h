@@ -4,12 +4,14 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
@@ -244,6 +246,11 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   bool AreConnected(const OutputPort<T>& output,
                     const InputPort<T>& input) const;
 
+  /// Returns the parallelism used when dispatching time derivative, discrete
+  /// update, and unrestricted update computations to this Diagram's
+  /// subsystems. See DiagramBuilder::set_parallelism().
+  Parallelism get_parallelism() const { return parallelism_; }
+
   using System<T>::GetSubsystemContext;
   using System<T>::GetMutableSubsystemContext;
 
@@ -496,6 +503,14 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
       const Context<T>& context, const ContinuousState<T>& proposed_derivatives,
       EigenPtr<VectorX<T>> residual) const final;
 
+  void DoCalcTimeDerivativesBatch(
+      const std::vector<const Context<T>*>& contexts,
+      const std::vector<ContinuousState<T>*>& derivatives) const final;
+
+  void DoEvalOutputBatch(
+      OutputPortIndex port_index,
+      const std::vector<const Context<T>*>& contexts) const final;
+
   // A structural outline of a Diagram, produced by DiagramBuilder.
   struct Blueprint {
     // The ordered subsystem ports that are inputs to the entire diagram.
@@ -514,6 +529,8 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     std::map<InputPortLocator, OutputPortLocator> connection_map;
     // All of the systems to be included in the diagram.
     internal::OwnedSystems<T> systems;
+    // The parallelism used to dispatch independent subsystem computations.
+    Parallelism parallelism;
   };
 
   // Constructs a Diagram from the Blueprint that a DiagramBuilder produces.
@@ -542,6 +559,24 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   const AbstractValue& EvalSubsystemOutputPort(
       const DiagramContext<T>& context, const OutputPortLocator& id) const;
 
+  // Brings the subsystem output port `id` up to date in each of `contexts`
+  // using the subsystem's EvalOutputBatch(). Before doing so, recursively does
+  // the same for every subsystem output port connected to one of that
+  // subsystem's inputs, so that batch-capable subsystems find their inputs
+  // already cached rather than evaluating them one context at a time. Ports
+  // already in `visited` are skipped, which also terminates the recursion
+  // around (non-algebraic) cycles; any value that is not primed this way is
+  // still computed on demand, so the order affects only speed.
+  void EvalSubsystemOutputBatch(
+      const std::vector<const DiagramContext<T>*>& contexts,
+      const OutputPortLocator& id,
+      std::set<OutputPortLocator>* visited) const;
+
+  // Returns the subcontext of subsystem `index` in each of `contexts`.
+  static std::vector<const Context<T>*> GetSubsystemContexts(
+      const std::vector<const DiagramContext<T>*>& contexts,
+      SubsystemIndex index);
+
   // Converts an InputPortLocator to a DiagramContext::InputPortIdentifier.
   // The DiagramContext::InputPortIdentifier contains the index of the System in
   // the diagram, instead of an actual pointer to the System.
@@ -564,6 +599,22 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
   int num_subsystems() const;
 
+  // Partitions the subsystems into groups that share no port connections,
+  // i.e., the connected components of the (undirected) subsystem graph
+  // induced by connection_map_. Each group is sorted by SubsystemIndex.
+  void CalcSubsystemGroups();
+
+  // Invokes `calc(i)` once for every SubsystemIndex i. When parallelism_ is
+  // enabled and there is more than one subsystem group, the groups are
+  // processed concurrently (and the subsystems within a group serially, in
+  // index order); otherwise everything runs serially in index order. The
+  // first exception thrown by `calc` (if any) is rethrown after all groups
+  // have finished. `calc` is a template parameter (rather than a
+  // std::function) so that the serial path never allocates.
+  template <typename CalcSubsystem>
+  void ForEachSubsystemMaybeInParallel(
+      const DiagramContext<T>& context, const CalcSubsystem& calc) const;
+
   // A map from the input ports of constituent systems, to the output ports of
   // the systems from which they get their values.
   std::map<InputPortLocator, OutputPortLocator> connection_map_;
@@ -586,6 +637,18 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // allocated as a cache entry to avoid heap operations during simulation.
   CacheIndex event_times_buffer_cache_index_{};
 
+  // The index of a cache entry that stores a buffer of witness function
+  // pointers. It is only used in DoGetWitnessFunctions(), but is allocated as
+  // a cache entry to avoid heap operations during simulation.
+  CacheIndex witness_functions_buffer_cache_index_{};
+
+  // The parallelism used by ForEachSubsystemMaybeInParallel().
+  Parallelism parallelism_;
+
+  // The subsystems partitioned into independent groups; see
+  // CalcSubsystemGroups().
+  std::vector<std::vector<SubsystemIndex>> subsystem_groups_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
@@ -262,6 +262,33 @@ class DiagramBuilder {
     return registered_systems_.empty();
   }
 
+  /// Sets the parallelism that the built Diagram uses when dispatching time
+  /// derivative, discrete update, and unrestricted update computations to its
+  /// subsystems. The subsystems are partitioned into groups that share no port
+  /// connections (the connected components of the port graph); with more than
+  /// one thread, distinct groups are evaluated concurrently while subsystems
+  /// within a group are still evaluated serially in the order they were added.
+  /// Only the `double` and `AutoDiffXd` scalar types are parallelized, and
+  /// the setting is preserved by scalar conversion. The default is
+  /// Parallelism::None().
+  ///
+  /// @warning Enabling parallelism requires that the derivative and update
+  /// computations of every subsystem be safe to run concurrently with those
+  /// of any other subsystem in a different group; in particular, subsystems
+  /// must not share mutable data outside of the Context. Any input ports of
+  /// the Diagram itself are evaluated before dispatch so that the groups only
+  /// ever read them.
+  void set_parallelism(Parallelism parallelism) {
+    ThrowIfAlreadyBuilt();
+    parallelism_ = parallelism;
+  }
+
+  /// Returns the parallelism set by set_parallelism().
+  Parallelism get_parallelism() const {
+    ThrowIfAlreadyBuilt();
+    return parallelism_;
+  }
+
   /// Returns true iff Build() or BuildInto() has been called on this Builder,
   /// in which case it's an error to call any member function other than the
   /// the destructor.
@@ -465,6 +492,9 @@ class DiagramBuilder {
   // Whether or not Build() or BuildInto() has been called yet.
   bool already_built_{false};
 
+  // The parallelism to be used by the Diagram to be built.
+  Parallelism parallelism_;
+
   // The ordered inputs and outputs of the Diagram to be built.
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<std::string> input_port_names_;
@@ -294,6 +294,17 @@ void DiagramContext<T>::DoPropagateBulkChange(
   }
 }
 
+template <typename T>
+void DiagramContext<T>::DoPropagateCopyFixedInputPortValues(
+    const ContextBase& source) {
+  auto& source_diagram = dynamic_cast<const DiagramContext<T>&>(source);
+  DRAKE_DEMAND(contexts_.size() == source_diagram.contexts_.size());
+  for (SubsystemIndex i(0); i < num_subcontexts(); ++i) {
+    ContextBase::CopyFixedInputPortValues(*source_diagram.contexts_[i],
+                                          &*contexts_[i]);
+  }
+}
+
 template <typename T>
 void DiagramContext<T>::DoPropagateCachingChange(
     void (Cache::*caching_change)()) const {
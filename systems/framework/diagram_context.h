@@ -122,6 +122,11 @@ class DiagramContext final : public Context<T> {
     return *contexts_[index].get();
   }
 
+  /// Returns the number of immediate child subcontexts in this DiagramContext.
+  int num_subcontexts() const {
+    return static_cast<int>(contexts_.size());
+  }
+
  protected:
   /// Protected copy constructor takes care of the local data members and
   /// all base class members, but doesn't update base class pointers so is
@@ -141,11 +146,6 @@ class DiagramContext final : public Context<T> {
   // the (non-empty) subcontexts.
   std::string do_to_string() const final;
 
-  // Returns the number of immediate child subcontexts in this DiagramContext.
-  int num_subcontexts() const {
-    return static_cast<int>(contexts_.size());
-  }
-
   const State<T>& do_access_state() const final {
     DRAKE_ASSERT(state_ != nullptr);
     return *state_;
@@ -170,6 +170,9 @@ class DiagramContext final : public Context<T> {
       int64_t change_event,
       void (ContextBase::*note_bulk_change)(int64_t change_event)) final;
 
+  // Recursively copies fixed input port values into subcontexts.
+  void DoPropagateCopyFixedInputPortValues(const ContextBase& source) final;
+
   // Recursively notifies subcontexts of some caching behavior change.
   void DoPropagateCachingChange(
       void (Cache::*caching_change)()) const final;
@@ -819,6 +819,27 @@ void LeafSystem<T>::DoCalcUnrestrictedUpdate(
   }
 }
 
+template <typename T>
+void LeafSystem<T>::SetVectorOutputBatch(
+    OutputPortIndex port_index, const std::vector<const Context<T>*>& contexts,
+    const Eigen::Ref<const MatrixX<T>>& values) const {
+  const auto& port =
+      dynamic_cast<const LeafOutputPort<T>&>(this->get_output_port(port_index));
+  DRAKE_THROW_UNLESS(port.get_data_type() == kVectorValued);
+  DRAKE_THROW_UNLESS(values.rows() == port.size());
+  DRAKE_THROW_UNLESS(values.cols() == static_cast<int>(contexts.size()));
+  const CacheEntry& cache_entry = port.cache_entry();
+  for (int k = 0; k < values.cols(); ++k) {
+    CacheEntryValue& value =
+        cache_entry.get_mutable_cache_entry_value(*contexts[k]);
+    // A value that is already up to date must equal the one given.
+    if (!value.is_out_of_date()) continue;
+    value.template GetMutableValueOrThrow<BasicVector<T>>().SetFromVector(
+        values.col(k));
+    value.mark_up_to_date();
+  }
+}
+
 template <typename T>
 std::unique_ptr<AbstractValue> LeafSystem<T>::DoAllocateInput(
     const InputPort<T>& input_port) const {
@@ -1918,6 +1918,18 @@ class LeafSystem : public System<T> {
       const std::vector<const UnrestrictedUpdateEvent<T>*>& events,
       State<T>* state) const;
 
+  /** (Advanced) For use by overrides of System::DoEvalOutputBatch(). Sets the
+  value of the vector-valued output port `port_index` in `contexts[k]` to
+  column `k` of `values`, for every k, and marks those values up to date so
+  that subsequent evaluations of the port return them without recomputation.
+  The caller is responsible for ensuring that `values` are the ones that the
+  port's calculator would have produced.
+  @pre `values` has one row per output port element and one column per
+       context. */
+  void SetVectorOutputBatch(OutputPortIndex port_index,
+                            const std::vector<const Context<T>*>& contexts,
+                            const Eigen::Ref<const MatrixX<T>>& values) const;
+
  private:
   using SystemBase::NextInputPortName;
   using SystemBase::NextOutputPortName;
@@ -281,6 +281,32 @@ void System<T>::CalcTimeDerivatives(const Context<T>& context,
   DoCalcTimeDerivatives(context, derivatives);
 }
 
+template <typename T>
+void System<T>::CalcTimeDerivativesBatch(
+    const std::vector<const Context<T>*>& contexts,
+    const std::vector<ContinuousState<T>*>& derivatives) const {
+  DRAKE_THROW_UNLESS(contexts.size() == derivatives.size());
+  for (size_t k = 0; k < contexts.size(); ++k) {
+    DRAKE_THROW_UNLESS(contexts[k] != nullptr);
+    DRAKE_THROW_UNLESS(derivatives[k] != nullptr);
+    ValidateContext(*contexts[k]);
+    ValidateCreatedForThisSystem(derivatives[k]);
+  }
+  DoCalcTimeDerivativesBatch(contexts, derivatives);
+}
+
+template <typename T>
+void System<T>::EvalOutputBatch(
+    OutputPortIndex port_index,
+    const std::vector<const Context<T>*>& contexts) const {
+  DRAKE_THROW_UNLESS(port_index >= 0 && port_index < this->num_output_ports());
+  for (const Context<T>* context : contexts) {
+    DRAKE_THROW_UNLESS(context != nullptr);
+    ValidateContext(*context);
+  }
+  DoEvalOutputBatch(port_index, contexts);
+}
+
 template <typename T>
 void System<T>::CalcImplicitTimeDerivativesResidual(
     const Context<T>& context, const ContinuousState<T>& proposed_derivatives,
@@ -1132,6 +1158,25 @@ void System<T>::DoCalcTimeDerivatives(const Context<T>& context,
   DRAKE_DEMAND(derivatives->size() == 0);
 }
 
+template <typename T>
+void System<T>::DoCalcTimeDerivativesBatch(
+    const std::vector<const Context<T>*>& contexts,
+    const std::vector<ContinuousState<T>*>& derivatives) const {
+  for (size_t k = 0; k < contexts.size(); ++k) {
+    DoCalcTimeDerivatives(*contexts[k], derivatives[k]);
+  }
+}
+
+template <typename T>
+void System<T>::DoEvalOutputBatch(
+    OutputPortIndex port_index,
+    const std::vector<const Context<T>*>& contexts) const {
+  const OutputPort<T>& port = get_output_port(port_index);
+  for (const Context<T>* context : contexts) {
+    port.template Eval<AbstractValue>(*context);
+  }
+}
+
 template <typename T>
 void System<T>::DoCalcImplicitTimeDerivativesResidual(
       const Context<T>& context, const ContinuousState<T>& proposed_derivatives,
@@ -574,6 +574,31 @@ class System : public SystemBase {
       const Context<T>& context, const ContinuousState<T>& proposed_derivatives,
       EigenPtr<VectorX<T>> residual) const;
 
+  /** (Advanced) Calculates the time derivatives for a batch of Contexts of
+  this %System, with the same result as calling CalcTimeDerivatives() for each
+  pair `(contexts[k], derivatives[k])`. This is the entry point used for
+  lockstep simulation of many instances of one %System (see BatchSimulator).
+  Systems that can process a whole batch at once (e.g., using matrix-matrix
+  rather than matrix-vector products) override DoCalcTimeDerivativesBatch();
+  all others are evaluated one Context at a time.
+
+  @throws std::exception if `contexts` and `derivatives` differ in size, or if
+    any entry is null or not valid for this %System. */
+  void CalcTimeDerivativesBatch(
+      const std::vector<const Context<T>*>& contexts,
+      const std::vector<ContinuousState<T>*>& derivatives) const;
+
+  /** (Advanced) Brings the value of the output port `port_index` up to date
+  in each of a batch of Contexts of this %System, with the same result as
+  evaluating the port in each Context. Subsequent evaluations of the port in
+  any of those Contexts will find the cached value. Systems that can compute
+  the outputs for a whole batch at once override DoEvalOutputBatch().
+
+  @throws std::exception if `port_index` is out of range or if any entry of
+    `contexts` is null or not valid for this %System. */
+  void EvalOutputBatch(OutputPortIndex port_index,
+                       const std::vector<const Context<T>*>& contexts) const;
+
   /** This method is the public entry point for dispatching all discrete
   variable update event handlers. Using all the discrete update handlers in
   @p events, the method calculates the update `xd(n+1)` to discrete
@@ -1637,6 +1662,24 @@ class System : public SystemBase {
       const Context<T>& context, const ContinuousState<T>& proposed_derivatives,
       EigenPtr<VectorX<T>> residual) const;
 
+  /** Override this if you can compute the time derivatives for a batch of
+  Contexts more efficiently than one at a time. The public method
+  CalcTimeDerivativesBatch() has already validated the arguments. The default
+  implementation calls DoCalcTimeDerivatives() for each entry. */
+  virtual void DoCalcTimeDerivativesBatch(
+      const std::vector<const Context<T>*>& contexts,
+      const std::vector<ContinuousState<T>*>& derivatives) const;
+
+  /** Override this if you can compute the value of an output port for a
+  batch of Contexts more efficiently than one at a time. The public method
+  EvalOutputBatch() has already validated the arguments. Overrides must leave
+  the port's value up to date in every Context; see
+  LeafSystem::SetVectorOutputBatch(). The default implementation evaluates
+  the port in each Context. */
+  virtual void DoEvalOutputBatch(
+      OutputPortIndex port_index,
+      const std::vector<const Context<T>*>& contexts) const;
+
   /** Computes the next time at which this System must perform a discrete
   action.
 
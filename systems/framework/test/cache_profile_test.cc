@@ -0,0 +1,166 @@
+#include "drake/systems/framework/cache_profile.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using ::testing::HasSubstr;
+
+// A system with one continuous state and two chained cache entries:
+// "square" depends on xc, and "cube" depends on "square" and xc.
+class ChainedCacheSystem final : public LeafSystem<double> {
+ public:
+  ChainedCacheSystem() {
+    this->DeclareContinuousState(1);
+    square_ = &this->DeclareCacheEntry(
+        "square", &ChainedCacheSystem::CalcSquare, {this->xc_ticket()});
+    cube_ = &this->DeclareCacheEntry(
+        "cube", &ChainedCacheSystem::CalcCube,
+        {square_->ticket(), this->xc_ticket()});
+  }
+
+  const CacheEntry& cube() const { return *cube_; }
+
+ private:
+  void CalcSquare(const Context<double>& context, double* result) const {
+    const double x = context.get_continuous_state_vector()[0];
+    *result = x * x;
+  }
+
+  void CalcCube(const Context<double>& context, double* result) const {
+    const double x = context.get_continuous_state_vector()[0];
+    *result = square_->Eval<double>(context) * x;
+  }
+
+  const CacheEntry* square_{};
+  const CacheEntry* cube_{};
+};
+
+class CacheProfileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    system_ = builder.AddSystem<ChainedCacheSystem>();
+    system_->set_name("chain");
+    diagram_ = builder.Build();
+    diagram_->set_name("diagram");
+    context_ = diagram_->CreateDefaultContext();
+  }
+
+  // Evaluates "cube" `num_evals` times for each of the states 1..num_states.
+  void Exercise(int num_states, int num_evals) {
+    Context<double>& subcontext =
+        system_->GetMyMutableContextFromRoot(context_.get());
+    for (int k = 1; k <= num_states; ++k) {
+      subcontext.SetContinuousState(Vector1d(k));
+      for (int i = 0; i < num_evals; ++i) {
+        EXPECT_EQ(system_->cube().Eval<double>(subcontext), k * k * k);
+      }
+    }
+  }
+
+  // Returns the record for the cache entry with the given description in the
+  // "chain" subsystem.
+  static const CacheProfileRecord& Find(
+      const std::vector<CacheProfileRecord>& records,
+      const std::string& description) {
+    for (const CacheProfileRecord& record : records) {
+      if (record.system_pathname == "::diagram::chain" &&
+          record.description == description) {
+        return record;
+      }
+    }
+    throw std::runtime_error("no record for " + description);
+  }
+
+  ChainedCacheSystem* system_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(CacheProfileTest, DisabledByDefault) {
+  Exercise(2, 3);
+  EXPECT_TRUE(CollectCacheProfile(*context_).empty());
+}
+
+TEST_F(CacheProfileTest, HitsMissesAndInvalidations) {
+  context_->EnableCacheProfiling();
+  Exercise(3, 4);
+
+  const std::vector<CacheProfileRecord> records =
+      CollectCacheProfile(*context_);
+  const CacheEntryProfile& cube = Find(records, "cube").profile;
+  const CacheEntryProfile& square = Find(records, "square").profile;
+
+  // Each state is computed once, then found three more times.
+  EXPECT_EQ(cube.num_misses, 3);
+  EXPECT_EQ(cube.num_hits, 9);
+  EXPECT_EQ(cube.calc_intervals.size(), 3);
+  EXPECT_GE(cube.calc_time, 0.0);
+  for (const auto& interval : cube.calc_intervals) {
+    EXPECT_LE(interval.start, interval.end);
+  }
+  // The square is only ever evaluated by the cube's Calc().
+  EXPECT_EQ(square.num_misses, 3);
+  EXPECT_EQ(square.num_hits, 0);
+
+  // The first state found the entries already out of date; each of the two
+  // state changes after that invalidated them.
+  EXPECT_EQ(cube.num_invalidations, 2);
+  EXPECT_EQ(square.num_invalidations, 2);
+  ASSERT_EQ(square.invalidation_causes.size(), 1);
+  EXPECT_THAT(square.invalidation_causes.begin()->first, HasSubstr("xc"));
+  EXPECT_EQ(square.invalidation_causes.begin()->second, 2);
+
+  // Once disabled, the statistics stop changing but remain available.
+  context_->DisableCacheProfiling();
+  Exercise(2, 2);
+  EXPECT_EQ(Find(CollectCacheProfile(*context_), "cube").profile.num_hits, 9);
+
+  // Resetting discards them.
+  context_->ResetCacheProfile();
+  EXPECT_EQ(Find(CollectCacheProfile(*context_), "cube").profile.num_hits, 0);
+
+  // A clone carries the profiling state along.
+  context_->EnableCacheProfiling();
+  auto clone = context_->Clone();
+  system_->cube().Eval<double>(system_->GetMyContextFromRoot(*clone));
+  EXPECT_EQ(Find(CollectCacheProfile(*clone), "cube").profile.num_hits, 1);
+  EXPECT_EQ(Find(CollectCacheProfile(*context_), "cube").profile.num_hits, 0);
+}
+
+TEST_F(CacheProfileTest, Formatting) {
+  context_->EnableCacheProfiling();
+  Exercise(2, 2);
+  const std::vector<CacheProfileRecord> records =
+      CollectCacheProfile(*context_);
+
+  const std::string table = FormatCacheProfileTable(records);
+  EXPECT_THAT(table, HasSubstr("misses"));
+  EXPECT_THAT(table, HasSubstr("::diagram::chain:cube"));
+  EXPECT_THAT(table, HasSubstr("::diagram::chain:square"));
+
+  const std::string trace = FormatCacheProfileChromeTrace(records);
+  EXPECT_THAT(trace, HasSubstr("\"traceEvents\""));
+  EXPECT_THAT(trace, HasSubstr("\"name\":\"::diagram::chain:cube\""));
+  // One complete event per recomputation: two of each entry.
+  int num_events = 0;
+  for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos;
+       pos = trace.find("\"ph\":\"X\"", pos + 1)) {
+    ++num_events;
+  }
+  EXPECT_EQ(num_events, 4);
+
+  EXPECT_EQ(FormatCacheProfileChromeTrace({}),
+            "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,184 @@
+#include "drake/systems/framework/context_pool.h"
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+class ContextPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    auto integrator = builder.AddSystem<Integrator<double>>(2);
+    builder.ExportInput(integrator->get_input_port(), "u");
+    diagram_ = builder.Build();
+    prototype_ = diagram_->CreateDefaultContext();
+    prototype_->SetTime(1.5);
+    prototype_->SetContinuousState(Eigen::Vector2d(1.0, 2.0));
+    diagram_->get_input_port().FixValue(prototype_.get(),
+                                        Eigen::Vector2d(3.0, 4.0));
+  }
+
+  // Scribbles on all of the values that a lease is expected to reset.
+  void Scribble(Context<double>* context) {
+    context->SetTime(99.0);
+    context->SetContinuousState(Eigen::Vector2d(-1.0, -2.0));
+    diagram_->get_input_port().FixValue(context, Eigen::Vector2d(-3.0, -4.0));
+  }
+
+  // Checks that `context` matches prototype_ (which the pool copied).
+  void ExpectMatchesPrototype(const Context<double>& context) {
+    EXPECT_EQ(context.get_time(), 1.5);
+    EXPECT_EQ(context.get_continuous_state_vector().CopyToVector(),
+              Eigen::Vector2d(1.0, 2.0));
+    EXPECT_EQ(diagram_->get_input_port().Eval(context),
+              Eigen::Vector2d(3.0, 4.0));
+    EXPECT_EQ(diagram_->EvalTimeDerivatives(context).CopyToVector(),
+              Eigen::Vector2d(3.0, 4.0));
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> prototype_;
+};
+
+TEST_F(ContextPoolTest, Construction) {
+  const ContextPool<double> dut(*prototype_, 3);
+  EXPECT_EQ(dut.num_contexts(), 3);
+  EXPECT_EQ(dut.num_leased(), 0);
+  EXPECT_NE(&dut.prototype(), prototype_.get());
+  ExpectMatchesPrototype(dut.prototype());
+  for (int i = 0; i < dut.num_contexts(); ++i) {
+    ExpectMatchesPrototype(dut.get_mutable_context(i));
+    EXPECT_NE(&dut.get_mutable_context(i), &dut.prototype());
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.get_mutable_context(3),
+                              ".*index 3 is out of range.*");
+
+  EXPECT_THROW(ContextPool<double>(*prototype_, 0), std::exception);
+}
+
+// Leases recycle the pooled contexts and reset them to the prototype.
+TEST_F(ContextPoolTest, AcquireAndRelease) {
+  const ContextPool<double> dut(*prototype_, 2);
+  const Context<double>* first{};
+  {
+    auto lease = dut.Acquire();
+    EXPECT_TRUE(lease.is_pooled());
+    EXPECT_EQ(dut.num_leased(), 1);
+    ExpectMatchesPrototype(*lease);
+    Scribble(&lease.get());
+    first = &lease.get();
+  }
+  EXPECT_EQ(dut.num_leased(), 0);
+
+  // Hold on to both contexts; one of them must be the one we scribbled on,
+  // and both must have been reset.
+  auto lease0 = dut.Acquire();
+  auto lease1 = dut.Acquire();
+  EXPECT_TRUE(lease0.is_pooled());
+  EXPECT_TRUE(lease1.is_pooled());
+  EXPECT_NE(&lease0.get(), &lease1.get());
+  EXPECT_TRUE(&lease0.get() == first || &lease1.get() == first);
+  EXPECT_EQ(dut.num_leased(), 2);
+  ExpectMatchesPrototype(*lease0);
+  ExpectMatchesPrototype(*lease1);
+
+  // The pool is exhausted, so the next lease gets a private clone.
+  {
+    auto overflow = dut.Acquire();
+    EXPECT_FALSE(overflow.is_pooled());
+    EXPECT_EQ(dut.num_leased(), 2);
+    ExpectMatchesPrototype(*overflow);
+  }
+
+  // Moving a lease transfers the obligation to release it.
+  ContextPool<double>::Lease moved = std::move(lease0);
+  EXPECT_EQ(dut.num_leased(), 2);
+  moved = std::move(lease1);
+  EXPECT_EQ(dut.num_leased(), 1);
+}
+
+TEST_F(ContextPoolTest, SetPrototypeFrom) {
+  ContextPool<double> dut(*prototype_, 1);
+  auto source = prototype_->Clone();
+  source->SetTime(2.5);
+  dut.SetPrototypeFrom(*source);
+  auto lease = dut.Acquire();
+  EXPECT_EQ(lease->get_time(), 2.5);
+
+  // The prototype cannot change while a context is leased.
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.SetPrototypeFrom(*prototype_),
+                              ".*num_leased\\(\\) == 0.*");
+}
+
+// A lessee that fixes an input port the prototype leaves unfixed does not
+// poison the pool: the next lease of that slot matches the prototype again.
+TEST_F(ContextPoolTest, FixedInputPortInLease) {
+  const auto unfixed = diagram_->CreateDefaultContext();
+  unfixed->SetTime(1.5);
+  const ContextPool<double> dut(*unfixed, 1);
+  {
+    auto lease = dut.Acquire();
+    EXPECT_EQ(lease->MaybeGetFixedInputPortValue(0), nullptr);
+    Scribble(&lease.get());
+    EXPECT_NE(lease->MaybeGetFixedInputPortValue(0), nullptr);
+  }
+  const Context<double>* slot{};
+  for (int i = 0; i < 2; ++i) {
+    auto lease = dut.Acquire();
+    EXPECT_TRUE(lease.is_pooled());
+    EXPECT_EQ(lease->MaybeGetFixedInputPortValue(0), nullptr);
+    EXPECT_EQ(lease->get_time(), 1.5);
+    EXPECT_EQ(lease->get_continuous_state_vector().CopyToVector(),
+              Eigen::Vector2d::Zero());
+    if (i == 0) {
+      slot = &lease.get();
+    } else {
+      // Once it matches the prototype again, the slot is reused in place.
+      EXPECT_EQ(&lease.get(), slot);
+    }
+  }
+}
+
+// Many threads contending for a small pool each get exclusive use of a
+// context for the duration of their lease.
+TEST_F(ContextPoolTest, ConcurrentAcquire) {
+  const ContextPool<double> dut(*prototype_, 2);
+  constexpr int kNumThreads = 4;
+  constexpr int kNumIterations = 50;
+  std::vector<int> failures(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([this, &dut, &failures, t]() {
+      for (int k = 0; k < kNumIterations; ++k) {
+        auto lease = dut.Acquire();
+        if (lease->get_time() != 1.5) ++failures[t];
+        const double mine = 100.0 * t + k;
+        lease->SetTime(mine);
+        std::this_thread::yield();
+        if (lease->get_time() != mine) ++failures[t];
+        Scribble(&lease.get());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int t = 0; t < kNumThreads; ++t) {
+    EXPECT_EQ(failures[t], 0);
+  }
+  EXPECT_EQ(dut.num_leased(), 0);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -747,6 +747,53 @@ TEST_F(DiagramContextTest, Clone) {
   }
 }
 
+// Tests that SetFrom() copies time, accuracy, state, parameters, and fixed
+// input port values into an existing clone, in place.
+TEST_F(DiagramContextTest, SetFrom) {
+  AttachInputPorts();
+  auto clone = dynamic_pointer_cast<DiagramContext<double>>(context_->Clone());
+  ASSERT_TRUE(clone != nullptr);
+
+  clone->SetTime(kTime + 1.0);
+  clone->SetAccuracy(1e-3);
+  clone->get_mutable_continuous_state_vector()[0] = 1024.0;
+  clone->get_mutable_discrete_state(0)[0] = -1.0;
+  clone->get_mutable_abstract_state<int>(0) = 12345;
+  clone->get_mutable_numeric_parameter(0).SetAtIndex(0, -2.0);
+  clone->get_mutable_abstract_parameter(0).set_value<int>(101);
+  clone->FixInputPort(0, Value<BasicVector<double>>(Vector1<double>(-8.0)));
+  const FixedInputPortValue* clone_port =
+      clone->MaybeGetFixedInputPortValue(0);
+  const int64_t serial_number = clone_port->serial_number();
+
+  // This is the method under test.
+  clone->SetFrom(*context_);
+
+  EXPECT_EQ(clone->get_time(), kTime);
+  EXPECT_EQ(clone->get_accuracy(), context_->get_accuracy());
+  VerifyClonedState(clone->get_state());
+  VerifyClonedParameters(clone->get_parameters());
+  // The fixed input port values were assigned in place.
+  EXPECT_EQ(clone->MaybeGetFixedInputPortValue(0), clone_port);
+  EXPECT_GT(clone_port->serial_number(), serial_number);
+  EXPECT_EQ(ReadVectorInputPort(*clone, 0)->get_value()[0], 128.0);
+  EXPECT_EQ(ReadVectorInputPort(*clone, 1)->get_value()[0], 256.0);
+
+  // Only root contexts may be set.
+  auto& subcontext = clone->GetMutableSubsystemContext(SubsystemIndex{0});
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      subcontext.SetFrom(context_->GetSubsystemContext(SubsystemIndex{0})),
+      "SetFrom\\(\\): Time change allowed only in the root Context.");
+
+  // The set of fixed input ports must match.
+  auto unfixed = dynamic_pointer_cast<DiagramContext<double>>(clone->Clone());
+  context_->GetMutableSubsystemContext(SubsystemIndex{0})
+      .FixInputPort(0, Value<BasicVector<double>>(Vector1<double>(1.0)));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      unfixed->SetFrom(*context_),
+      ".*input port 0 of .*adder0 is fixed in only one of the two contexts.");
+}
+
 TEST_F(DiagramContextTest, CloneState) {
   std::unique_ptr<State<double>> state = context_->CloneState();
   // Verify that the state was copied.
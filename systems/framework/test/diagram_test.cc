@@ -3836,6 +3836,72 @@ GTEST_TEST(ImplicitTimeDerivatives, DiagramProcessing) {
   EXPECT_EQ(residual, expected_result);
 }
 
+// Builds a diagram of several independent "stations", each of which is a
+// source feeding a gain, with the gain feeding both an integrator and a
+// zero-order hold. Two more integrators share a single exported input.
+std::unique_ptr<Diagram<double>> MakeStationsDiagram(Parallelism parallelism) {
+  constexpr int kSize = 2;
+  DiagramBuilder<double> builder;
+  for (int k = 0; k < 4; ++k) {
+    auto source = builder.AddSystem<ConstantVectorSource<double>>(
+        Vector2d(k, k + 1.0));
+    auto gain = builder.AddSystem<Gain<double>>(k + 2.0, kSize);
+    auto integrator = builder.AddSystem<Integrator<double>>(kSize);
+    auto hold = builder.AddSystem<ZeroOrderHold<double>>(0.25, kSize);
+    builder.Connect(source->get_output_port(), gain->get_input_port());
+    builder.Connect(gain->get_output_port(), integrator->get_input_port());
+    builder.Connect(gain->get_output_port(), hold->get_input_port());
+  }
+  auto shared0 = builder.AddSystem<Integrator<double>>(kSize);
+  auto shared1 = builder.AddSystem<Integrator<double>>(kSize);
+  builder.ExportInput(shared0->get_input_port(), "u");
+  builder.ConnectInput("u", shared1->get_input_port());
+  builder.set_parallelism(parallelism);
+  return builder.Build();
+}
+
+// Tests that dispatching to independent subsystem groups in parallel produces
+// the same derivatives and discrete updates as serial dispatch.
+GTEST_TEST(DiagramParallelismTest, MatchesSerial) {
+  const auto serial = MakeStationsDiagram(Parallelism::None());
+  const auto parallel = MakeStationsDiagram(Parallelism(4));
+  EXPECT_EQ(serial->get_parallelism().num_threads(), 1);
+  EXPECT_EQ(parallel->get_parallelism().num_threads(), 4);
+
+  std::vector<VectorXd> derivatives;
+  std::vector<VectorXd> updates;
+  for (const Diagram<double>* diagram : {serial.get(), parallel.get()}) {
+    auto context = diagram->CreateDefaultContext();
+    diagram->get_input_port(0).FixValue(context.get(), Vector2d(3.0, 4.0));
+    context->SetContinuousState(
+        VectorXd::LinSpaced(diagram->num_continuous_states(), 1.0, 2.0));
+    derivatives.push_back(
+        diagram->EvalTimeDerivatives(*context).CopyToVector());
+    const DiscreteValues<double>& xd =
+        diagram->EvalUniquePeriodicDiscreteUpdate(*context);
+    VectorXd update(2 * xd.num_groups());
+    for (int g = 0; g < xd.num_groups(); ++g) {
+      update.segment<2>(2 * g) = xd.value(g);
+    }
+    updates.push_back(update);
+  }
+  EXPECT_EQ(derivatives[0], derivatives[1]);
+  EXPECT_EQ(updates[0], updates[1]);
+  EXPECT_EQ(derivatives[1].tail<4>(), Vector4d(3.0, 4.0, 3.0, 4.0));
+  EXPECT_EQ(updates[1].head<2>(), Vector2d(0.0, 2.0));
+
+  // Scalar conversion preserves the setting.
+  EXPECT_EQ(
+      System<double>::ToAutoDiffXd(*parallel)->get_parallelism().num_threads(),
+      4);
+
+  // The builder refuses changes once the diagram is built.
+  DiagramBuilder<double> builder;
+  builder.AddSystem<Adder<double>>(1, 1);
+  builder.Build();
+  EXPECT_THROW(builder.set_parallelism(Parallelism::Max()), std::exception);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
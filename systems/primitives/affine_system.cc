@@ -466,6 +466,65 @@ void AffineSystem<T>::DoCalcTimeDerivatives(
   derivatives->SetFromVector(xdot);
 }
 
+template <typename T>
+void AffineSystem<T>::DoCalcTimeDerivativesBatch(
+    const std::vector<const Context<T>*>& contexts,
+    const std::vector<ContinuousState<T>*>& derivatives) const {
+  if (this->num_states() == 0 || this->time_period() > 0.0) return;
+
+  const int batch_size = static_cast<int>(contexts.size());
+  MatrixX<T> xdot = f0_.replicate(1, batch_size);
+  xdot += A_.template cast<T>() * GatherContinuousStates(contexts);
+  if (this->num_inputs() > 0) {
+    xdot += B_.template cast<T>() * GatherInputs(contexts);
+  }
+  for (int k = 0; k < batch_size; ++k) {
+    derivatives[k]->SetFromVector(xdot.col(k));
+  }
+}
+
+template <typename T>
+void AffineSystem<T>::DoEvalOutputBatch(
+    OutputPortIndex port_index,
+    const std::vector<const Context<T>*>& contexts) const {
+  if (this->time_period() > 0.0) {
+    TimeVaryingAffineSystem<T>::DoEvalOutputBatch(port_index, contexts);
+    return;
+  }
+
+  const int batch_size = static_cast<int>(contexts.size());
+  MatrixX<T> y = y0_.replicate(1, batch_size);
+  if (has_meaningful_C_) {
+    y += C_.template cast<T>() * GatherContinuousStates(contexts);
+  }
+  if (has_meaningful_D_) {
+    y += D_.template cast<T>() * GatherInputs(contexts);
+  }
+  this->SetVectorOutputBatch(port_index, contexts, y);
+}
+
+template <typename T>
+MatrixX<T> AffineSystem<T>::GatherContinuousStates(
+    const std::vector<const Context<T>*>& contexts) const {
+  MatrixX<T> x(this->num_states(), contexts.size());
+  for (int k = 0; k < x.cols(); ++k) {
+    x.col(k) = dynamic_cast<const BasicVector<T>&>(
+                   contexts[k]->get_continuous_state_vector())
+                   .get_value();
+  }
+  return x;
+}
+
+template <typename T>
+MatrixX<T> AffineSystem<T>::GatherInputs(
+    const std::vector<const Context<T>*>& contexts) const {
+  MatrixX<T> u(this->num_inputs(), contexts.size());
+  for (int k = 0; k < u.cols(); ++k) {
+    u.col(k) = this->get_input_port().Eval(*contexts[k]);
+  }
+  return u;
+}
+
 // Overrides the base class default event handler with a simpler one.
 template <typename T>
 EventStatus AffineSystem<T>::CalcDiscreteUpdate(
@@ -278,6 +278,22 @@ class AffineSystem : public TimeVaryingAffineSystem<T> {
   void DoCalcTimeDerivatives(const Context<T>& context,
                              ContinuousState<T>* derivatives) const final;
 
+  // Stacks the states and inputs of a batch of contexts as matrix columns so
+  // that the whole batch is computed with matrix-matrix products.
+  void DoCalcTimeDerivativesBatch(
+      const std::vector<const Context<T>*>& contexts,
+      const std::vector<ContinuousState<T>*>& derivatives) const final;
+
+  void DoEvalOutputBatch(
+      OutputPortIndex port_index,
+      const std::vector<const Context<T>*>& contexts) const final;
+
+  // Returns the continuous states (or inputs) of `contexts` as the columns of
+  // a matrix.
+  MatrixX<T> GatherContinuousStates(
+      const std::vector<const Context<T>*>& contexts) const;
+  MatrixX<T> GatherInputs(const std::vector<const Context<T>*>& contexts) const;
+
   // We can simplify the discrete update event handler here.
   EventStatus CalcDiscreteUpdate(
       const Context<T>& context, DiscreteValues<T>* updates) const final;
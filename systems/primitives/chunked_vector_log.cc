@@ -0,0 +1,401 @@
+#include "drake/systems/primitives/chunked_vector_log.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/fmt.h"
+#include "drake/common/unused.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+// A scratch file holding the spilled chunks of a ChunkedVectorLog<double>.
+// The file starts with four 64-bit words (a magic number, the input size, the
+// chunk size, and the number of samples written so far), followed by the
+// chunks in order. Each chunk holds `chunk_size` times, then for each element
+// of the input vector, that element's `chunk_size` values.
+class VectorLogSpillFile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VectorLogSpillFile)
+
+  VectorLogSpillFile(const std::string& directory, int input_size,
+                     int chunk_size)
+      : input_size_(input_size),
+        chunk_size_(chunk_size),
+        buffer_(static_cast<size_t>(input_size + 1) * chunk_size) {
+    std::string path_template =
+        (std::filesystem::path(directory) / "vector_log_XXXXXX").string();
+    fd_ = ::mkstemp(&path_template[0]);
+    if (fd_ < 0) {
+      throw std::runtime_error(fmt::format(
+          "ChunkedVectorLog: could not create a spill file in '{}': {}",
+          directory, std::strerror(errno)));
+    }
+    filename_ = std::move(path_template);
+    WriteHeader();
+  }
+
+  ~VectorLogSpillFile() {
+    if (map_ != nullptr) {
+      ::munmap(map_, map_size_);
+    }
+    ::close(fd_);
+    ::unlink(filename_.c_str());
+  }
+
+  const std::string& filename() const { return filename_; }
+
+  int64_t num_chunks() const { return num_chunks_; }
+
+  // Appends one full chunk.
+  void Append(const VectorX<double>& times, const MatrixX<double>& data) {
+    DRAKE_DEMAND(times.size() == chunk_size_);
+    DRAKE_DEMAND(data.rows() == input_size_ && data.cols() == chunk_size_);
+    // Transpose into the columnar layout.
+    Eigen::Map<VectorX<double>>(buffer_.data(), chunk_size_) = times;
+    Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                             Eigen::RowMajor>>(
+        buffer_.data() + chunk_size_, input_size_, chunk_size_) = data;
+    Write(buffer_.data(), chunk_bytes(), chunk_offset(num_chunks_));
+    ++num_chunks_;
+    WriteHeader();
+  }
+
+  // Returns the start of the `k`'th chunk, mapping the file as needed. The
+  // pointer remains valid until a call to chunk() that follows Append(). This
+  // may be called concurrently (but not concurrently with Append()); the lazy
+  // remapping is guarded by a mutex.
+  const double* chunk(int64_t k) const {
+    DRAKE_DEMAND(0 <= k && k < num_chunks_);
+    const size_t required = chunk_offset(num_chunks_);
+    std::lock_guard<std::mutex> guard(map_mutex_);
+    if (map_size_ < required) {
+      if (map_ != nullptr) {
+        ::munmap(map_, map_size_);
+        map_ = nullptr;
+        map_size_ = 0;
+      }
+      void* map = ::mmap(nullptr, required, PROT_READ, MAP_SHARED, fd_, 0);
+      if (map == MAP_FAILED) {
+        throw std::runtime_error(fmt::format(
+            "ChunkedVectorLog: could not map the spill file '{}': {}",
+            filename_, std::strerror(errno)));
+      }
+      map_ = map;
+      map_size_ = required;
+    }
+    return reinterpret_cast<const double*>(static_cast<const char*>(map_) +
+                                           chunk_offset(k));
+  }
+
+ private:
+  static constexpr size_t kHeaderBytes = 4 * sizeof(int64_t);
+
+  size_t chunk_bytes() const { return buffer_.size() * sizeof(double); }
+
+  size_t chunk_offset(int64_t k) const {
+    return kHeaderBytes + static_cast<size_t>(k) * chunk_bytes();
+  }
+
+  void WriteHeader() {
+    int64_t header[4] = {0, input_size_, chunk_size_,
+                         num_chunks_ * chunk_size_};
+    std::memcpy(&header[0], "DRKVLOG1", sizeof(int64_t));
+    Write(header, kHeaderBytes, 0);
+  }
+
+  void Write(const void* source, size_t size, size_t offset) {
+    const char* bytes = static_cast<const char*>(source);
+    while (size > 0) {
+      const ssize_t written = ::pwrite(fd_, bytes, size, offset);
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        throw std::runtime_error(fmt::format(
+            "ChunkedVectorLog: could not write to the spill file '{}': {}",
+            filename_, std::strerror(errno)));
+      }
+      bytes += written;
+      size -= written;
+      offset += written;
+    }
+  }
+
+  const int input_size_;
+  const int chunk_size_;
+  std::string filename_;
+  int fd_{-1};
+  int64_t num_chunks_{0};
+  // Scratch space for transposing one chunk.
+  std::vector<double> buffer_;
+  // The read-only mapping of the file, which chunk() grows lazily.
+  mutable std::mutex map_mutex_;
+  mutable void* map_{};
+  mutable size_t map_size_{0};
+};
+
+}  // namespace internal
+
+template <typename T>
+ChunkedVectorLog<T>::ChunkedVectorLog(int input_size,
+                                      const ChunkedVectorLogConfig& config)
+    : input_size_(input_size), config_(config) {
+  DRAKE_THROW_UNLESS(input_size >= 0);
+  DRAKE_THROW_UNLESS(config.chunk_size > 0);
+  if (config.ring_duration.has_value()) {
+    DRAKE_THROW_UNLESS(*config.ring_duration >= 0.0);
+  }
+  if (config.spill_directory.has_value()) {
+    if constexpr (!std::is_same_v<T, double>) {
+      throw std::logic_error(
+          "ChunkedVectorLog: spill_directory is only supported for T = "
+          "double");
+    }
+    if (config.ring_duration.has_value()) {
+      throw std::logic_error(
+          "ChunkedVectorLog: spill_directory and ring_duration cannot be "
+          "combined");
+    }
+  }
+}
+
+template <typename T>
+ChunkedVectorLog<T>::ChunkedVectorLog(const ChunkedVectorLog& other)
+    : input_size_(other.input_size_), config_(other.config_) {
+  if (other.spill_file_ != nullptr) {
+    throw std::logic_error(fmt::format(
+        "ChunkedVectorLog: cannot copy a log that has spilled to '{}'",
+        other.spill_file_->filename()));
+  }
+  chunks_ = other.chunks_;
+  back_count_ = other.back_count_;
+  num_discarded_samples_ = other.num_discarded_samples_;
+}
+
+template <typename T>
+ChunkedVectorLog<T>& ChunkedVectorLog<T>::operator=(
+    const ChunkedVectorLog& other) {
+  if (this != &other) {
+    *this = ChunkedVectorLog<T>(other);
+  }
+  return *this;
+}
+
+template <typename T>
+ChunkedVectorLog<T>::ChunkedVectorLog(ChunkedVectorLog&&) = default;
+
+template <typename T>
+ChunkedVectorLog<T>& ChunkedVectorLog<T>::operator=(ChunkedVectorLog&& other) {
+  if (this != &other) {
+    input_size_ = other.input_size_;
+    config_ = other.config_;
+    // Unlike their move constructors, the containers' move assignment does
+    // not promise to leave `other` empty, so be explicit.
+    chunks_ = std::move(other.chunks_);
+    other.chunks_.clear();
+    back_count_ = std::move(other.back_count_);
+    num_discarded_samples_ = std::move(other.num_discarded_samples_);
+    num_spilled_samples_ = std::move(other.num_spilled_samples_);
+    spare_chunks_ = std::move(other.spare_chunks_);
+    other.spare_chunks_.clear();
+    spill_file_ = std::move(other.spill_file_);
+  }
+  return *this;
+}
+
+template <typename T>
+ChunkedVectorLog<T>::~ChunkedVectorLog() = default;
+
+template <typename T>
+std::string ChunkedVectorLog<T>::spill_filename() const {
+  return spill_file_ != nullptr ? spill_file_->filename() : std::string();
+}
+
+template <typename T>
+T ChunkedVectorLog<T>::sample_time(int64_t i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_samples());
+  const int64_t chunk_size = config_.chunk_size;
+  if (i < num_spilled_samples_) {
+    if constexpr (std::is_same_v<T, double>) {
+      return spill_file_->chunk(i / chunk_size)[i % chunk_size];
+    }
+    DRAKE_UNREACHABLE();
+  }
+  i -= num_spilled_samples_;
+  return chunks_[i / chunk_size].times(i % chunk_size);
+}
+
+template <typename T>
+VectorX<T> ChunkedVectorLog<T>::sample(int64_t i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_samples());
+  const int64_t chunk_size = config_.chunk_size;
+  if (i < num_spilled_samples_) {
+    if constexpr (std::is_same_v<T, double>) {
+      const double* chunk = spill_file_->chunk(i / chunk_size);
+      return Eigen::Map<const VectorX<double>, 0, Eigen::InnerStride<>>(
+          chunk + chunk_size + i % chunk_size, input_size_,
+          Eigen::InnerStride<>(chunk_size));
+    }
+    DRAKE_UNREACHABLE();
+  }
+  i -= num_spilled_samples_;
+  return chunks_[i / chunk_size].data.col(i % chunk_size);
+}
+
+template <typename T>
+template <typename Visitor>
+void ChunkedVectorLog<T>::VisitSamples(Visitor&& visit) const {
+  const int chunk_size = config_.chunk_size;
+  if (num_spilled_samples_ > 0) {
+    if constexpr (std::is_same_v<T, double>) {
+      for (int64_t k = 0; k < spill_file_->num_chunks(); ++k) {
+        const double* chunk = spill_file_->chunk(k);
+        visit(Eigen::Map<const VectorX<double>>(chunk, chunk_size),
+              Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic,
+                                             Eigen::Dynamic, Eigen::RowMajor>>(
+                  chunk + chunk_size, input_size_, chunk_size));
+      }
+    } else {
+      DRAKE_UNREACHABLE();
+    }
+  }
+  for (size_t k = 0; k < chunks_.size(); ++k) {
+    const int64_t count =
+        (k + 1 == chunks_.size()) ? int64_t{back_count_} : chunk_size;
+    visit(chunks_[k].times.head(count), chunks_[k].data.leftCols(count));
+  }
+}
+
+template <typename T>
+VectorX<T> ChunkedVectorLog<T>::sample_times() const {
+  VectorX<T> result(num_samples());
+  int64_t offset = 0;
+  VisitSamples([&](const auto& times, const auto& data) {
+    unused(data);
+    result.segment(offset, times.size()) = times;
+    offset += times.size();
+  });
+  return result;
+}
+
+template <typename T>
+MatrixX<T> ChunkedVectorLog<T>::data() const {
+  MatrixX<T> result(input_size_, num_samples());
+  int64_t offset = 0;
+  VisitSamples([&](const auto& times, const auto& data) {
+    unused(times);
+    result.middleCols(offset, data.cols()) = data;
+    offset += data.cols();
+  });
+  return result;
+}
+
+template <typename T>
+VectorLog<T> ChunkedVectorLog<T>::ToVectorLog() const {
+  VectorLog<T> result(input_size_);
+  result.Reserve(num_samples());
+  VectorX<T> sample(input_size_);
+  VisitSamples([&](const auto& times, const auto& data) {
+    for (int j = 0; j < times.size(); ++j) {
+      sample = data.col(j);
+      result.AddData(times(j), sample);
+    }
+  });
+  return result;
+}
+
+template <typename T>
+void ChunkedVectorLog<T>::Clear() {
+  for (Chunk& chunk : chunks_) {
+    spare_chunks_.push_back(std::move(chunk));
+  }
+  chunks_.clear();
+  back_count_ = 0;
+  num_discarded_samples_ = 0;
+  num_spilled_samples_ = 0;
+  spill_file_.reset();
+}
+
+template <typename T>
+void ChunkedVectorLog<T>::AddData(const T& time, const VectorX<T>& sample) {
+  DRAKE_THROW_UNLESS(sample.size() == input_size_);
+  if (chunks_.empty() || back_count_ == config_.chunk_size) {
+    PushChunk();
+  }
+  Chunk& back = chunks_.back();
+  back.times(int64_t{back_count_}) = time;
+  back.data.col(int64_t{back_count_}) = sample;
+  ++back_count_;
+  if (config_.ring_duration.has_value()) {
+    DiscardExpiredChunks(time);
+  }
+}
+
+template <typename T>
+void ChunkedVectorLog<T>::PushChunk() {
+  // In spill mode, the (full) chunk we are about to move on from is the only
+  // one in memory.
+  if (config_.spill_directory.has_value() && !chunks_.empty()) {
+    DRAKE_DEMAND(chunks_.size() == 1);
+    SpillFrontChunk();
+  }
+  Chunk chunk;
+  if (!spare_chunks_.empty()) {
+    chunk = std::move(spare_chunks_.back());
+    spare_chunks_.pop_back();
+  } else {
+    chunk.times.resize(config_.chunk_size);
+    chunk.data.resize(input_size_, config_.chunk_size);
+  }
+  chunks_.push_back(std::move(chunk));
+  back_count_ = 0;
+}
+
+template <typename T>
+void ChunkedVectorLog<T>::SpillFrontChunk() {
+  if constexpr (std::is_same_v<T, double>) {
+    if (spill_file_ == nullptr) {
+      spill_file_ = std::make_unique<internal::VectorLogSpillFile>(
+          *config_.spill_directory, input_size_, config_.chunk_size);
+    }
+    spill_file_->Append(chunks_.front().times, chunks_.front().data);
+    num_spilled_samples_ += config_.chunk_size;
+    spare_chunks_.push_back(std::move(chunks_.front()));
+    chunks_.pop_front();
+  } else {
+    DRAKE_UNREACHABLE();
+  }
+}
+
+template <typename T>
+void ChunkedVectorLog<T>::DiscardExpiredChunks(const T& newest_time) {
+  const int64_t last = config_.chunk_size - 1;
+  while (chunks_.size() > 1) {
+    const T age = newest_time - chunks_.front().times(last);
+    if (!(ExtractDoubleOrThrow(age) > *config_.ring_duration)) {
+      break;
+    }
+    spare_chunks_.push_back(std::move(chunks_.front()));
+    chunks_.pop_front();
+    num_discarded_samples_ += config_.chunk_size;
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ChunkedVectorLog)
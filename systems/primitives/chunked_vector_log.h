@@ -0,0 +1,204 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/name_value.h"
+#include "drake/common/reset_after_move.h"
+#include "drake/systems/primitives/vector_log.h"
+
+namespace drake {
+namespace systems {
+
+/// The storage options for a ChunkedVectorLog.
+struct ChunkedVectorLogConfig {
+  /// Passes this object to an Archive.
+  /// Refer to @ref yaml_serialization "YAML Serialization" for background.
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(chunk_size));
+    a->Visit(DRAKE_NVP(ring_duration));
+    a->Visit(DRAKE_NVP(spill_directory));
+  }
+
+  /// The number of samples stored in each fixed-size chunk. Must be positive.
+  int chunk_size{1000};
+
+  /// When set, the log only retains the most recent samples: whole chunks
+  /// whose every sample is more than this many seconds older than the newest
+  /// sample are discarded (and their storage reused), so at least the last
+  /// `ring_duration` seconds are always available. Must be non-negative.
+  std::optional<double> ring_duration;
+
+  /// When set, each chunk is written to a file in this (existing) directory as
+  /// soon as it is full, so that only one chunk is ever held in memory. The
+  /// file is read back through a read-only memory map, and is deleted when
+  /// the log is cleared or destroyed. Only supported when T = double, and
+  /// cannot be combined with `ring_duration`.
+  std::optional<std::string> spill_directory;
+};
+
+namespace internal {
+class VectorLogSpillFile;
+}  // namespace internal
+
+/**
+ This utility class is an alternative to VectorLog for very long recordings.
+ Rather than a single matrix that is reallocated (and copied) whenever it
+ fills up, samples are appended to a sequence of fixed-size chunks, so adding
+ a sample is O(1) and never copies previously logged data. Like VectorLog,
+ this is a standalone class, not a Drake System; VectorLogSink uses it when
+ given a ChunkedVectorLogConfig.
+
+ Two optional modes bound its memory use (see ChunkedVectorLogConfig):
+
+ - In ring-buffer mode, only the most recent `ring_duration` seconds are
+   retained. Discarded chunks are recycled, so once the window is full,
+   logging does not allocate at all.
+ - In spill mode (T = double only), full chunks are written to an on-disk
+   file in a columnar layout: after a small header, each chunk stores its
+   `chunk_size` times followed by, for each element of the input vector, that
+   element's `chunk_size` values. Spilled samples remain accessible through
+   this class's accessors, which read them back via a memory map.
+
+ Because the samples are not contiguous in memory, sample_times() and data()
+ return copies; prefer sample_time() and sample() to inspect a few samples,
+ or ToVectorLog() to hand the whole log to code that expects a VectorLog.
+
+ Ring-buffer mode assumes that sample times are non-decreasing; otherwise,
+ this object imposes no constraints on the stored data.
+
+ A log that has spilled to disk cannot be copied (copying throws), since the
+ copy would have to duplicate the file. It can be moved.
+
+ As usual, the const accessors may be called concurrently (including for
+ spilled samples), but not concurrently with AddData() or Clear().
+
+ @tparam_default_scalar
+ */
+template <typename T>
+class ChunkedVectorLog {
+ public:
+  ChunkedVectorLog(const ChunkedVectorLog&);
+  ChunkedVectorLog& operator=(const ChunkedVectorLog&);
+  ChunkedVectorLog(ChunkedVectorLog&&);
+  ChunkedVectorLog& operator=(ChunkedVectorLog&&);
+
+  /** Constructs the log.
+   @param input_size  Dimension of the per-time step data set.
+   @param config      The storage options.
+   @throws std::exception if `config` is invalid (see ChunkedVectorLogConfig).
+   */
+  explicit ChunkedVectorLog(int input_size,
+                            const ChunkedVectorLogConfig& config = {});
+
+  ~ChunkedVectorLog();
+
+  /** Reports the size of the log's input vector. */
+  int get_input_size() const { return input_size_; }
+
+  /** Returns the storage options. */
+  const ChunkedVectorLogConfig& config() const { return config_; }
+
+  /** Returns the number of samples currently available, i.e., taken since
+   construction or the last Clear() and not yet discarded by the ring buffer.
+   */
+  int64_t num_samples() const {
+    return num_spilled_samples_ + num_in_memory_samples();
+  }
+
+  /** Returns the number of samples discarded by the ring buffer since
+   construction or the last Clear(). Sample `i` of this log is the
+   `(num_discarded_samples() + i)`'th sample that was added. */
+  int64_t num_discarded_samples() const { return num_discarded_samples_; }
+
+  /** Returns the number of (leading) samples that have been spilled to disk.
+   */
+  int64_t num_spilled_samples() const { return num_spilled_samples_; }
+
+  /** Returns the name of the file that samples are spilled to, or an empty
+   string if nothing has been spilled (yet). */
+  std::string spill_filename() const;
+
+  /** Returns the time of the `i`'th available sample.
+   @throws std::exception if `i` is out of range. */
+  T sample_time(int64_t i) const;
+
+  /** Returns the `i`'th available sample.
+   @throws std::exception if `i` is out of range. */
+  VectorX<T> sample(int64_t i) const;
+
+  /** Returns a copy of all available time stamps. */
+  VectorX<T> sample_times() const;
+
+  /** Returns a copy of all available samples, one per column. */
+  MatrixX<T> data() const;
+
+  /** Returns a copy of all available samples as a VectorLog. */
+  VectorLog<T> ToVectorLog() const;
+
+  /** Clears the logged data, including any spill file. In-memory chunks are
+   kept for reuse. */
+  void Clear();
+
+  /** Adds a `sample` to the end of the log with the associated `time` value.
+
+   @param time      The time value for this sample.
+   @param sample    A vector of data of the declared size for this log.
+   */
+  void AddData(const T& time, const VectorX<T>& sample);
+
+ private:
+  // A fixed-size block of storage for `chunk_size` samples.
+  struct Chunk {
+    VectorX<T> times;
+    MatrixX<T> data;
+  };
+
+  int64_t num_in_memory_samples() const {
+    return chunks_.empty()
+               ? 0
+               : (static_cast<int64_t>(chunks_.size()) - 1) *
+                         config_.chunk_size +
+                     back_count_;
+  }
+
+  // Calls `visit(times, data)` for each stored run of consecutive samples, in
+  // order, where `times` is a VectorX<T>-like segment and `data` the matching
+  // block of columns.
+  template <typename Visitor>
+  void VisitSamples(Visitor&& visit) const;
+
+  // Makes room at the end of the log for one more sample.
+  void PushChunk();
+
+  // Writes the full chunk at the front of chunks_ to the spill file, and
+  // recycles it.
+  void SpillFrontChunk();
+
+  // Recycles chunks that have fallen out of the ring buffer's window.
+  void DiscardExpiredChunks(const T& newest_time);
+
+  int input_size_{};
+  ChunkedVectorLogConfig config_;
+
+  // Every chunk is full, except for the one at the back, which holds
+  // `back_count_` samples.
+  std::deque<Chunk> chunks_;
+  reset_after_move<int64_t> back_count_{0};
+  reset_after_move<int64_t> num_discarded_samples_{0};
+  reset_after_move<int64_t> num_spilled_samples_{0};
+
+  // Chunks that have been discarded or spilled, ready to be reused.
+  std::vector<Chunk> spare_chunks_;
+
+  // Created when the first chunk is spilled.
+  std::unique_ptr<internal::VectorLogSpillFile> spill_file_;
+};
+
+}  // namespace systems
+}  // namespace drake
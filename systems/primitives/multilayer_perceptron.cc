@@ -1,8 +1,11 @@
 #include "drake/systems/primitives/multilayer_perceptron.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_bool.h"
+#include "drake/common/unused.h"
 #include "drake/systems/framework/basic_vector.h"
 
 namespace drake {
@@ -23,6 +26,56 @@ struct CalcLayersData {
   std::vector<VectorX<T>> Xn;
 };
 
+// Buffers for processing one block of columns of a batch in the scalar type
+// S. They are sized for a whole block; a partial block uses the leading
+// columns.
+template <typename S>
+struct PerceptronBlockBuffers {
+  // Sizes the buffers for the given network and block size. This only
+  // allocates when the sizes change.
+  void Resize(const std::vector<int>& layers, int block_size, bool gradients,
+              int num_parameters) {
+    const auto fit = [block_size](int rows, MatrixX<S>* m) {
+      if (m->rows() != rows || m->cols() != block_size) {
+        m->resize(rows, block_size);
+      }
+    };
+    const int num_weights = static_cast<int>(layers.size()) - 1;
+    fit(layers[0], &input);
+    Xn.resize(num_weights);
+    for (int i = 0; i < num_weights; ++i) {
+      fit(layers[i + 1], &Xn[i]);
+    }
+    if (gradients) {
+      dXn.resize(num_weights);
+      delta.resize(num_weights);
+      for (int i = 0; i < num_weights; ++i) {
+        fit(layers[i + 1], &dXn[i]);
+        fit(layers[i + 1], &delta[i]);
+      }
+      fit(layers[0], &dinput);
+      if (dloss_dparams.size() != num_parameters) {
+        dloss_dparams.resize(num_parameters);
+      }
+    }
+  }
+
+  MatrixX<S> input;               // The input (after any sin/cos features).
+  std::vector<MatrixX<S>> Xn;     // The output of each layer.
+  std::vector<MatrixX<S>> dXn;    // dXn/d(Wx+b) for each layer.
+  std::vector<MatrixX<S>> delta;  // dloss/d(Wx+b) for each layer.
+  MatrixX<S> dinput;              // dloss/d(input).
+  VectorX<S> dloss_dparams;       // This thread's share of the gradient.
+  S loss{};                       // This thread's share of the loss.
+};
+
+template <typename T>
+struct PerceptronBatchWorkspace {
+  // One entry per thread, for the arithmetic in T or in float, respectively.
+  std::vector<PerceptronBlockBuffers<T>> native;
+  std::vector<PerceptronBlockBuffers<float>> single;
+};
+
 }  // namespace internal
 
 namespace {
@@ -96,6 +149,34 @@ void Activation(
   }
 }
 
+// Applies the activation function in place to the columns of `X`. When `dX`
+// is non-null, it is set to the derivative of the activation with respect to
+// its argument (computed from the activation's value).
+template <typename S>
+void ActivateInPlace(PerceptronActivationType type, Eigen::Ref<MatrixX<S>> X,
+                     EigenPtr<MatrixX<S>> dX) {
+  if (type == kTanh) {
+    X = X.array().tanh().matrix();
+    if (dX) {
+      dX->array() = S(1.0) - X.array().square();
+    }
+  } else if (type == kReLU) {
+    X = X.array().max(S(0.0)).matrix();
+    if (dX) {
+      for (int j = 0; j < X.cols(); ++j) {
+        for (int i = 0; i < X.rows(); ++i) {
+          (*dX)(i, j) = (X(i, j) > 0) ? S(1.0) : S(0.0);
+        }
+      }
+    }
+  } else {
+    DRAKE_DEMAND(type == kIdentity);
+    if (dX) {
+      dX->setConstant(S(1.0));
+    }
+  }
+}
+
 }  // namespace
 
 template <typename T>
@@ -170,6 +251,17 @@ MultilayerPerceptron<T>::MultilayerPerceptron(
   BackPropData<T> backprop_data(num_weights_);
   backprop_cache_ = &this->DeclareCacheEntry(
       "backprop", ValueProducer(backprop_data, &ValueProducer::NoopCalc));
+
+  // Declare cache entries for the blocked batch methods.
+  float_parameters_cache_ = &this->DeclareCacheEntry(
+      "float_parameters", Eigen::VectorXf(num_parameters_),
+      &MultilayerPerceptron<T>::CalcFloatParameters,
+      {this->numeric_parameter_ticket(NumericParameterIndex(0))});
+  batch_workspace_cache_ = &this->DeclareCacheEntry(
+      "batch_workspace",
+      ValueProducer(internal::PerceptronBatchWorkspace<T>(),
+                    &ValueProducer::NoopCalc),
+      {this->nothing_ticket()});
 }
 
 template <typename T>
@@ -450,6 +542,278 @@ void MultilayerPerceptron<T>::BatchOutput(const Context<T>& context,
   }
 }
 
+template <typename T>
+void MultilayerPerceptron<T>::BlockedBatchOutput(
+    const Context<T>& context, const Eigen::Ref<const MatrixX<T>>& X,
+    const PerceptronBatchOptions& options, EigenPtr<MatrixX<T>> Y,
+    EigenPtr<MatrixX<T>> dYdX) const {
+  this->ValidateContext(context);
+  DRAKE_DEMAND(X.rows() == this->get_input_port().size());
+  DRAKE_DEMAND(Y->rows() == layers_[num_weights_]);
+  DRAKE_DEMAND(Y->cols() == X.cols());
+  DRAKE_THROW_UNLESS(options.block_size > 0);
+  if (dYdX != nullptr) {
+    if (layers_[num_weights_] != 1) {
+      throw std::logic_error(
+          "BlockedBatchOutput: dYdX != nullptr, but BlockedBatchOutput only "
+          "supports gradients when the output layer has size 1.");
+    }
+    DRAKE_DEMAND(dYdX->rows() == X.rows());
+    DRAKE_DEMAND(dYdX->cols() == X.cols());
+  }
+  if (!options.use_float32) {
+    CalcBlocked<T>(context, X, nullptr, options, Y, dYdX, nullptr, nullptr);
+  } else if constexpr (std::is_same_v<T, double>) {
+    CalcBlocked<float>(context, X, nullptr, options, Y, dYdX, nullptr,
+                       nullptr);
+  } else {
+    throw std::logic_error(
+        "BlockedBatchOutput: use_float32 is only supported for T = double.");
+  }
+}
+
+template <typename T>
+T MultilayerPerceptron<T>::BlockedBackpropagationMeanSquaredError(
+    const Context<T>& context, const Eigen::Ref<const MatrixX<T>>& X,
+    const Eigen::Ref<const MatrixX<T>>& Y_desired,
+    const PerceptronBatchOptions& options,
+    EigenPtr<VectorX<T>> dloss_dparams) const {
+  this->ValidateContext(context);
+  DRAKE_DEMAND(X.rows() == this->get_input_port().size());
+  DRAKE_DEMAND(Y_desired.rows() == layers_[num_weights_]);
+  DRAKE_DEMAND(Y_desired.cols() == X.cols());
+  DRAKE_DEMAND(dloss_dparams->rows() == num_parameters_);
+  DRAKE_THROW_UNLESS(options.block_size > 0);
+  T loss{};
+  if (!options.use_float32) {
+    CalcBlocked<T>(context, X, &Y_desired, options, nullptr, nullptr,
+                   dloss_dparams, &loss);
+  } else if constexpr (std::is_same_v<T, double>) {
+    CalcBlocked<float>(context, X, &Y_desired, options, nullptr, nullptr,
+                       dloss_dparams, &loss);
+  } else {
+    throw std::logic_error(
+        "BlockedBackpropagationMeanSquaredError: use_float32 is only "
+        "supported for T = double.");
+  }
+  return loss;
+}
+
+template <typename T>
+template <typename S>
+void MultilayerPerceptron<T>::CalcBlocked(
+    const Context<T>& context, const Eigen::Ref<const MatrixX<T>>& X,
+    const Eigen::Ref<const MatrixX<T>>* Y_desired,
+    const PerceptronBatchOptions& options, EigenPtr<MatrixX<T>> Y,
+    EigenPtr<MatrixX<T>> dYdX, EigenPtr<VectorX<T>> dloss_dparams,
+    T* loss) const {
+  const bool backprop = Y_desired != nullptr;
+  const bool gradients = backprop || dYdX != nullptr;
+  const int batch_size = X.cols();
+  const int block_size = options.block_size;
+  const int num_blocks = (batch_size + block_size - 1) / block_size;
+  // Symbolic expressions are not safe to manipulate concurrently.
+  int num_threads = 1;
+  if constexpr (scalar_predicate<T>::is_bool) {
+    num_threads = std::max(
+        1, std::min(options.parallelism.num_threads(), num_blocks));
+  }
+
+  // The parameters, in the scalar type S.
+  const VectorX<S>* params{};
+  if constexpr (std::is_same_v<S, T>) {
+    params = &GetParameters(context);
+  } else {
+    params = &float_parameters_cache_->template Eval<VectorX<S>>(context);
+  }
+  const auto W = [this, params](int i) {
+    return Eigen::Map<const MatrixX<S>>(params->data() + weight_indices_[i],
+                                        layers_[i + 1], layers_[i]);
+  };
+  const auto b = [this, params](int i) {
+    return Eigen::Map<const VectorX<S>>(params->data() + bias_indices_[i],
+                                        layers_[i + 1]);
+  };
+
+  // One set of buffers per thread.
+  internal::PerceptronBatchWorkspace<T>& workspace =
+      batch_workspace_cache_->get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<
+              internal::PerceptronBatchWorkspace<T>>();
+  std::vector<internal::PerceptronBlockBuffers<S>>* buffers{};
+  if constexpr (std::is_same_v<S, T>) {
+    buffers = &workspace.native;
+  } else {
+    buffers = &workspace.single;
+  }
+  if (static_cast<int>(buffers->size()) < num_threads) {
+    buffers->resize(num_threads);
+  }
+  for (int t = 0; t < num_threads; ++t) {
+    (*buffers)[t].Resize(layers_, block_size, gradients, num_parameters_);
+  }
+
+  // Thread t processes blocks t, t + num_threads, t + 2 * num_threads, ....
+  const auto process = [&](int t) {
+    internal::PerceptronBlockBuffers<S>& buf = (*buffers)[t];
+    if (backprop) {
+      buf.dloss_dparams.setZero();
+      buf.loss = S(0.0);
+    }
+    for (int block = t; block < num_blocks; block += num_threads) {
+      const int c0 = block * block_size;
+      const int n = std::min(block_size, batch_size - c0);
+
+      // Input features.
+      auto input = buf.input.leftCols(n);
+      if (has_input_features_) {
+        int feature_row = 0, input_row = 0;
+        for (bool use_sin_cos : use_sin_cos_for_input_) {
+          const auto x = X.block(input_row++, c0, 1, n);
+          if (use_sin_cos) {
+            input.row(feature_row++) = x.array().sin().template cast<S>();
+            input.row(feature_row++) = x.array().cos().template cast<S>();
+          } else {
+            input.row(feature_row++) = x.template cast<S>();
+          }
+        }
+      } else {
+        input = X.middleCols(c0, n).template cast<S>();
+      }
+
+      // Forward pass.
+      for (int i = 0; i < num_weights_; ++i) {
+        auto Xn = buf.Xn[i].leftCols(n);
+        if (i == 0) {
+          Xn.noalias() = W(0) * input;
+        } else {
+          Xn.noalias() = W(i) * buf.Xn[i - 1].leftCols(n);
+        }
+        Xn.colwise() += b(i);
+        auto dXn = gradients ? buf.dXn[i].leftCols(n) : Xn;
+        ActivateInPlace<S>(activation_types_[i], Xn,
+                           gradients ? &dXn : nullptr);
+      }
+      const auto y = buf.Xn[num_weights_ - 1].leftCols(n);
+      if (Y != nullptr) {
+        Y->middleCols(c0, n) = y.template cast<T>();
+      }
+      if (!gradients) continue;
+
+      // Backward pass, starting from dloss/dy (where loss ≡ y when computing
+      // dYdX).
+      if (backprop) {
+        auto dloss_dy = buf.delta[num_weights_ - 1].leftCols(n);
+        dloss_dy = y - Y_desired->middleCols(c0, n).template cast<S>();
+        buf.loss += dloss_dy.squaredNorm();
+        dloss_dy *= S(2.0 / batch_size);
+      } else {
+        buf.delta[num_weights_ - 1].leftCols(n).setConstant(S(1.0));
+      }
+      for (int i = num_weights_ - 1; i >= 0; --i) {
+        auto delta = buf.delta[i].leftCols(n);
+        delta.array() *= buf.dXn[i].leftCols(n).array();
+        if (backprop) {
+          Eigen::Map<MatrixX<S>> dloss_dW(
+              buf.dloss_dparams.data() + weight_indices_[i], layers_[i + 1],
+              layers_[i]);
+          if (i > 0) {
+            dloss_dW.noalias() +=
+                delta * buf.Xn[i - 1].leftCols(n).transpose();
+          } else {
+            dloss_dW.noalias() += delta * input.transpose();
+          }
+          buf.dloss_dparams.segment(bias_indices_[i], layers_[i + 1]) +=
+              delta.rowwise().sum();
+        }
+        if (i > 0) {
+          buf.delta[i - 1].leftCols(n).noalias() = W(i).transpose() * delta;
+        } else if (dYdX != nullptr) {
+          buf.dinput.leftCols(n).noalias() = W(0).transpose() * delta;
+        }
+      }
+      if (dYdX != nullptr) {
+        const auto dinput = buf.dinput.leftCols(n);
+        int feature_row = 0, input_row = 0;
+        for (bool use_sin_cos : use_sin_cos_for_input_) {
+          auto dydx = dYdX->block(input_row, c0, 1, n);
+          if (use_sin_cos) {
+            const auto x = X.block(input_row, c0, 1, n).array();
+            dydx = (dinput.row(feature_row).template cast<T>().array() *
+                        x.cos() -
+                    dinput.row(feature_row + 1).template cast<T>().array() *
+                        x.sin())
+                       .matrix();
+            feature_row += 2;
+          } else {
+            dydx = dinput.row(feature_row++).template cast<T>();
+          }
+          ++input_row;
+        }
+      }
+    }
+  };
+  if (num_threads == 1) {
+    process(0);
+  } else {
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+    for (int t = 0; t < num_threads; ++t) {
+      process(t);
+    }
+  }
+
+  // Sum the per-thread shares of the loss and its gradient.
+  if (backprop) {
+    dloss_dparams->setZero();
+    *loss = T(0.0);
+    for (int t = 0; t < num_threads; ++t) {
+      *dloss_dparams += (*buffers)[t].dloss_dparams.template cast<T>();
+      *loss += T((*buffers)[t].loss);
+    }
+    *loss /= batch_size;
+  }
+}
+
+template <typename T>
+void MultilayerPerceptron<T>::CalcFloatParameters(
+    const Context<T>& context, Eigen::VectorXf* params) const {
+  if constexpr (std::is_same_v<T, double>) {
+    *params = GetParameters(context).template cast<float>();
+  } else {
+    unused(context, params);
+    DRAKE_UNREACHABLE();
+  }
+}
+
+template <typename T>
+void MultilayerPerceptron<T>::DoEvalOutputBatch(
+    OutputPortIndex port_index,
+    const std::vector<const Context<T>*>& contexts) const {
+  bool shared_parameters = false;
+  if constexpr (scalar_predicate<T>::is_bool) {
+    shared_parameters = !contexts.empty();
+    for (size_t k = 1; shared_parameters && k < contexts.size(); ++k) {
+      shared_parameters = (GetParameters(*contexts[k]).array() ==
+                           GetParameters(*contexts[0]).array())
+                              .all();
+    }
+  }
+  if (!shared_parameters) {
+    LeafSystem<T>::DoEvalOutputBatch(port_index, contexts);
+    return;
+  }
+
+  MatrixX<T> X(this->get_input_port().size(), contexts.size());
+  for (int k = 0; k < X.cols(); ++k) {
+    X.col(k) = this->get_input_port().Eval(*contexts[k]);
+  }
+  MatrixX<T> Y(layers_[num_weights_], X.cols());
+  BatchOutput(*contexts[0], X, &Y);
+  this->SetVectorOutputBatch(port_index, contexts, Y);
+}
+
 template <typename T>
 void MultilayerPerceptron<T>::CalcOutput(const Context<T>& context,
                                          BasicVector<T>* y) const {
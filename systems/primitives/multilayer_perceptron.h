@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -15,14 +16,38 @@ enum PerceptronActivationType {
   kTanh,
 };
 
+/** Options for MultilayerPerceptron::BlockedBatchOutput() and
+ MultilayerPerceptron::BlockedBackpropagationMeanSquaredError(). */
+struct PerceptronBatchOptions {
+  /** The batch is processed in blocks of at most this many columns. Every
+   layer is applied to one block before the next block is started, so that the
+   block's intermediate activations stay in cache. Must be positive. */
+  int block_size{64};
+
+  /** The blocks are distributed over at most this many threads (when Drake is
+   built with OpenMP and T is double or AutoDiffXd). */
+  Parallelism parallelism{Parallelism::None()};
+
+  /** When true, the parameters are converted to single precision (float32)
+   and all of the arithmetic is performed in single precision; the results are
+   converted back to double. The single-precision copy of the parameters is
+   cached in the Context and is only refreshed when the parameters change.
+   This roughly halves the memory traffic, at the cost of results that are
+   only accurate to about 1e-6 (relative). Only supported for T = double. */
+  bool use_float32{false};
+};
+
 // Forward declarations.
 namespace internal {
 
-// Note: This struct is defined outside the class to avoid the ReportZeroHash
-// warning in AbstractValue.
+// Note: These structs are defined outside the class to avoid the
+// ReportZeroHash warning in AbstractValue.
 template <typename T>
 struct CalcLayersData;
 
+template <typename T>
+struct PerceptronBatchWorkspace;
+
 }  // namespace internal
 
 /** The MultilayerPerceptron (MLP) is one of the most common forms of neural
@@ -269,14 +294,67 @@ class MultilayerPerceptron final : public LeafSystem<T> {
                    EigenPtr<MatrixX<T>> Y,
                    EigenPtr<MatrixX<T>> dYdX = nullptr) const;
 
+  /** Computes the same results as BatchOutput(), but processes the batch in
+   cache-sized blocks of columns, optionally spread over multiple threads
+   and/or in single precision; see PerceptronBatchOptions.
+
+   The per-thread layer buffers are stored in the System Cache and are sized
+   for one block, so repeated calls with the same `options` do not allocate
+   memory, even when the batch size changes.
+
+   @throws std::exception if dYdX != nullptr and the network has more than one
+   output.
+   @throws std::exception if `options.block_size` is not positive, or if
+   `options.use_float32` is true and T is not double. */
+  void BlockedBatchOutput(const Context<T>& context,
+                          const Eigen::Ref<const MatrixX<T>>& X,
+                          const PerceptronBatchOptions& options,
+                          EigenPtr<MatrixX<T>> Y,
+                          EigenPtr<MatrixX<T>> dYdX = nullptr) const;
+
+  /** Computes the same results as BackpropagationMeanSquaredError(), but
+   processes the batch as described for BlockedBatchOutput(). When the blocks
+   are spread over multiple threads, each thread accumulates the gradient of
+   its own blocks and the per-thread gradients are summed at the end.
+
+   @throws std::exception if `options.block_size` is not positive, or if
+   `options.use_float32` is true and T is not double. */
+  T BlockedBackpropagationMeanSquaredError(
+      const Context<T>& context, const Eigen::Ref<const MatrixX<T>>& X,
+      const Eigen::Ref<const MatrixX<T>>& Y_desired,
+      const PerceptronBatchOptions& options,
+      EigenPtr<VectorX<T>> dloss_dparams) const;
+
  private:
   // Calculates y = f(x) for the entire network.
   void CalcOutput(const Context<T>& context, BasicVector<T>* y) const;
 
+  // When every context holds the same parameters, evaluates the whole batch
+  // with BatchOutput(); otherwise evaluates one context at a time.
+  void DoEvalOutputBatch(
+      OutputPortIndex port_index,
+      const std::vector<const Context<T>*>& contexts) const final;
+
   // Calculates the cache entries for the hidden units in the network.
   void CalcLayers(const Context<T>& context,
                   internal::CalcLayersData<T>* data) const;
 
+  // Calculates the single-precision copy of the parameters.
+  void CalcFloatParameters(const Context<T>& context,
+                           Eigen::VectorXf* params) const;
+
+  // The implementation of BlockedBatchOutput() (when `Y_desired` is null) and
+  // BlockedBackpropagationMeanSquaredError() (otherwise), with the arithmetic
+  // performed in the scalar type S (either T or float). Unused outputs are
+  // null.
+  template <typename S>
+  void CalcBlocked(const Context<T>& context,
+                   const Eigen::Ref<const MatrixX<T>>& X,
+                   const Eigen::Ref<const MatrixX<T>>* Y_desired,
+                   const PerceptronBatchOptions& options,
+                   EigenPtr<MatrixX<T>> Y, EigenPtr<MatrixX<T>> dYdX,
+                   EigenPtr<VectorX<T>> dloss_dparams, T* loss) const;
+
   // Calculates the (potentially batch) feature vector values.  When `X` is
   // size `num_inputs`-by-`N`, then `Features` is set to size
   // `layers()[0]`-by-`N`.
@@ -297,6 +375,8 @@ class MultilayerPerceptron final : public LeafSystem<T> {
 
   CacheEntry* calc_layers_cache_{};
   CacheEntry* backprop_cache_{};
+  CacheEntry* float_parameters_cache_{};
+  CacheEntry* batch_workspace_cache_{};
 
   template <typename>
   friend class MultilayerPerceptron;
@@ -0,0 +1,190 @@
+#include "drake/systems/primitives/chunked_vector_log.h"
+
+#include <filesystem>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns the sample logged at step `k` by Fill().
+template <typename T>
+VectorX<T> MakeSample(int k) {
+  return Vector3<T>(k, 10.0 * k, -1.0 * k);
+}
+
+// Returns the time of the sample logged at step `k` by Fill(). The step size
+// is exact in binary, so that times can be compared exactly.
+double MakeTime(int k) {
+  return 0.125 * k;
+}
+
+// Adds `num_samples` samples to `log`.
+template <typename T>
+void Fill(ChunkedVectorLog<T>* log, int num_samples) {
+  for (int k = 0; k < num_samples; ++k) {
+    log->AddData(MakeTime(k), MakeSample<T>(k));
+  }
+}
+
+template <typename T>
+class ChunkedVectorLogTest : public testing::Test {};
+
+using ScalarTypes = ::testing::Types<double, AutoDiffXd, symbolic::Expression>;
+TYPED_TEST_SUITE(ChunkedVectorLogTest, ScalarTypes);
+
+TYPED_TEST(ChunkedVectorLogTest, Unbounded) {
+  using T = TypeParam;
+  ChunkedVectorLog<T> dut(3, {.chunk_size = 4});
+  EXPECT_EQ(dut.get_input_size(), 3);
+  EXPECT_EQ(dut.num_samples(), 0);
+  EXPECT_EQ(dut.sample_times().size(), 0);
+  EXPECT_EQ(dut.data().cols(), 0);
+
+  Fill(&dut, 10);
+  EXPECT_EQ(dut.num_samples(), 10);
+  EXPECT_EQ(dut.num_discarded_samples(), 0);
+  EXPECT_EQ(dut.num_spilled_samples(), 0);
+  EXPECT_EQ(dut.spill_filename(), "");
+  for (int k = 0; k < 10; ++k) {
+    EXPECT_EQ(dut.sample_time(k), MakeTime(k));
+    EXPECT_EQ(dut.sample(k), MakeSample<T>(k));
+    EXPECT_EQ(dut.sample_times()[k], MakeTime(k));
+    EXPECT_EQ(dut.data().col(k), MakeSample<T>(k));
+  }
+  EXPECT_THROW(dut.sample(10), std::exception);
+  EXPECT_THROW(dut.sample_time(-1), std::exception);
+
+  const VectorLog<T> flat = dut.ToVectorLog();
+  EXPECT_EQ(flat.num_samples(), 10);
+  EXPECT_EQ(flat.sample_times(), dut.sample_times());
+  EXPECT_EQ(flat.data(), dut.data());
+
+  // Copies are independent.
+  ChunkedVectorLog<T> copy(dut);
+  copy.AddData(MakeTime(10), MakeSample<T>(10));
+  EXPECT_EQ(copy.num_samples(), 11);
+  EXPECT_EQ(dut.num_samples(), 10);
+
+  // Moved-from logs are empty.
+  ChunkedVectorLog<T> moved(std::move(copy));
+  EXPECT_EQ(moved.num_samples(), 11);
+  EXPECT_EQ(copy.num_samples(), 0);
+  copy = std::move(moved);
+  EXPECT_EQ(copy.num_samples(), 11);
+  EXPECT_EQ(moved.num_samples(), 0);
+
+  dut.Clear();
+  EXPECT_EQ(dut.num_samples(), 0);
+  Fill(&dut, 2);
+  EXPECT_EQ(dut.sample(1), MakeSample<T>(1));
+}
+
+TYPED_TEST(ChunkedVectorLogTest, Ring) {
+  using T = TypeParam;
+  // The window spans four steps; each chunk spans three.
+  ChunkedVectorLog<T> dut(3, {.chunk_size = 4, .ring_duration = 0.5});
+  Fill(&dut, 8);
+  EXPECT_EQ(dut.num_discarded_samples(), 0);
+  EXPECT_EQ(dut.num_samples(), 8);
+
+  // The first chunk ends with step 3, so expires once step 8 is logged.
+  dut.AddData(MakeTime(8), MakeSample<T>(8));
+  EXPECT_EQ(dut.num_discarded_samples(), 4);
+  EXPECT_EQ(dut.num_samples(), 5);
+  EXPECT_EQ(dut.sample_time(0), MakeTime(4));
+  EXPECT_EQ(dut.sample(0), MakeSample<T>(4));
+  EXPECT_EQ(dut.sample_times()[4], MakeTime(8));
+
+  // However long the log runs, it retains the last half second (five
+  // samples) plus at most part of one more chunk.
+  for (int k = 9; k < 100; ++k) {
+    dut.AddData(MakeTime(k), MakeSample<T>(k));
+    EXPECT_GE(dut.num_samples(), 5);
+    EXPECT_LE(dut.num_samples(), 8);
+    EXPECT_EQ(dut.num_discarded_samples() + dut.num_samples(), k + 1);
+  }
+  EXPECT_EQ(dut.sample(dut.num_samples() - 1), MakeSample<T>(99));
+}
+
+GTEST_TEST(ChunkedVectorLogSpillTest, Spill) {
+  const std::string directory = temp_directory();
+  ChunkedVectorLog<double> dut(
+      3, {.chunk_size = 4, .spill_directory = directory});
+  Fill(&dut, 4);
+  EXPECT_EQ(dut.num_spilled_samples(), 0);
+  EXPECT_EQ(dut.spill_filename(), "");
+
+  // A copy is fine until something has been spilled.
+  ChunkedVectorLog<double> copy(dut);
+  EXPECT_EQ(copy.num_samples(), 4);
+
+  dut.Clear();
+  Fill(&dut, 11);
+  EXPECT_EQ(dut.num_samples(), 11);
+  EXPECT_EQ(dut.num_spilled_samples(), 8);
+  const std::string filename = dut.spill_filename();
+  EXPECT_TRUE(std::filesystem::exists(filename));
+  // The header, plus two chunks of times and data.
+  EXPECT_EQ(std::filesystem::file_size(filename),
+            4 * sizeof(int64_t) + 2 * 4 * 4 * sizeof(double));
+
+  for (int k = 0; k < 11; ++k) {
+    EXPECT_EQ(dut.sample_time(k), MakeTime(k));
+    EXPECT_EQ(dut.sample(k), MakeSample<double>(k));
+  }
+  const VectorLog<double> flat = dut.ToVectorLog();
+  EXPECT_EQ(flat.num_samples(), 11);
+  EXPECT_EQ(flat.sample_times(), dut.sample_times());
+  EXPECT_EQ(flat.data(), dut.data());
+  EXPECT_EQ(flat.data().col(5), MakeSample<double>(5));
+
+  // Reading interleaved with more spilling remaps the file.
+  Fill(&dut, 8);
+  EXPECT_EQ(dut.num_spilled_samples(), 16);
+  EXPECT_EQ(dut.sample(15), MakeSample<double>(4));
+  EXPECT_EQ(dut.sample_time(2), MakeTime(2));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(ChunkedVectorLog<double>{dut},
+                              ".*cannot copy a log that has spilled.*");
+
+  ChunkedVectorLog<double> moved(std::move(dut));
+  EXPECT_EQ(moved.spill_filename(), filename);
+  EXPECT_EQ(moved.num_samples(), 19);
+
+  moved.Clear();
+  EXPECT_FALSE(std::filesystem::exists(filename));
+  EXPECT_EQ(moved.num_samples(), 0);
+
+  std::filesystem::remove_all(directory);
+}
+
+GTEST_TEST(ChunkedVectorLogSpillTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ChunkedVectorLog<double>(3, {.chunk_size = 0}), ".*chunk_size.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ChunkedVectorLog<double>(3, {.ring_duration = -1.0}),
+      ".*ring_duration.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ChunkedVectorLog<double>(
+          3, {.ring_duration = 1.0, .spill_directory = temp_directory()}),
+      ".*cannot be combined.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ChunkedVectorLog<AutoDiffXd>(3, {.spill_directory = temp_directory()}),
+      ".*only supported for T = double.*");
+  ChunkedVectorLog<double> bad(3, {.chunk_size = 1,
+                                   .spill_directory = "/no/such/directory"});
+  bad.AddData(MakeTime(0), MakeSample<double>(0));
+  DRAKE_EXPECT_THROWS_MESSAGE(bad.AddData(MakeTime(1), MakeSample<double>(1)),
+                              ".*could not create a spill file.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
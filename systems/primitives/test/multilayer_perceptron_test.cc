@@ -405,6 +405,111 @@ GTEST_TEST(MultilayerPerceptronTest, SinCosFeatures) {
   }
 }
 
+// The blocked batch methods match the unblocked ones for any block size and
+// number of threads, and approximately so in single precision.
+GTEST_TEST(MultilayerPerceptronTest, Blocked) {
+  for (bool use_sin_cos : {false, true}) {
+    for (const auto& type : {kIdentity, kReLU, kTanh}) {
+      MultilayerPerceptron<double> mlp({use_sin_cos, false, false}, {8, 8, 1},
+                                       {type, type, kIdentity});
+      auto context = mlp.CreateDefaultContext();
+      RandomGenerator generator(243);
+      mlp.SetRandomContext(context.get(), &generator);
+
+      const int batch_size = 23;
+      const MatrixXd X = MatrixXd::Random(3, batch_size);
+      const Eigen::RowVectorXd Y_desired =
+          Eigen::RowVectorXd::Random(batch_size);
+      Eigen::RowVectorXd Y_expected(batch_size), Y(batch_size);
+      MatrixXd dYdX_expected(3, batch_size), dYdX(3, batch_size);
+      mlp.BatchOutput(*context, X, &Y_expected, &dYdX_expected);
+      VectorXd dloss_dparams_expected(mlp.num_parameters());
+      VectorXd dloss_dparams(mlp.num_parameters());
+      const double loss_expected = mlp.BackpropagationMeanSquaredError(
+          *context, X, Y_desired, &dloss_dparams_expected);
+
+      for (const int block_size : {1, 5, 64}) {
+        for (const int num_threads : {1, 3}) {
+          PerceptronBatchOptions options{
+              .block_size = block_size,
+              .parallelism = Parallelism(num_threads)};
+          mlp.BlockedBatchOutput(*context, X, options, &Y, &dYdX);
+          EXPECT_TRUE(CompareMatrices(Y, Y_expected, 1e-14));
+          EXPECT_TRUE(CompareMatrices(dYdX, dYdX_expected, 1e-14));
+          const double loss = mlp.BlockedBackpropagationMeanSquaredError(
+              *context, X, Y_desired, options, &dloss_dparams);
+          EXPECT_NEAR(loss, loss_expected, 1e-14);
+          EXPECT_TRUE(
+              CompareMatrices(dloss_dparams, dloss_dparams_expected, 1e-14));
+
+          options.use_float32 = true;
+          mlp.BlockedBatchOutput(*context, X, options, &Y, &dYdX);
+          EXPECT_TRUE(CompareMatrices(Y, Y_expected, 1e-5));
+          EXPECT_TRUE(CompareMatrices(dYdX, dYdX_expected, 1e-5));
+          EXPECT_NEAR(mlp.BlockedBackpropagationMeanSquaredError(
+                          *context, X, Y_desired, options, &dloss_dparams),
+                      loss_expected, 1e-5);
+          EXPECT_TRUE(
+              CompareMatrices(dloss_dparams, dloss_dparams_expected, 1e-5));
+        }
+      }
+
+      // The single-precision parameters follow changes to the parameters.
+      const PerceptronBatchOptions float_options{.use_float32 = true};
+      mlp.SetRandomContext(context.get(), &generator);
+      mlp.BatchOutput(*context, X, &Y_expected);
+      mlp.BlockedBatchOutput(*context, X, float_options, &Y);
+      EXPECT_TRUE(CompareMatrices(Y, Y_expected, 1e-5));
+    }
+  }
+}
+
+GTEST_TEST(MultilayerPerceptronTest, BlockedDoesNotAllocate) {
+  MultilayerPerceptron<double> mlp({4, 16, 16, 2});
+  auto context = mlp.CreateDefaultContext();
+  RandomGenerator generator(243);
+  mlp.SetRandomContext(context.get(), &generator);
+  const PerceptronBatchOptions options{.block_size = 8};
+  const MatrixXd X = MatrixXd::Random(4, 20);
+  const MatrixXd Y_desired = MatrixXd::Random(2, 20);
+  MatrixXd Y(2, 20);
+  VectorXd dloss_dparams(mlp.num_parameters());
+  mlp.BlockedBatchOutput(*context, X, options, &Y);
+  mlp.BlockedBackpropagationMeanSquaredError(*context, X, Y_desired, options,
+                                             &dloss_dparams);
+  {
+    // Later calls reuse the buffers, even with a different batch size.
+    drake::test::LimitMalloc guard({.max_num_allocations = 0});
+    mlp.BlockedBatchOutput(*context, X, options, &Y);
+    mlp.BlockedBackpropagationMeanSquaredError(*context, X, Y_desired, options,
+                                               &dloss_dparams);
+    auto Y_left = Y.leftCols(13);
+    mlp.BlockedBatchOutput(*context, X.leftCols(13), options, &Y_left);
+  }
+}
+
+GTEST_TEST(MultilayerPerceptronTest, BlockedThrows) {
+  MultilayerPerceptron<double> mlp({2, 2});
+  auto context = mlp.CreateDefaultContext();
+  const Eigen::Matrix2d X = Eigen::Matrix2d::Zero();
+  Eigen::Matrix2d Y, dYdX;
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      mlp.BlockedBatchOutput(*context, X, {}, &Y, &dYdX),
+      ".*only supports gradients when the output layer has size 1.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      mlp.BlockedBatchOutput(*context, X, {.block_size = 0}, &Y),
+      ".*block_size > 0.*");
+
+  MultilayerPerceptron<AutoDiffXd> mlp_ad({2, 2});
+  auto context_ad = mlp_ad.CreateDefaultContext();
+  MatrixX<AutoDiffXd> Y_ad(2, 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      mlp_ad.BlockedBatchOutput(*context_ad, X.cast<AutoDiffXd>(),
+                                {.use_float32 = true}, &Y_ad),
+      ".*use_float32 is only supported for T = double.");
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -212,6 +213,46 @@ GTEST_TEST(TestVectorLogSink, DiagramToAutoDiff) {
   EXPECT_TRUE(is_autodiffxd_convertible(*diagram));
 }
 
+// A sink given a ChunkedVectorLogConfig logs to a ChunkedVectorLog instead.
+GTEST_TEST(TestVectorLogSink, ChunkedLog) {
+  DiagramBuilder<double> builder;
+  auto system = builder.AddSystem<ConstantVectorSource<double>>(2.0);
+  auto logger = LogVectorOutput(
+      system->get_output_port(), &builder, {TriggerType::kPeriodic}, 0.125,
+      ChunkedVectorLogConfig{.chunk_size = 2, .ring_duration = 0.5});
+  ASSERT_TRUE(logger->chunked_config().has_value());
+  EXPECT_EQ(logger->chunked_config()->chunk_size, 2);
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(1);
+
+  const auto& log = logger->FindChunkedLog(simulator.get_context());
+  EXPECT_EQ(&log, &logger->FindMutableChunkedLog(
+                      &simulator.get_mutable_context()));
+  EXPECT_EQ(log.num_discarded_samples() + log.num_samples(), 9);
+  EXPECT_EQ(log.sample_time(log.num_samples() - 1), 1.0);
+  EXPECT_LE(log.sample_time(0), 0.5);
+  EXPECT_EQ(log.sample(0), Vector1d(2.0));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(logger->FindLog(simulator.get_context()),
+                              ".*stores a ChunkedVectorLog.*");
+  VectorLogSink<double> plain(1);
+  auto context = plain.CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(plain.GetChunkedLog(*context),
+                              ".*stores a VectorLog.*");
+
+  // Scalar conversion preserves the configuration, except for spilling.
+  VectorLogSink<double> spilling(
+      2, {TriggerType::kForced}, 0.0,
+      {.chunk_size = 3, .spill_directory = temp_directory()});
+  EXPECT_TRUE(is_autodiffxd_convertible(spilling, [&](const auto& converted) {
+    ASSERT_TRUE(converted.chunked_config().has_value());
+    EXPECT_EQ(converted.chunked_config()->chunk_size, 3);
+    EXPECT_FALSE(converted.chunked_config()->spill_directory.has_value());
+  }));
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -1,5 +1,9 @@
 #include "drake/systems/primitives/vector_log_sink.h"
 
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 #include "drake/common/default_scalars.h"
 
 namespace drake {
@@ -24,18 +28,48 @@ VectorLogSink<T>::VectorLogSink(
     int input_size,
     const TriggerTypeSet& publish_triggers,
     double publish_period)
+    : VectorLogSink<T>(input_size, publish_triggers, publish_period,
+                       std::nullopt) {}
+
+template <typename T>
+VectorLogSink<T>::VectorLogSink(
+    int input_size,
+    const TriggerTypeSet& publish_triggers,
+    double publish_period,
+    const ChunkedVectorLogConfig& chunked_config)
+    : VectorLogSink<T>(input_size, publish_triggers, publish_period,
+                       std::optional<ChunkedVectorLogConfig>(chunked_config)) {}
+
+template <typename T>
+VectorLogSink<T>::VectorLogSink(
+    int input_size,
+    const TriggerTypeSet& publish_triggers,
+    double publish_period,
+    std::optional<ChunkedVectorLogConfig> chunked_config)
     : LeafSystem<T>(SystemTypeTag<VectorLogSink>{}),
     publish_triggers_(publish_triggers),
-    publish_period_(publish_period) {
+    publish_period_(publish_period),
+    chunked_config_(std::move(chunked_config)) {
   DRAKE_DEMAND(publish_period >= 0.0);
   DRAKE_DEMAND(!publish_triggers.empty());
 
+  // Spilling to disk is only supported for T = double; see the constructor
+  // documentation.
+  if constexpr (!std::is_same_v<T, double>) {
+    if (chunked_config_.has_value()) {
+      chunked_config_->spill_directory = std::nullopt;
+    }
+  }
+
   // This cache entry just maintains log storage. It is only ever updated
   // by WriteToLog(). This declaration of the cache entry invokes no
   // invalidation support from the cache system.
   log_cache_index_ =
       this->DeclareCacheEntry(
           "log",
+          chunked_config_.has_value() ?
+          ValueProducer(ChunkedVectorLog<T>(input_size, *chunked_config_),
+                        &ValueProducer::NoopCalc) :
           ValueProducer(VectorLog<T>(input_size), &ValueProducer::NoopCalc),
           {this->nothing_ticket()}).cache_index();
 
@@ -80,48 +114,91 @@ template <typename U>
 VectorLogSink<T>::VectorLogSink(const VectorLogSink<U>& other)
     : VectorLogSink<T>(other.get_input_port().size(),
                        other.publish_triggers_,
-                       other.publish_period_) {}
+                       other.publish_period_,
+                       other.chunked_config_) {}
 
 template <typename T>
 const VectorLog<T>&
 VectorLogSink<T>::GetLog(const Context<T>& context) const {
   // Relying on the mutable implementation here avoids pointless out-of-date
   // checks.
-  return GetLogFromCache(context);
+  return GetLogFromCache<VectorLog<T>>(context);
 }
 
 template <typename T>
 VectorLog<T>&
 VectorLogSink<T>::GetMutableLog(Context<T>* context) const {
-  return GetLogFromCache(*context);
+  return GetLogFromCache<VectorLog<T>>(*context);
 }
 
 template <typename T>
 const VectorLog<T>&
 VectorLogSink<T>::FindLog(const Context<T>& root_context) const {
-  return GetLogFromCache(this->GetMyContextFromRoot(root_context));
+  return GetLogFromCache<VectorLog<T>>(
+      this->GetMyContextFromRoot(root_context));
 }
 
 template <typename T>
 VectorLog<T>&
 VectorLogSink<T>::FindMutableLog(Context<T>* root_context) const {
-  return GetLogFromCache(this->GetMyMutableContextFromRoot(root_context));
+  return GetLogFromCache<VectorLog<T>>(
+      this->GetMyMutableContextFromRoot(root_context));
 }
 
 template <typename T>
-VectorLog<T>&
-VectorLogSink<T>::GetLogFromCache(const Context<T>& context) const {
+const ChunkedVectorLog<T>&
+VectorLogSink<T>::GetChunkedLog(const Context<T>& context) const {
+  return GetLogFromCache<ChunkedVectorLog<T>>(context);
+}
+
+template <typename T>
+ChunkedVectorLog<T>&
+VectorLogSink<T>::GetMutableChunkedLog(Context<T>* context) const {
+  return GetLogFromCache<ChunkedVectorLog<T>>(*context);
+}
+
+template <typename T>
+const ChunkedVectorLog<T>&
+VectorLogSink<T>::FindChunkedLog(const Context<T>& root_context) const {
+  return GetLogFromCache<ChunkedVectorLog<T>>(
+      this->GetMyContextFromRoot(root_context));
+}
+
+template <typename T>
+ChunkedVectorLog<T>&
+VectorLogSink<T>::FindMutableChunkedLog(Context<T>* root_context) const {
+  return GetLogFromCache<ChunkedVectorLog<T>>(
+      this->GetMyMutableContextFromRoot(root_context));
+}
+
+template <typename T>
+template <typename Log>
+Log& VectorLogSink<T>::GetLogFromCache(const Context<T>& context) const {
   this->ValidateContext(context);
+  constexpr bool is_chunked = std::is_same_v<Log, ChunkedVectorLog<T>>;
+  if (chunked_config_.has_value() != is_chunked) {
+    throw std::logic_error(fmt::format(
+        "VectorLogSink '{}' stores a {}; use {} to access it",
+        this->get_name(),
+        is_chunked ? "VectorLog" : "ChunkedVectorLog",
+        is_chunked ? "GetLog() or FindLog()"
+                   : "GetChunkedLog() or FindChunkedLog()"));
+  }
   CacheEntryValue& value =
       this->get_cache_entry(log_cache_index_)
       .get_mutable_cache_entry_value(context);
-  return value.GetMutableValueOrThrow<VectorLog<T>>();
+  return value.GetMutableValueOrThrow<Log>();
 }
 
 template <typename T>
 EventStatus VectorLogSink<T>::WriteToLog(const Context<T>& context) const {
-  GetLogFromCache(context).AddData(
-      context.get_time(), this->get_input_port().Eval(context));
+  if (chunked_config_.has_value()) {
+    GetLogFromCache<ChunkedVectorLog<T>>(context).AddData(
+        context.get_time(), this->get_input_port().Eval(context));
+  } else {
+    GetLogFromCache<VectorLog<T>>(context).AddData(
+        context.get_time(), this->get_input_port().Eval(context));
+  }
   return EventStatus::Succeeded();
 }
 
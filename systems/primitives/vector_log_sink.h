@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include "drake/systems/framework/event.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/framework/output_port.h"
+#include "drake/systems/primitives/chunked_vector_log.h"
 #include "drake/systems/primitives/vector_log.h"
 
 namespace drake {
@@ -26,6 +28,13 @@ namespace systems {
 /// where each column corresponds to a data point. The VectorLogSink saves a
 /// data point and the context time whenever it samples its input.
 ///
+/// For long recordings, the sink can instead be given a
+/// ChunkedVectorLogConfig, in which case it stores a ChunkedVectorLog, which
+/// appends to fixed-size chunks without ever copying earlier samples, and can
+/// optionally retain only a recent time window or spill to disk. Access that
+/// log with GetChunkedLog() and friends rather than GetLog(). Note that a
+/// context whose log has spilled to disk cannot be cloned.
+///
 /// @warning The logged data MUST NOT be used to modify the behavior of a
 /// simulation. In technical terms, the log is not stored as System State, so
 /// should not be considered part of that state. This distinction allows the
@@ -96,16 +105,34 @@ class VectorLogSink final : public LeafSystem<T> {
                 const TriggerTypeSet& publish_triggers,
                 double publish_period = 0.0);
 
+  /// Constructs a vector log sink that stores a ChunkedVectorLog, configured
+  /// by `chunked_config`, rather than a VectorLog. The other parameters are as
+  /// described above. Scalar conversion of a sink that spills to disk yields a
+  /// sink that keeps its chunks in memory, since spilling requires T = double.
+  /// @throws std::exception if `chunked_config` is invalid.
+  VectorLogSink(int input_size,
+                const TriggerTypeSet& publish_triggers,
+                double publish_period,
+                const ChunkedVectorLogConfig& chunked_config);
+
   /// Scalar-converting copy constructor. See @ref system_scalar_conversion.
   template <typename U>
   explicit VectorLogSink(const VectorLogSink<U>&);
 
+  /// Returns the configuration of the ChunkedVectorLog used by this sink, or
+  /// nullopt if it uses a VectorLog.
+  const std::optional<ChunkedVectorLogConfig>& chunked_config() const {
+    return chunked_config_;
+  }
+
   /// Access the log within this component's context.
   /// @throws std::exception if context was not created for this system.
+  /// @throws std::exception if this sink stores a ChunkedVectorLog.
   const VectorLog<T>& GetLog(const Context<T>& context) const;
 
   /// Access the log as a mutable object within this component's context.
   /// @throws std::exception if context was not created for this system.
+  /// @throws std::exception if this sink stores a ChunkedVectorLog.
   VectorLog<T>& GetMutableLog(Context<T>* context) const;
 
   /// Access the log within a containing root context.
@@ -118,16 +145,39 @@ class VectorLogSink final : public LeafSystem<T> {
   /// not created for the containing diagram.
   VectorLog<T>& FindMutableLog(Context<T>* root_context) const;
 
+  /// @name Chunked log access
+  /// These mirror the accessors above, for a sink constructed with a
+  /// ChunkedVectorLogConfig. Each throws std::exception if this sink stores a
+  /// VectorLog instead, or under the same conditions as its counterpart.
+  //@{
+  const ChunkedVectorLog<T>& GetChunkedLog(const Context<T>& context) const;
+  ChunkedVectorLog<T>& GetMutableChunkedLog(Context<T>* context) const;
+  const ChunkedVectorLog<T>& FindChunkedLog(
+      const Context<T>& root_context) const;
+  ChunkedVectorLog<T>& FindMutableChunkedLog(Context<T>* root_context) const;
+  //@}
+
  private:
   template <typename> friend class VectorLogSink;
 
-  // Access the mutable vector log stored in the given `context`'s cache entry.
-  // @throws std::exception if context was not created for this system.
-  VectorLog<T>& GetLogFromCache(const Context<T>& context) const;
+  // Delegated-to constructor for all of the public ones.
+  VectorLogSink(int input_size,
+                const TriggerTypeSet& publish_triggers,
+                double publish_period,
+                std::optional<ChunkedVectorLogConfig> chunked_config);
+
+  // Access the mutable vector log stored in the given `context`'s cache entry,
+  // where Log is VectorLog<T> or ChunkedVectorLog<T>.
+  // @throws std::exception if context was not created for this system, or
+  // if this sink stores the other kind of log.
+  template <typename Log>
+  Log& GetLogFromCache(const Context<T>& context) const;
 
-  // Remember trigger details for use in scalar conversion.
+  // Remember trigger details (and storage options) for use in scalar
+  // conversion.
   TriggerTypeSet publish_triggers_;
   double publish_period_{};
+  std::optional<ChunkedVectorLogConfig> chunked_config_;
 
   // Logging is done in this event handler.
   EventStatus WriteToLog(const Context<T>& context) const;
@@ -186,5 +236,31 @@ VectorLogSink<T>* LogVectorOutput(
   return sink;
 }
 
+/// LogVectorOutput provides a convenience function for adding a VectorLogSink
+/// that stores a ChunkedVectorLog configured by `chunked_config`, initialized
+/// to the correct size, and connected to an output in a DiagramBuilder. The
+/// other parameters are as described above.
+///
+/// @param src the output port to attach logging to.
+/// @param builder the diagram builder.
+/// @param publish_triggers Set of triggers that determine when messages will
+/// be published. Supported TriggerTypes are {kForced, kPeriodic, kPerStep}.
+/// @param publish_period Period that messages will be published.
+/// @param chunked_config The storage options for the log.
+/// @pre publish_period > 0 if and only if publish_triggers contains kPeriodic.
+template <typename T>
+VectorLogSink<T>* LogVectorOutput(
+    const OutputPort<T>& src,
+    DiagramBuilder<T>* builder,
+    const TriggerTypeSet& publish_triggers,
+    double publish_period,
+    const ChunkedVectorLogConfig& chunked_config) {
+  VectorLogSink<T>* sink =
+      builder->template AddSystem<VectorLogSink<T>>(
+          src.size(), publish_triggers, publish_period, chunked_config);
+  builder->Connect(src, sink->get_input_port());
+  return sink;
+}
+
 }  // namespace systems
 }  // namespace drake